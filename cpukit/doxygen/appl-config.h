@@ -2042,6 +2042,10 @@
  *
  * * #CONFIGURE_IMFS_DISABLE_UTIME
  *
+ * * #CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+ *
+ * * #CONFIGURE_IMFS_ENABLE_HASHED_DIRECTORIES
+ *
  * * #CONFIGURE_IMFS_ENABLE_MKFIFO
  *
  * @{
@@ -2165,6 +2169,32 @@
  */
 #define CONFIGURE_FILESYSTEM_JFFS2
 
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * The value of this configuration option defines the number of entries of the
+ * file system name cache.  The cache is used by the path evaluation of the
+ * IMFS, the RFS, and the DOSFS to avoid repeated directory searches.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Value Constraints
+ * The value of this configuration option shall be greater than or equal to
+ * zero.
+ *
+ * @par Notes
+ * @parblock
+ * A value of zero disables the file system name cache.
+ *
+ * The cache contains also negative entries for names which do not exist.  The
+ * entries of a file system instance are invalidated by each change of a
+ * directory of this instance, for example by mknod(), rename(), or unlink().
+ * Names longer than 31 characters are not cached.
+ * @endparblock
+ */
+#define CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES
+
 /* Generated from spec:/acfg/if/filesystem-nfs */
 
 /**
@@ -2411,6 +2441,55 @@
  */
 #define CONFIGURE_IMFS_DISABLE_UTIME
 
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the regular files of the
+ * root IMFS store their data in a few large memory areas (extents) instead of
+ * blocks of #CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK bytes.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the regular files of the
+ * root IMFS use the block based memory files.
+ *
+ * @par Notes
+ * @parblock
+ * A file is kept in one contiguous memory area which grows geometrically.
+ * This enables large copies in read() and write() and shared mappings with
+ * mmap() which return a direct pointer to the file data.  Once a file was
+ * mapped, its memory areas are no longer moved, further growth of the file
+ * adds areas.  A shared mapping keeps a reference to the file, so it stays
+ * valid after the file is closed and removed until it is unmapped.
+ *
+ * This configuration option has no effect if
+ * #CONFIGURE_IMFS_DISABLE_MKNOD_FILE is defined.
+ * @endparblock
+ */
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the directories of the
+ * root IMFS use a hashed name index for the path evaluation.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the directories of the root
+ * IMFS are searched linearly during the path evaluation.
+ *
+ * @par Notes
+ * @parblock
+ * The directory read order is the same as for directories without an index.
+ * The index needs additional memory for each directory.  This option is
+ * useful for directories with a lot of entries, for example a ``/dev``
+ * directory with thousands of device nodes.
+ *
+ * This configuration option has no effect if
+ * #CONFIGURE_IMFS_DISABLE_READDIR is defined.
+ * @endparblock
+ */
+#define CONFIGURE_IMFS_ENABLE_HASHED_DIRECTORIES
+
 /* Generated from spec:/acfg/if/imfs-enable-mkfifo */
 
 /**
@@ -60,7 +60,8 @@ extern "C" {
 #define RTEMS_CAPTURE_ONLY_MONITOR   (1U << 5)
 
 /*
- * Per-CPU capture flags.
+ * Per-CPU capture flags. Records lost due to a full capture buffer are
+ * counted, see rtems_capture_get_lost(), RTEMS_CAPTURE_OVERFLOW is not set.
  */
 #define RTEMS_CAPTURE_OVERFLOW       (1U << 0)
 #define RTEMS_CAPTURE_READER_ACTIVE  (1U << 1)
@@ -254,6 +255,13 @@ typedef enum rtems_capture_trigger
 
 typedef void (*rtems_capture_timestamp)(rtems_capture_time* time);
 
+/**
+ * @brief Capture per CPU data.
+ *
+ * This structure is private to the capture engine.
+ */
+struct rtems_capture_per_cpu_data;
+
 /**
  * @brief Capture record lock context.
  *
@@ -262,14 +270,14 @@ typedef void (*rtems_capture_timestamp)(rtems_capture_time* time);
  * masks interrupts so use this lock only when needed and do not hold it for
  * long.
  *
- * The lock first masks the CPU interrupt before taking the interrupt
- * lock. This stops a thread context taking the lock and then an interrupt on
- * the same CPU attempting to take the lock so creating a deadlock.
- *
+ * Only the executing CPU records into its per CPU buffer, so masking the CPU
+ * interrupt is enough to own the buffer. The reader of the buffer never
+ * blocks the recording CPU, so the time to record is bounded on SMP
+ * configurations.
  */
 typedef struct {
-  rtems_interrupt_lock_context lock_context;
-  rtems_interrupt_lock*        lock;
+  rtems_interrupt_level              level;
+  struct rtems_capture_per_cpu_data* cpu;
 } rtems_capture_record_lock_context;
 
 /**
@@ -553,6 +561,9 @@ rtems_capture_clear_trigger (rtems_name                 from_name,
  * rtems_capture_release. Calls this function without a release will
  * result in at least the same number of records being released.
  *
+ * The records may be read while capture control is enabled. The records
+ * recorded after the read are provided by the next read.
+ *
  * @param[in]  cpu The cpu number that the records were recorded on
  * @param[out] read will contain the number of records read
  * @param[out] recs The capture records that are read.
@@ -579,6 +590,61 @@ rtems_status_code rtems_capture_read (uint32_t     cpu,
  */
 rtems_status_code rtems_capture_release (uint32_t cpu, uint32_t count);
 
+/**
+ * @brief Capture get lost records.
+ *
+ * This function gets the number of records which could not be recorded on
+ * a CPU since its capture buffer was full. The count is cleared by
+ * rtems_capture_flush.
+ *
+ * @param[in]  cpu The cpu number of the capture buffer
+ * @param[out] lost will contain the number of lost records
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code rtems_capture_get_lost (uint32_t cpu, uint32_t* lost);
+
+/**
+ * @brief Capture record visitor.
+ *
+ * @param[in] cpu The cpu number that the record was recorded on.
+ * @param[in] rec The record header copied out of the capture buffer.
+ * @param[in] data The record data which follows the header in the capture
+ *            buffer. The data may be mis-aligned.
+ * @param[in] size The size of the record data in bytes.
+ * @param[in] arg The visitor argument.
+ *
+ * @retval true Stop the read.
+ * @retval false Continue the read.
+ */
+typedef bool (*rtems_capture_record_visitor) (uint32_t                    cpu,
+                                               const rtems_capture_record* rec,
+                                               const void*                 data,
+                                               size_t                      size,
+                                               void*                       arg);
+
+/**
+ * @brief Capture read merged records.
+ *
+ * This function reads the records of all CPUs, merges them by the time
+ * stamp, calls the visitor for each record in time order and releases the
+ * visited records. It stops after the specified number of records, if the
+ * visitor returns true, or if no more records are available.
+ *
+ * @param[in] count The maximum number of records to visit.
+ * @param[in] visitor The record visitor.
+ * @param[in] arg The visitor argument.
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code rtems_capture_read_merged (size_t                       count,
+                                             rtems_capture_record_visitor visitor,
+                                             void*                        arg);
+
 /**
  * @brief Capture filter
  *
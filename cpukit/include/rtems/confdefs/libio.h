@@ -44,6 +44,7 @@
 #ifdef CONFIGURE_INIT
 
 #include <rtems/confdefs/bsp.h>
+#include <rtems/libio_.h>
 #include <rtems/sysinit.h>
 
 #ifdef CONFIGURE_FILESYSTEM_ALL
@@ -256,6 +257,8 @@ static const rtems_filesystem_operations_table IMFS_root_ops = {
 static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #ifdef CONFIGURE_IMFS_DISABLE_READDIR
     &IMFS_mknod_control_dir_minimal,
+  #elif defined(CONFIGURE_IMFS_ENABLE_HASHED_DIRECTORIES)
+    &IMFS_mknod_control_dir_hashed,
   #else
     &IMFS_mknod_control_dir_default,
   #endif
@@ -266,6 +269,8 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #endif
   #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
     &IMFS_mknod_control_enosys,
+  #elif defined(CONFIGURE_IMFS_ENABLE_EXTENT_FILES)
+    &IMFS_mknod_control_extfile,
   #else
     &IMFS_mknod_control_memfile,
   #endif
@@ -328,9 +333,40 @@ RTEMS_SYSINIT_ITEM(
 #if CONFIGURE_MAXIMUM_FILE_DESCRIPTORS > 0
   rtems_libio_t rtems_libio_iops[ CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ];
 
+  Atomic_Ulong rtems_libio_iop_free_map[
+    RTEMS_LIBIO_IOP_FREE_MAP_WORDS( CONFIGURE_MAXIMUM_FILE_DESCRIPTORS )
+  ];
+
   const uint32_t rtems_libio_number_iops = RTEMS_ARRAY_SIZE( rtems_libio_iops );
 #endif
 
+#if defined(CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES) && \
+  CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES > 0 && \
+  !defined(CONFIGURE_APPLICATION_DISABLE_FILESYSTEM)
+  static rtems_filesystem_name_cache_entry _Filesystem_Name_cache_entries[
+    CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES
+  ];
+
+  static rtems_chain_control _Filesystem_Name_cache_buckets[
+    CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES
+  ];
+
+  static void _Filesystem_Name_cache_initialize( void )
+  {
+    rtems_filesystem_name_cache_initialize(
+      _Filesystem_Name_cache_entries,
+      _Filesystem_Name_cache_buckets,
+      CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES
+    );
+  }
+
+  RTEMS_SYSINIT_ITEM(
+    _Filesystem_Name_cache_initialize,
+    RTEMS_SYSINIT_ROOT_FILESYSTEM,
+    RTEMS_SYSINIT_ORDER_FIRST
+  );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
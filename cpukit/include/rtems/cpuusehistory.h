@@ -0,0 +1,222 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_CPUUSEHISTORY_H
+#define _RTEMS_CPUUSEHISTORY_H
+
+#include <rtems.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup libmisc_cpuuse
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of intervals in a CPU usage history.
+ */
+#define RTEMS_CPU_USAGE_HISTORY_SIZE 64
+
+/**
+ * @brief The minimum CPU usage history interval in microseconds.
+ */
+#define RTEMS_CPU_USAGE_HISTORY_INTERVAL_MINIMUM 1000
+
+/**
+ * @brief The maximum CPU usage history interval in microseconds.
+ */
+#define RTEMS_CPU_USAGE_HISTORY_INTERVAL_MAXIMUM 1000000
+
+/**
+ * @brief The CPU usage history of a thread.
+ */
+typedef struct {
+  /**
+   * @brief The count of valid samples.
+   */
+  uint32_t sample_count;
+
+  /**
+   * @brief The CPU time used by the thread in each interval in microseconds.
+   *
+   * Index zero is the most recent completed interval.
+   */
+  uint32_t samples[ RTEMS_CPU_USAGE_HISTORY_SIZE ];
+
+  /**
+   * @brief The maximum sample.
+   */
+  uint32_t peak;
+
+  /**
+   * @brief The index of the maximum sample.
+   */
+  uint32_t peak_index;
+
+  /**
+   * @brief The count of samples greater than or equal to the burst threshold.
+   */
+  uint32_t burst_count;
+} rtems_cpu_usage_history;
+
+/**
+ * @brief The CPU usage history of a processor.
+ */
+typedef struct {
+  /**
+   * @brief The count of valid samples.
+   */
+  uint32_t sample_count;
+
+  /**
+   * @brief The idle time of the processor in each interval in microseconds.
+   *
+   * Index zero is the most recent completed interval.
+   */
+  uint32_t idle_samples[ RTEMS_CPU_USAGE_HISTORY_SIZE ];
+
+  /**
+   * @brief The interrupt processing time in microseconds which was observed
+   *   with the most recent completed interval.
+   *
+   * This value is only available if RTEMS was built with profiling enabled,
+   * otherwise it is zero.  The interrupt time is included in the CPU time of
+   * the interrupted threads.
+   */
+  uint32_t interrupt_time;
+
+  /**
+   * @brief The exponentially weighted load averages of the processor over
+   *   one second, ten seconds, and sixty seconds.
+   *
+   * The load is the fraction of time the processor was not idle in units of
+   * 0.1 percent, so a fully loaded processor has a load of 1000.
+   */
+  uint32_t load_averages[ 3 ];
+} rtems_cpu_usage_processor_history;
+
+/**
+ * @brief Starts the CPU usage history.
+ *
+ * The CPU time of each thread is accounted at context switches through a
+ * thread switch extension in intervals of the specified length.  No clock
+ * tick or timer processing is involved.  Intervals without a context switch
+ * are completed lazily at the next context switch or query.  The history of
+ * each thread is a ring of the CPU time samples of the most recent
+ * RTEMS_CPU_USAGE_HISTORY_SIZE intervals.
+ *
+ * The history requires one free user extension, see
+ * CONFIGURE_MAXIMUM_USER_EXTENSIONS.  The history cannot be stopped.
+ *
+ * @param interval The interval length in microseconds.
+ * @param burst_threshold The burst threshold in percent of the interval
+ *   length.  A sample greater than or equal to this threshold is a burst.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_INVALID_NUMBER The interval was out of range or the burst
+ *   threshold was zero or greater than 100.
+ *
+ * @retval RTEMS_RESOURCE_IN_USE The history was already started.
+ *
+ * @retval RTEMS_TOO_MANY There was no free user extension.
+ *
+ * @retval RTEMS_NO_MEMORY There was not enough memory to allocate the
+ *   history of the existing threads.
+ */
+rtems_status_code rtems_cpu_usage_history_start(
+  uint32_t interval,
+  uint32_t burst_threshold
+);
+
+/**
+ * @brief Checks if the CPU usage history is started.
+ *
+ * @retval true The history is started.
+ *
+ * @retval false Otherwise.
+ */
+bool rtems_cpu_usage_history_is_running( void );
+
+/**
+ * @brief Gets the interval length of the CPU usage history.
+ *
+ * @return The interval length in microseconds, zero if the history is not
+ *   started.
+ */
+uint32_t rtems_cpu_usage_history_get_interval( void );
+
+/**
+ * @brief Gets the CPU usage history of the thread.
+ *
+ * @param id The thread identifier.
+ * @param[out] history The CPU usage history of the thread.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_INVALID_ADDRESS The history parameter was NULL.
+ *
+ * @retval RTEMS_INCORRECT_STATE The history was not started.
+ *
+ * @retval RTEMS_INVALID_ID There was no thread with this identifier or it
+ *   had no history.
+ */
+rtems_status_code rtems_cpu_usage_history_get(
+  rtems_id                 id,
+  rtems_cpu_usage_history *history
+);
+
+/**
+ * @brief Gets the CPU usage history of the processor.
+ *
+ * @param cpu_index The processor index.
+ * @param[out] history The CPU usage history of the processor.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_INVALID_ADDRESS The history parameter was NULL.
+ *
+ * @retval RTEMS_INCORRECT_STATE The history was not started.
+ *
+ * @retval RTEMS_INVALID_NUMBER The processor index was invalid.
+ */
+rtems_status_code rtems_cpu_usage_history_get_processor(
+  uint32_t                           cpu_index,
+  rtems_cpu_usage_processor_history *history
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_CPUUSEHISTORY_H */
@@ -205,6 +205,27 @@ IMFS_jnode_t *IMFS_node_remove_default(
 
 IMFS_jnode_t *IMFS_node_remove_directory( IMFS_jnode_t *node );
 
+/**
+ * @brief Reads the entries of an IMFS directory.
+ *
+ * This is the read handler of the IMFS directories with a readdir() support.
+ */
+ssize_t IMFS_dir_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+);
+
+/**
+ * @brief Gets the status of an IMFS directory.
+ *
+ * This is the fstat handler of the IMFS directories with a readdir() support.
+ */
+int IMFS_stat_directory(
+  const rtems_filesystem_location_info_t *loc,
+  struct stat                            *buf
+);
+
 /**
  * @brief Destroys an IMFS node.
  *
@@ -283,12 +304,38 @@ struct IMFS_jnode_tt {
   const IMFS_node_control *control;
 };
 
+typedef struct IMFS_directory_index IMFS_directory_index;
+
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+  IMFS_directory_index                 *index;
 } IMFS_directory_t;
 
+/**
+ * @brief Operations of an optional directory index.
+ *
+ * The index is used to speed up the name lookup in large directories.  The
+ * IMFS_directory_t::Entries chain remains the authoritative list of entries
+ * and defines the order of the directory read.
+ *
+ * @see IMFS_mknod_control_dir_hashed.
+ */
+typedef struct {
+  IMFS_jnode_t *(*lookup)(
+    IMFS_directory_t *dir,
+    const char       *name,
+    size_t            namelen
+  );
+  void (*add)( IMFS_directory_t *dir, IMFS_jnode_t *node );
+  void (*remove)( IMFS_directory_t *dir, IMFS_jnode_t *node );
+} IMFS_directory_index_operations;
+
+struct IMFS_directory_index {
+  const IMFS_directory_index_operations *ops;
+};
+
 typedef struct {
   IMFS_jnode_t              Node;
   rtems_device_major_number major;
@@ -322,6 +369,32 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+/**
+ * @brief Maximum count of extents of an IMFS extent file.
+ */
+#define IMFS_EXTFILE_EXTENT_COUNT 8
+
+typedef struct {
+  unsigned char *data;
+  size_t         size;
+} IMFS_extfile_extent;
+
+/**
+ * @brief IMFS extent file.
+ *
+ * The file data is stored in a small number of large memory areas.  As long
+ * as the file was not mapped, the file data is kept in one contiguous area
+ * which grows geometrically.  Once the file was mapped, the existing extents
+ * are never moved, further growth adds extents.
+ */
+typedef struct {
+  IMFS_filebase_t     File;
+  size_t              capacity;      /* total size of all extents */
+  uint8_t             extent_count;
+  bool                mapped;
+  IMFS_extfile_extent extents[ IMFS_EXTFILE_EXTENT_COUNT ];
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
@@ -431,8 +504,10 @@ typedef struct {
 
 extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
+extern const IMFS_mknod_control IMFS_mknod_control_dir_hashed;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -1063,11 +1138,23 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+
+  if ( dir->index != NULL ) {
+    ( *dir->index->ops->add )( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
+  IMFS_directory_t *dir;
+
   IMFS_assert( node->Parent != NULL );
+  dir = (IMFS_directory_t *) node->Parent;
+
+  if ( dir->index != NULL ) {
+    ( *dir->index->ops->remove )( dir, node );
+  }
+
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
 }
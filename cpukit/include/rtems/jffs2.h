@@ -16,6 +16,7 @@
 #define RTEMS_JFFS2_H
 
 #include <rtems/fs.h>
+#include <rtems/rtems/tasks.h>
 #include <sys/param.h>
 #include <sys/ioccom.h>
 #include <zlib.h>
@@ -442,6 +443,126 @@ int rtems_jffs2_compressor_zlib_decompress(
   uint32_t datalen
 );
 
+/**
+ * @brief Log2 of the hash table size of the LZ4 compressor.
+ */
+#define RTEMS_JFFS2_COMPRESSOR_LZ4_HASH_LOG 12
+
+/**
+ * @brief LZ4 compressor control structure.
+ *
+ * The LZ4 compressor trades some compression ratio for a much faster
+ * decompression compared to the ZLIB compressor.  It uses the LZ4 block
+ * format.  The compressor type of the data nodes is specific to RTEMS, so
+ * file system images using this compressor cannot be read by Linux.
+ *
+ * The decompress operation handles also data compressed by the RTIME and
+ * ZLIB compressors, so existing file systems can switch to the LZ4
+ * compressor.
+ */
+typedef struct {
+  rtems_jffs2_compressor_control super;
+  uint16_t hash_table[1 << RTEMS_JFFS2_COMPRESSOR_LZ4_HASH_LOG];
+
+  /**
+   * @brief The ZLIB control used to decompress data nodes written by the ZLIB
+   * compressor.
+   *
+   * Zero-initialize this member.
+   */
+  rtems_jffs2_compressor_zlib_control zlib;
+} rtems_jffs2_compressor_lz4_control;
+
+/**
+ * @brief LZ4 compressor compress operation.
+ */
+uint16_t rtems_jffs2_compressor_lz4_compress(
+  rtems_jffs2_compressor_control *self,
+  unsigned char *data_in,
+  unsigned char *cdata_out,
+  uint32_t *datalen,
+  uint32_t *cdatalen
+);
+
+/**
+ * @brief LZ4 compressor decompress operation.
+ */
+int rtems_jffs2_compressor_lz4_decompress(
+  rtems_jffs2_compressor_control *self,
+  uint16_t comprtype,
+  unsigned char *cdata_in,
+  unsigned char *data_out,
+  uint32_t cdatalen,
+  uint32_t datalen
+);
+
+/**
+ * @brief JFFS2 garbage collection task configuration.
+ *
+ * The garbage collection task is created by the mount of a writeable file
+ * system instance and deleted by the unmount.  It is woken up through the
+ * garbage collection trigger of the file system and performs incremental
+ * garbage collection passes.  The file system is locked only for
+ * @ref passes_per_slice garbage collection passes at once, so that writers
+ * are delayed at most by this amount of work.  Keeping free erase blocks
+ * ahead of the demand avoids garbage collection in the context of writers.
+ *
+ * The task counts against the configured maximum of Classic API tasks.
+ *
+ * @see rtems_jffs2_mount_data::gc_task.
+ */
+typedef struct {
+  /**
+   * @brief Priority of the garbage collection task.
+   *
+   * It should be lower than the priority of the writers, so that the garbage
+   * collection runs in otherwise idle time.
+   */
+  rtems_task_priority priority;
+
+  /**
+   * @brief Stack size of the garbage collection task in bytes.
+   *
+   * The stack must be large enough for the selected compressor.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief Garbage collection continues until the count of free and erasing
+   * erase blocks reaches this watermark.
+   *
+   * The garbage collection performs always the work necessary according to
+   * the JFFS2 garbage collection thresholds.  A watermark above these
+   * thresholds keeps more free erase blocks available at the expense of
+   * more flash wear.  A value of zero disables the watermark.
+   */
+  uint32_t free_blocks_watermark;
+
+  /**
+   * @brief Count of garbage collection passes carried out while the file
+   * system is locked.
+   *
+   * A value of zero is interpreted as one.
+   */
+  uint32_t passes_per_slice;
+
+  /**
+   * @brief Interval in clock ticks between two slices while more garbage
+   * collection work is necessary.
+   *
+   * A value of zero is interpreted as one.
+   */
+  rtems_interval slice_interval;
+
+  /**
+   * @brief Interval in clock ticks after which the task checks for garbage
+   * collection work without a trigger.
+   *
+   * A value of zero disables the periodic checks.
+   */
+  rtems_interval idle_interval;
+} rtems_jffs2_gc_task_config;
+
 /**
  * @brief JFFS2 mount options.
  *
@@ -459,6 +580,28 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Enables the erase block summary support.
+   *
+   * If enabled, a summary node is written to the end of each erase block
+   * which is filled up.  The summary node describes all nodes of the erase
+   * block, so that the mount needs to read only the summary node instead of
+   * all nodes of the erase block.  This reduces the mount time considerably.
+   * The summary nodes need some flash space.  Erase blocks written without
+   * summary support are scanned as usual, so the option may be changed
+   * between mounts.
+   */
+  bool enable_summary;
+
+  /**
+   * @brief Garbage collection task configuration.
+   *
+   * The garbage collection task is optional and this pointer may be @c NULL.
+   * In this case the application is responsible for the garbage collection,
+   * see rtems_jffs2_flash_control::trigger_garbage_collection.
+   */
+  const rtems_jffs2_gc_task_config *gc_task;
 } rtems_jffs2_mount_data;
 
 /**
@@ -595,6 +738,43 @@ typedef struct {
  */
 #define RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION _IO('F', 3)
 
+/**
+ * @brief Compression of the file system default.
+ *
+ * @see RTEMS_JFFS2_SET_COMPRESSION.
+ */
+#define RTEMS_JFFS2_COMPRESSION_DEFAULT 0
+
+/**
+ * @brief No compression.
+ *
+ * @see RTEMS_JFFS2_SET_COMPRESSION.
+ */
+#define RTEMS_JFFS2_COMPRESSION_NONE 1
+
+/**
+ * @brief IO control to select the compression of a file.
+ *
+ * The argument is a pointer to an int containing
+ * RTEMS_JFFS2_COMPRESSION_DEFAULT or RTEMS_JFFS2_COMPRESSION_NONE.  The
+ * selection applies to data written afterwards, this includes data moved by
+ * the garbage collection.  Use RTEMS_JFFS2_COMPRESSION_NONE for example for
+ * files which contain already compressed data or which are read with a tight
+ * latency budget.
+ *
+ * The selection is stored in the data nodes written for the file and is
+ * restored when the inode is read from the flash, so the garbage collection
+ * honours it also after the inode was evicted from the inode cache.
+ */
+#define RTEMS_JFFS2_SET_COMPRESSION _IOW('F', 4, int)
+
+/**
+ * @brief IO control to get the compression selection of a file.
+ *
+ * @see RTEMS_JFFS2_SET_COMPRESSION.
+ */
+#define RTEMS_JFFS2_GET_COMPRESSION _IOR('F', 5, int)
+
 /** @} */
 
 #ifdef __cplusplus
@@ -1014,6 +1014,37 @@ typedef int (*rtems_filesystem_mmap_t)(
   off_t off
 );
 
+/**
+ * @brief Copies data from a file to another file.
+ *
+ * This handler is called for the input file.  The data is copied from the
+ * current offset of the input file to the current offset of the output file.
+ * Both offsets are advanced by the count of copied bytes.  File systems may
+ * use this handler to move the data without an intermediate buffer.
+ *
+ * For explicit offsets of rtems_copy_file_range(), the handler is called with
+ * private copies of the IO controls, so the handlers shall use the offset of
+ * the IO control as the file position.
+ *
+ * Handler tables without this handler use
+ * rtems_filesystem_default_copy_file_range().
+ *
+ * @param[in, out] iop_in The IO pointer of the input file.
+ * @param[in, out] iop_out The IO pointer of the output file.
+ * @param[in] count The maximum count of bytes to copy.
+ *
+ * @retval non-negative Count of copied bytes.  A value of zero indicates the
+ *   end of the input file.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ *
+ * @see rtems_filesystem_default_copy_file_range().
+ */
+typedef ssize_t (*rtems_filesystem_copy_file_range_t)(
+  rtems_libio_t *iop_in,
+  rtems_libio_t *iop_out,
+  size_t count
+);
+
 /**
  * @brief File system node operations table.
  */
@@ -1034,6 +1065,7 @@ struct _rtems_filesystem_file_handlers_r {
   rtems_filesystem_readv_t readv_h;
   rtems_filesystem_writev_t writev_h;
   rtems_filesystem_mmap_t mmap_h;
+  rtems_filesystem_copy_file_range_t copy_file_range_h;
 };
 
 /**
@@ -1270,6 +1302,18 @@ int rtems_filesystem_default_mmap(
   off_t off
 );
 
+/**
+ * @brief Copies the data with the read handler of the input file and the
+ * write handler of the output file through an intermediate buffer.
+ *
+ * @see rtems_filesystem_copy_file_range_t.
+ */
+ssize_t rtems_filesystem_default_copy_file_range(
+  rtems_libio_t *iop_in,
+  rtems_libio_t *iop_out,
+  size_t         count
+);
+
 /** @} */
 
 /**
@@ -1589,6 +1633,56 @@ void rtems_libio_exit(void);
  */
 extern int rtems_mkdir(const char *path, mode_t mode);
 
+/**
+ * @brief Copies data from a file to another file.
+ *
+ * The data is copied through the copy file range handler of the input file,
+ * so that file systems can avoid the copy through a user buffer.  Other file
+ * systems and devices use the read and write handlers.
+ *
+ * @param fd_in The input file descriptor.  It shall be open for reading.
+ * @param off_in If this pointer is NULL, then the data is read from the
+ *   current file offset of the input file and the file offset is advanced.
+ *   Otherwise, the data is read from the offset referenced by the pointer, the
+ *   offset is advanced by the count of copied bytes and the file offset of the
+ *   input file is neither used nor changed.  Explicit offsets are only allowed
+ *   for regular files.
+ * @param fd_out The output file descriptor.  It shall be open for writing.
+ * @param off_out The offset of the output file, see @a off_in.
+ * @param count The maximum count of bytes to copy.
+ *
+ * @retval non-negative Count of copied bytes.  A value of zero indicates the
+ *   end of the input file.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ */
+ssize_t rtems_copy_file_range(
+  int     fd_in,
+  off_t  *off_in,
+  int     fd_out,
+  off_t  *off_out,
+  size_t  count
+);
+
+/**
+ * @brief Copies data from a file to another file or device.
+ *
+ * This is a Linux compatible variant of rtems_copy_file_range().
+ *
+ * @param fd_out The output file descriptor.  It shall be open for writing.
+ * @param fd_in The input file descriptor.  It shall be open for reading.
+ * @param offset The offset of the input file, see rtems_copy_file_range().
+ * @param count The maximum count of bytes to copy.
+ *
+ * @retval non-negative Count of copied bytes.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ */
+ssize_t rtems_sendfile(
+  int     fd_out,
+  int     fd_in,
+  off_t  *offset,
+  size_t  count
+);
+
 /** @} */
 
 /**
@@ -1657,6 +1751,14 @@ struct rtems_filesystem_mount_table_entry_tt {
    * @see ClassicEventTransient.
    */
   rtems_id                               unmount_task;
+
+  /**
+   * The generation of the file system name cache entries of this file system
+   * instance.  It is incremented by each directory change.
+   *
+   * @see rtems_filesystem_name_cache_invalidate().
+   */
+  unsigned int                           name_cache_generation;
 };
 
 /**
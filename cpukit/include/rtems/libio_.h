@@ -79,8 +79,29 @@ extern "C" {
 
 extern const uint32_t rtems_libio_number_iops;
 extern rtems_libio_t rtems_libio_iops[];
-extern void *rtems_libio_iop_free_head;
-extern void **rtems_libio_iop_free_tail;
+
+/**
+ * @brief Count of bits of a word of the free descriptor map.
+ */
+#define RTEMS_LIBIO_IOP_FREE_MAP_BITS ( CHAR_BIT * sizeof( unsigned long ) )
+
+/**
+ * @brief Count of words of the free descriptor map for the specified count of
+ * file descriptors.
+ */
+#define RTEMS_LIBIO_IOP_FREE_MAP_WORDS( _count ) \
+  ( ( ( _count ) + RTEMS_LIBIO_IOP_FREE_MAP_BITS - 1 ) / \
+    RTEMS_LIBIO_IOP_FREE_MAP_BITS )
+
+/**
+ * @brief The free descriptor map.
+ *
+ * A set bit indicates a free file descriptor.  The bit of file descriptor
+ * @c fd is bit @c fd % RTEMS_LIBIO_IOP_FREE_MAP_BITS of word
+ * @c fd / RTEMS_LIBIO_IOP_FREE_MAP_BITS.  The map is changed with atomic
+ * operations, so the allocation and release of file descriptors need no lock.
+ */
+extern Atomic_Ulong rtems_libio_iop_free_map[];
 
 extern const rtems_filesystem_file_handlers_r rtems_filesystem_null_handlers;
 
@@ -442,9 +463,21 @@ int rtems_filesystem_utime_update(
 /**
  * This routine searches the IOP Table for an unused entry.  If it
  * finds one, it returns it.  Otherwise, it returns NULL.
+ *
+ * The search starts after the most recently allocated entry, so released
+ * entries are reused as late as possible.  This increases the likelihood that
+ * a use after close is detected.  The allocation uses no lock.
  */
 rtems_libio_t *rtems_libio_allocate(void);
 
+/**
+ * @brief Returns the count of free entries of the IOP Table.
+ *
+ * The count is a snapshot which may be outdated if other threads open or
+ * close file descriptors concurrently.
+ */
+uint32_t rtems_libio_count_free( void );
+
 /**
  * Convert UNIX fnctl(2) flags to ones that RTEMS drivers understand
  */
@@ -1093,6 +1126,158 @@ static inline mode_t rtems_filesystem_location_type(
   return st.st_mode;
 }
 
+/**
+ * @brief Maximum length of a name in the file system name cache.
+ *
+ * Longer names are not cached.
+ */
+#define RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX 31
+
+/**
+ * @brief File system name cache entry.
+ *
+ * An entry maps a name in a parent directory of a file system instance to the
+ * file system specific child node.  A child value of zero indicates a negative
+ * entry, the name does not exist in the parent directory.
+ */
+typedef struct {
+  rtems_chain_node                            Hash_node;
+  rtems_chain_node                            Lru_node;
+  const rtems_filesystem_mount_table_entry_t *mt_entry;
+  unsigned int                                generation;
+  uint32_t                                    hash;
+  uintptr_t                                   parent;
+  uintptr_t                                   child;
+  uintptr_t                                   child_2;
+  uint8_t                                     namelen;
+  char                                        name[ RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX ];
+} rtems_filesystem_name_cache_entry;
+
+/**
+ * @brief File system name cache statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of lookups which returned a child node.
+   */
+  uint32_t positive_hits;
+
+  /**
+   * @brief Count of lookups which returned a negative entry.
+   */
+  uint32_t negative_hits;
+
+  /**
+   * @brief Count of lookups which found no valid entry.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of file system instance invalidations.
+   */
+  uint32_t invalidations;
+} rtems_filesystem_name_cache_statistics;
+
+/**
+ * @brief Initializes the file system name cache.
+ *
+ * This function is called during system initialization if the application
+ * configured CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES to a positive value.
+ * Without an initialization all cache operations are no-operations.
+ *
+ * @param[in] entries The cache entries.
+ * @param[in] buckets The hash buckets.
+ * @param[in] count The count of cache entries and hash buckets.
+ */
+void rtems_filesystem_name_cache_initialize(
+  rtems_filesystem_name_cache_entry *entries,
+  rtems_chain_control               *buckets,
+  size_t                             count
+);
+
+/**
+ * @brief Looks up a name in the file system name cache.
+ *
+ * The file system instance must be locked by the caller.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] parent The file system specific key of the parent directory.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ * @param[out] child The child node, zero for a negative entry.
+ * @param[out] child_2 The second child value of the file system.
+ *
+ * @retval true A valid entry was found.
+ * @retval false Otherwise.
+ */
+bool rtems_filesystem_name_cache_lookup(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t                                   parent,
+  const char                                 *name,
+  size_t                                      namelen,
+  uintptr_t                                  *child,
+  uintptr_t                                  *child_2
+);
+
+/**
+ * @brief Enters the result of a directory lookup into the file system name
+ * cache.
+ *
+ * The file system instance must be locked by the caller.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] parent The file system specific key of the parent directory.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ * @param[in] child The child node, zero for a negative entry.
+ * @param[in] child_2 The second child value of the file system.
+ */
+void rtems_filesystem_name_cache_enter(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t                                   parent,
+  const char                                 *name,
+  size_t                                      namelen,
+  uintptr_t                                   child,
+  uintptr_t                                   child_2
+);
+
+/**
+ * @brief Invalidates all file system name cache entries of a file system
+ * instance.
+ *
+ * This function must be called after each change of a directory of the file
+ * system instance.  The entries are invalidated through a generation count of
+ * the file system instance, so the invalidation is independent of the count
+ * of cache entries.
+ *
+ * @param[in] mt_entry The file system instance.
+ */
+void rtems_filesystem_name_cache_invalidate(
+  rtems_filesystem_mount_table_entry_t *mt_entry
+);
+
+/**
+ * @brief Removes all file system name cache entries of a file system
+ * instance.
+ *
+ * This function is called during unmount before the file system instance is
+ * freed.
+ *
+ * @param[in] mt_entry The file system instance.
+ */
+void rtems_filesystem_name_cache_purge(
+  const rtems_filesystem_mount_table_entry_t *mt_entry
+);
+
+/**
+ * @brief Gets the file system name cache statistics.
+ *
+ * @param[out] statistics The statistics.
+ */
+void rtems_filesystem_name_cache_get_statistics(
+  rtems_filesystem_name_cache_statistics *statistics
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -34,25 +34,8 @@
 extern "C" {
 #endif
 
-/* Control block to manage each pipe */
-typedef struct pipe_control {
-  char *Buffer;
-  unsigned int Size;
-  unsigned int Start;
-  unsigned int Length;
-  unsigned int Readers;
-  unsigned int Writers;
-  unsigned int waitingReaders;
-  unsigned int waitingWriters;
-  unsigned int readerCounter;     /* incremental counters */
-  unsigned int writerCounter;     /* for differentiation of successive opens */
-  rtems_mutex Mutex;
-  rtems_condition_variable readBarrier;   /* wait queues */
-  rtems_condition_variable writeBarrier;
-#if 0
-  boolean Anonymous;      /* anonymous pipe or FIFO */
-#endif
-} pipe_control_t;
+/* Control block to manage each pipe, see fifo.c */
+typedef struct pipe_control pipe_control_t;
 
 /**
  * @brief Release a pipe.
@@ -116,6 +99,69 @@ extern int pipe_ioctl(
   rtems_libio_t   *iop
 );
 
+/**
+ * @brief Move data from a pipe to a file descriptor.
+ *
+ * Interface to rtems_pipe_splice().
+ */
+extern ssize_t pipe_splice_read(
+  pipe_control_t *pipe,
+  int             fd_out,
+  size_t          count,
+  rtems_libio_t  *iop
+);
+
+/**
+ * @brief Move data from a file descriptor to a pipe.
+ *
+ * Interface to rtems_pipe_splice().
+ */
+extern ssize_t pipe_splice_write(
+  pipe_control_t *pipe,
+  int             fd_in,
+  size_t          count,
+  rtems_libio_t  *iop
+);
+
+/**
+ * @brief Moves data between a pipe and a file descriptor.
+ *
+ * At least one of the file descriptors shall refer to a pipe or FIFO.  The
+ * data is transferred between the pipe buffer and the other file descriptor
+ * using read() or write() through a buffer of PIPE_BUF bytes on the stack of
+ * the caller, so at most PIPE_BUF bytes are moved by one call.  The pipe is
+ * not locked during the I/O on the other file descriptor.
+ *
+ * If @a fd_in refers to a pipe, then up to @a count bytes are read from the
+ * pipe and written to @a fd_out.  The call blocks like read() on the pipe
+ * until data is available, unless the pipe file descriptor is in
+ * non-blocking mode.  Data read from the pipe which cannot be written to
+ * @a fd_out due to an error is discarded.
+ *
+ * Otherwise, if @a fd_out refers to a pipe, then up to @a count bytes are
+ * read from @a fd_in and written to the pipe.  The call blocks like write()
+ * on the pipe until some space is available, unless the pipe file descriptor
+ * is in non-blocking mode.  Data is only read from @a fd_in if space is
+ * available in the pipe.  Once data is read from @a fd_in, the call waits
+ * until it is written to the pipe, also in non-blocking mode.
+ *
+ * @param fd_in The file descriptor to read from.
+ * @param fd_out The file descriptor to write to.
+ * @param count The maximum count of bytes to move.
+ *
+ * @return The count of bytes moved.  A return value of zero indicates an end
+ *   of file condition of the input, e.g. a pipe without writers.
+ *
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ *   EINVAL indicates that no file descriptor refers to a pipe or that both
+ *   refer to the same pipe.
+ */
+extern ssize_t rtems_pipe_splice(
+  int    fd_in,
+  int    fd_out,
+  size_t count
+);
+
 /** @} */
 
 #ifdef __cplusplus
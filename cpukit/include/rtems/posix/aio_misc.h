@@ -19,6 +19,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include <aio.h>
 #include <pthread.h>
 #include <rtems.h>
@@ -30,6 +31,8 @@ extern "C"
 {
 #endif
 
+  struct rtems_aio_listio;
+
   /* Actual request being processed */
   typedef struct
   {
@@ -39,30 +42,71 @@ extern "C"
     int priority;               /* see above */
     pthread_t caller_thread;    /* used for notification */
     struct aiocb *aiocbp;       /* aio control block */
+    struct rtems_aio_listio *listio; /* lio_listio() batch or NULL */
   } rtems_aio_request;
 
   typedef struct
   {
-    rtems_chain_node next_fd;   /* order fd chains in queue */
+    rtems_chain_node next_fd;   /* chain of the fd table bucket */
+    rtems_chain_node next_ready; /* chain of fd chains ready for a worker */
     rtems_chain_control perfd;  /* chain of requests for this fd */
     int fildes;                 /* file descriptor to be processed */
     int new_fd;                 /* if this is a newly created chain */
-    pthread_mutex_t mutex;      
-    pthread_cond_t cond;
-
+    int active;                 /* requests in progress by a worker */
   } rtems_aio_request_chain;
 
   typedef struct
   {
-    pthread_mutex_t mutex;
-    pthread_cond_t new_req;
+    rtems_chain_node next_idle; /* chain of idle workers */
+    pthread_t thread;
+    pthread_cond_t cond;        /* signalled if r_chain was assigned */
+    rtems_aio_request_chain *r_chain; /* fd chain worked on or NULL */
+  } rtems_aio_worker;
+
+  /* Completion state of a lio_listio() batch */
+  typedef struct rtems_aio_listio
+  {
+    pthread_cond_t done;        /* signalled if pending drops to zero */
+    int pending;                /* number of requests not yet completed */
+    int mode;                   /* LIO_WAIT or LIO_NOWAIT */
+    struct sigevent sig;        /* notification for LIO_NOWAIT */
+  } rtems_aio_listio;
+
+#ifndef AIO_MAX_THREADS
+#define AIO_MAX_THREADS 5
+#endif
+
+#ifndef AIO_MAX_QUEUE_SIZE
+#define AIO_MAX_QUEUE_SIZE 30
+#endif
+
+/* Number of buckets of the fd table, should be a power of two */
+#ifndef AIO_FD_TABLE_SIZE
+#define AIO_FD_TABLE_SIZE 32
+#endif
+
+/* Maximum number of adjacent requests merged into one vectored transfer */
+#ifndef AIO_MAX_MERGE
+#define AIO_MAX_MERGE 16
+#endif
+
+#ifndef AIO_LISTIO_MAX
+#define AIO_LISTIO_MAX AIO_MAX_QUEUE_SIZE
+#endif
+
+  typedef struct
+  {
+    pthread_mutex_t mutex;      /* protects the whole queue */
     pthread_attr_t attr;
 
-    rtems_chain_control work_req; /* chains being worked by active threads */
-    rtems_chain_control idle_req; /* fd chains waiting to be processed */
+    rtems_chain_control fd_table[AIO_FD_TABLE_SIZE]; /* fd chains by fd hash */
+    rtems_chain_control ready_req; /* fd chains waiting for a worker */
+    rtems_chain_control idle_workers; /* workers waiting for a fd chain */
+    rtems_aio_worker workers[AIO_MAX_THREADS];
     unsigned int initialized;     /* specific value if queue is initialized */
-    int active_threads;           /* the number of active threads */
-    int idle_threads;             /* number of idle threads */
+    int active_threads;           /* the number of busy workers */
+    int idle_threads;             /* number of idle workers */
+    int queued_requests;          /* requests not yet taken by a worker */
 
   } rtems_aio_queue;
 
@@ -70,25 +114,15 @@ extern rtems_aio_queue aio_request_queue;
 
 #define AIO_QUEUE_INITIALIZED 0xB00B
 
-#ifndef AIO_MAX_THREADS
-#define AIO_MAX_THREADS 5
-#endif
-
-#ifndef AIO_MAX_QUEUE_SIZE
-#define AIO_MAX_QUEUE_SIZE 30
-#endif
-
 int rtems_aio_init (void);
 int rtems_aio_enqueue (rtems_aio_request *req);
-rtems_aio_request_chain *rtems_aio_search_fd 
-(
-  rtems_chain_control *chain,
-  int fildes,
-  int create
-);
+int rtems_aio_enqueue_list (rtems_chain_control *reqs);
+rtems_aio_request_chain *rtems_aio_search_fd (int fildes, int create);
 void rtems_aio_remove_fd (rtems_aio_request_chain *r_chain);
 int rtems_aio_remove_req (rtems_chain_control *chain,
 				 struct aiocb *aiocbp);
+void rtems_aio_complete (rtems_aio_request *req);
+void rtems_aio_listio_release (rtems_aio_listio *listio);
 
 #ifdef RTEMS_DEBUG
 #include <assert.h>
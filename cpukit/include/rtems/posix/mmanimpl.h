@@ -35,6 +35,8 @@ typedef struct mmap_mappings_s {
   size_t             len;   /**< The length of memory mapped */
   int                flags; /**< The mapping flags */
   POSIX_Shm_Control *shm;   /**< The shared memory object or NULL */
+  bool               file_referenced; /**< The file location is referenced */
+  rtems_filesystem_location_info_t file; /**< The mapped regular file */
 } mmap_mapping;
 
 extern rtems_chain_control mmap_mappings;
@@ -51,7 +51,10 @@ extern "C" {
  * Profiling information includes critical timing values such as the maximum
  * time of disabled thread dispatching which is a measure for the thread
  * dispatch latency.  On SMP configurations statistics of all SMP locks in the
- * system are available.
+ * system are available.  The wait time statistics of the thread queues used
+ * by the blocking objects show which objects cause latencies under load.  The
+ * latency tracer records the code addresses of the longest sections with
+ * disabled interrupts, disabled thread dispatching, and held SMP locks.
  *
  * Profiling information can be retrieved via rtems_profiling_iterate() and
  * reported as an XML dump via rtems_profiling_report_xml().  These functions
@@ -77,7 +80,21 @@ typedef enum {
    *
    * @see rtems_profiling_smp_lock.
    */
-  RTEMS_PROFILING_SMP_LOCK
+  RTEMS_PROFILING_SMP_LOCK,
+
+  /**
+   * @brief Type of thread queue profiling data.
+   *
+   * @see rtems_profiling_thread_queue.
+   */
+  RTEMS_PROFILING_THREAD_QUEUE,
+
+  /**
+   * @brief Type of latency profiling data.
+   *
+   * @see rtems_profiling_latency.
+   */
+  RTEMS_PROFILING_LATENCY
 } rtems_profiling_type;
 
 /**
@@ -178,6 +195,36 @@ typedef struct {
    * This value may overflow.
    */
   uint64_t total_interrupt_time;
+
+  /**
+   * @brief The maximum inter-processor interrupt latency in nanoseconds.
+   *
+   * This is the time interval between an inter-processor interrupt request on
+   * another processor, for example to carry out a thread dispatch after a
+   * cross-processor wakeup, and the start of the inter-processor interrupt
+   * handler on this processor.  The values are only meaningful if the CPU
+   * counters of all processors are synchronized.  On uniprocessor
+   * configurations this field has a constant value of zero.
+   */
+  uint32_t max_ipi_latency;
+
+  /**
+   * @brief Count of received inter-processor interrupts which were requested
+   * while no other request was pending.
+   *
+   * This value may overflow.
+   */
+  uint64_t ipi_count;
+
+  /**
+   * @brief Total inter-processor interrupt latency in nanoseconds.
+   *
+   * The average inter-processor interrupt latency is the total latency divided
+   * by the inter-processor interrupt count.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_ipi_latency;
 } rtems_profiling_per_cpu;
 
 /**
@@ -265,6 +312,224 @@ typedef struct {
   uint64_t contention_counts[RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS];
 } rtems_profiling_smp_lock;
 
+/**
+ * @brief Count of wait time histogram buckets for thread queue profiling.
+ *
+ * Bucket zero counts the waits shorter than one microsecond.  Bucket N
+ * greater than zero counts the waits in the interval [2^(N - 1), 2^N)
+ * microseconds.  The last bucket counts also all longer waits.
+ */
+#define RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS 16
+
+/**
+ * @brief Count of owners tracked by thread queue profiling.
+ */
+#define RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT 4
+
+/**
+ * @brief Thread queue owner profiling data.
+ */
+typedef struct {
+  /**
+   * @brief The identifier of the owner or zero if the thread queue had no
+   * owner at the wait begin instant, e.g. in case of a counting semaphore.
+   */
+  uint32_t id;
+
+  /**
+   * @brief The count of waits blocked on this owner.
+   *
+   * This value may overflow.
+   */
+  uint64_t wait_count;
+
+  /**
+   * @brief Total wait time blocked on this owner in nanoseconds.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_wait_time;
+} rtems_profiling_thread_queue_owner;
+
+/**
+ * @brief Thread queue profiling data.
+ *
+ * Thread queues are used by all blocking objects, e.g. mutexes, semaphores,
+ * condition variables, barriers, message queues, and futexes.  The profiling
+ * data of a thread queue is collected per processor and summed up by
+ * rtems_profiling_iterate().  A fixed count of thread queues is profiled per
+ * processor.  If no free profiling data is available for a thread queue, then
+ * the profiling data of the least waited for thread queue is evicted, see
+ * rtems_profiling_get_thread_queue_dropped_wait_count().
+ *
+ * The wait begin instant is the point in time right before the thread queue
+ * lock release in the enqueue sequence.  The wait end instant is the point in
+ * time right after the thread resumed execution in the enqueue sequence.  The
+ * wait time is the time elapsed between the wait begin and end instants.
+ *
+ * The owners are maintained by the space-saving algorithm.  If a new owner
+ * does not fit into the owner set, then the owner with the lowest wait count
+ * is replaced and the new owner inherits its counts.  Thus, the counts of an
+ * owner are upper bounds, however, the owners which caused the most waits are
+ * always in the set.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The thread queue address.
+   */
+  const void *queue;
+
+  /**
+   * @brief The object identifier of the thread queue or zero if the thread
+   * queue is not associated with an object, e.g. a self-contained mutex.
+   */
+  uint32_t id;
+
+  /**
+   * @brief The thread queue name.
+   */
+  const char *name;
+
+  /**
+   * @brief Indicates if the object of the thread queue was deleted.
+   *
+   * The profiling data of a deleted object may be evicted by another thread
+   * queue.
+   */
+  bool deleted;
+
+  /**
+   * @brief The maximum wait time in nanoseconds.
+   */
+  uint64_t max_wait_time;
+
+  /**
+   * @brief The count of waits.
+   *
+   * This value may overflow.
+   */
+  uint64_t wait_count;
+
+  /**
+   * @brief Total wait time in nanoseconds.
+   *
+   * The average wait time is the total wait time divided by the wait count.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_wait_time;
+
+  /**
+   * @brief The wait time histogram.
+   *
+   * @see RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS.
+   *
+   * The values may overflow.
+   */
+  uint64_t histogram[RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS];
+
+  /**
+   * @brief The owners which caused the most waits.
+   *
+   * Unused entries have a wait count of zero.
+   */
+  rtems_profiling_thread_queue_owner
+    owners[RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT];
+} rtems_profiling_thread_queue;
+
+/**
+ * @brief Count of latency sections recorded for each kind and processor.
+ */
+#define RTEMS_PROFILING_LATENCY_COUNT 8
+
+/**
+ * @brief Kind of a latency section.
+ */
+typedef enum {
+  /**
+   * @brief Section with disabled interrupts.
+   *
+   * Only the interrupt disable and enable sequences of C code are traced.
+   */
+  RTEMS_PROFILING_LATENCY_INTERRUPTS_DISABLED,
+
+  /**
+   * @brief Section with disabled thread dispatching in thread context.
+   */
+  RTEMS_PROFILING_LATENCY_THREAD_DISPATCH_DISABLED,
+
+  /**
+   * @brief Section with an owned SMP lock, e.g. the per-processor lock.
+   *
+   * These sections are only traced on SMP configurations.
+   */
+  RTEMS_PROFILING_LATENCY_LOCK_HELD
+} rtems_profiling_latency_kind;
+
+/**
+ * @brief Latency profiling data.
+ *
+ * For each processor and kind, the RTEMS_PROFILING_LATENCY_COUNT longest
+ * sections are recorded.  The sections of a processor and kind are visited
+ * in the order of decreasing duration.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The processor index of the section.
+   */
+  uint32_t processor_index;
+
+  /**
+   * @brief The section kind.
+   */
+  rtems_profiling_latency_kind kind;
+
+  /**
+   * @brief The rank of the section, zero is the longest section of the
+   * processor and kind.
+   */
+  uint32_t rank;
+
+  /**
+   * @brief The section duration in nanoseconds.
+   */
+  uint32_t duration;
+
+  /**
+   * @brief The code address which started the section.
+   *
+   * This is the return address of the function which started the section.  It
+   * may be NULL, e.g. if thread dispatching was disabled by an interrupt.
+   */
+  const void *begin;
+
+  /**
+   * @brief The code address which ended the section.
+   */
+  const void *end;
+
+  /**
+   * @brief The identifier of the thread executing at the section end or zero.
+   */
+  uint32_t executing;
+
+  /**
+   * @brief The lock name of a RTEMS_PROFILING_LATENCY_LOCK_HELD section or
+   * NULL.
+   */
+  const char *name;
+} rtems_profiling_latency;
+
 /**
  * @brief Collection of profiling data.
  */
@@ -283,6 +548,16 @@ typedef union {
    * @brief SMP lock profiling data if indicated by the header.
    */
   rtems_profiling_smp_lock smp_lock;
+
+  /**
+   * @brief Thread queue profiling data if indicated by the header.
+   */
+  rtems_profiling_thread_queue thread_queue;
+
+  /**
+   * @brief Latency profiling data if indicated by the header.
+   */
+  rtems_profiling_latency latency;
 } rtems_profiling_data;
 
 /**
@@ -309,6 +584,32 @@ void rtems_profiling_iterate(
   void *visitor_arg
 );
 
+/**
+ * @brief Resets the thread queue profiling data.
+ *
+ * Use this function to start a new measurement interval, e.g. before a load
+ * test.
+ */
+void rtems_profiling_reset_thread_queues(void);
+
+/**
+ * @brief Gets the count of thread queue waits which were not profiled.
+ *
+ * The waits of evicted thread queue profiling data are counted.  The count is
+ * cleared by rtems_profiling_reset_thread_queues().
+ *
+ * @return Returns the count of thread queue waits which were not profiled.
+ */
+uint64_t rtems_profiling_get_thread_queue_dropped_wait_count(void);
+
+/**
+ * @brief Resets the latency profiling data.
+ *
+ * Use this function to start a new measurement interval, e.g. before a load
+ * test.
+ */
+void rtems_profiling_reset_latencies(void);
+
 /**
  * @brief Reports profiling data as XML.
  *
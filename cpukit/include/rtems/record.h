@@ -1882,6 +1882,120 @@ uint32_t rtems_record_interrupt_disable( void );
  */
 void rtems_record_interrupt_enable( uint32_t level );
 
+/**
+ * @brief The modes of the function entry and exit tracing.
+ *
+ * The function entry and exit tracing produces RTEMS_RECORD_FUNCTION_ENTRY and
+ * RTEMS_RECORD_FUNCTION_EXIT events with the function address as data in the
+ * __cyg_profile_func_enter() and __cyg_profile_func_exit() hooks of the
+ * -finstrument-functions compiler option.
+ */
+typedef enum {
+  /**
+   * @brief No function events are produced.
+   */
+  RTEMS_RECORD_FUNCTION_DISABLED,
+
+  /**
+   * @brief Function events are produced for all instrumented functions.
+   */
+  RTEMS_RECORD_FUNCTION_ALL,
+
+  /**
+   * @brief Function events are produced only for the instrumented functions
+   *   of the filter.
+   */
+  RTEMS_RECORD_FUNCTION_INCLUDE,
+
+  /**
+   * @brief Function events are produced only for the instrumented functions
+   *   which are not in the filter.
+   */
+  RTEMS_RECORD_FUNCTION_EXCLUDE
+} rtems_record_function_mode;
+
+/**
+ * @brief The maximum count of functions in the function filter.
+ */
+#define RTEMS_RECORD_FUNCTION_FILTER_MAXIMUM 255
+
+/**
+ * @brief Sets the mode of the function entry and exit tracing.
+ *
+ * The initial mode is RTEMS_RECORD_FUNCTION_ALL if the record support is
+ * configured, otherwise it is RTEMS_RECORD_FUNCTION_DISABLED and other modes
+ * must not be set.
+ *
+ * The code of the record support and the code used by it, for example the
+ * counter support of the BSP, must not be instrumented, see the
+ * -finstrument-functions-exclude-file-list compiler option.
+ *
+ * @param mode The new mode.
+ */
+void rtems_record_function_set_mode( rtems_record_function_mode mode );
+
+/**
+ * @brief Gets the mode of the function entry and exit tracing.
+ *
+ * @return The current mode.
+ */
+rtems_record_function_mode rtems_record_function_get_mode( void );
+
+/**
+ * @brief Adds the function to the function filter.
+ *
+ * The function filter may be changed while function events are produced.
+ * Concurrent function hooks may not observe the change immediately.
+ *
+ * @param function The function address.
+ *
+ * @retval true The function was added to the filter or was already in the
+ *   filter.
+ *
+ * @retval false The filter was full.
+ */
+bool rtems_record_function_filter_add( const void *function );
+
+/**
+ * @brief Removes all functions from the function filter.
+ */
+void rtems_record_function_filter_clear( void );
+
+/**
+ * @brief Produces the thread queue profiling data.
+ *
+ * For each profiled thread queue, the RTEMS_RECORD_THREAD_QUEUE_ADDRESS,
+ * RTEMS_RECORD_THREAD_QUEUE_ID, RTEMS_RECORD_THREAD_QUEUE_NAME,
+ * RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT, RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME,
+ * and RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME_MAX events are produced.  Each used
+ * histogram bucket produces a RTEMS_RECORD_THREAD_QUEUE_WAIT_BUCKET event
+ * followed by a RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT event.  Each owner
+ * produces a RTEMS_RECORD_THREAD_QUEUE_OWNER event followed by
+ * RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT and
+ * RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME events.  The times are in nanoseconds.
+ *
+ * Profiling data is only available if RTEMS was built with profiling
+ * enabled, see rtems_profiling_iterate().
+ */
+void rtems_record_thread_queue_statistics( void );
+
+/**
+ * @brief Produces the latency profiling data.
+ *
+ * For each recorded section, the RTEMS_RECORD_LATENCY_PROCESSOR,
+ * RTEMS_RECORD_LATENCY_KIND, RTEMS_RECORD_LATENCY_DURATION,
+ * RTEMS_RECORD_LATENCY_BEGIN, RTEMS_RECORD_LATENCY_END, and
+ * RTEMS_RECORD_LATENCY_EXECUTING events are produced.  Sections with a held
+ * lock produce also RTEMS_RECORD_LATENCY_LOCK_NAME events.  The kind is a
+ * rtems_profiling_latency_kind value.  The duration is in nanoseconds.  The
+ * sections of a processor and kind are produced in the order of decreasing
+ * duration.
+ *
+ * Profiling data is only available if RTEMS was built with profiling
+ * enabled, see rtems_profiling_iterate().
+ */
+void rtems_record_latencies( void );
+
 typedef void ( *rtems_record_drain_visitor )(
   const rtems_record_item *items,
   size_t                   count,
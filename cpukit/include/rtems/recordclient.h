@@ -37,6 +37,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -236,6 +237,953 @@ static inline void rtems_record_client_bintime_to_seconds_and_nanoseconds(
   *nanoseconds = (uint32_t) ( ( ns_per_sec * (uint32_t) bt ) >> 32 );
 }
 
+/**
+ * @brief A node of the function call tree or of the flat function profile.
+ *
+ * All times are in the bintime format of the record client handler, see
+ * rtems_record_client_bintime_to_nanoseconds().
+ */
+typedef struct rtems_record_client_function_node {
+  /**
+   * @brief The parent node in the call tree.
+   *
+   * This member is NULL for the nodes of the flat function profile.
+   */
+  struct rtems_record_client_function_node *parent;
+
+  /**
+   * @brief The first callee of this node in the call tree.
+   */
+  struct rtems_record_client_function_node *first_child;
+
+  /**
+   * @brief The next callee of the parent node in the call tree.
+   */
+  struct rtems_record_client_function_node *next_sibling;
+
+  /**
+   * @brief The next node in the same hash bucket of the flat function profile.
+   */
+  struct rtems_record_client_function_node *next_in_bucket;
+
+  /**
+   * @brief The function address reported by the RTEMS_RECORD_FUNCTION_ENTRY
+   * and RTEMS_RECORD_FUNCTION_EXIT events.
+   */
+  uint64_t function;
+
+  /**
+   * @brief The count of calls.
+   */
+  uint64_t calls;
+
+  /**
+   * @brief The time spent in the function including its callees.
+   *
+   * Recursive calls of a function are accounted only once in the flat
+   * function profile.
+   */
+  uint64_t total_time;
+
+  /**
+   * @brief The time spent in the function excluding its callees.
+   */
+  uint64_t self_time;
+
+  /**
+   * @brief The count of active calls of the function on all call stacks.
+   */
+  uint32_t active;
+} rtems_record_client_function_node;
+
+typedef struct rtems_record_client_function_stack
+  rtems_record_client_function_stack;
+
+#define RTEMS_RECORD_CLIENT_FUNCTION_HASH_BITS 8
+
+#define RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE \
+  ( 1 << RTEMS_RECORD_CLIENT_FUNCTION_HASH_BITS )
+
+/**
+ * @brief The function profile context.
+ *
+ * The function profile rebuilds the call trees of the function entry and exit
+ * events produced by the -finstrument-functions support of the target.  Each
+ * thread and the interrupt context of each processor has its own call stack.
+ * Time while a thread is switched out or interrupted is not accounted to the
+ * active calls of the thread.
+ */
+typedef struct {
+  /**
+   * @brief The root of the call tree.
+   *
+   * The children of the root are the outermost calls of all contexts.
+   */
+  rtems_record_client_function_node root;
+
+  /**
+   * @brief The hash buckets of the flat function profile.
+   */
+  rtems_record_client_function_node *
+    functions[ RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE ];
+
+  /**
+   * @brief The hash buckets of the call stacks.
+   */
+  rtems_record_client_function_stack *
+    stacks[ RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE ];
+
+  struct {
+    /**
+     * @brief The call stack of the thread executing on the processor.
+     */
+    rtems_record_client_function_stack *thread;
+
+    /**
+     * @brief The call stack of the interrupt context of the processor.
+     */
+    rtems_record_client_function_stack *interrupt;
+
+    /**
+     * @brief The interrupt nest level of the processor.
+     */
+    uint32_t interrupt_nest_level;
+  } per_cpu[ RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT ];
+
+  /**
+   * @brief The count of function exit events without a corresponding entry
+   * event on the call stack.
+   */
+  uint64_t unmatched_exits;
+
+  /**
+   * @brief The count of calls implicitly finished by the exit event of a
+   * caller.
+   */
+  uint64_t implicit_exits;
+
+  /**
+   * @brief The count of calls discarded due to ring buffer overflows.
+   */
+  uint64_t discarded_calls;
+} rtems_record_client_function_context;
+
+/**
+ * @brief Visits a node of the function profile.
+ *
+ * @param node The visited node.
+ * @param depth The call depth of the node.  It is zero for the nodes of the
+ *   flat function profile.
+ * @param arg The visitor argument.
+ */
+typedef void ( *rtems_record_client_function_visitor )(
+  const rtems_record_client_function_node *node,
+  uint32_t                                 depth,
+  void                                    *arg
+);
+
+/**
+ * @brief Initializes a function profile.
+ *
+ * @param ctx The function profile context to initialize.
+ */
+void rtems_record_client_function_init(
+  rtems_record_client_function_context *ctx
+);
+
+/**
+ * @brief Processes a record item for the function profile.
+ *
+ * This function may be used as the record client handler, see
+ * rtems_record_client_init(), or it may be called by a record client handler.
+ * It uses the RTEMS_RECORD_FUNCTION_ENTRY, RTEMS_RECORD_FUNCTION_EXIT,
+ * RTEMS_RECORD_THREAD_SWITCH_IN, RTEMS_RECORD_THREAD_SWITCH_OUT,
+ * RTEMS_RECORD_INTERRUPT_ENTRY, RTEMS_RECORD_INTERRUPT_EXIT, and
+ * RTEMS_RECORD_PER_CPU_OVERFLOW events.  Other events are ignored.
+ *
+ * @param bt The bintime of the record item.
+ * @param cpu The processor index of the record item.
+ * @param event The event of the record item.
+ * @param data The data of the record item.
+ * @param arg The function profile context.
+ *
+ * @retval RTEMS_RECORD_CLIENT_SUCCESS Successful operation.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU The processor index was
+ *   out of range.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY There was not enough memory to
+ *   extend the call tree or a call stack.
+ */
+rtems_record_client_status rtems_record_client_function_process(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+);
+
+/**
+ * @brief Visits the nodes of the call tree in depth-first order.
+ *
+ * The callees of a node are visited in the order of their first call.  The
+ * root node is not visited.
+ *
+ * @param ctx The function profile context.
+ * @param visitor The visitor function.
+ * @param arg The visitor argument.
+ */
+void rtems_record_client_function_visit_call_tree(
+  const rtems_record_client_function_context *ctx,
+  rtems_record_client_function_visitor        visitor,
+  void                                       *arg
+);
+
+/**
+ * @brief Visits the nodes of the flat function profile in an unspecified
+ * order.
+ *
+ * @param ctx The function profile context.
+ * @param visitor The visitor function.
+ * @param arg The visitor argument.
+ */
+void rtems_record_client_function_visit_functions(
+  const rtems_record_client_function_context *ctx,
+  rtems_record_client_function_visitor        visitor,
+  void                                       *arg
+);
+
+/**
+ * @brief Frees the resources of the function profile.
+ *
+ * Calls which are still active are not accounted.
+ *
+ * @param ctx The function profile context.
+ */
+void rtems_record_client_function_destroy(
+  rtems_record_client_function_context *ctx
+);
+
+/**
+ * @brief Resolves a program counter to the start address of its function.
+ *
+ * @param pc The program counter of a sample or a caller.
+ * @param arg The resolver argument.
+ *
+ * @return The start address of the function containing the program counter.
+ */
+typedef uint64_t ( *rtems_record_client_sample_resolver )(
+  uint64_t  pc,
+  void     *arg
+);
+
+/**
+ * @brief An entry of the program counter sample histograms.
+ */
+typedef struct rtems_record_client_sample_node {
+  /**
+   * @brief The next node in the same hash bucket.
+   */
+  struct rtems_record_client_sample_node *next;
+
+  /**
+   * @brief The resolved function address or the thread identifier.
+   */
+  uint64_t key;
+
+  /**
+   * @brief The count of samples with the program counter in this function or
+   * of samples of this thread.
+   */
+  uint64_t self;
+
+  /**
+   * @brief The count of samples with this function either as the program
+   * counter or in the backtrace.
+   *
+   * For the thread histogram, this member is equal to the self member.
+   */
+  uint64_t total;
+} rtems_record_client_sample_node;
+
+#define RTEMS_RECORD_CLIENT_SAMPLE_FRAME_MAXIMUM 32
+
+/**
+ * @brief The program counter sample context.
+ *
+ * The samples are produced by the program counter sampling of the target, see
+ * rtems_record_sampler_start().
+ */
+typedef struct {
+  /**
+   * @brief The resolver of program counters to functions.
+   */
+  rtems_record_client_sample_resolver resolve;
+
+  /**
+   * @brief The resolver argument.
+   */
+  void *resolve_arg;
+
+  /**
+   * @brief The hash buckets of the function histogram.
+   */
+  rtems_record_client_sample_node *
+    functions[ RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE ];
+
+  /**
+   * @brief The hash buckets of the thread histogram.
+   */
+  rtems_record_client_sample_node *
+    threads[ RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE ];
+
+  /**
+   * @brief The functions of the current sample of each processor.
+   *
+   * This is used to count a function only once for the total histogram in
+   * case of recursion.
+   */
+  struct {
+    uint64_t frames[ RTEMS_RECORD_CLIENT_SAMPLE_FRAME_MAXIMUM ];
+    uint32_t frame_count;
+  } per_cpu[ RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT ];
+
+  /**
+   * @brief The count of samples.
+   */
+  uint64_t sample_count;
+} rtems_record_client_sample_context;
+
+/**
+ * @brief Visits an entry of the program counter sample histograms.
+ *
+ * @param node The visited node.
+ * @param arg The visitor argument.
+ */
+typedef void ( *rtems_record_client_sample_visitor )(
+  const rtems_record_client_sample_node *node,
+  void                                  *arg
+);
+
+/**
+ * @brief Initializes a program counter sample context.
+ *
+ * @param ctx The sample context to initialize.
+ * @param resolve The resolver to map program counters to functions.  It may
+ *   be NULL, in this case the histogram is built for the program counters.
+ *   The resolver is not called for program counters of value zero, these
+ *   denote samples without an available interrupted context.
+ * @param arg The resolver argument.
+ */
+void rtems_record_client_sample_init(
+  rtems_record_client_sample_context  *ctx,
+  rtems_record_client_sample_resolver  resolve,
+  void                                *arg
+);
+
+/**
+ * @brief Processes a record item for the program counter sample histograms.
+ *
+ * This function may be used as the record client handler, see
+ * rtems_record_client_init(), or it may be called by a record client handler.
+ * It uses the RTEMS_RECORD_SAMPLE_PC, RTEMS_RECORD_SAMPLE_THREAD, and
+ * RTEMS_RECORD_SAMPLE_CALLER events.  Other events are ignored.
+ *
+ * @param bt The bintime of the record item.
+ * @param cpu The processor index of the record item.
+ * @param event The event of the record item.
+ * @param data The data of the record item.
+ * @param arg The sample context.
+ *
+ * @retval RTEMS_RECORD_CLIENT_SUCCESS Successful operation.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU The processor index was
+ *   out of range.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY There was not enough memory to
+ *   extend a histogram.
+ */
+rtems_record_client_status rtems_record_client_sample_process(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+);
+
+/**
+ * @brief Visits the entries of the function histogram in an unspecified
+ * order.
+ *
+ * @param ctx The sample context.
+ * @param visitor The visitor function.
+ * @param arg The visitor argument.
+ */
+void rtems_record_client_sample_visit_functions(
+  const rtems_record_client_sample_context *ctx,
+  rtems_record_client_sample_visitor        visitor,
+  void                                     *arg
+);
+
+/**
+ * @brief Visits the entries of the thread histogram in an unspecified order.
+ *
+ * @param ctx The sample context.
+ * @param visitor The visitor function.
+ * @param arg The visitor argument.
+ */
+void rtems_record_client_sample_visit_threads(
+  const rtems_record_client_sample_context *ctx,
+  rtems_record_client_sample_visitor        visitor,
+  void                                     *arg
+);
+
+/**
+ * @brief Frees the resources of the program counter sample context.
+ *
+ * @param ctx The sample context.
+ */
+void rtems_record_client_sample_destroy(
+  rtems_record_client_sample_context *ctx
+);
+
+#define RTEMS_RECORD_CLIENT_SCHED_NAME_SIZE 32
+
+/**
+ * @brief The scheduling state of a thread in the scheduling analysis.
+ */
+typedef enum {
+  /**
+   * @brief The state of the thread is not known.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_UNKNOWN,
+
+  /**
+   * @brief The thread executes on a processor.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_EXECUTING,
+
+  /**
+   * @brief The thread is ready to execute but is not executing.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_READY,
+
+  /**
+   * @brief The thread is blocked.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_BLOCKED
+} rtems_record_client_sched_state;
+
+/**
+ * @brief A thread of the scheduling analysis.
+ *
+ * All times are in the bintime format of the record client handler, see
+ * rtems_record_client_bintime_to_nanoseconds().
+ */
+typedef struct rtems_record_client_sched_thread {
+  /**
+   * @brief The next thread in the same hash bucket.
+   */
+  struct rtems_record_client_sched_thread *next;
+
+  /**
+   * @brief The next thread waiting for a resource.
+   */
+  struct rtems_record_client_sched_thread *next_waiter;
+
+  /**
+   * @brief The thread identifier.
+   */
+  uint64_t id;
+
+  /**
+   * @brief The thread name reported by the RTEMS_RECORD_THREAD_NAME events.
+   */
+  char name[ RTEMS_RECORD_CLIENT_SCHED_NAME_SIZE ];
+
+  /**
+   * @brief The length of the thread name.
+   */
+  size_t name_length;
+
+  /**
+   * @brief The current priority of the thread.
+   *
+   * This member is only valid if the priority_known member is true.
+   */
+  uint64_t priority;
+
+  /**
+   * @brief If true, then the current priority of the thread is known.
+   */
+  bool priority_known;
+
+  /**
+   * @brief If true, then the thread blocked since it started to execute.
+   */
+  bool blocking;
+
+  /**
+   * @brief If true, then the thread waits for the resource specified by the
+   * wait_resource member.
+   */
+  bool waiting;
+
+  /**
+   * @brief The scheduling state of the thread.
+   */
+  rtems_record_client_sched_state state;
+
+  /**
+   * @brief The processor index of the processor which executes or executed
+   * the thread most recently.
+   */
+  uint32_t cpu;
+
+  /**
+   * @brief The begin of the ready state.
+   */
+  uint64_t ready_bt;
+
+  /**
+   * @brief The resource for which the thread waits.
+   */
+  uint64_t wait_resource;
+
+  /**
+   * @brief The time the thread executed.
+   */
+  uint64_t run_time;
+
+  /**
+   * @brief The count of thread switches to this thread.
+   */
+  uint64_t switch_in_count;
+
+  /**
+   * @brief The count of intervals in which the thread was ready to execute
+   * but did not execute.
+   */
+  uint64_t ready_count;
+
+  /**
+   * @brief The total time the thread was ready to execute but did not
+   * execute.
+   */
+  uint64_t total_ready_latency;
+
+  /**
+   * @brief The maximum time the thread was ready to execute but did not
+   * execute.
+   */
+  uint64_t max_ready_latency;
+
+  /**
+   * @brief The count of detected priority inversions while this thread
+   * waited for a resource.
+   */
+  uint64_t inversion_count;
+} rtems_record_client_sched_thread;
+
+/**
+ * @brief The kind of a scheduling analysis segment.
+ */
+typedef enum {
+  /**
+   * @brief The thread executed on the processor in the segment.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_SEGMENT_EXECUTE,
+
+  /**
+   * @brief The thread was ready to execute but did not execute in the
+   * segment.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_SEGMENT_READY,
+
+  /**
+   * @brief A priority inversion was detected at the begin of the segment.
+   *
+   * The thread waits for a resource owned by the owner thread.  The owner is
+   * ready to execute but the runner thread with a lower priority than the
+   * thread starts to execute on the processor.  The begin and end of the
+   * segment are equal.
+   */
+  RTEMS_RECORD_CLIENT_SCHED_SEGMENT_INVERSION
+} rtems_record_client_sched_segment_kind;
+
+/**
+ * @brief A segment of the scheduling timeline.
+ */
+typedef struct {
+  /**
+   * @brief The segment kind.
+   */
+  rtems_record_client_sched_segment_kind kind;
+
+  /**
+   * @brief The thread of the segment.
+   */
+  const rtems_record_client_sched_thread *thread;
+
+  /**
+   * @brief The resource owner for segments of the
+   * RTEMS_RECORD_CLIENT_SCHED_SEGMENT_INVERSION kind, otherwise NULL.
+   */
+  const rtems_record_client_sched_thread *owner;
+
+  /**
+   * @brief The executing thread with a lower priority for segments of the
+   * RTEMS_RECORD_CLIENT_SCHED_SEGMENT_INVERSION kind, otherwise NULL.
+   */
+  const rtems_record_client_sched_thread *runner;
+
+  /**
+   * @brief The processor index of the segment.
+   */
+  uint32_t cpu;
+
+  /**
+   * @brief The begin of the segment.
+   */
+  uint64_t begin;
+
+  /**
+   * @brief The end of the segment.
+   */
+  uint64_t end;
+} rtems_record_client_sched_segment;
+
+/**
+ * @brief Handles a segment of the scheduling timeline.
+ *
+ * @param segment The segment.
+ * @param arg The handler argument.
+ */
+typedef void ( *rtems_record_client_sched_segment_handler )(
+  const rtems_record_client_sched_segment *segment,
+  void                                    *arg
+);
+
+typedef struct rtems_record_client_sched_resource
+  rtems_record_client_sched_resource;
+
+/**
+ * @brief The scheduling analysis context.
+ *
+ * The scheduling analysis processes the record items in a streaming fashion.
+ * The timeline segments are passed to a handler once they are complete.  The
+ * memory usage depends only on the count of threads and resources.  It does
+ * not depend on the length of the record item stream.
+ *
+ * The analysis uses the following events.  The record extensions, see
+ * CONFIGURE_RECORD_EXTENSIONS_ENABLED, produce all of them except the
+ * resource obtain and release events.
+ *
+ * - RTEMS_RECORD_THREAD_SWITCH_OUT and RTEMS_RECORD_THREAD_SWITCH_IN with the
+ *   thread identifier to build the timeline and the processor utilization.
+ *   Threads of the internal object API, for example the idle threads, are
+ *   accounted as idle time.
+ *
+ * - RTEMS_RECORD_THREAD_ID, RTEMS_RECORD_THREAD_CREATE, and
+ *   RTEMS_RECORD_THREAD_SWITCH_IN with the thread identifier select the thread
+ *   for the following RTEMS_RECORD_THREAD_NAME,
+ *   RTEMS_RECORD_THREAD_PRIO_CURRENT_HIGH, and
+ *   RTEMS_RECORD_THREAD_PRIO_CURRENT_LOW events of the same processor.  The
+ *   record extensions produce the current priority of the heir thread after
+ *   each thread switch in.
+ *
+ * - RTEMS_RECORD_THREAD_STATE_CLEAR with the thread identifier indicates that
+ *   the thread is ready to execute, RTEMS_RECORD_THREAD_STATE_SET with the
+ *   thread identifier indicates that the thread blocks.  The record
+ *   extensions produce one of them for the executing thread right before its
+ *   thread switch out.  Once these events are present in the stream, a thread
+ *   switched out without a block is considered as preempted and thus ready to
+ *   execute.  The ready latency is the time from the begin of the ready state
+ *   to the next thread switch to the thread.  Since the unblock of a thread is
+ *   not recorded, the ready latency covers only preempted threads for streams
+ *   of the record extensions.
+ *
+ * - RTEMS_RECORD_THREAD_RESOURCE_OBTAIN and
+ *   RTEMS_RECORD_THREAD_RESOURCE_RELEASE with a resource identifier for the
+ *   executing thread of the processor to track the resource owners, and
+ *   RTEMS_RECORD_THREAD_QUEUE_ENQUEUE with a resource identifier for the
+ *   executing thread which starts to wait for the resource.  The wait ends
+ *   with the next thread switch to the waiting thread.  The record extensions
+ *   produce the thread queue enqueue event with the thread queue address
+ *   right before the thread switch out of a thread which blocks on a thread
+ *   queue.
+ *
+ * - RTEMS_RECORD_THREAD_QUEUE_OWNER with the thread identifier of the owner
+ *   of the resource for which the executing thread of the processor waits.
+ *   The record extensions produce it after the thread queue enqueue event.
+ *   An identifier of zero indicates that the resource has no owner.
+ *
+ * - RTEMS_RECORD_PER_CPU_OVERFLOW to discard the state of the processor.
+ */
+typedef struct {
+  /**
+   * @brief The segment handler.
+   */
+  rtems_record_client_sched_segment_handler handler;
+
+  /**
+   * @brief The segment handler argument.
+   */
+  void *handler_arg;
+
+  /**
+   * @brief The hash buckets of the threads.
+   */
+  rtems_record_client_sched_thread *
+    threads[ RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE ];
+
+  /**
+   * @brief The hash buckets of the resources.
+   */
+  rtems_record_client_sched_resource *
+    resources[ RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE ];
+
+  /**
+   * @brief The threads waiting for a resource.
+   */
+  rtems_record_client_sched_thread *waiters;
+
+  struct {
+    /**
+     * @brief The thread executing on the processor.
+     */
+    rtems_record_client_sched_thread *executing;
+
+    /**
+     * @brief The begin of the execution of the executing thread.
+     */
+    uint64_t switch_in_bt;
+
+    /**
+     * @brief The thread selected by the last RTEMS_RECORD_THREAD_ID or
+     * RTEMS_RECORD_THREAD_CREATE event of the processor.
+     */
+    rtems_record_client_sched_thread *selected;
+
+    /**
+     * @brief The upper bits of the priority of the last
+     * RTEMS_RECORD_THREAD_PRIO_CURRENT_HIGH event.
+     */
+    uint64_t priority_high;
+
+    /**
+     * @brief If true, then the priority inversion check for the thread
+     *   switched in most recently is pending.
+     */
+    bool check_inversion;
+
+    /**
+     * @brief The time the processor executed threads other than the idle
+     * threads.
+     */
+    uint64_t busy_time;
+
+    /**
+     * @brief The time the processor executed idle threads.
+     */
+    uint64_t idle_time;
+
+    /**
+     * @brief The time of the first item of the processor.
+     *
+     * The processor utilization is the busy time divided by the time
+     * interval between the first and the last item.
+     */
+    uint64_t first_bt;
+
+    /**
+     * @brief The time of the last item of the processor.
+     */
+    uint64_t last_bt;
+
+    /**
+     * @brief If true, then at least one item of the processor was processed.
+     */
+    bool active;
+  } per_cpu[ RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT ];
+
+  /**
+   * @brief If true, then the stream contains thread state events.
+   */
+  bool state_events;
+
+  /**
+   * @brief The count of detected priority inversions.
+   */
+  uint64_t inversion_count;
+
+  /**
+   * @brief The count of ring buffer overflows.
+   */
+  uint64_t overflow_count;
+} rtems_record_client_sched_context;
+
+/**
+ * @brief Visits a thread of the scheduling analysis.
+ *
+ * @param thread The visited thread.
+ * @param arg The visitor argument.
+ */
+typedef void ( *rtems_record_client_sched_visitor )(
+  const rtems_record_client_sched_thread *thread,
+  void                                   *arg
+);
+
+/**
+ * @brief Initializes a scheduling analysis context.
+ *
+ * @param ctx The scheduling analysis context to initialize.
+ * @param handler The handler for the segments of the scheduling timeline.  It
+ *   may be NULL.
+ * @param arg The handler argument.
+ */
+void rtems_record_client_sched_init(
+  rtems_record_client_sched_context         *ctx,
+  rtems_record_client_sched_segment_handler  handler,
+  void                                      *arg
+);
+
+/**
+ * @brief Processes a record item for the scheduling analysis.
+ *
+ * This function may be used as the record client handler, see
+ * rtems_record_client_init(), or it may be called by a record client handler.
+ *
+ * @param bt The bintime of the record item.
+ * @param cpu The processor index of the record item.
+ * @param event The event of the record item.
+ * @param data The data of the record item.
+ * @param arg The scheduling analysis context.
+ *
+ * @retval RTEMS_RECORD_CLIENT_SUCCESS Successful operation.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU The processor index was
+ *   out of range.
+ *
+ * @retval RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY There was not enough memory to
+ *   add a thread or resource.
+ */
+rtems_record_client_status rtems_record_client_sched_process(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+);
+
+/**
+ * @brief Finishes the execution segments of all processors at the time of
+ * the last item of the processor.
+ *
+ * Call this function after the last record item was processed.
+ *
+ * @param ctx The scheduling analysis context.
+ */
+void rtems_record_client_sched_finish(
+  rtems_record_client_sched_context *ctx
+);
+
+/**
+ * @brief Visits the threads of the scheduling analysis in an unspecified
+ * order.
+ *
+ * @param ctx The scheduling analysis context.
+ * @param visitor The visitor function.
+ * @param arg The visitor argument.
+ */
+void rtems_record_client_sched_visit_threads(
+  const rtems_record_client_sched_context *ctx,
+  rtems_record_client_sched_visitor        visitor,
+  void                                    *arg
+);
+
+/**
+ * @brief Frees the resources of the scheduling analysis context.
+ *
+ * @param ctx The scheduling analysis context.
+ */
+void rtems_record_client_sched_destroy(
+  rtems_record_client_sched_context *ctx
+);
+
+/**
+ * @brief The Chrome trace event format writer context.
+ *
+ * The writer produces a JSON array of trace events which can be loaded by
+ * the Chrome trace viewer and Perfetto.  The execution segments are shown
+ * per processor, the ready segments per thread.
+ */
+typedef struct {
+  /**
+   * @brief The output file.
+   */
+  FILE *file;
+
+  /**
+   * @brief The count of written trace events.
+   */
+  uint64_t count;
+} rtems_record_client_chrome_context;
+
+/**
+ * @brief Initializes a Chrome trace event format writer and writes the
+ * beginning of the trace.
+ *
+ * @param ctx The writer context to initialize.
+ * @param file The output file.
+ */
+void rtems_record_client_chrome_begin(
+  rtems_record_client_chrome_context *ctx,
+  FILE                               *file
+);
+
+/**
+ * @brief Writes a segment of the scheduling timeline as a trace event.
+ *
+ * This function may be used as the segment handler of the scheduling
+ * analysis, see rtems_record_client_sched_init().
+ *
+ * @param segment The segment to write.
+ * @param arg The writer context.
+ */
+void rtems_record_client_chrome_segment(
+  const rtems_record_client_sched_segment *segment,
+  void                                    *arg
+);
+
+/**
+ * @brief Writes a record item as an instant trace event.
+ *
+ * The event name is provided by rtems_record_event_text().
+ *
+ * @param ctx The writer context.
+ * @param bt The bintime of the record item.
+ * @param cpu The processor index of the record item.
+ * @param event The event of the record item.
+ * @param data The data of the record item.
+ */
+void rtems_record_client_chrome_instant(
+  rtems_record_client_chrome_context *ctx,
+  uint64_t                            bt,
+  uint32_t                            cpu,
+  rtems_record_event                  event,
+  uint64_t                            data
+);
+
+/**
+ * @brief Writes the end of the trace.
+ *
+ * @param ctx The writer context.
+ */
+void rtems_record_client_chrome_end(
+  rtems_record_client_chrome_context *ctx
+);
+
 /** @} */
 
 #ifdef __cplusplus
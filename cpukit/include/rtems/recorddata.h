@@ -55,7 +55,7 @@ extern "C" {
  * The record version reflects the record event definitions.  It is reported by
  * the RTEMS_RECORD_VERSION event.
  */
-#define RTEMS_RECORD_THE_VERSION 9
+#define RTEMS_RECORD_THE_VERSION 12
 
 /**
  * @brief The items are in 32-bit little-endian format.
@@ -182,6 +182,13 @@ typedef enum {
   RTEMS_RECORD_KEVENT_EXIT,
   RTEMS_RECORD_KQUEUE_ENTRY,
   RTEMS_RECORD_KQUEUE_EXIT,
+  RTEMS_RECORD_LATENCY_BEGIN,
+  RTEMS_RECORD_LATENCY_DURATION,
+  RTEMS_RECORD_LATENCY_END,
+  RTEMS_RECORD_LATENCY_EXECUTING,
+  RTEMS_RECORD_LATENCY_KIND,
+  RTEMS_RECORD_LATENCY_LOCK_NAME,
+  RTEMS_RECORD_LATENCY_PROCESSOR,
   RTEMS_RECORD_LENGTH,
   RTEMS_RECORD_LINE,
   RTEMS_RECORD_LINK_ENTRY,
@@ -281,6 +288,9 @@ typedef enum {
   RTEMS_RECORD_RTEMS_TIMER_RESET,
   RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_AFTER,
   RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_WHEN,
+  RTEMS_RECORD_SAMPLE_CALLER,
+  RTEMS_RECORD_SAMPLE_PC,
+  RTEMS_RECORD_SAMPLE_THREAD,
   RTEMS_RECORD_SBWAIT_ENTRY,
   RTEMS_RECORD_SBWAIT_EXIT,
   RTEMS_RECORD_SBWAKEUP_ENTRY,
@@ -385,8 +395,13 @@ typedef enum {
   RTEMS_RECORD_THREAD_QUEUE_ID,
   RTEMS_RECORD_THREAD_QUEUE_INITIALIZE,
   RTEMS_RECORD_THREAD_QUEUE_NAME,
+  RTEMS_RECORD_THREAD_QUEUE_OWNER,
   RTEMS_RECORD_THREAD_QUEUE_SURRENDER,
   RTEMS_RECORD_THREAD_QUEUE_SURRENDER_STICKY,
+  RTEMS_RECORD_THREAD_QUEUE_WAIT_BUCKET,
+  RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT,
+  RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME,
+  RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME_MAX,
   RTEMS_RECORD_THREAD_RESOURCE_OBTAIN,
   RTEMS_RECORD_THREAD_RESOURCE_RELEASE,
   RTEMS_RECORD_THREAD_RESTART,
@@ -437,21 +452,6 @@ typedef enum {
   RTEMS_RECORD_WRITEV_EXIT,
 
   /* Unused system events */
-  RTEMS_RECORD_SYSTEM_341,
-  RTEMS_RECORD_SYSTEM_342,
-  RTEMS_RECORD_SYSTEM_343,
-  RTEMS_RECORD_SYSTEM_344,
-  RTEMS_RECORD_SYSTEM_345,
-  RTEMS_RECORD_SYSTEM_346,
-  RTEMS_RECORD_SYSTEM_347,
-  RTEMS_RECORD_SYSTEM_348,
-  RTEMS_RECORD_SYSTEM_349,
-  RTEMS_RECORD_SYSTEM_350,
-  RTEMS_RECORD_SYSTEM_351,
-  RTEMS_RECORD_SYSTEM_352,
-  RTEMS_RECORD_SYSTEM_353,
-  RTEMS_RECORD_SYSTEM_354,
-  RTEMS_RECORD_SYSTEM_355,
   RTEMS_RECORD_SYSTEM_356,
   RTEMS_RECORD_SYSTEM_357,
   RTEMS_RECORD_SYSTEM_358,
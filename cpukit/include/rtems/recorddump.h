@@ -55,6 +55,20 @@ typedef void ( *rtems_record_dump_chunk )(
   size_t      length
 );
 
+/**
+ * @brief Dumps the record header and the thread names.
+ *
+ * This is the start of a record stream.  The items of the processors may
+ * follow, for example through rtems_record_drain().
+ *
+ * @param chunk Handler to dump a chunk of data.
+ * @param arg The argument for the handler.
+ */
+void rtems_record_dump_header(
+  rtems_record_dump_chunk  chunk,
+  void                    *arg
+);
+
 /**
  * @brief Dumps the record header, the thread names, and all items of all
  * processors.
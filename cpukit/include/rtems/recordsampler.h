@@ -0,0 +1,166 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RECORDSAMPLER_H
+#define _RTEMS_RECORDSAMPLER_H
+
+#include "recorddata.h"
+
+#include <rtems.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSRecord
+ *
+ * @{
+ */
+
+/**
+ * @brief The maximum count of callers recorded for a sample.
+ */
+#define RTEMS_RECORD_SAMPLER_BACKTRACE_MAXIMUM 16
+
+/**
+ * @brief Starts the program counter sampling on all processors.
+ *
+ * Each processor samples its interrupted context every interval clock ticks
+ * through a watchdog.  A sample consists of one RTEMS_RECORD_SAMPLE_PC item
+ * with the interrupted program counter, one RTEMS_RECORD_SAMPLE_THREAD item
+ * with the identifier of the executing thread, and up to backtrace_depth
+ * RTEMS_RECORD_SAMPLE_CALLER items with the return addresses found through
+ * the frame pointer chain of the interrupted context.
+ *
+ * The interrupted context is obtained through
+ * _Record_Sampler_Get_interrupted_context().  If it is not available for a
+ * sample, then the program counter of the sample is zero and there are no
+ * callers.
+ *
+ * @param interval The sample interval in clock ticks.
+ * @param backtrace_depth The maximum count of callers for each sample.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_INCORRECT_STATE The record support is not configured.
+ *
+ * @retval RTEMS_NOT_IMPLEMENTED There is no implementation of
+ *   _Record_Sampler_Get_interrupted_context() for this architecture and the
+ *   BSP provides none.
+ *
+ * @retval RTEMS_INVALID_NUMBER The interval was zero or the backtrace depth
+ *   was greater than RTEMS_RECORD_SAMPLER_BACKTRACE_MAXIMUM.
+ *
+ * @retval RTEMS_RESOURCE_IN_USE The sampling was already started.
+ */
+rtems_status_code rtems_record_sampler_start(
+  uint32_t interval,
+  uint32_t backtrace_depth
+);
+
+/**
+ * @brief Stops the program counter sampling on all processors.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ *
+ * @retval RTEMS_INCORRECT_STATE The sampling was not started.
+ */
+rtems_status_code rtems_record_sampler_stop( void );
+
+/**
+ * @brief Checks if the program counter sampling is started.
+ *
+ * @retval true The sampling is started.
+ *
+ * @retval false Otherwise.
+ */
+bool rtems_record_sampler_is_running( void );
+
+/**
+ * @brief Gets the count of samples produced on the processor.
+ *
+ * The count includes the samples of rtems_record_sampler_sample() calls.
+ *
+ * @param cpu_index The processor index.
+ *
+ * @return The count of samples.
+ */
+uint32_t rtems_record_sampler_get_sample_count( uint32_t cpu_index );
+
+/**
+ * @brief Produces a sample of the interrupted context.
+ *
+ * This function may be used by the interrupt handler of a dedicated sample
+ * timer.  It must be called in interrupt context or with interrupts disabled
+ * and the record support must be configured.
+ *
+ * The backtrace is limited to the backtrace depth of the last
+ * rtems_record_sampler_start().  The frame records are only followed while
+ * they are inside the stack of the executing thread or the interrupt stack of
+ * the current processor.  Supported are the frame record layouts with the
+ * caller frame pointer followed by the return address at the frame pointer
+ * (for example AArch64, x86) or directly below the frame pointer (RISC-V).
+ * On other architectures, the frame pointer shall be zero.
+ *
+ * @param pc The interrupted program counter.
+ * @param frame_pointer The frame pointer of the interrupted context, or zero
+ *   if no backtrace shall be recorded.
+ */
+void rtems_record_sampler_sample( uintptr_t pc, uintptr_t frame_pointer );
+
+/**
+ * @brief Gets the interrupted context of the current interrupt.
+ *
+ * This function is called by the clock tick driven sampling.  On AArch64
+ * (LP64), the implementation uses the interrupt context saved on the thread
+ * stack by the outer-most interrupt and the frame record chain on the
+ * interrupt stack.  The frame pointers shall not be omitted to get a
+ * backtrace.  On other architectures, there is no implementation and
+ * rtems_record_sampler_start() returns RTEMS_NOT_IMPLEMENTED.  A BSP may
+ * provide an implementation based on the interrupt frame saved by its
+ * interrupt entry code.
+ *
+ * @param[out] pc The interrupted program counter.
+ * @param[out] frame_pointer The frame pointer of the interrupted context.
+ *
+ * @retval true The interrupted context was returned.
+ *
+ * @retval false The interrupted context is not available.
+ */
+bool _Record_Sampler_Get_interrupted_context(
+  uintptr_t *pc,
+  uintptr_t *frame_pointer
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_RECORDSAMPLER_H */
@@ -0,0 +1,204 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RECORDSINK_H
+#define _RTEMS_RECORDSINK_H
+
+#include "recorddata.h"
+
+#include <sys/types.h>
+#include <rtems.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSRecord
+ *
+ * @{
+ */
+
+/**
+ * @brief The record sink configuration.
+ *
+ * @see rtems_record_sink_start().
+ */
+typedef struct {
+  /**
+   * @brief The path of the storage.
+   *
+   * In case the path denotes a block device, then the record stream is written
+   * to file_count consecutive regions of file_size bytes on the block device.
+   * Otherwise, the record stream is written to the files
+   * <path>.0, <path>.1, ..., <path>.<file_count - 1>.  The files and regions
+   * are used round-robin.  Each file and region starts with a record stream
+   * header and the thread names, so it can be processed on its own.  The
+   * unused remainder of a region is zero-filled.
+   */
+  const char *path;
+
+  /**
+   * @brief The count of files or regions in the set.
+   *
+   * A value of zero is treated as one.
+   */
+  uint32_t file_count;
+
+  /**
+   * @brief The size in bytes of a file or region.
+   *
+   * The sink switches to the next file or region after a drain in case the
+   * current one reached this size, so files may be slightly larger.  A value
+   * of zero disables the rotation for files.  For block devices, a value of
+   * zero divides the block device evenly into file_count regions.
+   */
+  size_t file_size;
+
+  /**
+   * @brief The drain period in clock ticks.
+   *
+   * The sink drains immediately again if a drain found a per-processor ring
+   * buffer more than half full.  A value of zero (RTEMS_NO_TIMEOUT) drains
+   * only on request through rtems_record_sink_flush().
+   */
+  rtems_interval period;
+
+  /**
+   * @brief The zlib compression level.
+   *
+   * A value of zero disables the compression.  Each file and region is a
+   * separate zlib stream.
+   */
+  int compression_level;
+
+  /**
+   * @brief The size in bytes of the write buffer.
+   *
+   * A value of zero selects a default size.  For block devices it should be a
+   * multiple of the block size.
+   */
+  size_t buffer_size;
+} rtems_record_sink_config;
+
+/**
+ * @brief The record sink statistics.
+ *
+ * @see rtems_record_sink_get_statistics().
+ */
+typedef struct {
+  /**
+   * @brief The count of drained items.
+   */
+  uint64_t drained_items;
+
+  /**
+   * @brief The count of bytes written to the storage.
+   */
+  uint64_t written_bytes;
+
+  /**
+   * @brief The count of per-processor drains which found an overflow of the
+   * ring buffer.
+   */
+  uint64_t overflows;
+
+  /**
+   * @brief The count of items lost due to ring buffer overflows.
+   */
+  uint64_t lost_items;
+
+  /**
+   * @brief The count of switches to the next file or region.
+   */
+  uint32_t rotations;
+
+  /**
+   * @brief The first error number of a failed storage operation or zero.
+   */
+  int error;
+} rtems_record_sink_statistics;
+
+/**
+ * @brief Starts the record sink task which continuously drains the record
+ * items of all processors to files or a block device.
+ *
+ * There is at most one record sink.
+ *
+ * @param config The record sink configuration.  The path is copied.
+ * @param priority The task priority.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The configuration or path was NULL.
+ * @retval RTEMS_INCORRECT_STATE The record sink is already running.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the sink.
+ * @retval RTEMS_INVALID_SIZE The regions do not fit onto the block device or
+ *   are too small for the record item capacity of all processors.
+ * @retval RTEMS_IO_ERROR The first file or the block device could not be
+ *   opened or a zlib error occurred.
+ */
+rtems_status_code rtems_record_sink_start(
+  const rtems_record_sink_config *config,
+  rtems_task_priority             priority
+);
+
+/**
+ * @brief Stops the record sink task.
+ *
+ * The sink drains all items, finishes the current file or region, and
+ * synchronizes it with the storage before the task terminates.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The record sink is not running.
+ */
+rtems_status_code rtems_record_sink_stop( void );
+
+/**
+ * @brief Requests an immediate drain of the record sink.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The record sink is not running.
+ */
+rtems_status_code rtems_record_sink_flush( void );
+
+/**
+ * @brief Gets the record sink statistics.
+ *
+ * The statistics of the last record sink are available after
+ * rtems_record_sink_stop().
+ *
+ * @param[out] stats The record sink statistics.
+ */
+void rtems_record_sink_get_statistics( rtems_record_sink_statistics *stats );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_RECORDSINK_H */
@@ -40,6 +40,47 @@ extern "C" {
  */
 typedef uint32_t   ISR_Level;
 
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief Starts an interrupts disabled section for the latency tracer if the
+ *   interrupts were enabled in the previous interrupt level.
+ *
+ * @param level The previous interrupt level.
+ */
+void _Latency_trace_ISR_disable( ISR_Level level );
+
+/**
+ * @brief Ends an interrupts disabled section for the latency tracer if the
+ *   interrupts are enabled in the interrupt level to restore.
+ *
+ * @param level The interrupt level to restore.
+ */
+void _Latency_trace_ISR_enable( ISR_Level level );
+
+/**
+ * @brief Ends an interrupts disabled section for the latency tracer if the
+ *   new interrupt level enables all interrupts.
+ *
+ * @param new_level The new interrupt level.
+ */
+void _Latency_trace_ISR_set_level( uint32_t new_level );
+
+#define _ISR_Latency_trace_disable( _level ) \
+  _Latency_trace_ISR_disable( _level )
+
+#define _ISR_Latency_trace_enable( _level ) \
+  _Latency_trace_ISR_enable( _level )
+
+#define _ISR_Latency_trace_set_level( _new_level ) \
+  _Latency_trace_ISR_set_level( _new_level )
+#else
+#define _ISR_Latency_trace_disable( _level ) do { } while ( 0 )
+
+#define _ISR_Latency_trace_enable( _level ) do { } while ( 0 )
+
+#define _ISR_Latency_trace_set_level( _new_level ) do { } while ( 0 )
+#endif
+
 /**
  *  @brief Disables interrupts on this processor.
  *
@@ -57,6 +98,7 @@ typedef uint32_t   ISR_Level;
 #define _ISR_Local_disable( _level ) \
   do { \
     _CPU_ISR_Disable( _level ); \
+    _ISR_Latency_trace_disable( _level ); \
     RTEMS_COMPILER_MEMORY_BARRIER(); \
   } while (0)
 
@@ -74,6 +116,7 @@ typedef uint32_t   ISR_Level;
 #define _ISR_Local_enable( _level ) \
   do { \
     RTEMS_COMPILER_MEMORY_BARRIER(); \
+    _ISR_Latency_trace_enable( _level ); \
     _CPU_ISR_Enable( _level ); \
   } while (0)
 
@@ -99,7 +142,9 @@ typedef uint32_t   ISR_Level;
 #define _ISR_Local_flash( _level ) \
   do { \
     RTEMS_COMPILER_MEMORY_BARRIER(); \
+    _ISR_Latency_trace_enable( _level ); \
     _CPU_ISR_Flash( _level ); \
+    _ISR_Latency_trace_disable( _level ); \
     RTEMS_COMPILER_MEMORY_BARRIER(); \
   } while (0)
 
@@ -140,6 +185,7 @@ typedef uint32_t   ISR_Level;
 #define _ISR_Set_level( _new_level ) \
   do { \
     RTEMS_COMPILER_MEMORY_BARRIER();  \
+    _ISR_Latency_trace_set_level( _new_level ); \
     _CPU_ISR_Set_level( _new_level ); \
     RTEMS_COMPILER_MEMORY_BARRIER();  \
   } while (0)
@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreLatencyTrace
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreLatencyTrace.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_LATENCYTRACE_H
+#define _RTEMS_SCORE_LATENCYTRACE_H
+
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/object.h>
+
+#if defined(RTEMS_PROFILING)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreLatencyTrace Latency Tracer
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the latency tracer implementation.
+ *
+ * The latency tracer records the longest sections with disabled interrupts,
+ * disabled thread dispatching, and held SMP locks of each processor together
+ * with the code addresses which started and ended the sections.  It is part
+ * of the profiling support.
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of sections recorded for each kind and processor.
+ */
+#define LATENCY_TRACE_ENTRY_COUNT 8
+
+/**
+ * @brief Latency trace section kinds.
+ */
+typedef enum {
+  /**
+   * @brief Sections with disabled interrupts.
+   *
+   * The sections start with an _ISR_Local_disable() and end with an
+   * _ISR_Local_enable(), _ISR_Local_flash(), or _ISR_Set_level() which
+   * enable the interrupts.  Interrupt disable and enable sequences of
+   * assembler code are not traced.
+   */
+  LATENCY_TRACE_INTERRUPTS_DISABLED,
+
+  /**
+   * @brief Sections with disabled thread dispatching in thread context.
+   */
+  LATENCY_TRACE_THREAD_DISPATCH_DISABLED,
+
+  /**
+   * @brief Sections with an owned SMP lock, e.g. the per-processor lock.
+   *
+   * This kind is only used in SMP configurations.  In uniprocessor
+   * configurations, the ISR locks just disable interrupts.
+   */
+  LATENCY_TRACE_LOCK_HELD,
+
+  /**
+   * @brief The count of section kinds.
+   */
+  LATENCY_TRACE_KIND_COUNT
+} Latency_trace_Kind;
+
+/**
+ * @brief Latency trace entry.
+ */
+typedef struct {
+  /**
+   * @brief The section duration in CPU counter ticks or zero if the entry is
+   *   unused.
+   */
+  CPU_Counter_ticks duration;
+
+  /**
+   * @brief The code address which started the section.
+   *
+   * This is the return address of the function which started the section.  It
+   * may be NULL, e.g. if the section was started by an interrupt.
+   */
+  const void *begin;
+
+  /**
+   * @brief The code address which ended the section.
+   */
+  const void *end;
+
+  /**
+   * @brief The identifier of the thread executing at the section end or zero.
+   */
+  Objects_Id executing;
+
+  /**
+   * @brief The lock name of a LATENCY_TRACE_LOCK_HELD section or NULL.
+   */
+  const char *name;
+} Latency_trace_Entry;
+
+/**
+ * @brief Records a section.
+ *
+ * The section is recorded on the current processor if it is one of the
+ * longest sections of the kind.  The executing thread is recorded as well.
+ *
+ * @param kind The section kind.
+ * @param duration The section duration in CPU counter ticks.
+ * @param begin The code address which started the section.
+ * @param end The code address which ended the section.
+ * @param name The lock name or NULL.
+ */
+void _Latency_trace_Update(
+  Latency_trace_Kind  kind,
+  CPU_Counter_ticks   duration,
+  const void         *begin,
+  const void         *end,
+  const char         *name
+);
+
+/**
+ * @brief Cancels the interrupts disabled section of the current processor.
+ *
+ * This function shall be called by the outer-most interrupt processing with
+ * interrupts disabled.  An interrupt indicates that the interrupts were
+ * enabled, so that a section started before has ended in code which is not
+ * traced.
+ *
+ * @param cpu_index The index of the current processor.
+ */
+void _Latency_trace_Interrupt_entry( uint32_t cpu_index );
+
+/**
+ * @brief Gets a snapshot of the recorded sections of the processor and kind.
+ *
+ * @param cpu_index The processor index.
+ * @param kind The section kind.
+ * @param[out] entries The recorded sections sorted by decreasing duration.
+ *
+ * @return Returns the count of recorded sections.
+ */
+size_t _Latency_trace_Get(
+  uint32_t             cpu_index,
+  Latency_trace_Kind   kind,
+  Latency_trace_Entry  entries[ LATENCY_TRACE_ENTRY_COUNT ]
+);
+
+/**
+ * @brief Resets the recorded sections of all processors.
+ *
+ * Sections in progress at the reset are still recorded.
+ */
+void _Latency_trace_Reset( void );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTEMS_PROFILING */
+
+#endif /* _RTEMS_SCORE_LATENCYTRACE_H */
@@ -40,7 +40,7 @@ extern "C" {
 
 #if defined( RTEMS_SMP )
   #if defined( RTEMS_PROFILING )
-    #define PER_CPU_CONTROL_SIZE_PROFILING 332
+    #define PER_CPU_CONTROL_SIZE_PROFILING 372
   #else
     #define PER_CPU_CONTROL_SIZE_PROFILING 0
   #endif
@@ -252,6 +252,14 @@ typedef struct {
    */
   CPU_Counter_ticks thread_dispatch_disabled_instant;
 
+  /**
+   * @brief The code address which disabled thread dispatching.
+   *
+   * This value is used by the latency tracer.  It is NULL, if thread
+   * dispatching was disabled by an interrupt.
+   */
+  const void *thread_dispatch_disabled_caller;
+
   /**
    * @brief The maximum time of disabled thread dispatching in CPU counter
    * ticks.
@@ -309,6 +317,42 @@ typedef struct {
    * This value may overflow.
    */
   uint64_t total_interrupt_time;
+
+#if defined( RTEMS_SMP )
+  /**
+   * @brief The instant in CPU counter ticks of the oldest inter-processor
+   * interrupt request to this processor which was not yet received.
+   *
+   * This value is set by the requesting processor.  It is zero, if no request
+   * is pending.
+   */
+  Atomic_Ulong ipi_request_instant;
+
+  /**
+   * @brief The maximum inter-processor interrupt latency in CPU counter ticks.
+   *
+   * This is the time interval between the inter-processor interrupt request
+   * on the requesting processor and the start of the inter-processor interrupt
+   * handler on this processor.  The CPU counters of all processors must be
+   * synchronized to get meaningful values.
+   */
+  CPU_Counter_ticks max_ipi_latency;
+
+  /**
+   * @brief Count of received inter-processor interrupts with a pending
+   * request instant.
+   *
+   * This value may overflow.
+   */
+  uint64_t ipi_count;
+
+  /**
+   * @brief Total inter-processor interrupt latency in CPU counter ticks.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_ipi_latency;
+#endif
 #endif /* defined( RTEMS_PROFILING ) */
 } Per_CPU_Stats;
 
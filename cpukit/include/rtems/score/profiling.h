@@ -24,6 +24,7 @@
 #ifndef _RTEMS_SCORE_PROFILING
 #define _RTEMS_SCORE_PROFILING
 
+#include <rtems/score/latencytrace.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/isrlock.h>
 
@@ -59,6 +60,7 @@ static inline void _Profiling_Thread_dispatch_disable(
     Per_CPU_Stats *stats = &cpu->Stats;
 
     stats->thread_dispatch_disabled_instant = _CPU_Counter_read();
+    stats->thread_dispatch_disabled_caller = RTEMS_RETURN_ADDRESS();
     ++stats->thread_dispatch_disabled_count;
   }
 #else
@@ -89,6 +91,7 @@ static inline void _Profiling_Thread_dispatch_disable_critical(
     Per_CPU_Stats *stats = &cpu->Stats;
 
     stats->thread_dispatch_disabled_instant = lock_context->ISR_disable_instant;
+    stats->thread_dispatch_disabled_caller = RTEMS_RETURN_ADDRESS();
     ++stats->thread_dispatch_disabled_count;
   }
 #else
@@ -126,6 +129,14 @@ static inline void _Profiling_Thread_dispatch_enable(
     if ( stats->max_thread_dispatch_disabled_time < delta ) {
       stats->max_thread_dispatch_disabled_time = delta;
     }
+
+    _Latency_trace_Update(
+      LATENCY_TRACE_THREAD_DISPATCH_DISABLED,
+      delta,
+      stats->thread_dispatch_disabled_caller,
+      RTEMS_RETURN_ADDRESS(),
+      NULL
+    );
   }
 #else
   (void) cpu;
@@ -156,6 +167,74 @@ static inline void _Profiling_Update_max_interrupt_delay(
 #endif
 }
 
+/**
+ * @brief Notes an inter-processor interrupt request to the target processor.
+ *
+ * Only the instant of the oldest pending request is kept, so that the
+ * measured latency covers all requests which are served by one
+ * inter-processor interrupt.
+ *
+ * @param[in, out] cpu_target is the target processor of the request.
+ */
+static inline void _Profiling_Inter_processor_interrupt_request(
+  Per_CPU_Control *cpu_target
+)
+{
+#if defined( RTEMS_PROFILING ) && defined( RTEMS_SMP )
+  unsigned long expected;
+
+  expected = 0;
+  (void) _Atomic_Compare_exchange_ulong(
+    &cpu_target->Stats.ipi_request_instant,
+    &expected,
+    _CPU_Counter_read(),
+    ATOMIC_ORDER_RELAXED,
+    ATOMIC_ORDER_RELAXED
+  );
+#else
+  (void) cpu_target;
+#endif
+}
+
+/**
+ * @brief Updates the inter-processor interrupt latency statistics.
+ *
+ * Must be called at the begin of the inter-processor interrupt handler.
+ *
+ * @param[in, out] cpu_self is the processor control of the processor executing
+ *   this function.
+ */
+static inline void _Profiling_Inter_processor_interrupt_receive(
+  Per_CPU_Control *cpu_self
+)
+{
+#if defined( RTEMS_PROFILING ) && defined( RTEMS_SMP )
+  Per_CPU_Stats     *stats;
+  CPU_Counter_ticks  request_instant;
+
+  stats = &cpu_self->Stats;
+  request_instant = (CPU_Counter_ticks) _Atomic_Exchange_ulong(
+    &stats->ipi_request_instant,
+    0,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( request_instant != 0 ) {
+    CPU_Counter_ticks delta;
+
+    delta = _CPU_Counter_difference( _CPU_Counter_read(), request_instant );
+    ++stats->ipi_count;
+    stats->total_ipi_latency += delta;
+
+    if ( stats->max_ipi_latency < delta ) {
+      stats->max_ipi_latency = delta;
+    }
+  }
+#else
+  (void) cpu_self;
+#endif
+}
+
 /**
  * @brief Updates the interrupt profiling statistics.
  *
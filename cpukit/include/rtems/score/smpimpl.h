@@ -22,6 +22,7 @@
 #include <rtems/score/smp.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/processormask.h>
+#include <rtems/score/profiling.h>
 #include <rtems/fatal.h>
 
 #ifdef __cplusplus
@@ -189,6 +190,8 @@ static inline long unsigned _SMP_Inter_processor_interrupt_handler(
 {
   unsigned long message;
 
+  _Profiling_Inter_processor_interrupt_receive( cpu_self );
+
   /*
    * In the common case the inter-processor interrupt is issued to carry out a
    * thread dispatch.
@@ -23,6 +23,7 @@
 #if defined(RTEMS_SMP)
 
 #include <rtems/score/chain.h>
+#include <rtems/score/latencytrace.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -132,6 +133,13 @@ typedef struct {
    */
   CPU_Counter_ticks acquire_instant;
 
+  /**
+   * @brief The code address which performed the last lock acquire.
+   *
+   * This value is used by the latency tracer.
+   */
+  const void *acquire_caller;
+
   /**
    * @brief The lock stats used for the last lock acquire.
    */
@@ -216,6 +224,7 @@ static inline void _SMP_lock_Stats_acquire_end(
 
   second = _CPU_Counter_read();
   stats_context->acquire_instant = second;
+  stats_context->acquire_caller = RTEMS_RETURN_ADDRESS();
   delta = _CPU_Counter_difference( second, acquire_context->first );
 
   ++stats->usage_count;
@@ -258,6 +267,14 @@ static inline void _SMP_lock_Stats_release_update(
   if ( stats->max_section_time < delta ) {
     _SMP_lock_Stats_register_or_max_section_time( stats, delta );
   }
+
+  _Latency_trace_Update(
+    LATENCY_TRACE_LOCK_HELD,
+    delta,
+    stats_context->acquire_caller,
+    RTEMS_RETURN_ADDRESS(),
+    stats->name
+  );
 }
 
 typedef struct {
@@ -253,6 +253,12 @@ RTEMS_INLINE_ROUTINE void _Thread_Dispatch_request(
   if ( cpu_self == cpu_target ) {
     cpu_self->dispatch_necessary = true;
   } else {
+    /*
+     * Note the request before it is visible, otherwise an inter-processor
+     * interrupt of another processor could serve it before the instant is
+     * recorded.
+     */
+    _Profiling_Inter_processor_interrupt_request( cpu_target );
     _Atomic_Fetch_or_ulong( &cpu_target->message, 0, ATOMIC_ORDER_RELEASE );
     _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu_target ) );
   }
@@ -0,0 +1,296 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQueue
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreThreadQueue related to thread queue statistics.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_THREADQSTATS_H
+#define _RTEMS_SCORE_THREADQSTATS_H
+
+#include <rtems/score/threadq.h>
+
+#if defined(RTEMS_PROFILING)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreThreadQueue
+ *
+ * @{
+ */
+
+/**
+ * @brief The maximum count of thread queues with statistics per processor.
+ *
+ * Each processor maintains its own statistics table which is only updated by
+ * the processor itself with interrupts disabled, so there is no global lock.
+ * The statistics of a thread queue are allocated at the end of its first
+ * contended wait on a processor.  Only a small, fixed count of table entries
+ * is probed for a thread queue.  If none of them is free or belongs to the
+ * thread queue, then the probed entry with the least waits is evicted, see
+ * _Thread_queue_Stats_get_dropped().  The tables of all processors are
+ * aggregated by _Thread_queue_Stats_get().
+ */
+#define THREAD_QUEUE_STATS_MAXIMUM 64
+
+/**
+ * @brief The count of wait time histogram buckets.
+ *
+ * Bucket zero counts the waits shorter than one microsecond.  Bucket N
+ * greater than zero counts the waits in the interval [2^(N - 1), 2^N)
+ * microseconds.  The last bucket counts also all longer waits.
+ */
+#define THREAD_QUEUE_STATS_HISTOGRAM_COUNTS 16
+
+/**
+ * @brief The count of thread queue owners tracked by the statistics.
+ */
+#define THREAD_QUEUE_STATS_OWNER_COUNT 4
+
+/**
+ * @brief The size of the thread queue name buffer of the statistics.
+ */
+#define THREAD_QUEUE_STATS_NAME_SIZE 16
+
+/**
+ * @brief Thread queue owner statistics.
+ */
+typedef struct {
+  /**
+   * @brief The identifier of the owner or zero if the thread queue had no
+   *   owner at the enqueue instant.
+   */
+  Objects_Id id;
+
+  /**
+   * @brief The count of waits blocked on this owner.
+   */
+  uint64_t wait_count;
+
+  /**
+   * @brief The total wait time blocked on this owner in nanoseconds.
+   */
+  uint64_t total_wait_time;
+} Thread_queue_Stats_owner;
+
+/**
+ * @brief Thread queue statistics.
+ *
+ * The wait begin instant is the point in time right before the thread queue
+ * lock release in the enqueue sequence.  The wait end instant is the point in
+ * time right after the thread resumed execution in the enqueue sequence.  The
+ * wait time is the time elapsed between the wait begin and end instants.
+ *
+ * The owners are maintained by the space-saving algorithm.  If an owner is
+ * not in the set and the set is full, then the owner with the lowest wait
+ * count is replaced and the new owner inherits its counts.  Thus, the counts
+ * of an owner are upper bounds, however, the owners which caused the most
+ * waits are always in the set.
+ */
+typedef struct {
+  /**
+   * @brief The thread queue or NULL if this statistics entry is unused.
+   */
+  const Thread_queue_Queue *queue;
+
+  /**
+   * @brief The object identifier of the thread queue or zero if the thread
+   *   queue is not associated with an object.
+   */
+  Objects_Id id;
+
+  /**
+   * @brief The thread queue name.
+   *
+   * It is only set in snapshots obtained by _Thread_queue_Stats_get().  The
+   * name of a deleted object is the name at its last accounted wait if the
+   * object class has no string names, otherwise it is empty.
+   */
+  char name[ THREAD_QUEUE_STATS_NAME_SIZE ];
+
+  /**
+   * @brief This member is true, if the object of the thread queue was deleted,
+   *   otherwise false.
+   *
+   * It is only set in snapshots obtained by _Thread_queue_Stats_get().
+   */
+  bool deleted;
+
+  /**
+   * @brief The maximum wait time in nanoseconds.
+   */
+  uint64_t max_wait_time;
+
+  /**
+   * @brief The count of waits.
+   */
+  uint64_t wait_count;
+
+  /**
+   * @brief The total wait time in nanoseconds.
+   */
+  uint64_t total_wait_time;
+
+  /**
+   * @brief The wait time histogram.
+   *
+   * @see THREAD_QUEUE_STATS_HISTOGRAM_COUNTS.
+   */
+  uint64_t histogram[ THREAD_QUEUE_STATS_HISTOGRAM_COUNTS ];
+
+  /**
+   * @brief The owners which caused the most waits.
+   */
+  Thread_queue_Stats_owner owners[ THREAD_QUEUE_STATS_OWNER_COUNT ];
+} Thread_queue_Stats;
+
+/**
+ * @brief Local context for thread queue statistics.
+ */
+typedef struct {
+  /**
+   * @brief The thread queue or NULL if the wait is not accounted.
+   */
+  const Thread_queue_Queue *queue;
+
+  /**
+   * @brief The object identifier of the thread queue.
+   */
+  Objects_Id id;
+
+  /**
+   * @brief The owner identifier at the wait begin instant.
+   */
+  Objects_Id owner;
+
+  /**
+   * @brief The wait begin instant in CPU counter ticks.
+   */
+  CPU_Counter_ticks first;
+
+  /**
+   * @brief The statistics generation at the wait begin instant.
+   *
+   * The generation changes with each reset of the statistics.
+   */
+  unsigned int generation;
+
+  /**
+   * @brief The thread queue name if the thread queue is not associated with
+   *   an object.
+   */
+  const char *name;
+
+  /**
+   * @brief The object name of the thread queue at the wait begin instant.
+   */
+  Objects_Name object_name;
+} Thread_queue_Stats_context;
+
+/**
+ * @brief Begins the statistics of a thread queue wait.
+ *
+ * The thread queue lock must be owned by the caller.  The identifier and the
+ * object name are captured here, since the thread queue may be destroyed
+ * before the wait ends.  No object lookup is done during the wait.
+ *
+ * @param[out] stats_context The statistics context.
+ * @param queue The thread queue.
+ * @param the_thread The thread to enqueue.  Waits of other threads than the
+ *   executing thread (e.g. thread proxies) are not accounted.
+ */
+void _Thread_queue_Stats_wait_begin(
+  Thread_queue_Stats_context *stats_context,
+  const Thread_queue_Queue   *queue,
+  const Thread_Control       *the_thread
+);
+
+/**
+ * @brief Ends the statistics of a thread queue wait.
+ *
+ * @param[in, out] stats_context The statistics context initialized by
+ *   _Thread_queue_Stats_wait_begin().
+ */
+void _Thread_queue_Stats_wait_end( Thread_queue_Stats_context *stats_context );
+
+/**
+ * @brief Gets the count of thread queue statistics entry indices.
+ *
+ * @return Returns THREAD_QUEUE_STATS_MAXIMUM times the processor maximum.
+ */
+size_t _Thread_queue_Stats_get_count( void );
+
+/**
+ * @brief Gets a snapshot of the thread queue statistics entry with the
+ *   specified index.
+ *
+ * The statistics of a thread queue are summed up over all processors and
+ * reported only for the index of the first processor entry of the thread
+ * queue.  The name and the deleted status are resolved by this function, so
+ * it shall be called in a context which may obtain the object allocator
+ * mutex.
+ *
+ * @param index The statistics entry index, see
+ *   _Thread_queue_Stats_get_count().
+ * @param[out] snapshot The snapshot of the statistics entry.
+ *
+ * @retval true The statistics entry is in use and reported by this index.
+ * @retval false Otherwise.
+ */
+bool _Thread_queue_Stats_get( size_t index, Thread_queue_Stats *snapshot );
+
+/**
+ * @brief Gets the count of waits of evicted statistics entries.
+ *
+ * @return Returns the count of dropped waits since the last reset.
+ */
+uint64_t _Thread_queue_Stats_get_dropped( void );
+
+/**
+ * @brief Resets all thread queue statistics.
+ *
+ * Waits in progress at the reset are not accounted.
+ */
+void _Thread_queue_Stats_reset( void );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTEMS_PROFILING */
+
+#endif /* _RTEMS_SCORE_THREADQSTATS_H */
@@ -93,6 +93,7 @@ extern rtems_shell_cmd_t rtems_shell_PROFREPORT_Command;
 extern rtems_shell_cmd_t rtems_shell_WKSPACE_INFO_Command;
 extern rtems_shell_cmd_t rtems_shell_MALLOC_INFO_Command;
 extern rtems_shell_cmd_t rtems_shell_RTRACE_Command;
+extern rtems_shell_cmd_t rtems_shell_PCSAMPLE_Command;
 #if RTEMS_NETWORKING
   extern rtems_shell_cmd_t rtems_shell_IFCONFIG_Command;
   extern rtems_shell_cmd_t rtems_shell_ROUTE_Command;
@@ -488,6 +489,11 @@ extern rtems_shell_alias_t * const rtems_shell_Initial_aliases[];
         defined(CONFIGURE_SHELL_COMMAND_RTRACE)
       &rtems_shell_RTRACE_Command,
     #endif
+    #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
+         !defined(CONFIGURE_SHELL_NO_COMMAND_PCSAMPLE)) || \
+        defined(CONFIGURE_SHELL_COMMAND_PCSAMPLE)
+      &rtems_shell_PCSAMPLE_Command,
+    #endif
 
     /*
      *  Network related commands
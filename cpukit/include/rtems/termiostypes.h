@@ -22,6 +22,7 @@
 #include <rtems/chain.h>
 #include <rtems/thread.h>
 #include <sys/ioccom.h>
+#include <sys/uio.h>
 #include <stdint.h>
 #include <termios.h>
 
@@ -238,6 +239,35 @@ typedef struct {
    * @brief Termios device mode.
    */
   rtems_termios_device_mode mode;
+
+  /**
+   * @brief Scatter-gather write in case mode is TERMIOS_IRQ_DRIVEN,
+   * TERMIOS_IRQ_SERVER_DRIVEN or TERMIOS_TASK_DRIVEN.
+   *
+   * This handler is optional and may be @c NULL.  If present, then blocking
+   * writes which need no output processing (OPOST is cleared) and no XON/XOFF
+   * flow control are handed directly to the device instead of being copied to
+   * the raw output buffer, provided they are at least as large as the raw
+   * output buffer or come from writev().  The device may transfer the data
+   * straight from the buffers of the IO vector, e.g. via DMA.
+   *
+   * The handler is called with the device lock acquired and shall only start
+   * the transfer.  The IO vector and its buffers are valid until the device
+   * reported the transfer of all characters via
+   * rtems_termios_dequeue_characters().  The device may report the
+   * completion of several or all buffers at once, e.g. once per DMA transfer
+   * completion.  The write() caller is blocked until the transfer completed.
+   *
+   * @param[in] context The Termios device context.
+   * @param[in] iov The IO vector with the output buffers.
+   * @param[in] iovcnt The count of buffers in the IO vector.  The total length
+   *   of the buffers is non-zero, however, individual buffers may be empty.
+   */
+  void (*write_vector)(
+    rtems_termios_device_context *context,
+    const struct iovec           *iov,
+    int                           iovcnt
+  );
 } rtems_termios_device_handler;
 
 /**
@@ -339,6 +369,12 @@ typedef struct rtems_termios_tty {
   int  t_dqlen; /* count of characters dequeued from device */
   enum {rob_idle, rob_busy, rob_wait }  rawOutBufState;
 
+  /**
+   * @brief Count of characters of a write_vector() transfer not yet reported
+   * as transmitted by the device.
+   */
+  size_t rawOutDirectLen;
+
   /*
    * Callbacks to device-specific routines
    */
@@ -2574,6 +2574,18 @@ typedef struct {
 
 #define T_MEASURE_RUNTIME_REPORT_SAMPLES 0x2
 
+/*
+ * Report the statistics of each variant additionally in one "M:J:" line with
+ * a JSON object and one "M:C:" line with comma-separated values.  The values
+ * are the name, variant, sample count, minimum, 1st percentile, 1st quartile,
+ * median, 3rd quartile, 99th percentile, maximum, median absolute deviation,
+ * sum of all samples, and duration of the variant.  The times are in seconds.
+ * The request name shall not contain quotation marks or commas.
+ */
+#define T_MEASURE_RUNTIME_REPORT_JSON 0x4
+
+#define T_MEASURE_RUNTIME_REPORT_CSV 0x8
+
 #define T_MEASURE_RUNTIME_DISABLE_FULL_CACHE 0x10
 
 #define T_MEASURE_RUNTIME_DISABLE_HOT_CACHE 0x20
@@ -79,7 +79,8 @@ const rtems_filesystem_file_handlers_r rtems_filesystem_null_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static void null_op_lock_or_unlock(
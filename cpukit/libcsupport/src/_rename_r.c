@@ -72,6 +72,7 @@ int _rename_r(
       rtems_filesystem_eval_path_get_token( &new_ctx ),
       rtems_filesystem_eval_path_get_tokenlen( &new_ctx )
     );
+    rtems_filesystem_name_cache_invalidate( new_currentloc->mt_entry );
   }
 
   rtems_filesystem_eval_path_cleanup_with_parent( &old_ctx, &old_parentloc );
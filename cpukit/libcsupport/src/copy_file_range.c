@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup LibIO
+ *
+ * @brief rtems_copy_file_range() and rtems_sendfile() Implementation
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio_.h>
+
+static rtems_libio_t *rtems_copy_file_range_hold(
+  int          fd,
+  unsigned int access
+)
+{
+  rtems_libio_t *iop;
+  unsigned int   flags;
+  unsigned int   mandatory;
+
+  if ( (uint32_t) fd >= rtems_libio_number_iops ) {
+    errno = EBADF;
+    return NULL;
+  }
+
+  iop = rtems_libio_iop( fd );
+  flags = rtems_libio_iop_hold( iop );
+  mandatory = LIBIO_FLAGS_OPEN | access;
+
+  if ( ( flags & mandatory ) != mandatory ) {
+    rtems_libio_iop_drop( iop );
+    errno = EBADF;
+    return NULL;
+  }
+
+  return iop;
+}
+
+static bool rtems_copy_file_range_is_regular( const rtems_libio_t *iop )
+{
+  struct stat st;
+
+  memset( &st, 0, sizeof( st ) );
+
+  return ( *iop->pathinfo.handlers->fstat_h )( &iop->pathinfo, &st ) == 0
+    && S_ISREG( st.st_mode );
+}
+
+/*
+ * Explicit offsets are used through a private copy of the IO control, so the
+ * file offset of the file descriptor is neither used nor changed like in
+ * pread() and pwrite().
+ */
+static void rtems_copy_file_range_positional(
+  rtems_libio_t       *positional,
+  const rtems_libio_t *iop,
+  off_t                offset
+)
+{
+  _Atomic_Init_uint( &positional->flags, rtems_libio_iop_flags( iop ) );
+  positional->offset = offset;
+  positional->pathinfo = iop->pathinfo;
+  positional->data0 = iop->data0;
+  positional->data1 = iop->data1;
+}
+
+static ssize_t rtems_copy_file_range_with_iops(
+  rtems_libio_t *iop_in,
+  off_t         *off_in,
+  rtems_libio_t *iop_out,
+  off_t         *off_out,
+  size_t         count
+)
+{
+  rtems_libio_t                       positional_in;
+  rtems_libio_t                       positional_out;
+  rtems_filesystem_copy_file_range_t  copy_file_range_h;
+  ssize_t                             n;
+
+  if ( iop_in == iop_out ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  if ( off_out != NULL && rtems_libio_iop_is_append( iop_out ) ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  if (
+    ( off_in != NULL && !rtems_copy_file_range_is_regular( iop_in ) )
+      || ( off_out != NULL && !rtems_copy_file_range_is_regular( iop_out ) )
+  ) {
+    rtems_set_errno_and_return_minus_one( ESPIPE );
+  }
+
+  if ( count > SSIZE_MAX ) {
+    count = SSIZE_MAX;
+  }
+
+  if ( off_in != NULL ) {
+    rtems_copy_file_range_positional( &positional_in, iop_in, *off_in );
+    iop_in = &positional_in;
+  }
+
+  if ( off_out != NULL ) {
+    rtems_copy_file_range_positional( &positional_out, iop_out, *off_out );
+    iop_out = &positional_out;
+  }
+
+  copy_file_range_h = iop_in->pathinfo.handlers->copy_file_range_h;
+  if ( copy_file_range_h == NULL ) {
+    copy_file_range_h = rtems_filesystem_default_copy_file_range;
+  }
+
+  n = ( *copy_file_range_h )( iop_in, iop_out, count );
+
+  if ( off_in != NULL ) {
+    *off_in = positional_in.offset;
+  }
+
+  if ( off_out != NULL ) {
+    *off_out = positional_out.offset;
+  }
+
+  return n;
+}
+
+ssize_t rtems_copy_file_range(
+  int     fd_in,
+  off_t  *off_in,
+  int     fd_out,
+  off_t  *off_out,
+  size_t  count
+)
+{
+  rtems_libio_t *iop_in;
+  rtems_libio_t *iop_out;
+  ssize_t        n;
+
+  if (
+    ( off_in != NULL && *off_in < 0 )
+      || ( off_out != NULL && *off_out < 0 )
+  ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  iop_in = rtems_copy_file_range_hold( fd_in, LIBIO_FLAGS_READ );
+  if ( iop_in == NULL ) {
+    return -1;
+  }
+
+  iop_out = rtems_copy_file_range_hold( fd_out, LIBIO_FLAGS_WRITE );
+  if ( iop_out == NULL ) {
+    rtems_libio_iop_drop( iop_in );
+    return -1;
+  }
+
+  n = rtems_copy_file_range_with_iops(
+    iop_in,
+    off_in,
+    iop_out,
+    off_out,
+    count
+  );
+
+  rtems_libio_iop_drop( iop_out );
+  rtems_libio_iop_drop( iop_in );
+  return n;
+}
+
+ssize_t rtems_sendfile(
+  int     fd_out,
+  int     fd_in,
+  off_t  *offset,
+  size_t  count
+)
+{
+  return rtems_copy_file_range( fd_in, offset, fd_out, NULL, count );
+}
@@ -106,40 +106,104 @@ int rtems_libio_to_fcntl_flags( unsigned int flags )
   return fcntl_flags;
 }
 
+/*
+ * The descriptor after the most recently allocated descriptor.  It is only a
+ * hint for the start of the search, so relaxed memory accesses are sufficient.
+ */
+static Atomic_Uint rtems_libio_iop_free_cursor;
+
 rtems_libio_t *rtems_libio_allocate( void )
 {
-  rtems_libio_t *iop;
+  uint32_t      count;
+  uint32_t      words;
+  uint32_t      start;
+  uint32_t      w;
+  uint32_t      i;
+  unsigned long mask;
 
-  rtems_libio_lock();
+  count = rtems_libio_number_iops;
 
-  iop = rtems_libio_iop_free_head;
-
-  if ( iop != NULL ) {
-    void *next;
+  if ( count == 0 ) {
+    return NULL;
+  }
 
-    next = iop->data1;
-    rtems_libio_iop_free_head = next;
+  words = RTEMS_LIBIO_IOP_FREE_MAP_WORDS( count );
+  start = _Atomic_Load_uint( &rtems_libio_iop_free_cursor, ATOMIC_ORDER_RELAXED );
+  w = start / RTEMS_LIBIO_IOP_FREE_MAP_BITS;
+  mask = ~0UL << ( start % RTEMS_LIBIO_IOP_FREE_MAP_BITS );
 
-    if ( next == NULL ) {
-      rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+  /*
+   * Visit the start word twice, first for the descriptors at or after the
+   * cursor and at the end for the descriptors before the cursor.
+   */
+  for ( i = 0; i <= words; ++i ) {
+    Atomic_Ulong  *word;
+    unsigned long  free;
+
+    word = &rtems_libio_iop_free_map[ w ];
+    free = _Atomic_Load_ulong( word, ATOMIC_ORDER_RELAXED );
+
+    while ( ( free & mask ) != 0 ) {
+      unsigned long bit;
+
+      bit = (unsigned long) __builtin_ctzl( free & mask );
+
+      if (
+        _Atomic_Compare_exchange_ulong(
+          word,
+          &free,
+          free & ~( 1UL << bit ),
+          ATOMIC_ORDER_ACQUIRE,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        uint32_t fd;
+
+        fd = w * RTEMS_LIBIO_IOP_FREE_MAP_BITS + (uint32_t) bit;
+        _Atomic_Store_uint(
+          &rtems_libio_iop_free_cursor,
+          fd + 1 < count ? fd + 1 : 0,
+          ATOMIC_ORDER_RELAXED
+        );
+
+        return &rtems_libio_iops[ fd ];
+      }
     }
+
+    mask = ~0UL;
+    w = w + 1 < words ? w + 1 : 0;
   }
 
-  rtems_libio_unlock();
+  return NULL;
+}
 
-  return iop;
+uint32_t rtems_libio_count_free( void )
+{
+  uint32_t free_count;
+  uint32_t words;
+  uint32_t i;
+
+  free_count = 0;
+  words = RTEMS_LIBIO_IOP_FREE_MAP_WORDS( rtems_libio_number_iops );
+
+  for ( i = 0; i < words; ++i ) {
+    free_count += (uint32_t) __builtin_popcountl(
+      _Atomic_Load_ulong( &rtems_libio_iop_free_map[ i ], ATOMIC_ORDER_RELAXED )
+    );
+  }
+
+  return free_count;
 }
 
 void rtems_libio_free(
   rtems_libio_t *iop
 )
 {
-  size_t zero;
+  size_t   zero;
+  uint32_t fd;
 
   rtems_filesystem_location_free( &iop->pathinfo );
 
-  rtems_libio_lock();
-
   /*
    * Clear everything except the reference count part.  At this point in time
    * there may be still some holders of this file descriptor.
@@ -149,11 +213,13 @@ void rtems_libio_free(
   memset( (char *) iop + zero, 0, sizeof( *iop ) - zero );
 
   /*
-   * Append it to the free list.  This increases the likelihood that a use
-   * after close is detected.
+   * Mark it as free.  The release order makes the cleared entry visible to the
+   * next owner.
    */
-  *rtems_libio_iop_free_tail = iop;
-  rtems_libio_iop_free_tail = &iop->data1;
-
-  rtems_libio_unlock();
+  fd = (uint32_t) rtems_libio_iop_to_descriptor( iop );
+  _Atomic_Fetch_or_ulong(
+    &rtems_libio_iop_free_map[ fd / RTEMS_LIBIO_IOP_FREE_MAP_BITS ],
+    1UL << ( fd % RTEMS_LIBIO_IOP_FREE_MAP_BITS ),
+    ATOMIC_ORDER_RELEASE
+  );
 }
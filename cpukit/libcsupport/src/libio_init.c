@@ -41,22 +41,30 @@ void rtems_libio_unlock( void )
   _API_Mutex_Unlock( &rtems_libio_mutex );
 }
 
-void *rtems_libio_iop_free_head;
-
-void **rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
-
 static void rtems_libio_init( void )
 {
     uint32_t i;
-    rtems_libio_t *iop;
+    uint32_t words;
+
+    words = RTEMS_LIBIO_IOP_FREE_MAP_WORDS( rtems_libio_number_iops );
 
-    if (rtems_libio_number_iops > 0)
+    for (i = 0 ; i < words ; i++)
     {
-        iop = rtems_libio_iop_free_head = &rtems_libio_iops[0];
-        for (i = 0 ; (i + 1) < rtems_libio_number_iops ; i++, iop++)
-          iop->data1 = iop + 1;
-        iop->data1 = NULL;
-        rtems_libio_iop_free_tail = &iop->data1;
+        uint32_t      remaining;
+        unsigned long free;
+
+        remaining = rtems_libio_number_iops - i * RTEMS_LIBIO_IOP_FREE_MAP_BITS;
+
+        if (remaining >= RTEMS_LIBIO_IOP_FREE_MAP_BITS)
+          free = ~0UL;
+        else
+          free = ( 1UL << remaining ) - 1;
+
+        _Atomic_Store_ulong(
+          &rtems_libio_iop_free_map[ i ],
+          free,
+          ATOMIC_ORDER_RELAXED
+        );
     }
 }
 
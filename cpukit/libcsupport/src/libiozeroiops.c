@@ -43,4 +43,6 @@
 
 rtems_libio_t rtems_libio_iops[ 0 ];
 
+Atomic_Ulong rtems_libio_iop_free_map[ 0 ];
+
 const uint32_t rtems_libio_number_iops = 0;
@@ -54,21 +54,7 @@ static const struct {
 
 static int open_files(void)
 {
-  int free_count = 0;
-  rtems_libio_t *iop;
-
-  rtems_libio_lock();
-
-  iop = rtems_libio_iop_free_head;
-  while (iop != NULL) {
-    ++free_count;
-
-    iop = iop->data1;
-  }
-
-  rtems_libio_unlock();
-
-  return (int) rtems_libio_number_iops - free_count;
+  return (int) (rtems_libio_number_iops - rtems_libio_count_free());
 }
 
 static void get_heap_info(Heap_Control *heap, Heap_Information_block *info)
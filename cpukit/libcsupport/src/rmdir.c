@@ -48,6 +48,7 @@ int rmdir( const char *path )
   if ( S_ISDIR( type ) ) {
     if ( !rtems_filesystem_location_is_instance_root( currentloc ) ) {
       rv = (*ops->rmnod_h)( &parentloc, currentloc );
+      rtems_filesystem_name_cache_invalidate( currentloc->mt_entry );
     } else {
       rtems_filesystem_eval_path_error( &ctx, EBUSY );
       rv = -1;
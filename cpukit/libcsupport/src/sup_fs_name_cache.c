@@ -0,0 +1,373 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup LibIOInternal
+ *
+ * @brief File System Name Cache
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+#include <rtems/thread.h>
+
+#include <string.h>
+
+typedef struct {
+  rtems_mutex                             Mutex;
+  rtems_chain_control                     Lru;
+  rtems_chain_control                    *buckets;
+  size_t                                  bucket_count;
+  rtems_filesystem_name_cache_statistics  statistics;
+} rtems_filesystem_name_cache_control;
+
+static rtems_filesystem_name_cache_control rtems_filesystem_name_cache = {
+  .Mutex = RTEMS_MUTEX_INITIALIZER( "Name Cache" ),
+  .Lru = RTEMS_CHAIN_INITIALIZER_EMPTY( rtems_filesystem_name_cache.Lru )
+};
+
+void rtems_filesystem_name_cache_initialize(
+  rtems_filesystem_name_cache_entry *entries,
+  rtems_chain_control               *buckets,
+  size_t                             count
+)
+{
+  rtems_filesystem_name_cache_control *cache;
+  size_t                               i;
+
+  cache = &rtems_filesystem_name_cache;
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_chain_initialize_empty( &buckets[ i ] );
+    rtems_chain_set_off_chain( &entries[ i ].Hash_node );
+    entries[ i ].mt_entry = NULL;
+    rtems_chain_append_unprotected( &cache->Lru, &entries[ i ].Lru_node );
+  }
+
+  cache->buckets = buckets;
+  cache->bucket_count = count;
+}
+
+static uint32_t rtems_filesystem_name_cache_hash(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t                                   parent,
+  const char                                 *name,
+  size_t                                      namelen
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  hash = 2166136261U ^ (uint32_t) (uintptr_t) mt_entry;
+  hash *= 16777619U;
+  hash ^= (uint32_t) parent;
+  hash *= 16777619U;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static rtems_filesystem_name_cache_entry *rtems_filesystem_name_cache_find(
+  const rtems_filesystem_name_cache_control  *cache,
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t                                   parent,
+  const char                                 *name,
+  size_t                                      namelen,
+  uint32_t                                    hash
+)
+{
+  const rtems_chain_control *bucket;
+  const rtems_chain_node    *node;
+
+  bucket = &cache->buckets[ hash % cache->bucket_count ];
+  node = rtems_chain_immutable_first( bucket );
+
+  while ( !rtems_chain_is_tail( bucket, node ) ) {
+    rtems_filesystem_name_cache_entry *entry;
+
+    entry = RTEMS_CONTAINER_OF(
+      node,
+      rtems_filesystem_name_cache_entry,
+      Hash_node
+    );
+
+    if (
+      entry->hash == hash
+        && entry->mt_entry == mt_entry
+        && entry->parent == parent
+        && entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0
+    ) {
+      return entry;
+    }
+
+    node = rtems_chain_immutable_next( node );
+  }
+
+  return NULL;
+}
+
+/*
+ * Removes the entry from its hash bucket and makes it the first candidate for
+ * a reuse.
+ */
+static void rtems_filesystem_name_cache_free(
+  rtems_filesystem_name_cache_control *cache,
+  rtems_filesystem_name_cache_entry   *entry
+)
+{
+  rtems_chain_extract_unprotected( &entry->Hash_node );
+  rtems_chain_set_off_chain( &entry->Hash_node );
+  entry->mt_entry = NULL;
+  rtems_chain_extract_unprotected( &entry->Lru_node );
+  rtems_chain_prepend_unprotected( &cache->Lru, &entry->Lru_node );
+}
+
+bool rtems_filesystem_name_cache_lookup(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t                                   parent,
+  const char                                 *name,
+  size_t                                      namelen,
+  uintptr_t                                  *child,
+  uintptr_t                                  *child_2
+)
+{
+  rtems_filesystem_name_cache_control *cache;
+  rtems_filesystem_name_cache_entry   *entry;
+  uint32_t                             hash;
+  bool                                 found;
+
+  cache = &rtems_filesystem_name_cache;
+
+  if (
+    cache->bucket_count == 0
+      || namelen > RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX
+  ) {
+    return false;
+  }
+
+  hash = rtems_filesystem_name_cache_hash( mt_entry, parent, name, namelen );
+  found = false;
+
+  rtems_mutex_lock( &cache->Mutex );
+
+  entry = rtems_filesystem_name_cache_find(
+    cache,
+    mt_entry,
+    parent,
+    name,
+    namelen,
+    hash
+  );
+
+  if ( entry != NULL ) {
+    if ( entry->generation == mt_entry->name_cache_generation ) {
+      *child = entry->child;
+      *child_2 = entry->child_2;
+      found = true;
+
+      if ( entry->child != 0 ) {
+        ++cache->statistics.positive_hits;
+      } else {
+        ++cache->statistics.negative_hits;
+      }
+
+      rtems_chain_extract_unprotected( &entry->Lru_node );
+      rtems_chain_append_unprotected( &cache->Lru, &entry->Lru_node );
+    } else {
+      rtems_filesystem_name_cache_free( cache, entry );
+    }
+  }
+
+  if ( !found ) {
+    ++cache->statistics.misses;
+  }
+
+  rtems_mutex_unlock( &cache->Mutex );
+  return found;
+}
+
+void rtems_filesystem_name_cache_enter(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t                                   parent,
+  const char                                 *name,
+  size_t                                      namelen,
+  uintptr_t                                   child,
+  uintptr_t                                   child_2
+)
+{
+  rtems_filesystem_name_cache_control *cache;
+  rtems_filesystem_name_cache_entry   *entry;
+  uint32_t                             hash;
+
+  cache = &rtems_filesystem_name_cache;
+
+  if (
+    cache->bucket_count == 0
+      || namelen > RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX
+  ) {
+    return;
+  }
+
+  hash = rtems_filesystem_name_cache_hash( mt_entry, parent, name, namelen );
+
+  rtems_mutex_lock( &cache->Mutex );
+
+  entry = rtems_filesystem_name_cache_find(
+    cache,
+    mt_entry,
+    parent,
+    name,
+    namelen,
+    hash
+  );
+
+  if ( entry == NULL ) {
+    /* Reuse the least recently used entry */
+    entry = RTEMS_CONTAINER_OF(
+      rtems_chain_first( &cache->Lru ),
+      rtems_filesystem_name_cache_entry,
+      Lru_node
+    );
+
+    if ( !rtems_chain_is_node_off_chain( &entry->Hash_node ) ) {
+      rtems_chain_extract_unprotected( &entry->Hash_node );
+    }
+
+    entry->mt_entry = mt_entry;
+    entry->hash = hash;
+    entry->parent = parent;
+    entry->namelen = (uint8_t) namelen;
+    memcpy( entry->name, name, namelen );
+    rtems_chain_append_unprotected(
+      &cache->buckets[ hash % cache->bucket_count ],
+      &entry->Hash_node
+    );
+  }
+
+  entry->generation = mt_entry->name_cache_generation;
+  entry->child = child;
+  entry->child_2 = child_2;
+  rtems_chain_extract_unprotected( &entry->Lru_node );
+  rtems_chain_append_unprotected( &cache->Lru, &entry->Lru_node );
+
+  rtems_mutex_unlock( &cache->Mutex );
+}
+
+static void rtems_filesystem_name_cache_do_purge(
+  rtems_filesystem_name_cache_control        *cache,
+  const rtems_filesystem_mount_table_entry_t *mt_entry
+)
+{
+  rtems_chain_node *node;
+  rtems_chain_node *tail;
+
+  node = rtems_chain_first( &cache->Lru );
+  tail = rtems_chain_tail( &cache->Lru );
+
+  while ( node != tail ) {
+    rtems_filesystem_name_cache_entry *entry;
+
+    entry = RTEMS_CONTAINER_OF(
+      node,
+      rtems_filesystem_name_cache_entry,
+      Lru_node
+    );
+    node = rtems_chain_next( node );
+
+    if ( entry->mt_entry == mt_entry ) {
+      rtems_filesystem_name_cache_free( cache, entry );
+    }
+  }
+}
+
+void rtems_filesystem_name_cache_invalidate(
+  rtems_filesystem_mount_table_entry_t *mt_entry
+)
+{
+  rtems_filesystem_name_cache_control *cache;
+
+  cache = &rtems_filesystem_name_cache;
+
+  if ( cache->bucket_count == 0 ) {
+    return;
+  }
+
+  rtems_mutex_lock( &cache->Mutex );
+
+  ++cache->statistics.invalidations;
+  ++mt_entry->name_cache_generation;
+
+  /*
+   * Entries which survived a complete generation wrap around would become
+   * valid again.
+   */
+  if ( mt_entry->name_cache_generation == 0 ) {
+    rtems_filesystem_name_cache_do_purge( cache, mt_entry );
+  }
+
+  rtems_mutex_unlock( &cache->Mutex );
+}
+
+void rtems_filesystem_name_cache_purge(
+  const rtems_filesystem_mount_table_entry_t *mt_entry
+)
+{
+  rtems_filesystem_name_cache_control *cache;
+
+  cache = &rtems_filesystem_name_cache;
+
+  if ( cache->bucket_count == 0 ) {
+    return;
+  }
+
+  rtems_mutex_lock( &cache->Mutex );
+  rtems_filesystem_name_cache_do_purge( cache, mt_entry );
+  rtems_mutex_unlock( &cache->Mutex );
+}
+
+void rtems_filesystem_name_cache_get_statistics(
+  rtems_filesystem_name_cache_statistics *statistics
+)
+{
+  rtems_filesystem_name_cache_control *cache;
+
+  cache = &rtems_filesystem_name_cache;
+
+  rtems_mutex_lock( &cache->Mutex );
+  *statistics = cache->statistics;
+  rtems_mutex_unlock( &cache->Mutex );
+}
@@ -33,6 +33,7 @@
 #include <unistd.h>
 #include <sys/fcntl.h>
 #include <sys/filio.h>
+#include <sys/param.h>
 #include <sys/ttycom.h>
 
 #include <rtems/termiostypes.h>
@@ -1035,6 +1036,55 @@ doTransmit (const char *buf, size_t len, rtems_termios_tty *tty,
   return len;
 }
 
+/*
+ * Check if characters may be handed directly to the device via write_vector()
+ */
+static bool
+canTransmitDirect (const rtems_termios_tty *tty, bool wait)
+{
+  return wait
+    && tty->handler.write_vector != NULL
+    && tty->handler.mode != TERMIOS_POLLED
+    && (tty->termios.c_oflag & OPOST) == 0
+    && (tty->flow_ctrl & (FL_MDXON | FL_MDXOF)) == 0;
+}
+
+/*
+ * Send characters directly from the caller buffers to the device-specific
+ * code.  The raw output buffer is drained first to keep the character order.
+ * The caller buffers must stay valid until the device reported the transfer
+ * of all characters, so wait for the completion.
+ */
+static size_t
+doTransmitDirect (const struct iovec *iov, int iovcnt, size_t len,
+                  rtems_termios_tty *tty)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  while (tty->rawOutBuf.Tail != tty->rawOutBuf.Head) {
+    tty->rawOutBufState = rob_wait;
+    rtems_termios_device_lock_release (ctx, &lock_context);
+    rtems_binary_semaphore_wait (&tty->rawOutBuf.Semaphore);
+    rtems_termios_device_lock_acquire (ctx, &lock_context);
+  }
+
+  tty->rawOutDirectLen = len;
+  tty->rawOutBufState = rob_busy;
+  (*tty->handler.write_vector) (ctx, iov, iovcnt);
+
+  while (tty->rawOutDirectLen > 0) {
+    rtems_termios_device_lock_release (ctx, &lock_context);
+    rtems_binary_semaphore_wait (&tty->rawOutBuf.Semaphore);
+    rtems_termios_device_lock_acquire (ctx, &lock_context);
+  }
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+  return len;
+}
+
 void
 rtems_termios_puts (
   const void *_buf, size_t len, struct rtems_termios_tty *tty)
@@ -1164,6 +1214,12 @@ rtems_termios_write_tty (rtems_libio_t *iop, rtems_termios_tty *tty,
     }
 
     return len - todo;
+  } else if (len >= tty->rawOutBuf.Size && canTransmitDirect (tty, wait)) {
+    struct iovec iov;
+
+    iov.iov_base = RTEMS_DECONST (char *, buf);
+    iov.iov_len = len;
+    return doTransmitDirect (&iov, 1, len, tty);
   } else {
     return doTransmit (buf, len, tty, wait, false);
   }
@@ -1492,6 +1548,81 @@ fillBufferPoll (struct rtems_termios_tty *tty)
   return RTEMS_TERMIOS_IPROC_CONTINUE;
 }
 
+/*
+ * Restart the remote transmitter if the raw input queue dropped below the
+ * low water mark.  Called with the device lock held.
+ */
+static void
+restartRemoteTx (struct rtems_termios_tty *tty)
+{
+  tty->flow_ctrl &= ~FL_IREQXOF;
+  /* if tx stopped and XON should be sent... */
+  if (((tty->flow_ctrl & (FL_MDXON | FL_ISNTXOF))
+       ==                (FL_MDXON | FL_ISNTXOF))
+      && ((tty->rawOutBufState == rob_idle)
+    || (tty->flow_ctrl & FL_OSTOP))) {
+    /* XON should be sent now... */
+    (*tty->handler.write)(
+      tty->device_context, (void *)&(tty->termios.c_cc[VSTART]), 1);
+  } else if (tty->flow_ctrl & FL_MDRTS) {
+    tty->flow_ctrl &= ~FL_IRTSOFF;
+    /* activate RTS line */
+    if (tty->flow.start_remote_tx != NULL) {
+      tty->flow.start_remote_tx(tty->device_context);
+    }
+  }
+}
+
+/*
+ * In raw mode the input characters are placed into the canonical buffer
+ * without any processing, so whole chunks of the raw input queue can be
+ * copied.
+ */
+static bool
+canFillBufferInBulk (const struct rtems_termios_tty *tty)
+{
+  return (tty->termios.c_lflag & (ICANON | ISIG | ECHO | ECHOE | ECHOK |
+    ECHONL | ECHOPRT | ECHOCTL | ECHOKE)) == 0;
+}
+
+/*
+ * Copy the raw input queue to the canonical buffer.  Called with the device
+ * lock held.  Returns the number of characters moved.
+ */
+static unsigned int
+fillBufferBulk (struct rtems_termios_tty *tty)
+{
+  unsigned int size = tty->rawInBuf.Size;
+  unsigned int head = tty->rawInBuf.Head;
+  unsigned int tail = tty->rawInBuf.Tail;
+  unsigned int start;
+  unsigned int chunk;
+  unsigned int n;
+
+  n = (tail + size - head) % size;
+  n = MIN (n, (unsigned int) (CBUFSIZE - 1 - tty->ccount));
+
+  if (n == 0) {
+    return 0;
+  }
+
+  start = (head + 1) % size;
+  chunk = MIN (n, size - start);
+  memcpy (&tty->cbuf[tty->ccount], &tty->rawInBuf.theBuf[start], chunk);
+  memcpy (&tty->cbuf[tty->ccount + chunk], &tty->rawInBuf.theBuf[0],
+    n - chunk);
+  tty->ccount += n;
+
+  head = (head + n) % size;
+  tty->rawInBuf.Head = head;
+
+  if (((tail + size - head) % size) < tty->lowwater) {
+    restartRemoteTx (tty);
+  }
+
+  return n;
+}
+
 /*
  * Fill the input buffer from the raw input queue
  */
@@ -1511,6 +1642,15 @@ fillBufferQueue (struct rtems_termios_tty *tty)
 
     rtems_termios_device_lock_acquire (ctx, &lock_context);
 
+    if (canFillBufferInBulk (tty)) {
+      if (fillBufferBulk (tty) > 0) {
+        if (tty->ccount >= tty->termios.c_cc[VMIN])
+          wait = false;
+
+        timeout = tty->rawInBufSemaphoreTimeout;
+      }
+    }
+
     while ((tty->rawInBuf.Head != tty->rawInBuf.Tail) &&
                        (tty->ccount < (CBUFSIZE-1))) {
       unsigned char                    c;
@@ -1523,22 +1663,7 @@ fillBufferQueue (struct rtems_termios_tty *tty)
 
       if(((tty->rawInBuf.Tail - newHead) % tty->rawInBuf.Size)
          < tty->lowwater) {
-        tty->flow_ctrl &= ~FL_IREQXOF;
-        /* if tx stopped and XON should be sent... */
-        if (((tty->flow_ctrl & (FL_MDXON | FL_ISNTXOF))
-             ==                (FL_MDXON | FL_ISNTXOF))
-            && ((tty->rawOutBufState == rob_idle)
-          || (tty->flow_ctrl & FL_OSTOP))) {
-          /* XON should be sent now... */
-          (*tty->handler.write)(
-            tty->device_context, (void *)&(tty->termios.c_cc[VSTART]), 1);
-        } else if (tty->flow_ctrl & FL_MDRTS) {
-          tty->flow_ctrl &= ~FL_IRTSOFF;
-          /* activate RTS line */
-          if (tty->flow.start_remote_tx != NULL) {
-            tty->flow.start_remote_tx(tty->device_context);
-          }
-        }
+        restartRemoteTx (tty);
       }
 
       rtems_termios_device_lock_release (ctx, &lock_context);
@@ -1621,10 +1746,13 @@ rtems_termios_read_tty (
   /*
    * If there are characters in the buffer, then copy them to the caller.
    */
-  while (count && (tty->cindex < tty->ccount)) {
-    *buffer++ = tty->cbuf[tty->cindex++];
-    count--;
-   }
+  if (tty->cindex < tty->ccount) {
+    uint32_t n = MIN (count, (uint32_t) (tty->ccount - tty->cindex));
+
+    memcpy (buffer, &tty->cbuf[tty->cindex], n);
+    tty->cindex += n;
+    count -= n;
+  }
   tty->tty_rcvwakeup = false;
   *count_read = initial_count - count;
 
@@ -1694,6 +1822,112 @@ mustCallReceiveCallback (const rtems_termios_tty *tty, unsigned char c,
   }
 }
 
+/*
+ * Stop the remote transmitter since the raw input queue exceeds the high
+ * water mark.  Called with the device lock held.
+ */
+static void
+stopRemoteTx (struct rtems_termios_tty *tty)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+
+  /* incoming data stream should be stopped */
+  tty->flow_ctrl |= FL_IREQXOF;
+  if ((tty->flow_ctrl & (FL_MDXOF | FL_ISNTXOF))
+      ==                (FL_MDXOF             ) ) {
+    if ((tty->flow_ctrl & FL_OSTOP) ||
+        (tty->rawOutBufState == rob_idle)) {
+      /* if tx is stopped due to XOFF or out of data */
+      /*    call write function here                 */
+      tty->flow_ctrl |= FL_ISNTXOF;
+      (*tty->handler.write)(ctx,
+          (void *)&(tty->termios.c_cc[VSTOP]), 1);
+    }
+  } else if ((tty->flow_ctrl & (FL_MDRTS | FL_IRTSOFF)) == (FL_MDRTS) ) {
+    tty->flow_ctrl |= FL_IRTSOFF;
+    /* deactivate RTS line */
+    if (tty->flow.stop_remote_tx != NULL) {
+      tty->flow.stop_remote_tx(ctx);
+    }
+  }
+}
+
+/*
+ * Characters can be placed on the raw queue in bulk if no XON/XOFF
+ * characters must be recognized, no early input processing is enabled and
+ * the receive callback does not depend on individual characters.
+ */
+static bool
+canEnqueueInBulk (const rtems_termios_tty *tty)
+{
+  return (tty->flow_ctrl & FL_MDXON) == 0 &&
+    (tty->termios.c_iflag & (ISTRIP | IUCLC | ICRNL | INLCR | IGNCR)) == 0 &&
+    (tty->tty_rcv.sw_pfn == NULL || (tty->termios.c_lflag & ICANON) == 0);
+}
+
+/*
+ * Copy a chunk of characters to the raw queue.  The high water mark and the
+ * receive callback are checked once per chunk.  Returns the number of
+ * characters dropped because of overflow.
+ */
+static int
+enqueueBulk (struct rtems_termios_tty *tty, const char *buf, int len)
+{
+  rtems_termios_device_context *ctx = tty->device_context;
+  rtems_interrupt_lock_context lock_context;
+  unsigned int size;
+  unsigned int head;
+  unsigned int tail;
+  unsigned int start;
+  unsigned int chunk;
+  unsigned int n;
+  unsigned int content;
+  bool callReciveCallback;
+
+  rtems_termios_device_lock_acquire (ctx, &lock_context);
+
+  size = tty->rawInBuf.Size;
+  head = tty->rawInBuf.Head;
+  tail = tty->rawInBuf.Tail;
+
+  n = (head + size - tail - 1) % size;
+  n = MIN (n, (unsigned int) len);
+
+  start = (tail + 1) % size;
+  chunk = MIN (n, size - start);
+  memcpy (&tty->rawInBuf.theBuf[start], buf, chunk);
+  memcpy (&tty->rawInBuf.theBuf[0], buf + chunk, n - chunk);
+
+  tail = (tail + n) % size;
+  tty->rawInBuf.Tail = tail;
+  content = (tail + size - head) % size;
+
+  /* if chars_in_buffer > highwater                */
+  if (n > 0 && (tty->flow_ctrl & FL_IREQXOF) != 0 &&
+      content > tty->highwater) {
+    stopRemoteTx (tty);
+  }
+
+  callReciveCallback = false;
+
+  /*
+   * check to see if rcv wakeup callback was set
+   */
+  if (tty->tty_rcv.sw_pfn != NULL && !tty->tty_rcvwakeup &&
+      (n < (unsigned int) len || content >= tty->termios.c_cc[VMIN])) {
+    tty->tty_rcvwakeup = true;
+    callReciveCallback = true;
+  }
+
+  rtems_termios_device_lock_release (ctx, &lock_context);
+
+  if (callReciveCallback) {
+    (*tty->tty_rcv.sw_pfn)(&tty->termios, tty->tty_rcv.sw_arg);
+  }
+
+  return len - (int) n;
+}
+
 /*
  * Place characters on raw queue.
  * NOTE: This routine runs in the context of the
@@ -1726,6 +1960,13 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
     return 0;
   }
 
+  if (canEnqueueInBulk (tty)) {
+    dropped = enqueueBulk (tty, buf, len);
+    tty->rawInBufDropped += dropped;
+    rtems_binary_semaphore_post (&tty->rawInBuf.Semaphore);
+    return dropped;
+  }
+
   while (len--) {
     c = *buf++;
     /* FIXME: implement IXANY: any character restarts output */
@@ -1788,25 +2029,7 @@ rtems_termios_enqueue_raw_characters (void *ttyp, const char *buf, int len)
       /* if chars_in_buffer > highwater                */
       if ((tty->flow_ctrl & FL_IREQXOF) != 0 && (((newTail - head) %
           tty->rawInBuf.Size) > tty->highwater)) {
-        /* incoming data stream should be stopped */
-        tty->flow_ctrl |= FL_IREQXOF;
-        if ((tty->flow_ctrl & (FL_MDXOF | FL_ISNTXOF))
-            ==                (FL_MDXOF             ) ) {
-          if ((tty->flow_ctrl & FL_OSTOP) ||
-              (tty->rawOutBufState == rob_idle)) {
-            /* if tx is stopped due to XOFF or out of data */
-            /*    call write function here                 */
-            tty->flow_ctrl |= FL_ISNTXOF;
-            (*tty->handler.write)(ctx,
-                (void *)&(tty->termios.c_cc[VSTOP]), 1);
-          }
-        } else if ((tty->flow_ctrl & (FL_MDRTS | FL_IRTSOFF)) == (FL_MDRTS) ) {
-          tty->flow_ctrl |= FL_IRTSOFF;
-          /* deactivate RTS line */
-          if (tty->flow.stop_remote_tx != NULL) {
-            tty->flow.stop_remote_tx(ctx);
-          }
-        }
+        stopRemoteTx (tty);
       }
 
       callReciveCallback = false;
@@ -1862,8 +2085,36 @@ rtems_termios_refill_transmitter (struct rtems_termios_tty *tty)
 
   rtems_termios_device_lock_acquire (ctx, &lock_context);
 
-  /* check for XOF/XON to send */
-  if ((tty->flow_ctrl & (FL_MDXOF | FL_IREQXOF | FL_ISNTXOF))
+  if (tty->rawOutDirectLen > 0) {
+    /*
+     * transfer started via write_vector(), the device may report the
+     * completion of several buffers at once
+     */
+    len = tty->t_dqlen;
+    tty->t_dqlen = 0;
+    nToSend = 0;
+
+    if ((size_t) len < tty->rawOutDirectLen) {
+      tty->rawOutDirectLen -= (size_t) len;
+    } else {
+      tty->rawOutDirectLen = 0;
+      wakeUpWriterTask = true;
+
+      if (tty->rawOutBuf.Head != tty->rawOutBuf.Tail) {
+        /*
+         * Characters were queued meanwhile, e.g. via rtems_termios_puts()
+         */
+        nToSend = startXmit (tty, tty->rawOutBuf.Tail, false);
+      } else {
+        tty->rawOutBufState = rob_idle;
+        (*tty->handler.write) (ctx, NULL, 0);
+
+        if ( tty->tty_snd.sw_pfn != NULL) {
+          (*tty->tty_snd.sw_pfn)(&tty->termios, tty->tty_snd.sw_arg);
+        }
+      }
+    }
+  } else if ((tty->flow_ctrl & (FL_MDXOF | FL_IREQXOF | FL_ISNTXOF))
       == (FL_MDXOF | FL_IREQXOF)) {
     /* XOFF should be sent now... */
     (*tty->handler.write)(ctx, (void *)&(tty->termios.c_cc[VSTOP]), 1);
@@ -2194,6 +2445,36 @@ rtems_termios_imfs_write (rtems_libio_t *iop, const void *buffer, size_t count)
   return (ssize_t) bytes_moved;
 }
 
+static ssize_t
+rtems_termios_imfs_writev (
+  rtems_libio_t      *iop,
+  const struct iovec *iov,
+  int                 iovcnt,
+  ssize_t             total
+)
+{
+  struct rtems_termios_tty *tty;
+  ssize_t bytes_moved;
+
+  tty = iop->data1;
+
+  rtems_mutex_lock (&tty->osem);
+
+  /*
+   * Hand the complete IO vector to the device if possible, otherwise write
+   * the buffers one by one.
+   */
+  if (rtems_termios_linesw[tty->t_line].l_write == NULL && total > 0 &&
+      canTransmitDirect (tty, !rtems_libio_iop_is_no_delay (iop))) {
+    bytes_moved = (ssize_t) doTransmitDirect (iov, iovcnt, (size_t) total, tty);
+    rtems_mutex_unlock (&tty->osem);
+    return bytes_moved;
+  }
+
+  rtems_mutex_unlock (&tty->osem);
+  return rtems_filesystem_default_writev (iop, iov, iovcnt, total);
+}
+
 static int
 rtems_termios_imfs_ioctl (rtems_libio_t *iop, ioctl_command_t request,
   void *buffer)
@@ -2230,7 +2511,8 @@ static const rtems_filesystem_file_handlers_r rtems_termios_imfs_handler = {
   .mmap_h = rtems_termios_mmap,
   .poll_h = rtems_termios_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_termios_imfs_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static IMFS_jnode_t *
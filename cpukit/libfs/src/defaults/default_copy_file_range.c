@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup LibIOFSHandler
+ *
+ * @brief Default Copy File Range Handler
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+
+#include <stdlib.h>
+
+#define COPY_BUFFER_SIZE 4096
+
+ssize_t rtems_filesystem_default_copy_file_range(
+  rtems_libio_t *iop_in,
+  rtems_libio_t *iop_out,
+  size_t         count
+)
+{
+  char    *buffer;
+  size_t   size;
+  ssize_t  copied;
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  size = count < COPY_BUFFER_SIZE ? count : COPY_BUFFER_SIZE;
+  buffer = malloc( size );
+  if ( buffer == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOMEM );
+  }
+
+  copied = 0;
+
+  while ( count > 0 ) {
+    size_t  chunk;
+    ssize_t in;
+    ssize_t out;
+
+    chunk = count < size ? count : size;
+    in = ( *iop_in->pathinfo.handlers->read_h )( iop_in, buffer, chunk );
+    if ( in <= 0 ) {
+      if ( in < 0 && copied == 0 ) {
+        copied = -1;
+      }
+
+      break;
+    }
+
+    out = ( *iop_out->pathinfo.handlers->write_h )( iop_out, buffer, in );
+    if ( out <= 0 ) {
+      if ( out < 0 && copied == 0 ) {
+        copied = -1;
+      }
+
+      break;
+    }
+
+    copied += out;
+    count -= (size_t) out;
+
+    if ( out != in ) {
+      /*
+       * A short write leaves the input file offset past the data which was
+       * not accepted by the output file.  Move it back, so that a subsequent
+       * copy continues with this data.
+       */
+      ( *iop_in->pathinfo.handlers->lseek_h )(
+        iop_in,
+        (off_t) out - (off_t) in,
+        SEEK_CUR
+      );
+      break;
+    }
+
+    if ( (size_t) in != chunk ) {
+      break;
+    }
+  }
+
+  free( buffer );
+  return copied;
+}
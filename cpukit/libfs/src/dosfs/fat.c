@@ -27,6 +27,7 @@
 
 #include "fat.h"
 #include "fat_fat_operations.h"
+#include "fat_file.h"
 
 static int
  _fat_block_release(fat_fs_info_t *fs_info);
@@ -49,6 +50,142 @@ fat_cluster_num_to_block_num (const fat_fs_info_t *fs_info,
     return blk;
 }
 
+/* fat_buf_mirror_sector --
+ *     Copy a sector of the first FAT to the corresponding sectors of the
+ *     other FATs.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     sec_num  - sector number in the first FAT
+ *     data     - sector data
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+static int
+fat_buf_mirror_sector(fat_fs_info_t *fs_info,
+                      uint32_t       sec_num,
+                      const uint8_t *data)
+{
+    rtems_status_code sc;
+    uint8_t           i;
+    size_t            j;
+
+    for (i = 1; i < fs_info->vol.fats; i++)
+    {
+        rtems_bdbuf_buffer *bd;
+        uint32_t            mirror_sec;
+        uint32_t            blk;
+        uint32_t            blk_ofs;
+
+        mirror_sec = sec_num + fs_info->vol.fat_length * i;
+        blk = fat_sector_num_to_block_num(fs_info, mirror_sec);
+        blk_ofs = fat_sector_offset_to_block_offset(fs_info, mirror_sec, 0);
+
+        /*
+         * The mirror sector may share a block with the end of the previous
+         * FAT, in this case the block may be already held by the window.
+         */
+        for (j = 0; j < FAT_BUF_WINDOW_SIZE; ++j)
+        {
+            fat_cache_t *entry = &fs_info->c[j];
+
+            if (entry->state != FAT_CACHE_EMPTY && entry->blk_num == blk)
+            {
+                memcpy(entry->buf->buffer + blk_ofs, data, fs_info->vol.bps);
+                entry->modified = true;
+                break;
+            }
+        }
+
+        if (j < FAT_BUF_WINDOW_SIZE)
+            continue;
+
+        if (blk_ofs == 0
+            && fs_info->vol.bps == fs_info->vol.bytes_per_block)
+        {
+            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &bd);
+        }
+        else
+        {
+            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &bd);
+        }
+        if ( sc != RTEMS_SUCCESSFUL)
+            rtems_set_errno_and_return_minus_one(ENOMEM);
+        memcpy(bd->buffer + blk_ofs, data, fs_info->vol.bps);
+        sc = rtems_bdbuf_release_modified(bd);
+        if ( sc != RTEMS_SUCCESSFUL)
+            rtems_set_errno_and_return_minus_one(ENOMEM);
+    }
+
+    return RC_OK;
+}
+
+/* fat_buf_release_entry --
+ *     Give a buffer of the window back to bdbuf.  The FAT mirrors are
+ *     updated here, so that they are written only once for all changes done
+ *     while the FAT block was in the window.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     entry    - window entry
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+static int
+fat_buf_release_entry(fat_fs_info_t *fs_info, fat_cache_t *entry)
+{
+    rtems_status_code sc = RTEMS_SUCCESSFUL;
+    int               rc = RC_OK;
+
+    if (entry->state == FAT_CACHE_EMPTY)
+        return RC_OK;
+
+    if (entry->modified)
+    {
+        if (!fs_info->vol.mirror)
+        {
+            uint32_t sec_num = fat_block_num_to_sector_num(fs_info,
+                                                           entry->blk_num);
+            uint32_t fat_end = fs_info->vol.fat_loc + fs_info->vol.fat_length;
+            uint32_t i;
+
+            for (i = 0; i < fs_info->vol.sectors_per_block; ++i, ++sec_num)
+            {
+                if (sec_num >= fs_info->vol.fat_loc && sec_num < fat_end)
+                {
+                    int rc1 = fat_buf_mirror_sector(
+                        fs_info,
+                        sec_num,
+                        entry->buf->buffer + (i << fs_info->vol.sec_log2));
+                    if (rc1 != RC_OK)
+                        rc = rc1;
+                }
+            }
+        }
+
+        sc = rtems_bdbuf_release_modified(entry->buf);
+        entry->modified = false;
+    }
+    else
+    {
+        sc = rtems_bdbuf_release(entry->buf);
+    }
+
+    entry->state = FAT_CACHE_EMPTY;
+
+    if (fs_info->c_cur == entry)
+        fs_info->c_cur = NULL;
+
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return rc;
+}
+
 int
 fat_buf_access(fat_fs_info_t   *fs_info,
                const uint32_t   sec_num,
@@ -61,93 +198,107 @@ fat_buf_access(fat_fs_info_t   *fs_info,
     uint32_t          blk_ofs = fat_sector_offset_to_block_offset (fs_info,
                                                                    sec_num,
                                                                    0);
+    fat_cache_t      *entry = NULL;
+    fat_cache_t      *victim = &fs_info->c[0];
+    size_t            i;
 
-    if (fs_info->c.state == FAT_CACHE_EMPTY || fs_info->c.blk_num != sec_num)
+    for (i = 0; i < FAT_BUF_WINDOW_SIZE; ++i)
     {
-        fat_buf_release(fs_info);
+        fat_cache_t *cur = &fs_info->c[i];
+
+        if (cur->state == FAT_CACHE_EMPTY)
+        {
+            if (victim->state != FAT_CACHE_EMPTY)
+                victim = cur;
+        }
+        else if (cur->blk_num == blk)
+        {
+            entry = cur;
+            break;
+        }
+        else if (victim->state != FAT_CACHE_EMPTY &&
+                 (int32_t) (cur->last_use - victim->last_use) < 0)
+        {
+            victim = cur;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        int rc;
+
+        entry = victim;
+        rc = fat_buf_release_entry(fs_info, entry);
+        if (rc != RC_OK)
+            return rc;
 
         if (op_type == FAT_OP_TYPE_READ)
-            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &fs_info->c.buf);
+            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &entry->buf);
         else
-            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &fs_info->c.buf);
+            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &entry->buf);
         if (sc != RTEMS_SUCCESSFUL)
             rtems_set_errno_and_return_minus_one(EIO);
-        fs_info->c.blk_num = sec_num;
-        fs_info->c.modified = 0;
-        fs_info->c.state = FAT_CACHE_ACTUAL;
+        entry->blk_num = blk;
+        entry->modified = false;
+        entry->state = FAT_CACHE_ACTUAL;
     }
-    *sec_buf = &fs_info->c.buf->buffer[blk_ofs];
+
+    entry->last_use = ++fs_info->c_use;
+    fs_info->c_cur = entry;
+    *sec_buf = &entry->buf->buffer[blk_ofs];
     return RC_OK;
 }
 
 int
 fat_buf_release(fat_fs_info_t *fs_info)
 {
-    rtems_status_code sc = RTEMS_SUCCESSFUL;
-
-    if (fs_info->c.state == FAT_CACHE_EMPTY)
-        return RC_OK;
+    int    rc = RC_OK;
+    size_t i;
 
-    if (fs_info->c.modified)
+    for (i = 0; i < FAT_BUF_WINDOW_SIZE; ++i)
     {
-        uint32_t sec_num = fs_info->c.blk_num;
-        bool     sec_of_fat = ((sec_num >= fs_info->vol.fat_loc) &&
-                              (sec_num < fs_info->vol.rdir_loc));
-        uint32_t blk = fat_sector_num_to_block_num(fs_info, sec_num);
-        uint32_t blk_ofs = fat_sector_offset_to_block_offset(fs_info,
-                                                             sec_num,
-                                                             0);
-
-        if (sec_of_fat && !fs_info->vol.mirror)
-            memcpy(fs_info->sec_buf,
-                   fs_info->c.buf->buffer + blk_ofs,
-                   fs_info->vol.bps);
-
-        sc = rtems_bdbuf_release_modified(fs_info->c.buf);
-        if (sc != RTEMS_SUCCESSFUL)
-            rtems_set_errno_and_return_minus_one(EIO);
-        fs_info->c.modified = 0;
+        int rc1 = fat_buf_release_entry(fs_info, &fs_info->c[i]);
 
-        if (sec_of_fat && !fs_info->vol.mirror)
-        {
-            uint8_t i;
+        if (rc1 != RC_OK)
+            rc = rc1;
+    }
 
-            for (i = 1; i < fs_info->vol.fats; i++)
-            {
-                rtems_bdbuf_buffer *bd;
+    return rc;
+}
 
-                sec_num = fs_info->c.blk_num + fs_info->vol.fat_length * i,
-                blk = fat_sector_num_to_block_num(fs_info, sec_num);
-                blk_ofs = fat_sector_offset_to_block_offset(fs_info,
-                                                            sec_num,
-                                                            0);
+/* fat_buf_release_modified --
+ *     Give the modified buffers of the window back to bdbuf, so that the
+ *     swapout task writes them to the media.  This is done at the end of each
+ *     operation which changes the FAT.  The unmodified buffers stay in the
+ *     window.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+int
+fat_buf_release_modified(fat_fs_info_t *fs_info)
+{
+    int    rc = RC_OK;
+    size_t i;
 
-                if (blk_ofs == 0
-                    && fs_info->vol.bps == fs_info->vol.bytes_per_block)
-                {
-                    sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &bd);
-                }
-                else
-                {
-                    sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &bd);
-                }
-                if ( sc != RTEMS_SUCCESSFUL)
-                    rtems_set_errno_and_return_minus_one(ENOMEM);
-                memcpy(bd->buffer + blk_ofs, fs_info->sec_buf, fs_info->vol.bps);
-                sc = rtems_bdbuf_release_modified(bd);
-                if ( sc != RTEMS_SUCCESSFUL)
-                    rtems_set_errno_and_return_minus_one(ENOMEM);
-            }
-        }
-    }
-    else
+    for (i = 0; i < FAT_BUF_WINDOW_SIZE; ++i)
     {
-        sc = rtems_bdbuf_release(fs_info->c.buf);
-        if (sc != RTEMS_SUCCESSFUL)
-            rtems_set_errno_and_return_minus_one(EIO);
+        fat_cache_t *entry = &fs_info->c[i];
+
+        if (entry->state != FAT_CACHE_EMPTY && entry->modified)
+        {
+            int rc1 = fat_buf_release_entry(fs_info, entry);
+
+            if (rc1 != RC_OK)
+                rc = rc1;
+        }
     }
-    fs_info->c.state = FAT_CACHE_EMPTY;
-    return RC_OK;
+
+    return rc;
 }
 
 /* _fat_block_read --
@@ -185,13 +336,20 @@ _fat_block_read(
 
     while (count > 0)
     {
+        fat_fs_lock(fs_info);
+
         rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_READ, &sec_buf);
         if (rc != RC_OK)
+        {
+            fat_fs_unlock(fs_info);
             return -1;
+        }
 
         c = MIN(count, (fs_info->vol.bps - ofs));
         memcpy((buff + cmpltd), (sec_buf + ofs), c);
 
+        fat_fs_unlock(fs_info);
+
         count -= c;
         cmpltd += c;
         sec_num++;
@@ -210,6 +368,82 @@ fat_block_peek(
     rtems_bdbuf_peek(fs_info->vol.dd, blk, blk_cnt);
 }
 
+/* fat_buf_evict --
+ *     Release the window buffer which refers to the block 'blk'.  This must
+ *     be done before the block is accessed directly through bdbuf, otherwise
+ *     the direct access would wait for the release of the cached buffer.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     blk      - block number
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+static int
+fat_buf_evict(fat_fs_info_t *fs_info, uint32_t blk)
+{
+    int    rc = RC_OK;
+    size_t i;
+
+    fat_fs_lock(fs_info);
+
+    for (i = 0; i < FAT_BUF_WINDOW_SIZE; ++i)
+    {
+        fat_cache_t *entry = &fs_info->c[i];
+
+        if (entry->state != FAT_CACHE_EMPTY && entry->blk_num == blk)
+        {
+            rc = fat_buf_release_entry(fs_info, entry);
+            break;
+        }
+    }
+
+    fat_fs_unlock(fs_info);
+
+    return rc;
+}
+
+/*
+ * Cluster data is accessed directly through bdbuf without the cached buffer
+ * of the volume and without the volume lock.  The upper layer guarantees that
+ * a particular cluster is accessed by only one task at a time (per-file lock
+ * for file clusters, directory lock for directory clusters).
+ */
+static ssize_t
+fat_block_read(
+    fat_fs_info_t                        *fs_info,
+    const uint32_t                        start_blk,
+    const uint32_t                        offset,
+    const uint32_t                        count,
+    void                                 *buf)
+{
+    rtems_status_code   sc;
+    int                 rc;
+    uint32_t            bytes_to_read = MIN(count, (fs_info->vol.bytes_per_block - offset));
+    rtems_bdbuf_buffer *bd;
+
+    if (0 < bytes_to_read)
+    {
+        rc = fat_buf_evict(fs_info, start_blk);
+        if (RC_OK != rc)
+            return rc;
+
+        sc = rtems_bdbuf_read(fs_info->vol.dd, start_blk, &bd);
+        if (sc != RTEMS_SUCCESSFUL)
+            rtems_set_errno_and_return_minus_one(EIO);
+
+        memcpy(buf, bd->buffer + offset, bytes_to_read);
+
+        sc = rtems_bdbuf_release(bd);
+        if (sc != RTEMS_SUCCESSFUL)
+            rtems_set_errno_and_return_minus_one(EIO);
+    }
+
+    return bytes_to_read;
+}
+
 static ssize_t
 fat_block_write(
     fat_fs_info_t                        *fs_info,
@@ -218,31 +452,32 @@ fat_block_write(
     const uint32_t                        count,
     const void                           *buf)
 {
-    int                 rc             = RC_OK;
+    rtems_status_code   sc;
+    int                 rc;
     uint32_t            bytes_to_write = MIN(count, (fs_info->vol.bytes_per_block - offset));
-    uint8_t            *blk_buf;
-    uint32_t            sec_num        = fat_block_num_to_sector_num(fs_info, start_blk);
+    rtems_bdbuf_buffer *bd;
 
     if (0 < bytes_to_write)
     {
+        rc = fat_buf_evict(fs_info, start_blk);
+        if (RC_OK != rc)
+            return rc;
+
         if (bytes_to_write == fs_info->vol.bytes_per_block)
-        {
-            rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_GET, &blk_buf);
-        }
+            sc = rtems_bdbuf_get(fs_info->vol.dd, start_blk, &bd);
         else
-            rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_READ, &blk_buf);
+            sc = rtems_bdbuf_read(fs_info->vol.dd, start_blk, &bd);
+        if (sc != RTEMS_SUCCESSFUL)
+            rtems_set_errno_and_return_minus_one(EIO);
 
-        if (RC_OK == rc)
-        {
-            memcpy(blk_buf + offset, buf, bytes_to_write);
+        memcpy(bd->buffer + offset, buf, bytes_to_write);
 
-            fat_buf_mark_modified(fs_info);
-        }
+        sc = rtems_bdbuf_release_modified(bd);
+        if (sc != RTEMS_SUCCESSFUL)
+            rtems_set_errno_and_return_minus_one(EIO);
     }
-    if (RC_OK != rc)
-        return rc;
-    else
-        return bytes_to_write;
+
+    return bytes_to_write;
 }
 
 /* fat_sector_write --
@@ -281,17 +516,24 @@ fat_sector_write(
     {
         c = MIN(count, (fs_info->vol.bps - ofs));
 
+        fat_fs_lock(fs_info);
+
         if (c == fs_info->vol.bytes_per_block)
             rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_GET, &sec_buf);
         else
             rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_READ, &sec_buf);
         if (rc != RC_OK)
+        {
+            fat_fs_unlock(fs_info);
             return -1;
+        }
 
         memcpy((sec_buf + ofs), (buff + cmpltd), c);
 
         fat_buf_mark_modified(fs_info);
 
+        fat_fs_unlock(fs_info);
+
         count -= c;
         cmpltd +=c;
         sec_num++;
@@ -315,6 +557,8 @@ static ssize_t
 
     if (0 < bytes_to_write)
     {
+        fat_fs_lock(fs_info);
+
         if (bytes_to_write == fs_info->vol.bytes_per_block)
         {
             rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_GET, &blk_buf);
@@ -328,6 +572,8 @@ static ssize_t
 
             fat_buf_mark_modified(fs_info);
         }
+
+        fat_fs_unlock(fs_info);
     }
     if (RC_OK != rc)
         return rc;
@@ -380,6 +626,70 @@ fat_cluster_set(
     return bytes_written;
 }
 
+/* fat_cluster_read --
+ *     This function reads 'count' bytes from device filesystem is mounted on,
+ *     starts at 'start+offset' position where 'start' computed in clusters
+ *     and 'offset' is offset inside cluster.
+ *     Reading will NOT cross cluster boundaries!
+ *
+ * PARAMETERS:
+ *     fs_info            - FS info
+ *     start_cln          - cluster number to start reading from
+ *     offset             - offset inside cluster 'start'
+ *     count              - count of bytes to read
+ *     buff               - buffer provided by user
+ *
+ * RETURNS:
+ *     bytes read on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+ssize_t
+fat_cluster_read(
+    fat_fs_info_t                        *fs_info,
+    const uint32_t                        start_cln,
+    const uint32_t                        offset,
+    const uint32_t                        count,
+    void                                 *buff)
+{
+    ssize_t             rc               = RC_OK;
+    uint32_t            bytes_to_read    = MIN(count, (fs_info->vol.bpc - offset));
+    uint32_t            cur_blk          = fat_cluster_num_to_block_num(fs_info, start_cln);
+    uint32_t            blocks_in_offset = (offset >> fs_info->vol.bytes_per_block_log2);
+    uint32_t            ofs_blk          = offset - (blocks_in_offset << fs_info->vol.bytes_per_block_log2);
+    ssize_t             bytes_read       = 0;
+    uint8_t             *buffer          = (uint8_t*)buff;
+    ssize_t             ret;
+    uint32_t            c;
+
+    cur_blk += blocks_in_offset;
+
+    while (   (RC_OK == rc)
+           && (0 < bytes_to_read))
+    {
+      c = MIN(bytes_to_read, (fs_info->vol.bytes_per_block - ofs_blk));
+
+      ret = fat_block_read(
+          fs_info,
+          cur_blk,
+          ofs_blk,
+          c,
+          &buffer[bytes_read]);
+      if (c != ret)
+        rc = -1;
+      else
+      {
+          bytes_to_read -= ret;
+          bytes_read    += ret;
+          ++cur_blk;
+      }
+      ofs_blk = 0;
+    }
+    if (RC_OK != rc)
+      return rc;
+    else
+      return bytes_read;
+}
+
 /* _fat_block_release --
  *     This function works around the hack that hold a bdbuf and does
  *     not release it.
@@ -393,7 +703,13 @@ fat_cluster_set(
 int
 _fat_block_release(fat_fs_info_t *fs_info)
 {
-    return fat_buf_release(fs_info);
+    int rc;
+
+    fat_fs_lock(fs_info);
+    rc = fat_buf_release(fs_info);
+    fat_fs_unlock(fs_info);
+
+    return rc;
 }
 
 /* fat_cluster_write --
@@ -489,6 +805,8 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
     int                 i = 0;
     rtems_bdbuf_buffer *block = NULL;
 
+    rtems_recursive_mutex_init(&fs_info->lock, "FAT");
+
     vol->fd = open(device, O_RDWR);
     if (vol->fd < 0)
     {
@@ -748,15 +1066,6 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
         free(fs_info->rhash);
         rtems_set_errno_and_return_minus_one( ENOMEM );
     }
-    fs_info->sec_buf = (uint8_t *)calloc(vol->bps, sizeof(uint8_t));
-    if (fs_info->sec_buf == NULL)
-    {
-        close(vol->fd);
-        free(fs_info->vhash);
-        free(fs_info->rhash);
-        free(fs_info->uino);
-        rtems_set_errno_and_return_minus_one( ENOMEM );
-    }
 
     /*
      * If possible we will use the cluster size as bdbuf block size for faster
@@ -835,12 +1144,16 @@ fat_sync(fat_fs_info_t *fs_info)
 {
     int rc = RC_OK;
 
+    fat_fs_lock(fs_info);
+
     rc = fat_fat32_update_fsinfo_sector(fs_info);
     if ( rc != RC_OK )
         rc = -1;
 
     fat_buf_release(fs_info);
 
+    fat_fs_unlock(fs_info);
+
     if (rtems_bdbuf_syncdev(fs_info->vol.dd) != RTEMS_SUCCESSFUL)
         rc = -1;
 
@@ -873,7 +1186,7 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->vhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
-            free(node);
+            fat_file_free((fat_file_fd_t *) node);
     }
 
     for (i = 0; i < FAT_HASH_SIZE; i++)
@@ -882,16 +1195,17 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->rhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
-            free(node);
+            fat_file_free((fat_file_fd_t *) node);
     }
 
     free(fs_info->vhash);
     free(fs_info->rhash);
 
     free(fs_info->uino);
-    free(fs_info->sec_buf);
     close(fs_info->vol.fd);
 
+    rtems_recursive_mutex_destroy(&fs_info->lock);
+
     if (rc)
         errno = EIO;
     return rc;
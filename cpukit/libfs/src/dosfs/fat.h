@@ -30,6 +30,7 @@
 
 #include <errno.h>
 #include <rtems/bdbuf.h>
+#include <rtems/thread.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -336,17 +337,34 @@ typedef struct fat_vol_s
 } fat_vol_t;
 
 
+/*
+ * Number of bdbuf blocks which are kept in the buffer window of a volume.  It
+ * must be at least two, since some operations access two adjacent sectors.
+ * The window is emptied at the end of each file read and write, so the
+ * buffers are only held for the duration of one operation.
+ */
+#define FAT_BUF_WINDOW_SIZE 4
+
+/*
+ * Entry of the buffer window.  The block number is a bdbuf block number.
+ */
 typedef struct fat_cache_s
 {
     uint32_t            blk_num;
     bool                modified;
     uint8_t             state;
+    uint32_t            last_use;
     rtems_bdbuf_buffer *buf;
 } fat_cache_t;
 
 /*
  * This structure identifies the instance of the filesystem on the FAT
  * ("fat-file") level.
+ *
+ * The lock protects the file allocation tables, the cluster allocation state
+ * of the volume descriptor, the cached buffer and the sector buffer.  It is
+ * the innermost lock of the file system.  The lock order is: directory lock
+ * of the MSDOS layer, lock of the fat-file descriptor, this lock.
  */
 typedef struct fat_fs_info_s
 {
@@ -357,8 +375,10 @@ typedef struct fat_fs_info_s
     uint32_t             index;
     uint32_t             uino_pool_size; /* size */
     uint32_t             uino_base;
-    fat_cache_t          c;             /* cache */
-    uint8_t             *sec_buf; /* just placeholder for anything */
+    fat_cache_t          c[FAT_BUF_WINDOW_SIZE]; /* buffer window */
+    fat_cache_t         *c_cur;         /* most recently accessed entry */
+    uint32_t             c_use;         /* access counter for LRU */
+    rtems_recursive_mutex lock;         /* FAT table and cache lock */
 } fat_fs_info_t;
 
 /*
@@ -477,10 +497,22 @@ static inline uint32_t
             << fs_info->vol.sec_log2);
 }
 
+static inline void
+fat_fs_lock(fat_fs_info_t *fs_info)
+{
+    rtems_recursive_mutex_lock(&fs_info->lock);
+}
+
+static inline void
+fat_fs_unlock(fat_fs_info_t *fs_info)
+{
+    rtems_recursive_mutex_unlock(&fs_info->lock);
+}
+
 static inline void
 fat_buf_mark_modified(fat_fs_info_t *fs_info)
 {
-    fs_info->c.modified = true;
+    fs_info->c_cur->modified = true;
 }
 
 int
@@ -492,6 +524,9 @@ fat_buf_access(fat_fs_info_t  *fs_info,
 int
 fat_buf_release(fat_fs_info_t *fs_info);
 
+int
+fat_buf_release_modified(fat_fs_info_t *fs_info);
+
 ssize_t
 _fat_block_read(fat_fs_info_t                        *fs_info,
                 uint32_t                              start,
@@ -504,6 +539,13 @@ fat_block_peek(fat_fs_info_t                        *fs_info,
                const uint32_t                        blk,
                const uint32_t                        blk_cnt);
 
+ssize_t
+fat_cluster_read(fat_fs_info_t                    *fs_info,
+                   uint32_t                          start_cln,
+                   uint32_t                          offset,
+                   uint32_t                          count,
+                   void                             *buff);
+
 ssize_t
 fat_cluster_write(fat_fs_info_t                    *fs_info,
                     uint32_t                          start_cln,
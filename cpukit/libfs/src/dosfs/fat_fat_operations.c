@@ -42,8 +42,8 @@
  *
  *
  */
-int
-fat_scan_fat_for_free_clusters(
+static int
+_fat_scan_fat_for_free_clusters(
     fat_fs_info_t                        *fs_info,
     uint32_t                             *chain,
     uint32_t                              count,
@@ -143,7 +143,7 @@ fat_scan_fat_for_free_clusters(
     if (fs_info->vol.free_cls != FAT_UNDEFINED_VALUE)
         fs_info->vol.free_cls -= (*cls_added);
 
-    fat_buf_release(fs_info);
+    fat_buf_release_modified(fs_info);
 
     return RC_OK;
 
@@ -162,6 +162,25 @@ cleanup:
     return rc;
 }
 
+int
+fat_scan_fat_for_free_clusters(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                             *chain,
+    uint32_t                              count,
+    uint32_t                             *cls_added,
+    uint32_t                             *last_cl,
+    bool                                  zero_fill
+    )
+{
+    int rc;
+
+    fat_fs_lock(fs_info);
+    rc = _fat_scan_fat_for_free_clusters(fs_info, chain, count, cls_added, last_cl, zero_fill);
+    fat_fs_unlock(fs_info);
+
+    return rc;
+}
+
 /* fat_free_fat_clusters_chain --
  *     Free chain of clusters in Files Allocation Table.
  *
@@ -172,8 +191,8 @@ cleanup:
  * RETURNS:
  *     RC_OK on success, or -1 if error occurred (errno set appropriately)
  */
-int
-fat_free_fat_clusters_chain(
+static int
+_fat_free_fat_clusters_chain(
     fat_fs_info_t                        *fs_info,
     uint32_t                              chain
     )
@@ -207,13 +226,28 @@ fat_free_fat_clusters_chain(
         if (fs_info->vol.free_cls != FAT_UNDEFINED_VALUE)
             fs_info->vol.free_cls += freed_cls_cnt;
 
-    fat_buf_release(fs_info);
+    fat_buf_release_modified(fs_info);
     if (rc1 != RC_OK)
         return rc1;
 
     return RC_OK;
 }
 
+int
+fat_free_fat_clusters_chain(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              chain
+    )
+{
+    int rc;
+
+    fat_fs_lock(fs_info);
+    rc = _fat_free_fat_clusters_chain(fs_info, chain);
+    fat_fs_unlock(fs_info);
+
+    return rc;
+}
+
 /* fat_get_fat_cluster --
  *     Fetches the contents of the cluster (link to next cluster in the chain)
  *     from Files Allocation Table.
@@ -228,8 +262,8 @@ fat_free_fat_clusters_chain(
  *     RC_OK on success, or -1 if error occurred
  *     and errno set appropriately
  */
-int
-fat_get_fat_cluster(
+static int
+_fat_get_fat_cluster(
     fat_fs_info_t                        *fs_info,
     uint32_t                              cln,
     uint32_t                             *ret_val
@@ -298,6 +332,22 @@ fat_get_fat_cluster(
     return RC_OK;
 }
 
+int
+fat_get_fat_cluster(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              cln,
+    uint32_t                             *ret_val
+    )
+{
+    int rc;
+
+    fat_fs_lock(fs_info);
+    rc = _fat_get_fat_cluster(fs_info, cln, ret_val);
+    fat_fs_unlock(fs_info);
+
+    return rc;
+}
+
 /* fat_set_fat_cluster --
  *     Set the contents of the cluster (link to next cluster in the chain)
  *     from Files Allocation Table.
@@ -311,8 +361,8 @@ fat_get_fat_cluster(
  *     RC_OK on success, or -1 if error occurred
  *     and errno set appropriately
  */
-int
-fat_set_fat_cluster(
+static int
+_fat_set_fat_cluster(
     fat_fs_info_t                        *fs_info,
     uint32_t                              cln,
     uint32_t                              in_val
@@ -424,3 +474,19 @@ fat_set_fat_cluster(
 
     return RC_OK;
 }
+
+int
+fat_set_fat_cluster(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              cln,
+    uint32_t                              in_val
+    )
+{
+    int rc;
+
+    fat_fs_lock(fs_info);
+    rc = _fat_set_fat_cluster(fs_info, cln, in_val);
+    fat_fs_unlock(fs_info);
+
+    return rc;
+}
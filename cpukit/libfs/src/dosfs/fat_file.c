@@ -115,6 +115,8 @@ fat_file_open(
     if ( lfat_fd == NULL )
         rtems_set_errno_and_return_minus_one( ENOMEM );
 
+    rtems_mutex_init(&lfat_fd->lock, "FAT File");
+
     lfat_fd->links_num = 1;
     lfat_fd->flags &= ~FAT_FILE_REMOVED;
     lfat_fd->map.last_cln = FAT_UNDEFINED_VALUE;
@@ -129,7 +131,7 @@ fat_file_open(
 
         if ( lfat_fd->ino == 0 )
         {
-            free((*fat_fd));
+            fat_file_free(*fat_fd);
             /*
              * XXX: kernel resource is unsufficient, but not the memory,
              * but there is no suitable errno :(
@@ -164,6 +166,17 @@ fat_file_reopen(fat_file_fd_t *fat_fd)
     return RC_OK;
 }
 
+/* fat_file_update --
+ *     Write the changed meta data of the fat-file to its directory entry.
+ *     The caller must own the fat-file lock.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *
+ * RETURNS:
+ *     RC_OK, or -1 if error occurred (errno set appropriately)
+ */
 int
 fat_file_update(fat_fs_info_t *fs_info, fat_file_fd_t *fat_fd)
 {
@@ -229,12 +242,24 @@ fat_file_close(
     else
     {
         uint32_t key = fat_construct_key(fs_info, &fat_fd->dir_pos.sname);
+        bool     removed;
+
+        /*
+         * The size, cluster map, times and flags of the descriptor are
+         * protected by the fat-file lock, see msdos_file_sync().
+         */
+        fat_file_lock(fat_fd);
 
         fat_file_update(fs_info, fat_fd);
 
-        if (fat_fd->flags & FAT_FILE_REMOVED)
-        {
+        removed = (fat_fd->flags & FAT_FILE_REMOVED) != 0;
+        if (removed)
             rc = fat_file_truncate(fs_info, fat_fd, 0);
+
+        fat_file_unlock(fat_fd);
+
+        if (removed)
+        {
             if (rc == RC_OK)
             {
                 _hash_delete(fs_info->rhash, key, fat_fd->ino, fat_fd);
@@ -242,7 +267,7 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
-                free(fat_fd);
+                fat_file_free(fat_fd);
             }
         }
         else
@@ -254,7 +279,7 @@ fat_file_close(
             else
             {
                 _hash_delete(fs_info->vhash, key, fat_fd->ino, fat_fd);
-                free(fat_fd);
+                fat_file_free(fat_fd);
             }
         }
     }
@@ -262,29 +287,55 @@ fat_file_close(
     /*
      * flush any modified "cached" buffer back to disk
      */
+    fat_fs_lock(fs_info);
     rc = fat_buf_release(fs_info);
+    fat_fs_unlock(fs_info);
 
     return rc;
 }
 
-/* fat_file_read --
- *     Read 'count' bytes from 'start' position from fat-file. This
- *     interface hides the architecture of fat-file, represents it as
- *     linear file
+/* fat_file_free --
+ *     Free the memory of a fat-file descriptor.
  *
  * PARAMETERS:
- *     fs_info  - FS info
  *     fat_fd   - fat-file descriptor
- *     start    - offset in fat-file (in bytes) to read from
- *     count    - count of bytes to read
- *     buf      - buffer provided by user
+ */
+void
+fat_file_free(fat_file_fd_t *fat_fd)
+{
+    rtems_mutex_destroy(&fat_fd->lock);
+    free(fat_fd);
+}
+
+/* fat_file_release_window --
+ *     Give the buffers of the window back to bdbuf at the end of a file read
+ *     or write, so that the window does not pin bdbuf buffers between
+ *     operations.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     ret      - result of the file read or write
  *
  * RETURNS:
- *     the number of bytes read on success, or -1 if error occurred (errno
- *     set appropriately)
+ *     'ret' on success, or -1 if error occurred (errno set appropriately)
  */
-ssize_t
-fat_file_read(
+static ssize_t
+fat_file_release_window(fat_fs_info_t *fs_info, ssize_t ret)
+{
+    int rc;
+
+    fat_fs_lock(fs_info);
+    rc = fat_buf_release(fs_info);
+    fat_fs_unlock(fs_info);
+
+    if (rc != RC_OK && ret >= 0)
+        return rc;
+
+    return ret;
+}
+
+static ssize_t
+fat_file_read_window(
     fat_fs_info_t                        *fs_info,
     fat_file_fd_t                        *fat_fd,
     uint32_t                              start,
@@ -347,8 +398,6 @@ fat_file_read(
     {
         c = MIN(count, (fs_info->vol.bpc - ofs));
 
-        sec = fat_cluster_num_to_sector_num(fs_info, cur_cln);
-
         save_cln = cur_cln;
         rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
         if ( rc != RC_OK )
@@ -361,9 +410,7 @@ fat_file_read(
             blk_cnt = 1;
         fat_block_peek(fs_info, blk, blk_cnt);
 
-        sec += (ofs >> fs_info->vol.sec_log2);
-        byte = ofs & (fs_info->vol.bps - 1);
-        ret = _fat_block_read(fs_info, sec, byte, c, buf + cmpltd);
+        ret = fat_cluster_read(fs_info, save_cln, ofs, c, buf + cmpltd);
         if ( ret < 0 )
             return -1;
 
@@ -382,6 +429,36 @@ fat_file_read(
     return cmpltd;
 }
 
+/* fat_file_read --
+ *     Read 'count' bytes from 'start' position from fat-file. This
+ *     interface hides the architecture of fat-file, represents it as
+ *     linear file
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     start    - offset in fat-file (in bytes) to read from
+ *     count    - count of bytes to read
+ *     buf      - buffer provided by user
+ *
+ * RETURNS:
+ *     the number of bytes read on success, or -1 if error occurred (errno
+ *     set appropriately)
+ */
+ssize_t
+fat_file_read(
+    fat_fs_info_t                        *fs_info,
+    fat_file_fd_t                        *fat_fd,
+    uint32_t                              start,
+    uint32_t                              count,
+    uint8_t                              *buf
+)
+{
+    ssize_t ret = fat_file_read_window(fs_info, fat_fd, start, count, buf);
+
+    return fat_file_release_window(fs_info, ret);
+}
+
 /* fat_is_fat12_or_fat16_root_dir --
  *     Returns true for FAT12 root directories respectively FAT16
  *     root directories. Returns false for everything else.
@@ -476,24 +553,8 @@ fat_file_write_fat32_or_non_root_dir(
       return cmpltd;
 }
 
-/* fat_file_write --
- *     Write 'count' bytes of data from user supplied buffer to fat-file
- *     starting at offset 'start'. This interface hides the architecture
- *     of fat-file, represents it as linear file
- *
- * PARAMETERS:
- *     fs_info  - FS info
- *     fat_fd   - fat-file descriptor
- *     start    - offset(in bytes) to write from
- *     count    - count
- *     buf      - buffer provided by user
- *
- * RETURNS:
- *     number of bytes actually written to the file on success, or -1 if
- *     error occurred (errno set appropriately)
- */
-ssize_t
-fat_file_write(
+static ssize_t
+fat_file_write_window(
     fat_fs_info_t                        *fs_info,
     fat_file_fd_t                        *fat_fd,
     uint32_t                              start,
@@ -565,6 +626,36 @@ fat_file_write(
         return cmpltd;
 }
 
+/* fat_file_write --
+ *     Write 'count' bytes of data from user supplied buffer to fat-file
+ *     starting at offset 'start'. This interface hides the architecture
+ *     of fat-file, represents it as linear file
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     start    - offset(in bytes) to write from
+ *     count    - count
+ *     buf      - buffer provided by user
+ *
+ * RETURNS:
+ *     number of bytes actually written to the file on success, or -1 if
+ *     error occurred (errno set appropriately)
+ */
+ssize_t
+fat_file_write(
+    fat_fs_info_t                        *fs_info,
+    fat_file_fd_t                        *fat_fd,
+    uint32_t                              start,
+    uint32_t                              count,
+    const uint8_t                        *buf
+    )
+{
+    ssize_t ret = fat_file_write_window(fs_info, fat_fd, start, count, buf);
+
+    return fat_file_release_window(fs_info, ret);
+}
+
 /* fat_file_extend --
  *     Extend fat-file. If new length less than current fat-file size -
  *     do nothing. Otherwise calculate necessary count of clusters to add,
@@ -696,7 +787,10 @@ fat_file_extend(
                 fat_free_fat_clusters_chain(fs_info, chain);
                 return rc;
             }
-            fat_buf_release(fs_info);
+
+            fat_fs_lock(fs_info);
+            fat_buf_release_modified(fs_info);
+            fat_fs_unlock(fs_info);
         }
 
         /* update number of the last cluster of the file */
@@ -877,7 +971,9 @@ fat_file_mark_removed(
 
     _hash_insert(fs_info->rhash, key, fat_fd->ino, fat_fd);
 
+    fat_file_lock(fat_fd);
     fat_fd->flags |= FAT_FILE_REMOVED;
+    fat_file_unlock(fat_fd);
 }
 
 /* fat_file_size --
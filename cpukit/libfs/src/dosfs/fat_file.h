@@ -91,6 +91,11 @@ typedef struct fat_file_fd_s
     fat_file_map_t   map;
     time_t           ctime;
     time_t           mtime;
+    rtems_mutex      lock;          /*
+                                     * serializes data access and updates of
+                                     * size, cluster map and times of this
+                                     * fat-file
+                                     */
 
 } fat_file_fd_t;
 
@@ -182,6 +187,16 @@ static inline void fat_file_set_ctime_mtime(fat_file_fd_t *fat_fd, time_t t)
     fat_fd->flags |= FAT_FILE_META_DATA_CHANGED;
 }
 
+static inline void fat_file_lock(fat_file_fd_t *fat_fd)
+{
+    rtems_mutex_lock(&fat_fd->lock);
+}
+
+static inline void fat_file_unlock(fat_file_fd_t *fat_fd)
+{
+    rtems_mutex_unlock(&fat_fd->lock);
+}
+
 /* Prototypes for "fat-file" operations */
 int
 fat_file_open(fat_fs_info_t                         *fs_info,
@@ -231,6 +246,9 @@ int
 fat_file_size(fat_fs_info_t                        *fs_info,
               fat_file_fd_t                        *fat_fd);
 
+void
+fat_file_free(fat_file_fd_t *fat_fd);
+
 void
 fat_file_mark_removed(fat_fs_info_t                        *fs_info,
                       fat_file_fd_t                        *fat_fd);
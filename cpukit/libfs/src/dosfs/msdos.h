@@ -41,6 +41,47 @@ extern "C" {
 
 #define MSDOS_NAME_NOT_FOUND_ERR  0x7D01
 
+/*
+ * Number of buckets of the directory entry name cache hash tables.
+ */
+#define MSDOS_NAME_CACHE_HASH_SIZE    64
+
+/*
+ * Maximum number of directory entries kept in the name cache of a volume.
+ * The least recently used entry is evicted if this limit is reached.
+ */
+#define MSDOS_NAME_CACHE_MAX_ENTRIES  512
+
+/*
+ * Maximum length in bytes of a normalized name kept in the name cache.  Longer
+ * names are not cached.
+ */
+#define MSDOS_NAME_CACHE_NAME_SIZE    64
+
+typedef struct msdos_name_cache_entry msdos_name_cache_entry_t;
+
+/*
+ * Cache of directory entry names.  It maps a directory (identified by its
+ * first cluster) and a name in the normalized form used for comparison to the
+ * offsets of the short and long name entries within the directory.  It is
+ * populated with the result of a lookup and with the valid entries passed by
+ * the directory scan.  Only positive results are cached, so creation of new
+ * entries cannot make the cache stale.  Removal and rename of entries
+ * invalidate the affected cache entry, see msdos_set_first_char4file_name().
+ * The entries are allocated at mount time, unused entries are kept in the free
+ * chain.  The cache is protected by the volume mutex.
+ */
+typedef struct msdos_name_cache_s
+{
+    rtems_chain_control *name_hash;
+    rtems_chain_control *pos_hash;
+    rtems_chain_control  lru;
+    rtems_chain_control  free;
+    uint32_t             count;
+    msdos_name_cache_entry_t *entries;
+    uint8_t             *scan_name;
+} msdos_name_cache_t;
+
 /*
  * This structure identifies the instance of the filesystem on the MSDOS
  * level.
@@ -63,13 +104,23 @@ typedef struct msdos_fs_info_s
                                                             * nodes of file
                                                             * type
                                                             */
-    rtems_recursive_mutex vol_mutex;
+    rtems_recursive_mutex vol_mutex;                       /*
+                                                            * directory lock,
+                                                            * protects the name
+                                                            * space, directory
+                                                            * contents and the
+                                                            * buffers below;
+                                                            * file data is
+                                                            * protected by the
+                                                            * fat-file lock
+                                                            */
     uint8_t                          *cl_buf;              /*
                                                             * just placeholder
                                                             * for anything
                                                             */
 
     rtems_dosfs_convert_control      *converter;
+    msdos_name_cache_t                name_cache;
 } msdos_fs_info_t;
 
 RTEMS_INLINE_ROUTINE void msdos_fs_lock(msdos_fs_info_t *fs_info)
@@ -487,6 +538,59 @@ int msdos_sync(rtems_libio_t *iop);
 
 uint8_t msdos_lfn_checksum(const void *entry);
 
+int msdos_name_cache_init(msdos_name_cache_t *cache);
+
+void msdos_name_cache_destroy(msdos_name_cache_t *cache);
+
+bool msdos_name_cache_lookup(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln,
+    const uint8_t      *name,
+    size_t              name_len,
+    char               *sfn,
+    uint32_t           *sfn_offset,
+    uint32_t           *lfn_offset
+);
+
+void msdos_name_cache_insert(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln,
+    const uint8_t      *name,
+    size_t              name_len,
+    const char         *sfn,
+    const fat_pos_t    *sname,
+    uint32_t            sfn_offset,
+    uint32_t            lfn_offset
+);
+
+void msdos_name_cache_add_scanned(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln,
+    const uint8_t      *name,
+    size_t              name_len,
+    const char         *sfn,
+    const fat_pos_t    *sname,
+    uint32_t            sfn_offset,
+    uint32_t            lfn_offset
+);
+
+void msdos_name_cache_invalidate_entry(
+    msdos_name_cache_t *cache,
+    const fat_pos_t    *sname
+);
+
+void msdos_name_cache_invalidate_name(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln,
+    const uint8_t      *name,
+    size_t              name_len
+);
+
+void msdos_name_cache_invalidate_directory(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln
+);
+
 /** @} */
 
 #ifdef __cplusplus
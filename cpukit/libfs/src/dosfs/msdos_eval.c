@@ -68,6 +68,41 @@ static bool msdos_is_directory(
   return fat_fd->fat_file_type == FAT_DIRECTORY;
 }
 
+/*
+ * Only negative entries are kept in the file system name cache, the positive
+ * lookups are served by the directory entry name cache of the file system
+ * instance.  The parent directory is identified by its first cluster.
+ */
+static int msdos_eval_find_name(
+  rtems_filesystem_location_info_t *currentloc,
+  const char *token,
+  size_t tokenlen
+)
+{
+  fat_file_fd_t *fat_fd = currentloc->node_access;
+  uintptr_t parent = fat_fd->cln;
+  uintptr_t child;
+  uintptr_t child_2;
+  int rc;
+
+  if (rtems_filesystem_is_parent_directory(token, tokenlen)) {
+    return msdos_find_name(currentloc, token, tokenlen);
+  }
+
+  if (rtems_filesystem_name_cache_lookup(currentloc->mt_entry, parent,
+                                         token, tokenlen, &child, &child_2)) {
+    return MSDOS_NAME_NOT_FOUND_ERR;
+  }
+
+  rc = msdos_find_name(currentloc, token, tokenlen);
+  if (rc == MSDOS_NAME_NOT_FOUND_ERR) {
+    rtems_filesystem_name_cache_enter(currentloc->mt_entry, parent,
+                                      token, tokenlen, 0, 0);
+  }
+
+  return rc;
+}
+
 static rtems_filesystem_eval_path_generic_status msdos_eval_token(
   rtems_filesystem_eval_path_context_t *ctx,
   void *arg,
@@ -84,7 +119,7 @@ static rtems_filesystem_eval_path_generic_status msdos_eval_token(
   } else {
     rtems_filesystem_location_info_t *currentloc =
       rtems_filesystem_eval_path_get_currentloc(ctx);
-    int rc = msdos_find_name(currentloc, token, tokenlen);
+    int rc = msdos_eval_find_name(currentloc, token, tokenlen);
 
     if (rc == RC_OK) {
       rtems_filesystem_eval_path_clear_token(ctx);
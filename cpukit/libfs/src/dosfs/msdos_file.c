@@ -51,14 +51,14 @@ msdos_file_read(rtems_libio_t *iop, void *buffer, size_t count)
     msdos_fs_info_t   *fs_info = iop->pathinfo.mt_entry->fs_info;
     fat_file_fd_t     *fat_fd = iop->pathinfo.node_access;
 
-    msdos_fs_lock(fs_info);
+    fat_file_lock(fat_fd);
 
     ret = fat_file_read(&fs_info->fat, fat_fd, iop->offset, count,
                         buffer);
     if (ret > 0)
         iop->offset += ret;
 
-    msdos_fs_unlock(fs_info);
+    fat_file_unlock(fat_fd);
     return ret;
 }
 
@@ -82,7 +82,7 @@ msdos_file_write(rtems_libio_t *iop,const void *buffer, size_t count)
     msdos_fs_info_t   *fs_info = iop->pathinfo.mt_entry->fs_info;
     fat_file_fd_t     *fat_fd = iop->pathinfo.node_access;
 
-    msdos_fs_lock(fs_info);
+    fat_file_lock(fat_fd);
 
     if (rtems_libio_iop_is_append(iop))
         iop->offset = fat_fd->fat_file_size;
@@ -91,7 +91,7 @@ msdos_file_write(rtems_libio_t *iop,const void *buffer, size_t count)
                          buffer);
     if (ret < 0)
     {
-        msdos_fs_unlock(fs_info);
+        fat_file_unlock(fat_fd);
         return -1;
     }
 
@@ -106,7 +106,7 @@ msdos_file_write(rtems_libio_t *iop,const void *buffer, size_t count)
     if (ret > 0)
         fat_file_set_ctime_mtime(fat_fd, time(NULL));
 
-    msdos_fs_unlock(fs_info);
+    fat_file_unlock(fat_fd);
     return ret;
 }
 
@@ -129,7 +129,7 @@ msdos_file_stat(
     fat_file_fd_t     *fat_fd = loc->node_access;
     uint32_t           cl_mask = fs_info->fat.vol.bpc - 1;
 
-    msdos_fs_lock(fs_info);
+    fat_file_lock(fat_fd);
 
     buf->st_dev = fs_info->fat.vol.dev;
     buf->st_ino = fat_fd->ino;
@@ -143,7 +143,7 @@ msdos_file_stat(
     buf->st_ctime = fat_fd->ctime;
     buf->st_mtime = fat_fd->mtime;
 
-    msdos_fs_unlock(fs_info);
+    fat_file_unlock(fat_fd);
     return RC_OK;
 }
 
@@ -165,7 +165,7 @@ msdos_file_ftruncate(rtems_libio_t *iop, off_t length)
     fat_file_fd_t     *fat_fd = iop->pathinfo.node_access;
     uint32_t old_length;
 
-    msdos_fs_lock(fs_info);
+    fat_file_lock(fat_fd);
 
     old_length = fat_fd->fat_file_size;
     if (length < old_length) {
@@ -191,7 +191,7 @@ msdos_file_ftruncate(rtems_libio_t *iop, off_t length)
         fat_file_set_ctime_mtime(fat_fd, time(NULL));
     }
 
-    msdos_fs_unlock(fs_info);
+    fat_file_unlock(fat_fd);
 
     return rc;
 }
@@ -213,15 +213,23 @@ msdos_file_sync(rtems_libio_t *iop)
     msdos_fs_info_t   *fs_info = iop->pathinfo.mt_entry->fs_info;
     fat_file_fd_t     *fat_fd = iop->pathinfo.node_access;
 
+    /*
+     * The directory entry position may change through a rename, so the
+     * directory lock is necessary in addition to the file lock.
+     */
     msdos_fs_lock(fs_info);
+    fat_file_lock(fat_fd);
 
     rc = fat_file_update(&fs_info->fat, fat_fd);
     if (rc != RC_OK)
     {
+        fat_file_unlock(fat_fd);
         msdos_fs_unlock(fs_info);
         return rc;
     }
 
+    fat_file_unlock(fat_fd);
+
     rc = fat_sync(&fs_info->fat);
 
     msdos_fs_unlock(fs_info);
@@ -31,7 +31,9 @@
 #include "msdos.h"
 
 /* msdos_free_node_info --
- *     Call fat-file close routine.
+ *     Call fat-file close routine.  The file system instance lock (the
+ *     directory lock) is owned by the caller, fat_file_close() obtains the
+ *     fat-file lock for the update of the descriptor.
  */
 void
 msdos_free_node_info(const rtems_filesystem_location_info_t *pathloc)
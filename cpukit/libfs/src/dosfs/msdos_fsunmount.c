@@ -57,6 +57,7 @@ msdos_shut_down(rtems_filesystem_mount_table_entry_t *temp_mt_entry)
 
     rtems_recursive_mutex_destroy(&fs_info->vol_mutex);
     (*converter->handler->destroy)( converter );
+    msdos_name_cache_destroy(&fs_info->name_cache);
     free(fs_info->cl_buf);
     free(temp_mt_entry->fs_info);
 }
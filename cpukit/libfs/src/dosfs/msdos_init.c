@@ -46,7 +46,9 @@ static int msdos_utimens(
     if (times[0].tv_sec != times[1].tv_sec)
         rtems_set_errno_and_return_minus_one( ENOTSUP );
 
+    fat_file_lock(fat_fd);
     fat_file_set_mtime(fat_fd, times[1].tv_sec);
+    fat_file_unlock(fat_fd);
 
     return RC_OK;
 }
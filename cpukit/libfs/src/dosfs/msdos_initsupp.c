@@ -133,6 +133,16 @@ msdos_initialize_support(
         rtems_set_errno_and_return_minus_one(ENOMEM);
     }
 
+    rc = msdos_name_cache_init(&fs_info->name_cache);
+    if (rc != RC_OK)
+    {
+        free(fs_info->cl_buf);
+        fat_file_close(&fs_info->fat, fat_fd);
+        fat_shutdown_drive(&fs_info->fat);
+        free(fs_info);
+        return rc;
+    }
+
     rtems_recursive_mutex_init(&fs_info->vol_mutex,
                                RTEMS_FILESYSTEM_TYPE_DOSFS);
 
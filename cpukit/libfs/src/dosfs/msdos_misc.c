@@ -893,6 +893,9 @@ msdos_set_first_char4file_name(
     if (dir_pos->lname.cln == FAT_FILE_SHORT_NAME)
       start = dir_pos->sname;
 
+    if (fchar == MSDOS_THIS_DIR_ENTRY_EMPTY)
+      msdos_name_cache_invalidate_entry(&fs_info->name_cache, &dir_pos->sname);
+
     /*
      * We handle the changes directly due the way the short file
      * name code was written rather than use the fat_file_write
@@ -1022,13 +1025,25 @@ msdos_on_entry_found (
     fat_dir_pos_t                        *dir_pos,
     uint32_t                              dir_offset,
     const uint32_t                        dir_entry,
-    const fat_pos_t                      *lfn_start
+    const fat_pos_t                      *lfn_start,
+    uint32_t                             *sfn_offset,
+    uint32_t                             *lfn_offset
 )
 {
     int rc = RC_OK;
 #if MSDOS_FIND_PRINT
     printf ("MSFS:[9.3] SNF found\n");
 #endif
+    /*
+     * Remember the offsets of the entries within the directory for the name
+     * cache before the block numbers are converted to cluster numbers.
+     */
+    *sfn_offset = dir_offset * bts2rd + dir_entry;
+    if (lfn_start->cln != FAT_FILE_SHORT_NAME)
+        *lfn_offset = lfn_start->cln * bts2rd + lfn_start->ofs;
+    else
+        *lfn_offset = FAT_FILE_SHORT_NAME;
+
     /*
      * We get the entry we looked for - fill the position
      * structure and the 32 bytes of the short entry
@@ -1237,18 +1252,15 @@ static ssize_t msdos_short_entry_to_utf8_name (
 }
 
 static ssize_t
-msdos_compare_entry_against_filename (
+msdos_normalize_entry_name (
     rtems_dosfs_convert_control *converter,
     const uint8_t               *entry,
     const size_t                 entry_size,
-    const uint8_t               *filename,
-    const size_t                 name_len_remaining,
-    bool                        *is_matching)
+    uint8_t                     *entry_normalized,
+    const size_t                 buf_size)
 {
-  ssize_t      size_remaining = name_len_remaining;
-  int          eno            = 0;
-  uint8_t      entry_normalized[MSDOS_LFN_ENTRY_SIZE_UTF8];
-  size_t       bytes_in_entry_normalized = sizeof ( entry_normalized );
+  int          eno;
+  size_t       bytes_in_entry_normalized = buf_size;
 
   eno = (*converter->handler->utf8_normalize_and_fold) (
       converter,
@@ -1256,36 +1268,47 @@ msdos_compare_entry_against_filename (
       entry_size,
       &entry_normalized[0],
       &bytes_in_entry_normalized);
-  if (eno == 0) {
+  if (eno != 0) {
+    errno = eno;
+    return -1;
+  }
+
+  return (ssize_t) bytes_in_entry_normalized;
+}
+
+static ssize_t
+msdos_compare_entry_against_filename (
+    const uint8_t               *entry_normalized,
+    const size_t                 bytes_in_entry_normalized,
+    const uint8_t               *filename,
+    const size_t                 name_len_remaining,
+    bool                        *is_matching)
+{
+  ssize_t      size_remaining = name_len_remaining;
+
 #if MSDOS_FIND_PRINT > 1
-        printf ( "MSFS:[6] entry_normalized:%s"
-                 "name:%s\n",
-                 entry,
-                 filename );
+  printf ( "MSFS:[6] entry_normalized:%s"
+           "name:%s\n",
+           entry_normalized,
+           filename );
 #endif
-        if (bytes_in_entry_normalized <= size_remaining) {
-            size_remaining = size_remaining - bytes_in_entry_normalized;
-            if (0 == memcmp ( &entry_normalized[0],
-                              &filename[size_remaining],
-                              bytes_in_entry_normalized)) {
-                *is_matching = true;
-            } else {
-                *is_matching   = false;
-                size_remaining = name_len_remaining;
-            }
-
-        }
-        else {
-          *is_matching = false;
-        }
-    }
+  if (bytes_in_entry_normalized <= size_remaining) {
+      size_remaining = size_remaining - bytes_in_entry_normalized;
+      if (0 == memcmp ( &entry_normalized[0],
+                        &filename[size_remaining],
+                        bytes_in_entry_normalized)) {
+          *is_matching = true;
+      } else {
+          *is_matching   = false;
+          size_remaining = name_len_remaining;
+      }
 
-    if (eno != 0) {
-      size_remaining = -1;
-      errno          = eno;
-    }
+  }
+  else {
+    *is_matching = false;
+  }
 
-    return size_remaining;
+  return size_remaining;
 }
 
 static void
@@ -1300,6 +1323,113 @@ msdos_prepare_for_next_entry(
     *name_len_remaining = name_len_for_compare;
 }
 
+/*
+ * State to enter the valid entries passed by a directory scan into the name
+ * cache.  The long name entries are stored in reverse order, so the long name
+ * is assembled backwards in the scan name buffer of the cache.
+ */
+typedef struct {
+    uint8_t  *name;
+    size_t    name_begin;
+    uint32_t  lfn_offset;
+    int       lfn_entry;
+    uint8_t   lfn_checksum;
+    uint32_t  block_offset;
+    uint32_t  block_cln;
+} msdos_scan_context;
+
+static void
+msdos_scan_long_entry(
+    msdos_scan_context *scan,
+    const char         *entry,
+    uint32_t            entry_offset,
+    const uint8_t      *entry_normalized,
+    ssize_t             bytes_in_entry)
+{
+    int lfn_entry = *MSDOS_DIR_ENTRY_TYPE(entry) & MSDOS_LAST_LONG_ENTRY_MASK;
+
+    if ((*MSDOS_DIR_ENTRY_TYPE(entry) & MSDOS_LAST_LONG_ENTRY) != 0)
+    {
+        scan->lfn_offset = entry_offset;
+        scan->lfn_entry = lfn_entry;
+        scan->lfn_checksum = *MSDOS_DIR_LFN_CHECKSUM(entry);
+        scan->name_begin = MSDOS_NAME_MAX_UTF8_LFN_BYTES;
+    }
+
+    if (scan->lfn_offset == FAT_FILE_SHORT_NAME)
+        return;
+
+    if (scan->name == NULL ||
+        lfn_entry != scan->lfn_entry ||
+        scan->lfn_checksum != *MSDOS_DIR_LFN_CHECKSUM(entry) ||
+        bytes_in_entry <= 0 ||
+        (size_t) bytes_in_entry > scan->name_begin)
+    {
+        scan->lfn_offset = FAT_FILE_SHORT_NAME;
+        return;
+    }
+
+    scan->name_begin -= bytes_in_entry;
+    memcpy(&scan->name[scan->name_begin], entry_normalized, bytes_in_entry);
+    --scan->lfn_entry;
+}
+
+static void
+msdos_scan_short_entry(
+    msdos_fs_info_t    *fs_info,
+    fat_file_fd_t      *fat_fd,
+    uint32_t            bts2rd,
+    msdos_scan_context *scan,
+    const char         *entry,
+    uint32_t            dir_offset,
+    uint32_t            dir_entry,
+    const uint8_t      *sfn_normalized,
+    ssize_t             bytes_in_sfn)
+{
+    const uint8_t *name;
+    size_t         name_len;
+    uint32_t       lfn_offset;
+    fat_pos_t      sname;
+
+    if (scan->lfn_offset != FAT_FILE_SHORT_NAME &&
+        scan->lfn_entry == 0 &&
+        scan->lfn_checksum == msdos_lfn_checksum(entry))
+    {
+        name = &scan->name[scan->name_begin];
+        name_len = MSDOS_NAME_MAX_UTF8_LFN_BYTES - scan->name_begin;
+        lfn_offset = scan->lfn_offset;
+    }
+    else if (bytes_in_sfn > 0)
+    {
+        name = sfn_normalized;
+        name_len = bytes_in_sfn;
+        lfn_offset = FAT_FILE_SHORT_NAME;
+    }
+    else
+    {
+        scan->lfn_offset = FAT_FILE_SHORT_NAME;
+        return;
+    }
+
+    scan->lfn_offset = FAT_FILE_SHORT_NAME;
+
+    /* All entries of a directory block share the cluster */
+    if (scan->block_offset != dir_offset)
+    {
+        if (fat_file_ioctl(&fs_info->fat, fat_fd, F_CLU_NUM,
+                           dir_offset * bts2rd, &scan->block_cln) != RC_OK)
+            return;
+
+        scan->block_offset = dir_offset;
+    }
+
+    sname.cln = scan->block_cln;
+    sname.ofs = dir_entry;
+    msdos_name_cache_add_scanned(&fs_info->name_cache, fat_fd->cln,
+                                 name, name_len, MSDOS_DIR_NAME(entry), &sname,
+                                 dir_offset * bts2rd + dir_entry, lfn_offset);
+}
+
 static int
 msdos_find_file_in_directory (
     const uint8_t                        *filename_converted,
@@ -1314,7 +1444,9 @@ msdos_find_file_in_directory (
     char                                 *name_dir_entry,
     fat_dir_pos_t                        *dir_pos,
     uint32_t                             *empty_file_offset,
-    uint32_t                             *empty_entry_count)
+    uint32_t                             *empty_entry_count,
+    uint32_t                             *sfn_offset,
+    uint32_t                             *lfn_offset)
 {
     int               rc                = RC_OK;
     ssize_t           bytes_read;
@@ -1326,11 +1458,17 @@ msdos_find_file_in_directory (
     uint32_t          entries_per_block = bts2rd / MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE;
     int               lfn_entry         = 0;
     uint8_t           entry_utf8_normalized[MSDOS_LFN_ENTRY_SIZE_UTF8];
-    size_t            bytes_in_entry;
+    uint8_t           entry_normalized[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    ssize_t           bytes_in_entry;
     bool              filename_matched  = false;
     ssize_t           name_len_remaining;
     rtems_dosfs_convert_control *converter = fs_info->converter;
     uint32_t          dir_offset = 0;
+    msdos_scan_context scan;
+
+    scan.name = fs_info->name_cache.scan_name;
+    scan.lfn_offset = FAT_FILE_SHORT_NAME;
+    scan.block_offset = UINT32_MAX;
 
     /*
      * Scan the directory seeing if the file is present. While
@@ -1437,6 +1575,7 @@ msdos_find_file_in_directory (
                 msdos_prepare_for_next_entry(&lfn_start, &entry_matched,
                                              &name_len_remaining,
                                              name_len_for_compare);
+                scan.lfn_offset = FAT_FILE_SHORT_NAME;
             }
             else
             {
@@ -1461,6 +1600,34 @@ msdos_find_file_in_directory (
                 {
                     bool is_first_lfn_entry =
                         (lfn_start.cln == FAT_FILE_SHORT_NAME);
+                    bool is_last_long_entry =
+                        (*MSDOS_DIR_ENTRY_TYPE(entry) &
+                         MSDOS_LAST_LONG_ENTRY) != 0;
+
+                    /*
+                     * Decode every long name entry, also the entries which
+                     * do not match, to enter the long name into the name
+                     * cache.
+                     */
+                    bytes_in_entry = msdos_long_entry_to_utf8_name (
+                        converter,
+                        entry,
+                        is_last_long_entry,
+                        &entry_utf8_normalized[0],
+                        sizeof (entry_utf8_normalized));
+                    if (bytes_in_entry > 0) {
+                        bytes_in_entry = msdos_normalize_entry_name (
+                            converter,
+                            &entry_utf8_normalized[0],
+                            bytes_in_entry,
+                            &entry_normalized[0],
+                            sizeof (entry_normalized));
+                    }
+
+                    msdos_scan_long_entry(&scan, entry,
+                                          dir_offset * bts2rd + dir_entry,
+                                          &entry_normalized[0],
+                                          bytes_in_entry);
 
 /*                    int   o;*/
 #if MSDOS_FIND_PRINT
@@ -1481,8 +1648,7 @@ msdos_find_file_in_directory (
                          * The first entry must have the last long entry
                          * flag set.
                          */
-                        if ((*MSDOS_DIR_ENTRY_TYPE(entry) &
-                             MSDOS_LAST_LONG_ENTRY) == 0)
+                        if (!is_last_long_entry)
                             continue;
 
                         lfn_start.cln = dir_offset;
@@ -1521,16 +1687,9 @@ msdos_find_file_in_directory (
 #endif
                     lfn_entry--;
 
-                    bytes_in_entry = msdos_long_entry_to_utf8_name (
-                        converter,
-                        entry,
-                        is_first_lfn_entry,
-                        &entry_utf8_normalized[0],
-                        sizeof (entry_utf8_normalized));
                     if (bytes_in_entry > 0) {
                         name_len_remaining = msdos_compare_entry_against_filename (
-                            converter,
-                            &entry_utf8_normalized[0],
+                            &entry_normalized[0],
                             bytes_in_entry,
                             &filename_converted[0],
                             name_len_remaining,
@@ -1571,6 +1730,9 @@ msdos_find_file_in_directory (
                                                          &entry_matched,
                                                          &name_len_remaining,
                                                          name_len_for_compare);
+                            msdos_scan_short_entry(fs_info, fat_fd, bts2rd,
+                                                   &scan, entry, dir_offset,
+                                                   dir_entry, NULL, -1);
                         } else if (name_len_remaining == 0) {
                             filename_matched = true;
                             rc = msdos_on_entry_found (
@@ -1582,7 +1744,9 @@ msdos_find_file_in_directory (
                                 dir_pos,
                                 dir_offset,
                                 dir_entry,
-                                &lfn_start
+                                &lfn_start,
+                                sfn_offset,
+                                lfn_offset
                             );
                         }
 
@@ -1599,10 +1763,17 @@ msdos_find_file_in_directory (
                             &entry_utf8_normalized[0],
                             bytes_in_entry);
                         if (bytes_in_entry > 0) {
-                            name_len_remaining = msdos_compare_entry_against_filename (
+                            bytes_in_entry = msdos_normalize_entry_name (
                                 converter,
                                 &entry_utf8_normalized[0],
                                 bytes_in_entry,
+                                &entry_normalized[0],
+                                sizeof (entry_normalized));
+                        }
+                        if (bytes_in_entry > 0) {
+                            name_len_remaining = msdos_compare_entry_against_filename (
+                                &entry_normalized[0],
+                                bytes_in_entry,
                                 &filename_converted[0],
                                 name_len_for_compare,
                                 &entry_matched);
@@ -1617,7 +1788,9 @@ msdos_find_file_in_directory (
                                     dir_pos,
                                     dir_offset,
                                     dir_entry,
-                                    &lfn_start
+                                    &lfn_start,
+                                    sfn_offset,
+                                    lfn_offset
                                 );
                             }
                             if (rc == RC_OK && !filename_matched) {
@@ -1625,13 +1798,21 @@ msdos_find_file_in_directory (
                                                              &entry_matched,
                                                              &name_len_remaining,
                                                              name_len_for_compare);
+                                msdos_scan_short_entry(fs_info, fat_fd, bts2rd,
+                                                       &scan, entry,
+                                                       dir_offset, dir_entry,
+                                                       &entry_normalized[0],
+                                                       bytes_in_entry);
                             }
                         } else {
                           msdos_prepare_for_next_entry(&lfn_start,
                                                        &entry_matched,
                                                        &name_len_remaining,
                                                        name_len_for_compare);
+                          scan.lfn_offset = FAT_FILE_SHORT_NAME;
                         }
+                    } else {
+                        scan.lfn_offset = FAT_FILE_SHORT_NAME;
                     }
                 }
             }
@@ -1658,6 +1839,80 @@ msdos_find_file_in_directory (
     return rc;
 }
 
+/*
+ * Try to resolve the name through the name cache.  The directory entry is
+ * read back from the directory and its short name is checked against the
+ * cached one, so that a stale cache entry is never used.
+ */
+static int
+msdos_find_file_in_cache (
+    const uint8_t                        *filename_converted,
+    const size_t                          name_len_for_compare,
+    msdos_fs_info_t                      *fs_info,
+    fat_file_fd_t                        *fat_fd,
+    const uint32_t                        bts2rd,
+    char                                 *name_dir_entry,
+    fat_dir_pos_t                        *dir_pos,
+    bool                                 *found)
+{
+    int       rc;
+    ssize_t   bytes_read;
+    char      sfn[MSDOS_SHORT_NAME_LEN];
+    char      entry[MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE];
+    uint32_t  sfn_offset;
+    uint32_t  lfn_offset;
+    fat_pos_t lfn_start;
+
+    *found = false;
+
+    if (!msdos_name_cache_lookup(&fs_info->name_cache, fat_fd->cln,
+                                 filename_converted, name_len_for_compare,
+                                 sfn, &sfn_offset, &lfn_offset))
+        return RC_OK;
+
+    bytes_read = fat_file_read(&fs_info->fat, fat_fd, sfn_offset,
+                               MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE,
+                               (uint8_t *) entry);
+    if (   bytes_read != MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE
+        || *MSDOS_DIR_ENTRY_TYPE(entry) == MSDOS_THIS_DIR_ENTRY_EMPTY
+        || *MSDOS_DIR_ENTRY_TYPE(entry) == MSDOS_THIS_DIR_ENTRY_AND_REST_EMPTY
+        || memcmp(MSDOS_DIR_NAME(entry), sfn, MSDOS_SHORT_NAME_LEN) != 0)
+    {
+        msdos_name_cache_invalidate_name(&fs_info->name_cache, fat_fd->cln,
+                                         filename_converted,
+                                         name_len_for_compare);
+        return RC_OK;
+    }
+
+    if (lfn_offset != FAT_FILE_SHORT_NAME)
+    {
+        lfn_start.cln = lfn_offset / bts2rd;
+        lfn_start.ofs = lfn_offset % bts2rd;
+    }
+    else
+    {
+        lfn_start.cln = FAT_FILE_SHORT_NAME;
+        lfn_start.ofs = FAT_FILE_SHORT_NAME;
+    }
+
+    rc = msdos_on_entry_found (
+        fs_info,
+        fat_fd,
+        bts2rd,
+        name_dir_entry,
+        entry,
+        dir_pos,
+        sfn_offset / bts2rd,
+        sfn_offset % bts2rd,
+        &lfn_start,
+        &sfn_offset,
+        &lfn_offset
+    );
+    *found = (rc == RC_OK);
+
+    return rc;
+}
+
 static int
 msdos_get_pos(
     msdos_fs_info_t *fs_info,
@@ -1854,6 +2109,9 @@ msdos_find_name_in_fat_file (
     uint32_t                           bts2rd                     = 0;
     uint32_t                           empty_file_offset          = 0;
     uint32_t                           empty_entry_count          = 0;
+    uint32_t                           sfn_offset                 = 0;
+    uint32_t                           lfn_offset                 = 0;
+    bool                               found_in_cache             = false;
     unsigned int                       lfn_entries;
     rtems_dosfs_convert_control       *converter = fs_info->converter;
     void                              *buffer = converter->buffer.data;
@@ -1913,7 +2171,18 @@ msdos_find_name_in_fat_file (
             retval = -1;
         break;
     }
-    if (retval == RC_OK) {
+    if (retval == RC_OK && !create_node) {
+      retval = msdos_find_file_in_cache (
+          buffer,
+          name_len_for_compare,
+          fs_info,
+          fat_fd,
+          bts2rd,
+          name_dir_entry,
+          dir_pos,
+          &found_in_cache);
+    }
+    if (retval == RC_OK && !found_in_cache) {
       /* See if the file/directory does already exist */
       retval = msdos_find_file_in_directory (
           buffer,
@@ -1928,7 +2197,21 @@ msdos_find_name_in_fat_file (
           name_dir_entry,
           dir_pos,
           &empty_file_offset,
-          &empty_entry_count);
+          &empty_entry_count,
+          &sfn_offset,
+          &lfn_offset);
+
+      if (retval == RC_OK && !create_node) {
+        msdos_name_cache_insert (
+            &fs_info->name_cache,
+            fat_fd->cln,
+            buffer,
+            name_len_for_compare,
+            MSDOS_DIR_NAME(name_dir_entry),
+            &dir_pos->sname,
+            sfn_offset,
+            lfn_offset);
+      }
     }
     /* Create a non-existing file/directory if requested */
     if (   retval == RC_OK
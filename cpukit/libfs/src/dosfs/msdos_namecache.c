@@ -0,0 +1,399 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup DOSFS
+ *
+ * @brief Directory Entry Name Cache for the MSDOS FileSystem
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "msdos.h"
+
+/*
+ * Each used cache entry is linked into three chains: the bucket of the name
+ * hash (directory cluster and name), the bucket of the position hash (cluster
+ * and offset of the short name entry) and the LRU chain.  An unused entry is
+ * linked into the free chain through the LRU link.
+ */
+struct msdos_name_cache_entry
+{
+    rtems_chain_node name_link;
+    rtems_chain_node pos_link;
+    rtems_chain_node lru_link;
+    uint32_t         dir_cln;
+    uint32_t         hash;
+    fat_pos_t        sname;
+    uint32_t         sfn_offset;
+    uint32_t         lfn_offset;
+    char             sfn[MSDOS_SHORT_NAME_LEN];
+    size_t           name_len;
+    uint8_t          name[MSDOS_NAME_CACHE_NAME_SIZE];
+};
+
+static uint32_t
+msdos_name_cache_hash(uint32_t dir_cln, const uint8_t *name, size_t name_len)
+{
+    uint32_t hash = 2166136261U ^ dir_cln;
+    size_t   i;
+
+    for (i = 0; i < name_len; ++i)
+    {
+        hash ^= name[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+static uint32_t
+msdos_name_cache_pos_hash(const fat_pos_t *pos)
+{
+    return pos->cln * 31U + (pos->ofs / MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE);
+}
+
+static void
+msdos_name_cache_remove(msdos_name_cache_t      *cache,
+                        msdos_name_cache_entry_t *entry)
+{
+    rtems_chain_extract_unprotected(&entry->name_link);
+    rtems_chain_extract_unprotected(&entry->pos_link);
+    rtems_chain_extract_unprotected(&entry->lru_link);
+    rtems_chain_append_unprotected(&cache->free, &entry->lru_link);
+    --cache->count;
+}
+
+int
+msdos_name_cache_init(msdos_name_cache_t *cache)
+{
+    uint32_t i;
+
+    cache->name_hash = calloc(2 * MSDOS_NAME_CACHE_HASH_SIZE,
+                              sizeof(*cache->name_hash));
+    if (cache->name_hash == NULL)
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+
+    cache->entries = calloc(MSDOS_NAME_CACHE_MAX_ENTRIES,
+                            sizeof(*cache->entries));
+    cache->scan_name = malloc(MSDOS_NAME_MAX_UTF8_LFN_BYTES);
+    if (cache->entries == NULL || cache->scan_name == NULL)
+    {
+        free(cache->name_hash);
+        cache->name_hash = NULL;
+        free(cache->entries);
+        cache->entries = NULL;
+        free(cache->scan_name);
+        cache->scan_name = NULL;
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+    }
+
+    cache->pos_hash = cache->name_hash + MSDOS_NAME_CACHE_HASH_SIZE;
+
+    for (i = 0; i < MSDOS_NAME_CACHE_HASH_SIZE; ++i)
+    {
+        rtems_chain_initialize_empty(&cache->name_hash[i]);
+        rtems_chain_initialize_empty(&cache->pos_hash[i]);
+    }
+
+    rtems_chain_initialize_empty(&cache->lru);
+    rtems_chain_initialize_empty(&cache->free);
+
+    for (i = 0; i < MSDOS_NAME_CACHE_MAX_ENTRIES; ++i)
+        rtems_chain_append_unprotected(&cache->free,
+                                       &cache->entries[i].lru_link);
+
+    cache->count = 0;
+
+    return RC_OK;
+}
+
+void
+msdos_name_cache_destroy(msdos_name_cache_t *cache)
+{
+    free(cache->name_hash);
+    cache->name_hash = NULL;
+    cache->pos_hash = NULL;
+    free(cache->entries);
+    cache->entries = NULL;
+    free(cache->scan_name);
+    cache->scan_name = NULL;
+}
+
+static msdos_name_cache_entry_t *
+msdos_name_cache_find(msdos_name_cache_t *cache,
+                      uint32_t            dir_cln,
+                      const uint8_t      *name,
+                      size_t              name_len)
+{
+    uint32_t             hash;
+    rtems_chain_control *bucket;
+    rtems_chain_node    *node;
+
+    hash = msdos_name_cache_hash(dir_cln, name, name_len);
+    bucket = &cache->name_hash[hash % MSDOS_NAME_CACHE_HASH_SIZE];
+
+    for (node = rtems_chain_first(bucket);
+         !rtems_chain_is_tail(bucket, node);
+         node = rtems_chain_next(node))
+    {
+        msdos_name_cache_entry_t *entry =
+            RTEMS_CONTAINER_OF(node, msdos_name_cache_entry_t, name_link);
+
+        if (entry->hash == hash &&
+            entry->dir_cln == dir_cln &&
+            entry->name_len == name_len &&
+            memcmp(entry->name, name, name_len) == 0)
+            return entry;
+    }
+
+    return NULL;
+}
+
+bool
+msdos_name_cache_lookup(msdos_name_cache_t *cache,
+                        uint32_t            dir_cln,
+                        const uint8_t      *name,
+                        size_t              name_len,
+                        char               *sfn,
+                        uint32_t           *sfn_offset,
+                        uint32_t           *lfn_offset)
+{
+    msdos_name_cache_entry_t *entry;
+
+    if (cache->name_hash == NULL)
+        return false;
+
+    entry = msdos_name_cache_find(cache, dir_cln, name, name_len);
+    if (entry == NULL)
+        return false;
+
+    rtems_chain_extract_unprotected(&entry->lru_link);
+    rtems_chain_append_unprotected(&cache->lru, &entry->lru_link);
+
+    memcpy(sfn, entry->sfn, MSDOS_SHORT_NAME_LEN);
+    *sfn_offset = entry->sfn_offset;
+    *lfn_offset = entry->lfn_offset;
+    return true;
+}
+
+static void
+msdos_name_cache_enter(msdos_name_cache_t *cache,
+                       uint32_t            dir_cln,
+                       const uint8_t      *name,
+                       size_t              name_len,
+                       const char         *sfn,
+                       const fat_pos_t    *sname,
+                       uint32_t            sfn_offset,
+                       uint32_t            lfn_offset,
+                       bool                recently_used)
+{
+    msdos_name_cache_entry_t *entry;
+    rtems_chain_node         *node;
+
+    if (name_len > MSDOS_NAME_CACHE_NAME_SIZE)
+        return;
+
+    /* Recycle the least recently used entry if no free entry is left */
+    if (rtems_chain_is_empty(&cache->free))
+    {
+        node = rtems_chain_first(&cache->lru);
+        msdos_name_cache_remove(cache,
+            RTEMS_CONTAINER_OF(node, msdos_name_cache_entry_t, lru_link));
+    }
+
+    node = rtems_chain_get_first_unprotected(&cache->free);
+    entry = RTEMS_CONTAINER_OF(node, msdos_name_cache_entry_t, lru_link);
+
+    entry->dir_cln = dir_cln;
+    entry->hash = msdos_name_cache_hash(dir_cln, name, name_len);
+    entry->sname = *sname;
+    entry->sfn_offset = sfn_offset;
+    entry->lfn_offset = lfn_offset;
+    memcpy(entry->sfn, sfn, MSDOS_SHORT_NAME_LEN);
+    entry->name_len = name_len;
+    memcpy(entry->name, name, name_len);
+
+    rtems_chain_append_unprotected(
+        &cache->name_hash[entry->hash % MSDOS_NAME_CACHE_HASH_SIZE],
+        &entry->name_link);
+    rtems_chain_append_unprotected(
+        &cache->pos_hash[msdos_name_cache_pos_hash(sname) %
+                         MSDOS_NAME_CACHE_HASH_SIZE],
+        &entry->pos_link);
+
+    if (recently_used)
+        rtems_chain_append_unprotected(&cache->lru, &entry->lru_link);
+    else
+        rtems_chain_prepend_unprotected(&cache->lru, &entry->lru_link);
+
+    ++cache->count;
+}
+
+void
+msdos_name_cache_insert(msdos_name_cache_t *cache,
+                        uint32_t            dir_cln,
+                        const uint8_t      *name,
+                        size_t              name_len,
+                        const char         *sfn,
+                        const fat_pos_t    *sname,
+                        uint32_t            sfn_offset,
+                        uint32_t            lfn_offset)
+{
+    if (cache->name_hash == NULL)
+        return;
+
+    /*
+     * Drop previous entries for the same name and for the same directory entry
+     * position, the name may have a different form (e.g. short versus long
+     * name lookup).
+     */
+    msdos_name_cache_invalidate_name(cache, dir_cln, name, name_len);
+    msdos_name_cache_invalidate_entry(cache, sname);
+
+    msdos_name_cache_enter(cache, dir_cln, name, name_len, sfn, sname,
+                           sfn_offset, lfn_offset, true);
+}
+
+void
+msdos_name_cache_add_scanned(msdos_name_cache_t *cache,
+                             uint32_t            dir_cln,
+                             const uint8_t      *name,
+                             size_t              name_len,
+                             const char         *sfn,
+                             const fat_pos_t    *sname,
+                             uint32_t            sfn_offset,
+                             uint32_t            lfn_offset)
+{
+    rtems_chain_control *bucket;
+    rtems_chain_node    *node;
+
+    if (cache->name_hash == NULL)
+        return;
+
+    /*
+     * The first entry of a directory scan with a name wins, so keep existing
+     * entries for the name.  Keep also existing entries for the position, they
+     * were entered by an actual lookup.
+     */
+    if (msdos_name_cache_find(cache, dir_cln, name, name_len) != NULL)
+        return;
+
+    bucket = &cache->pos_hash[msdos_name_cache_pos_hash(sname) %
+                              MSDOS_NAME_CACHE_HASH_SIZE];
+
+    for (node = rtems_chain_first(bucket);
+         !rtems_chain_is_tail(bucket, node);
+         node = rtems_chain_next(node))
+    {
+        msdos_name_cache_entry_t *entry =
+            RTEMS_CONTAINER_OF(node, msdos_name_cache_entry_t, pos_link);
+
+        if (entry->sname.cln == sname->cln && entry->sname.ofs == sname->ofs)
+            return;
+    }
+
+    /*
+     * Entries which were only passed by a directory scan are entered as least
+     * recently used, so that a scan of a large directory cannot evict the
+     * entries of actual lookups.
+     */
+    msdos_name_cache_enter(cache, dir_cln, name, name_len, sfn, sname,
+                           sfn_offset, lfn_offset, false);
+}
+
+void
+msdos_name_cache_invalidate_entry(msdos_name_cache_t *cache,
+                                  const fat_pos_t    *sname)
+{
+    rtems_chain_control *bucket;
+    rtems_chain_node    *node;
+
+    if (cache->name_hash == NULL)
+        return;
+
+    bucket = &cache->pos_hash[msdos_name_cache_pos_hash(sname) %
+                              MSDOS_NAME_CACHE_HASH_SIZE];
+    node = rtems_chain_first(bucket);
+
+    while (!rtems_chain_is_tail(bucket, node))
+    {
+        msdos_name_cache_entry_t *entry =
+            RTEMS_CONTAINER_OF(node, msdos_name_cache_entry_t, pos_link);
+
+        node = rtems_chain_next(node);
+
+        if (entry->sname.cln == sname->cln && entry->sname.ofs == sname->ofs)
+            msdos_name_cache_remove(cache, entry);
+    }
+}
+
+void
+msdos_name_cache_invalidate_name(msdos_name_cache_t *cache,
+                                 uint32_t            dir_cln,
+                                 const uint8_t      *name,
+                                 size_t              name_len)
+{
+    msdos_name_cache_entry_t *entry;
+
+    if (cache->name_hash == NULL)
+        return;
+
+    entry = msdos_name_cache_find(cache, dir_cln, name, name_len);
+    if (entry != NULL)
+        msdos_name_cache_remove(cache, entry);
+}
+
+void
+msdos_name_cache_invalidate_directory(msdos_name_cache_t *cache,
+                                      uint32_t            dir_cln)
+{
+    rtems_chain_node *node;
+
+    if (cache->name_hash == NULL)
+        return;
+
+    node = rtems_chain_first(&cache->lru);
+
+    while (!rtems_chain_is_tail(&cache->lru, node))
+    {
+        msdos_name_cache_entry_t *entry =
+            RTEMS_CONTAINER_OF(node, msdos_name_cache_entry_t, lru_link);
+
+        node = rtems_chain_next(node);
+
+        if (entry->dir_cln == dir_cln)
+            msdos_name_cache_remove(cache, entry);
+    }
+}
@@ -70,6 +70,16 @@ msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
         return rc;
     }
 
+    if (fat_fd->fat_file_type == FAT_DIRECTORY)
+    {
+        /*
+         * The clusters of the directory will be reused, so forget everything
+         * cached for it.
+         */
+        msdos_name_cache_invalidate_directory(&fs_info->name_cache,
+                                              fat_fd->cln);
+    }
+
     fat_file_mark_removed(&fs_info->fat, fat_fd);
 
     return rc;
@@ -1411,7 +1411,8 @@ static const rtems_filesystem_file_handlers_r rtems_ftpfs_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static const rtems_filesystem_file_handlers_r rtems_ftpfs_root_handlers = {
@@ -1430,5 +1431,6 @@ static const rtems_filesystem_file_handlers_r rtems_ftpfs_root_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
@@ -91,6 +91,7 @@ int IMFS_add_node( const char *path, IMFS_jnode_t *node, void *arg )
         IMFS_assert( parent != NULL );
         IMFS_add_to_directory( parent, node );
         IMFS_mtime_ctime_update( parent );
+        rtems_filesystem_name_cache_invalidate( currentloc->mt_entry );
         rv = 0;
       } else {
         rv = -1;
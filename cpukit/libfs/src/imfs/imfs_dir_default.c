@@ -23,7 +23,7 @@
 #include <dirent.h>
 #include <string.h>
 
-static ssize_t IMFS_dir_read(
+ssize_t IMFS_dir_read(
   rtems_libio_t  *iop,
   void           *buffer,
   size_t          count
@@ -108,7 +108,7 @@ static size_t IMFS_directory_size( const IMFS_jnode_t *node )
   return size;
 }
 
-static int IMFS_stat_directory(
+int IMFS_stat_directory(
   const rtems_filesystem_location_info_t *loc,
   struct stat *buf
 )
@@ -136,7 +136,8 @@ static const rtems_filesystem_file_handlers_r IMFS_dir_default_handlers = {
   .mmap_h = rtems_filesystem_default_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 const IMFS_mknod_control IMFS_mknod_control_dir_default = {
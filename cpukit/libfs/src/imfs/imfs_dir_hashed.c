@@ -0,0 +1,338 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Directories with a Hashed Name Index
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The index is an open addressing hash table with linear probing.  It
+ * contains only pointers to the nodes, so the nodes need no additional
+ * storage.  At least one slot of the table is always empty, this terminates
+ * the probe sequences.
+ */
+
+#define IMFS_DIR_HASH_INITIAL_SIZE 16
+
+typedef struct {
+  IMFS_directory_index   Base;
+  size_t                 size;
+  size_t                 count;
+  IMFS_jnode_t         **table;
+} IMFS_directory_hash;
+
+static uint32_t IMFS_dir_hash_name( const char *name, size_t namelen )
+{
+  uint32_t hash = 2166136261U;
+  size_t   i;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash ^= (uint8_t) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static size_t IMFS_dir_hash_slot(
+  const IMFS_directory_hash *hash,
+  const char                *name,
+  size_t                     namelen
+)
+{
+  return IMFS_dir_hash_name( name, namelen ) & ( hash->size - 1 );
+}
+
+static void IMFS_dir_hash_insert(
+  IMFS_directory_hash *hash,
+  IMFS_jnode_t        *node
+)
+{
+  size_t mask = hash->size - 1;
+  size_t i = IMFS_dir_hash_slot( hash, node->name, node->namelen );
+
+  while ( hash->table[ i ] != NULL ) {
+    i = ( i + 1 ) & mask;
+  }
+
+  hash->table[ i ] = node;
+  ++hash->count;
+}
+
+static bool IMFS_dir_hash_rebuild(
+  IMFS_directory_t    *dir,
+  IMFS_directory_hash *hash,
+  size_t               size
+)
+{
+  IMFS_jnode_t     **table;
+  rtems_chain_node  *current;
+  rtems_chain_node  *tail;
+
+  table = calloc( size, sizeof( *table ) );
+  if ( table == NULL ) {
+    return false;
+  }
+
+  free( hash->table );
+  hash->table = table;
+  hash->size = size;
+  hash->count = 0;
+
+  current = rtems_chain_first( &dir->Entries );
+  tail = rtems_chain_tail( &dir->Entries );
+
+  while ( current != tail ) {
+    IMFS_dir_hash_insert( hash, (IMFS_jnode_t *) current );
+    current = rtems_chain_next( current );
+  }
+
+  return true;
+}
+
+static bool IMFS_dir_hash_is_match(
+  const IMFS_jnode_t *entry,
+  const char         *name,
+  size_t              namelen
+)
+{
+  return entry->namelen == namelen && memcmp( entry->name, name, namelen ) == 0;
+}
+
+static IMFS_jnode_t *IMFS_dir_hash_lookup(
+  IMFS_directory_t *dir,
+  const char       *name,
+  size_t            namelen
+)
+{
+  IMFS_directory_hash *hash = (IMFS_directory_hash *) dir->index;
+
+  if ( hash->table != NULL ) {
+    size_t        mask = hash->size - 1;
+    size_t        i = IMFS_dir_hash_slot( hash, name, namelen );
+    IMFS_jnode_t *entry;
+
+    while ( ( entry = hash->table[ i ] ) != NULL ) {
+      if ( IMFS_dir_hash_is_match( entry, name, namelen ) ) {
+        return entry;
+      }
+
+      i = ( i + 1 ) & mask;
+    }
+  } else {
+    /* The table could not be allocated, use the linear search */
+    rtems_chain_node *current = rtems_chain_first( &dir->Entries );
+    rtems_chain_node *tail = rtems_chain_tail( &dir->Entries );
+
+    while ( current != tail ) {
+      IMFS_jnode_t *entry = (IMFS_jnode_t *) current;
+
+      if ( IMFS_dir_hash_is_match( entry, name, namelen ) ) {
+        return entry;
+      }
+
+      current = rtems_chain_next( current );
+    }
+  }
+
+  return NULL;
+}
+
+static void IMFS_dir_hash_add( IMFS_directory_t *dir, IMFS_jnode_t *node )
+{
+  IMFS_directory_hash *hash = (IMFS_directory_hash *) dir->index;
+
+  /*
+   * The node is already on the entries chain, so a rebuild inserts it into
+   * the new table.
+   */
+  if ( hash->table == NULL ) {
+    size_t size = IMFS_DIR_HASH_INITIAL_SIZE;
+    size_t count = 0;
+    rtems_chain_node *current = rtems_chain_first( &dir->Entries );
+    rtems_chain_node *tail = rtems_chain_tail( &dir->Entries );
+
+    while ( current != tail ) {
+      ++count;
+      current = rtems_chain_next( current );
+    }
+
+    while ( 4 * count > 3 * size ) {
+      size *= 2;
+    }
+
+    (void) IMFS_dir_hash_rebuild( dir, hash, size );
+  } else if ( 4 * ( hash->count + 1 ) > 3 * hash->size ) {
+    if ( !IMFS_dir_hash_rebuild( dir, hash, 2 * hash->size ) ) {
+      if ( hash->count + 1 < hash->size ) {
+        IMFS_dir_hash_insert( hash, node );
+      } else {
+        /* Keep one slot empty, try again with the next added node */
+        free( hash->table );
+        hash->table = NULL;
+        hash->size = 0;
+        hash->count = 0;
+      }
+    }
+  } else {
+    IMFS_dir_hash_insert( hash, node );
+  }
+}
+
+static void IMFS_dir_hash_remove( IMFS_directory_t *dir, IMFS_jnode_t *node )
+{
+  IMFS_directory_hash *hash = (IMFS_directory_hash *) dir->index;
+  size_t               mask;
+  size_t               i;
+  size_t               j;
+
+  if ( hash->table == NULL ) {
+    return;
+  }
+
+  mask = hash->size - 1;
+  i = IMFS_dir_hash_slot( hash, node->name, node->namelen );
+
+  while ( hash->table[ i ] != node ) {
+    IMFS_assert( hash->table[ i ] != NULL );
+    i = ( i + 1 ) & mask;
+  }
+
+  /*
+   * Move the following entries of the probe sequence back, so that no
+   * deleted markers are necessary.
+   */
+  j = i;
+
+  while ( true ) {
+    IMFS_jnode_t *entry;
+    size_t        k;
+
+    j = ( j + 1 ) & mask;
+    entry = hash->table[ j ];
+
+    if ( entry == NULL ) {
+      break;
+    }
+
+    k = IMFS_dir_hash_slot( hash, entry->name, entry->namelen );
+
+    if ( ( ( j - k ) & mask ) >= ( ( j - i ) & mask ) ) {
+      hash->table[ i ] = entry;
+      i = j;
+    }
+  }
+
+  hash->table[ i ] = NULL;
+  --hash->count;
+}
+
+static const IMFS_directory_index_operations IMFS_dir_hash_ops = {
+  .lookup = IMFS_dir_hash_lookup,
+  .add = IMFS_dir_hash_add,
+  .remove = IMFS_dir_hash_remove
+};
+
+static IMFS_jnode_t *IMFS_node_initialize_dir_hashed(
+  IMFS_jnode_t *node,
+  void         *arg
+)
+{
+  IMFS_directory_t    *dir;
+  IMFS_directory_hash *hash;
+
+  node = IMFS_node_initialize_directory( node, arg );
+  dir = (IMFS_directory_t *) node;
+
+  /*
+   * The table is allocated with the first entry.  Without memory for the
+   * index the directory behaves like a default directory.
+   */
+  hash = calloc( 1, sizeof( *hash ) );
+  if ( hash != NULL ) {
+    hash->Base.ops = &IMFS_dir_hash_ops;
+    dir->index = &hash->Base;
+  }
+
+  return node;
+}
+
+static void IMFS_node_destroy_dir_hashed( IMFS_jnode_t *node )
+{
+  IMFS_directory_t    *dir = (IMFS_directory_t *) node;
+  IMFS_directory_hash *hash = (IMFS_directory_hash *) dir->index;
+
+  if ( hash != NULL ) {
+    free( hash->table );
+    free( hash );
+  }
+
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_dir_hashed_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_dir_read,
+  .write_h = rtems_filesystem_default_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_directory,
+  .fstat_h = IMFS_stat_directory,
+  .ftruncate_h = rtems_filesystem_default_ftruncate_directory,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
+};
+
+const IMFS_mknod_control IMFS_mknod_control_dir_hashed = {
+  {
+    .handlers = &IMFS_dir_hashed_handlers,
+    .node_initialize = IMFS_node_initialize_dir_hashed,
+    .node_remove = IMFS_node_remove_directory,
+    .node_destroy = IMFS_node_destroy_dir_hashed
+  },
+  .node_size = sizeof( IMFS_directory_t )
+};
@@ -49,6 +49,8 @@ static IMFS_jnode_t *IMFS_search_in_directory(
   } else {
     if ( rtems_filesystem_is_parent_directory( token, tokenlen ) ) {
       return dir->Node.Parent;
+    } else if ( dir->index != NULL ) {
+      return ( *dir->index->ops->lookup )( dir, token, tokenlen );
     } else {
       rtems_chain_control *entries = &dir->Entries;
       rtems_chain_node *current = rtems_chain_first( entries );
@@ -71,6 +73,50 @@ static IMFS_jnode_t *IMFS_search_in_directory(
   }
 }
 
+static IMFS_jnode_t *IMFS_lookup_in_directory(
+  const rtems_filesystem_location_info_t *currentloc,
+  IMFS_directory_t *dir,
+  const char *token,
+  size_t tokenlen
+)
+{
+  IMFS_jnode_t *entry;
+  uintptr_t child;
+  uintptr_t child_2;
+
+  if (
+    rtems_filesystem_is_current_directory( token, tokenlen )
+      || rtems_filesystem_is_parent_directory( token, tokenlen )
+  ) {
+    return IMFS_search_in_directory( dir, token, tokenlen );
+  }
+
+  if (
+    rtems_filesystem_name_cache_lookup(
+      currentloc->mt_entry,
+      (uintptr_t) dir,
+      token,
+      tokenlen,
+      &child,
+      &child_2
+    )
+  ) {
+    return (IMFS_jnode_t *) child;
+  }
+
+  entry = IMFS_search_in_directory( dir, token, tokenlen );
+  rtems_filesystem_name_cache_enter(
+    currentloc->mt_entry,
+    (uintptr_t) dir,
+    token,
+    tokenlen,
+    (uintptr_t) entry,
+    0
+  );
+
+  return entry;
+}
+
 static rtems_filesystem_global_location_t **IMFS_is_mount_point(
   IMFS_jnode_t *node,
   mode_t mode
@@ -110,7 +156,8 @@ static rtems_filesystem_eval_path_generic_status IMFS_eval_token(
   );
 
   if ( access_ok ) {
-    IMFS_jnode_t *entry = IMFS_search_in_directory( dir, token, tokenlen );
+    IMFS_jnode_t *entry =
+      IMFS_lookup_in_directory( currentloc, dir, token, tokenlen );
 
     if ( entry != NULL ) {
       bool terminal = !rtems_filesystem_eval_path_has_path( ctx );
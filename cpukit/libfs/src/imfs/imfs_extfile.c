@@ -0,0 +1,432 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Extent File Support
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <sys/param.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
+static unsigned char *IMFS_extfile_allocate( size_t *size, size_t min_size )
+{
+  unsigned char *data;
+
+  data = malloc( *size );
+
+  if ( data == NULL && *size > min_size ) {
+    *size = min_size;
+    data = malloc( *size );
+  }
+
+  return data;
+}
+
+/*
+ * Ensures that the file has a capacity of at least new_size bytes.  The
+ * capacity grows geometrically.
+ */
+static int IMFS_extfile_reserve( IMFS_extfile_t *extfile, size_t new_size )
+{
+  IMFS_extfile_extent *extent;
+  size_t               size;
+  size_t               min_size;
+
+  if ( new_size <= extfile->capacity ) {
+    return 0;
+  }
+
+  size = MAX( new_size, (size_t) IMFS_MEMFILE_BYTES_PER_BLOCK );
+
+  if ( extfile->capacity <= SIZE_MAX / 2 ) {
+    size = MAX( size, 2 * extfile->capacity );
+  }
+
+  /*
+   * Keep the file contiguous as long as nobody has a pointer to the data.
+   */
+  if ( extfile->extent_count == 1 && !extfile->mapped ) {
+    unsigned char *data;
+
+    extent = &extfile->extents[ 0 ];
+    data = realloc( extent->data, size );
+
+    if ( data == NULL && size > new_size ) {
+      size = new_size;
+      data = realloc( extent->data, size );
+    }
+
+    if ( data != NULL ) {
+      extent->data = data;
+      extent->size = size;
+      extfile->capacity = size;
+      return 0;
+    }
+  }
+
+  if ( extfile->extent_count >= IMFS_EXTFILE_EXTENT_COUNT ) {
+    rtems_set_errno_and_return_minus_one( ENOSPC );
+  }
+
+  min_size = new_size - extfile->capacity;
+  size -= extfile->capacity;
+  extent = &extfile->extents[ extfile->extent_count ];
+  extent->data = IMFS_extfile_allocate( &size, min_size );
+
+  if ( extent->data == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOSPC );
+  }
+
+  extent->size = size;
+  extfile->capacity += size;
+  ++extfile->extent_count;
+
+  return 0;
+}
+
+/*
+ * Copies data from or to the file.  The area must be within the capacity of
+ * the file.  If buffer is NULL, then the area is filled with zeros.
+ */
+static void IMFS_extfile_copy(
+  IMFS_extfile_t *extfile,
+  size_t          offset,
+  unsigned char  *buffer,
+  size_t          count,
+  bool            to_file
+)
+{
+  const IMFS_extfile_extent *extent = &extfile->extents[ 0 ];
+
+  if ( count == 0 ) {
+    return;
+  }
+
+  while ( offset >= extent->size ) {
+    offset -= extent->size;
+    ++extent;
+  }
+
+  while ( count > 0 ) {
+    size_t n = MIN( count, extent->size - offset );
+
+    if ( buffer == NULL ) {
+      memset( extent->data + offset, 0, n );
+    } else {
+      if ( to_file ) {
+        memcpy( extent->data + offset, buffer, n );
+      } else {
+        memcpy( buffer, extent->data + offset, n );
+      }
+
+      buffer += n;
+    }
+
+    count -= n;
+    offset = 0;
+    ++extent;
+  }
+}
+
+static int IMFS_extfile_extend( IMFS_extfile_t *extfile, off_t new_length )
+{
+  size_t old_size;
+  int    rv;
+
+  if ( (uintmax_t) new_length > SIZE_MAX ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  old_size = extfile->File.size;
+
+  if ( (size_t) new_length <= old_size ) {
+    return 0;
+  }
+
+  rv = IMFS_extfile_reserve( extfile, (size_t) new_length );
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  /* A truncate may have left old data behind the end of file */
+  IMFS_extfile_copy(
+    extfile,
+    old_size,
+    NULL,
+    (size_t) new_length - old_size,
+    true
+  );
+  extfile->File.size = (size_t) new_length;
+
+  return 0;
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  off_t           start = iop->offset;
+  size_t          size = extfile->File.size;
+
+  if ( start >= (off_t) size ) {
+    count = 0;
+  } else if ( count > size - (size_t) start ) {
+    count = size - (size_t) start;
+  }
+
+  IMFS_extfile_copy( extfile, (size_t) start, buffer, count, false );
+  IMFS_update_atime( &extfile->File.Node );
+  iop->offset = start + (off_t) count;
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  off_t           start;
+  int             rv;
+
+  if ( rtems_libio_iop_is_append( iop ) ) {
+    iop->offset = extfile->File.size;
+  }
+
+  start = iop->offset;
+
+  if ( count > (size_t) SSIZE_MAX ) {
+    count = SSIZE_MAX;
+  }
+
+  rv = IMFS_extfile_extend( extfile, start + (off_t) count );
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  IMFS_extfile_copy(
+    extfile,
+    (size_t) start,
+    RTEMS_DECONST( void *, buffer ),
+    count,
+    true
+  );
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+  iop->offset = start + (off_t) count;
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate( rtems_libio_t *iop, off_t length )
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+
+  if ( length > (off_t) extfile->File.size ) {
+    int rv;
+
+    rv = IMFS_extfile_extend( extfile, length );
+    if ( rv != 0 ) {
+      return rv;
+    }
+  } else {
+    /*
+     * Keep the memory, it may be mapped and it is likely used again by
+     * further writes.
+     */
+    extfile->File.size = (size_t) length;
+  }
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+/*
+ * Merges all extents into one.  This is only allowed if the file was not
+ * mapped before.
+ */
+static int IMFS_extfile_make_contiguous( IMFS_extfile_t *extfile )
+{
+  unsigned char *data;
+  size_t         offset;
+  uint8_t        i;
+
+  data = malloc( extfile->capacity );
+  if ( data == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOMEM );
+  }
+
+  offset = 0;
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    IMFS_extfile_extent *extent = &extfile->extents[ i ];
+
+    memcpy( data + offset, extent->data, extent->size );
+    offset += extent->size;
+    free( extent->data );
+  }
+
+  extfile->extents[ 0 ].data = data;
+  extfile->extents[ 0 ].size = extfile->capacity;
+  extfile->extent_count = 1;
+
+  return 0;
+}
+
+/*
+ * Shared mappings get a direct pointer to the file data.  The extents of a
+ * mapped file are neither moved nor released by a truncate.  mmap() holds a
+ * reference to the file for each shared mapping, so IMFS_extfile_destroy()
+ * releases the extents only after the last munmap() of the file.
+ */
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_extfile_t      *extfile = IMFS_iop_to_extfile( iop );
+  IMFS_extfile_extent *extent;
+  size_t               offset;
+
+  (void) prot;
+
+  if ( off < 0 || (uintmax_t) off > extfile->File.size ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  offset = (size_t) off;
+
+  if ( len > extfile->File.size - offset ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  if ( extfile->extent_count == 0 ) {
+    int rv;
+
+    rv = IMFS_extfile_reserve( extfile, MAX( len, 1 ) );
+    if ( rv != 0 ) {
+      return rv;
+    }
+  }
+
+  extent = &extfile->extents[ 0 ];
+
+  while ( offset >= extent->size ) {
+    offset -= extent->size;
+    ++extent;
+  }
+
+  if ( len > extent->size - offset ) {
+    int rv;
+
+    if ( extfile->mapped ) {
+      rtems_set_errno_and_return_minus_one( ENOTSUP );
+    }
+
+    rv = IMFS_extfile_make_contiguous( extfile );
+    if ( rv != 0 ) {
+      return rv;
+    }
+
+    extent = &extfile->extents[ 0 ];
+    offset = (size_t) off;
+  }
+
+  extfile->mapped = true;
+  *addr = extent->data + offset;
+  IMFS_update_atime( &extfile->File.Node );
+
+  return 0;
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_t *extfile = (IMFS_extfile_t *) node;
+  uint8_t         i;
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    free( extfile->extents[ i ].data );
+  }
+
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = IMFS_extfile_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_extfile_t )
+};
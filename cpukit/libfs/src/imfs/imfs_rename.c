@@ -82,6 +82,12 @@ int IMFS_rename(
 
   memcpy( control->name, name, namelen );
 
+  /*
+   * Remove the node while it still has its old name, a directory index may
+   * need the name to find the node.
+   */
+  IMFS_remove_from_directory( node );
+
   if ( node->control->node_destroy == IMFS_renamed_destroy ) {
     IMFS_restore_replaced_control( node );
   }
@@ -93,7 +99,6 @@ int IMFS_rename(
   node->name = control->name;
   node->namelen = namelen;
 
-  IMFS_remove_from_directory( node );
   IMFS_add_to_directory( new_parent, node );
   IMFS_update_ctime( node );
 
@@ -1,4 +1,8 @@
 #ifndef _LINUX_UIO_H
 #define _LINUX_UIO_H
 
+#include <sys/uio.h>
+
+#define kvec iovec
+
 #endif /* _LINUX_UIO_H */
@@ -45,7 +45,8 @@ uint16_t jffs2_compress(struct jffs2_sb_info *c, struct jffs2_inode_info *f,
 	rtems_jffs2_compressor_control *cc = sb->s_compressor_control;
 	int ret;
 
-	if (cc != NULL) {
+	/* RTEMS: Honour the per-inode compression selection */
+	if (cc != NULL && f->usercompr != RTEMS_JFFS2_COMPRESSION_NONE) {
 		*cpage_out = &cc->buffer[0];
 		ret = (*cc->compress)(cc, data_in, *cpage_out, datalen, cdatalen);
 	} else {
@@ -56,7 +57,10 @@ uint16_t jffs2_compress(struct jffs2_sb_info *c, struct jffs2_inode_info *f,
 		*cpage_out = data_in;
 		*datalen = *cdatalen;
 	}
-	return ret;
+
+	/* RTEMS: Store the compression selection in the upper byte, so that it
+	   ends up in the usercompr field of the node */
+	return ret | (f->usercompr << 8);
 }
 
 int jffs2_decompress(struct jffs2_sb_info *c, struct jffs2_inode_info *f,
@@ -67,9 +71,9 @@ int jffs2_decompress(struct jffs2_sb_info *c, struct jffs2_inode_info *f,
 	rtems_jffs2_compressor_control *cc = sb->s_compressor_control;
 
 	/* Older code had a bug where it would write non-zero 'usercompr'
-	   fields. Deal with it. */
-	if ((comprtype & 0xff) <= JFFS2_COMPR_ZLIB)
-		comprtype &= 0xff;
+	   fields. Deal with it.  RTEMS: The upper byte contains the
+	   compression selection of the inode, see jffs2_compress(). */
+	comprtype &= 0xff;
 
 	switch (comprtype & 0xff) {
 	case JFFS2_COMPR_NONE:
@@ -0,0 +1,360 @@
+#include "rtems-jffs2-config.h"
+
+/*
+ * JFFS2 -- Journalling Flash File System, Version 2.
+ *
+ * Copyright © 2026 embedded brains GmbH <rtems@embedded-brains.de>
+ *
+ * For licensing information, see the file 'LICENCE' in this directory.
+ *
+ *
+ *
+ * LZ4 block format encoder and decoder.
+ *
+ * The encoder uses a single hash table of the last positions of four byte
+ * sequences and performs a greedy match search.  The input is at most one
+ * page, so all match offsets fit into the 16-bit offsets of the format.
+ *
+ * The decoder checks all lengths and offsets against the buffer limits, so
+ * corrupt flash data cannot lead to out of bounds accesses.
+ *
+ */
+
+#include <linux/kernel.h>
+#include <linux/types.h>
+#include <linux/errno.h>
+#include <linux/string.h>
+#include <linux/jffs2.h>
+#include "compr.h"
+
+#define LZ4_MIN_MATCH 4
+
+#define LZ4_LAST_LITERALS 5
+
+#define LZ4_MF_LIMIT 12
+
+#define LZ4_MAX_OFFSET 65535
+
+#define LZ4_RUN_MASK 15
+
+static uint32_t lz4_read32(const unsigned char *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t lz4_hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - RTEMS_JFFS2_COMPRESSOR_LZ4_HASH_LOG);
+}
+
+static unsigned char *lz4_put_length(unsigned char *op, uint32_t len)
+{
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+
+	*op++ = (unsigned char) len;
+	return op;
+}
+
+static uint32_t lz4_sequence_size(uint32_t litlen, uint32_t matchlen)
+{
+	uint32_t size = 1 + litlen;
+
+	if (litlen >= LZ4_RUN_MASK)
+		size += (litlen - LZ4_RUN_MASK) / 255 + 1;
+
+	if (matchlen != 0) {
+		size += 2;
+		matchlen -= LZ4_MIN_MATCH;
+		if (matchlen >= LZ4_RUN_MASK)
+			size += (matchlen - LZ4_RUN_MASK) / 255 + 1;
+	}
+
+	return size;
+}
+
+static unsigned char *lz4_put_sequence(
+	unsigned char *op,
+	const unsigned char *literals,
+	uint32_t litlen,
+	uint32_t offset,
+	uint32_t matchlen
+)
+{
+	unsigned char *token = op++;
+
+	if (litlen >= LZ4_RUN_MASK) {
+		*token = LZ4_RUN_MASK << 4;
+		op = lz4_put_length(op, litlen - LZ4_RUN_MASK);
+	} else {
+		*token = (unsigned char) (litlen << 4);
+	}
+
+	memcpy(op, literals, litlen);
+	op += litlen;
+
+	if (matchlen != 0) {
+		*op++ = (unsigned char) offset;
+		*op++ = (unsigned char) (offset >> 8);
+
+		matchlen -= LZ4_MIN_MATCH;
+		if (matchlen >= LZ4_RUN_MASK) {
+			*token |= LZ4_RUN_MASK;
+			op = lz4_put_length(op, matchlen - LZ4_RUN_MASK);
+		} else {
+			*token |= (unsigned char) matchlen;
+		}
+	}
+
+	return op;
+}
+
+uint16_t rtems_jffs2_compressor_lz4_compress(
+	rtems_jffs2_compressor_control *super,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t *sourcelen,
+	uint32_t *dstlen
+)
+{
+	rtems_jffs2_compressor_lz4_control *self =
+		(rtems_jffs2_compressor_lz4_control *) super;
+	uint16_t *table = &self->hash_table[0];
+	uint32_t srclen = *sourcelen;
+	uint32_t outlen = *dstlen;
+	uint32_t ip;
+	uint32_t anchor;
+	uint32_t op;
+	uint32_t size;
+
+	if (srclen <= LZ4_MF_LIMIT || srclen > LZ4_MAX_OFFSET) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	memset(table, 0, sizeof(self->hash_table));
+	anchor = 0;
+	op = 0;
+	ip = 1;
+
+	while (ip + LZ4_MF_LIMIT <= srclen) {
+		uint32_t seq = lz4_read32(&data_in[ip]);
+		uint32_t h = lz4_hash(seq);
+		uint32_t ref = table[h];
+		uint32_t matchlen;
+		uint32_t matchlimit;
+
+		table[h] = (uint16_t) ip;
+
+		if (lz4_read32(&data_in[ref]) != seq) {
+			++ip;
+			continue;
+		}
+
+		/* Extend the match backwards into the pending literals */
+		while (ip > anchor && ref > 0 && data_in[ip - 1] == data_in[ref - 1]) {
+			--ip;
+			--ref;
+		}
+
+		matchlen = LZ4_MIN_MATCH;
+		matchlimit = srclen - LZ4_LAST_LITERALS;
+
+		while (ip + matchlen < matchlimit &&
+		       data_in[ip + matchlen] == data_in[ref + matchlen]) {
+			++matchlen;
+		}
+
+		size = lz4_sequence_size(ip - anchor, matchlen);
+		if (size > outlen - op) {
+			return JFFS2_COMPR_NONE;
+		}
+
+		op = (uint32_t) (lz4_put_sequence(
+			&cpage_out[op],
+			&data_in[anchor],
+			ip - anchor,
+			ip - ref,
+			matchlen
+		) - cpage_out);
+
+		ip += matchlen;
+		anchor = ip;
+
+		/* Make the positions near the match end available */
+		if (ip + LZ4_MF_LIMIT <= srclen) {
+			table[lz4_hash(lz4_read32(&data_in[ip - 2]))] = (uint16_t) (ip - 2);
+		}
+	}
+
+	size = lz4_sequence_size(srclen - anchor, 0);
+	if (size > outlen - op) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	op = (uint32_t) (lz4_put_sequence(
+		&cpage_out[op],
+		&data_in[anchor],
+		srclen - anchor,
+		0,
+		0
+	) - cpage_out);
+
+	if (op >= srclen) {
+		/* We failed */
+		return JFFS2_COMPR_NONE;
+	}
+
+	*dstlen = op;
+	return JFFS2_COMPR_LZ4;
+}
+
+static int lz4_get_length(
+	const unsigned char *data_in,
+	uint32_t srclen,
+	uint32_t *ip,
+	uint32_t *len
+)
+{
+	unsigned char b;
+
+	do {
+		if (*ip >= srclen) {
+			return -EIO;
+		}
+
+		b = data_in[*ip];
+		++(*ip);
+		*len += b;
+	} while (b == 255);
+
+	return 0;
+}
+
+static int lz4_decompress(
+	const unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t srclen,
+	uint32_t destlen
+)
+{
+	uint32_t ip = 0;
+	uint32_t op = 0;
+
+	while (true) {
+		unsigned char token;
+		uint32_t len;
+		uint32_t offset;
+
+		if (ip >= srclen) {
+			return -EIO;
+		}
+
+		token = data_in[ip++];
+
+		len = token >> 4;
+		if (len == LZ4_RUN_MASK && lz4_get_length(data_in, srclen, &ip, &len) != 0) {
+			return -EIO;
+		}
+
+		if (len > srclen - ip || len > destlen - op) {
+			return -EIO;
+		}
+
+		memcpy(&cpage_out[op], &data_in[ip], len);
+		ip += len;
+		op += len;
+
+		if (ip == srclen) {
+			/* The last sequence contains only literals */
+			break;
+		}
+
+		if (srclen - ip < 2) {
+			return -EIO;
+		}
+
+		offset = data_in[ip] | ((uint32_t) data_in[ip + 1] << 8);
+		ip += 2;
+
+		if (offset == 0 || offset > op) {
+			return -EIO;
+		}
+
+		len = token & LZ4_RUN_MASK;
+		if (len == LZ4_RUN_MASK && lz4_get_length(data_in, srclen, &ip, &len) != 0) {
+			return -EIO;
+		}
+
+		len += LZ4_MIN_MATCH;
+		if (len > destlen - op) {
+			return -EIO;
+		}
+
+		if (offset >= len) {
+			memcpy(&cpage_out[op], &cpage_out[op - offset], len);
+			op += len;
+		} else {
+			/* Overlapping copy, e.g. a run of repeated bytes */
+			const unsigned char *ref = &cpage_out[op - offset];
+			unsigned char *out = &cpage_out[op];
+
+			op += len;
+
+			while (len > 0) {
+				*out++ = *ref++;
+				--len;
+			}
+		}
+	}
+
+	if (op != destlen) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int rtems_jffs2_compressor_lz4_decompress(
+	rtems_jffs2_compressor_control *super,
+	uint16_t comprtype,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t srclen,
+	uint32_t destlen
+)
+{
+	rtems_jffs2_compressor_lz4_control *self =
+		(rtems_jffs2_compressor_lz4_control *) super;
+
+	switch (comprtype & 0xff) {
+	case JFFS2_COMPR_LZ4:
+		return lz4_decompress(data_in, cpage_out, srclen, destlen);
+	case JFFS2_COMPR_RTIME:
+		/* Keep file systems written with the RTIME compressor readable */
+		return rtems_jffs2_compressor_rtime_decompress(
+			super,
+			JFFS2_COMPR_RTIME,
+			data_in,
+			cpage_out,
+			srclen,
+			destlen
+		);
+	case JFFS2_COMPR_ZLIB:
+		/* Keep file systems written with the ZLIB compressor readable */
+		return rtems_jffs2_compressor_zlib_decompress(
+			&self->zlib.super,
+			JFFS2_COMPR_ZLIB,
+			data_in,
+			cpage_out,
+			srclen,
+			destlen
+		);
+	default:
+		return -EIO;
+	}
+}
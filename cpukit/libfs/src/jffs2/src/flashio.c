@@ -29,7 +29,7 @@ int jffs2_flash_read(struct jffs2_sb_info * c,
 	return (*fc->read)(fc, read_buffer_offset, write_buffer, size);
 }
 
-int jffs2_flash_write(struct jffs2_sb_info * c,
+static int jffs2_flash_direct_write(struct jffs2_sb_info * c,
 			   cyg_uint32 write_buffer_offset, const size_t size,
 			   size_t * return_size, unsigned char *read_buffer)
 {
@@ -41,6 +41,31 @@ int jffs2_flash_write(struct jffs2_sb_info * c,
 	return (*fc->write)(fc, write_buffer_offset, read_buffer, size);
 }
 
+int jffs2_flash_write(struct jffs2_sb_info * c,
+			   cyg_uint32 write_buffer_offset, const size_t size,
+			   size_t * return_size, unsigned char *read_buffer)
+{
+	int ret;
+
+	ret = jffs2_flash_direct_write(c, write_buffer_offset, size,
+				       return_size, read_buffer);
+
+	if (jffs2_sum_active()) {
+		struct kvec vecs[1];
+		int res;
+
+		vecs[0].iov_base = read_buffer;
+		vecs[0].iov_len = size;
+
+		res = jffs2_sum_add_kvec(c, vecs, 1, write_buffer_offset);
+		if (res) {
+			return res;
+		}
+	}
+
+	return ret;
+}
+
 int
 jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 		   unsigned long count, loff_t to, size_t * retlen)
@@ -49,6 +74,13 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 	size_t totlen = 0, thislen;
 	int ret = 0;
 
+	if (jffs2_sum_active()) {
+		ret = jffs2_sum_add_kvec(c, vecs, count, (uint32_t) to);
+		if (ret) {
+			return ret;
+		}
+	}
+
 	for (i = 0; i < count; i++) {
 		// writes need to be aligned but the data we're passed may not be
 		// Observation suggests most unaligned writes are small, so we
@@ -84,7 +116,7 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 					cbufptr += vecs[j].iov_len;
 				}
 				ret =
-				    jffs2_flash_write(c, to, sizetomalloc,
+				    jffs2_flash_direct_write(c, to, sizetomalloc,
 						      &thislen, cbuf);
 				if (thislen > totvecsize)	// in case it was aligned up
 					thislen = totvecsize;
@@ -103,14 +135,14 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 				memcpy(buf, vecs[i].iov_base, lentowrite);
 
 				ret =
-				    jffs2_flash_write(c, to, lentowrite,
+				    jffs2_flash_direct_write(c, to, lentowrite,
 						      &thislen, (char *) &buf);
 				if (thislen > vecs[i].iov_len)
 					thislen = vecs[i].iov_len;
 			}	// else
 		} else
 			ret =
-			    jffs2_flash_write(c, to, vecs[i].iov_len, &thislen,
+			    jffs2_flash_direct_write(c, to, vecs[i].iov_len, &thislen,
 					      vecs[i].iov_base);
 		totlen += thislen;
 		if (ret || thislen != vecs[i].iov_len)
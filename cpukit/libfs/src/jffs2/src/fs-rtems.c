@@ -29,6 +29,8 @@
 #include <assert.h>
 #include <rtems/libio.h>
 #include <rtems/libio_.h>
+#include <rtems/rtems/object.h>
+#include <rtems/rtems/tasks.h>
 
 /* Ensure that the JFFS2 values are identical to the POSIX defines */
 
@@ -130,6 +132,7 @@ static int jffs2_extend_file (struct _inode *inode, struct jffs2_raw_inode *ri,
 	ri->dsize = cpu_to_je32(offset - inode->i_size);
 	ri->csize = cpu_to_je32(0);
 	ri->compr = JFFS2_COMPR_ZERO;
+	ri->usercompr = f->usercompr;
 	ri->node_crc = cpu_to_je32(crc32(0, ri, sizeof(*ri)-8));
 	ri->data_crc = cpu_to_je32(0);
 		
@@ -244,6 +247,7 @@ static int jffs2_do_setattr (struct _inode *inode, struct iattr *iattr)
 	ri->offset = cpu_to_je32(0);
 	ri->csize = ri->dsize = cpu_to_je32(mdatalen);
 	ri->compr = JFFS2_COMPR_NONE;
+	ri->usercompr = f->usercompr;
 	if (ivalid & ATTR_SIZE && inode->i_size < iattr->ia_size) {
 		/* It's an extension. Make it a hole node */
 		ri->compr = JFFS2_COMPR_ZERO;
@@ -359,11 +363,17 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
 
 	if (do_mount_fs_was_successful) {
+		jffs2_sum_exit(c);
 		jffs2_free_ino_caches(c);
 		jffs2_free_raw_node_refs(c);
 		free(c->blocks);
 	}
 
+	if (sb->s_gc_task != 0) {
+		/* The task was created but not started */
+		(void) rtems_task_delete(sb->s_gc_task);
+	}
+
 	rtems_jffs2_flash_control_destroy(fs_info->sb.s_flash_control);
 	rtems_jffs2_compressor_control_destroy(fs_info->sb.s_compressor_control);
 	rtems_recursive_mutex_destroy(&sb->s_mutex);
@@ -556,6 +566,171 @@ static int rtems_jffs2_on_demand_garbage_collection(struct jffs2_sb_info *c)
 	}
 }
 
+static bool rtems_jffs2_gc_task_has_work(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	uint32_t dirty;
+
+	if (jffs2_thread_should_wake(c)) {
+		return true;
+	}
+
+	/* See jffs2_thread_should_wake() */
+	dirty = c->dirty_size + c->erasing_size - c->nr_erasing_blocks * c->sector_size;
+
+	return c->nr_free_blocks + c->nr_erasing_blocks < sb->s_gc_config.free_blocks_watermark
+		&& dirty > c->nospc_dirty_size;
+}
+
+static bool rtems_jffs2_gc_task_do_slice(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	uint32_t passes = sb->s_gc_config.passes_per_slice;
+	uint32_t i;
+	bool more;
+
+	rtems_jffs2_do_lock(sb);
+
+	more = rtems_jffs2_gc_task_has_work(sb);
+
+	for (i = 0; more && i < passes; ++i) {
+		int ret = jffs2_garbage_collect_pass(c);
+
+		if (ret != 0 && ret != -EAGAIN) {
+			/* Wait for the next trigger, e.g. the file system is full */
+			more = false;
+		} else {
+			more = rtems_jffs2_gc_task_has_work(sb);
+		}
+	}
+
+	rtems_jffs2_do_unlock(sb);
+
+	return more;
+}
+
+static void rtems_jffs2_gc_task(rtems_task_argument arg)
+{
+	struct super_block *sb = (struct super_block *) arg;
+	rtems_interval idle_interval = sb->s_gc_config.idle_interval;
+	rtems_event_set events = 0;
+	rtems_id stopper;
+
+	while ((events & RTEMS_JFFS2_GC_EVENT_STOP) == 0) {
+		bool more;
+
+		events = 0;
+		(void) rtems_event_receive(
+			RTEMS_JFFS2_GC_EVENT_TRIGGER | RTEMS_JFFS2_GC_EVENT_STOP,
+			RTEMS_EVENT_ANY | RTEMS_WAIT,
+			idle_interval != 0 ? idle_interval : RTEMS_NO_TIMEOUT,
+			&events
+		);
+
+		more = (events & RTEMS_JFFS2_GC_EVENT_STOP) == 0;
+
+		while (more) {
+			more = rtems_jffs2_gc_task_do_slice(sb);
+
+			if (more) {
+				/* Give the writers a chance to get the file system lock */
+				(void) rtems_event_receive(
+					RTEMS_JFFS2_GC_EVENT_STOP,
+					RTEMS_EVENT_ANY | RTEMS_WAIT,
+					sb->s_gc_config.slice_interval,
+					&events
+				);
+
+				more = (events & RTEMS_JFFS2_GC_EVENT_STOP) == 0;
+			}
+		}
+	}
+
+	stopper = sb->s_gc_stopper;
+	rtems_event_transient_send(stopper);
+	rtems_task_exit();
+}
+
+static int rtems_jffs2_gc_task_create(
+	struct super_block *sb,
+	const rtems_jffs2_gc_task_config *config
+)
+{
+	rtems_status_code sc;
+
+	sb->s_gc_config = *config;
+
+	if (sb->s_gc_config.passes_per_slice == 0) {
+		sb->s_gc_config.passes_per_slice = 1;
+	}
+
+	if (sb->s_gc_config.slice_interval == 0) {
+		sb->s_gc_config.slice_interval = 1;
+	}
+
+	sc = rtems_task_create(
+		rtems_build_name('J', 'F', 'G', 'C'),
+		config->priority,
+		config->stack_size,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_DEFAULT_ATTRIBUTES,
+		&sb->s_gc_task
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		sb->s_gc_task = 0;
+
+		return -rtems_status_code_to_errno(sc);
+	}
+
+	return 0;
+}
+
+static void rtems_jffs2_gc_task_start(struct super_block *sb)
+{
+	rtems_status_code sc;
+
+	sc = rtems_task_start(
+		sb->s_gc_task,
+		rtems_jffs2_gc_task,
+		(rtems_task_argument) sb
+	);
+	assert(sc == RTEMS_SUCCESSFUL);
+	(void) sc;
+}
+
+static void rtems_jffs2_gc_task_stop(struct super_block *sb)
+{
+	rtems_status_code sc;
+
+	if (sb->s_gc_task == 0) {
+		return;
+	}
+
+	sb->s_gc_stopper = rtems_task_self();
+	sc = rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT_STOP);
+	assert(sc == RTEMS_SUCCESSFUL);
+	sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+	assert(sc == RTEMS_SUCCESSFUL);
+	(void) sc;
+
+	sb->s_gc_task = 0;
+}
+
+static int rtems_jffs2_set_compression(
+	struct _inode *inode,
+	const int *compression
+)
+{
+	switch (*compression) {
+		case RTEMS_JFFS2_COMPRESSION_DEFAULT:
+		case RTEMS_JFFS2_COMPRESSION_NONE:
+			JFFS2_INODE_INFO(inode)->usercompr = (uint8_t) *compression;
+			return 0;
+		default:
+			return EINVAL;
+	}
+}
+
 static int rtems_jffs2_ioctl(
 	rtems_libio_t   *iop,
 	ioctl_command_t  request,
@@ -578,6 +753,13 @@ static int rtems_jffs2_ioctl(
 		case RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION:
 			eno = -jffs2_garbage_collect_pass(&inode->i_sb->jffs2_sb);
 			break;
+		case RTEMS_JFFS2_SET_COMPRESSION:
+			eno = rtems_jffs2_set_compression(inode, buffer);
+			break;
+		case RTEMS_JFFS2_GET_COMPRESSION:
+			*(int *) buffer = JFFS2_INODE_INFO(inode)->usercompr;
+			eno = 0;
+			break;
 		default:
 			eno = EINVAL;
 			break;
@@ -604,7 +786,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.mmap_h = rtems_filesystem_default_mmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static ssize_t rtems_jffs2_file_read(rtems_libio_t *iop, void *buf, size_t len)
@@ -747,7 +930,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.mmap_h = rtems_filesystem_default_mmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
@@ -766,7 +950,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
 	.mmap_h = rtems_filesystem_default_mmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static void rtems_jffs2_set_location(rtems_filesystem_location_info_t *loc, struct _inode *inode)
@@ -1054,6 +1239,8 @@ static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry
 	rtems_jffs2_fs_info *fs_info = mt_entry->fs_info;
 	struct _inode *root_i = mt_entry->mt_fs_root->location.node_access;
 
+	rtems_jffs2_gc_task_stop(&fs_info->sb);
+
 	icache_evict(root_i, NULL);
 	assert(root_i->i_cache_next == NULL);
 	assert(root_i->i_count == 1);
@@ -1262,6 +1449,7 @@ int rtems_jffs2_initialize(
 		sb->s_is_readonly = !mt_entry->writeable;
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
+		sb->s_enable_summary = jffs2_mount_data->enable_summary;
 
 		c->inocache_hashsize = inocache_hashsize;
 		c->inocache_list = &fs_info->inode_cache[0];
@@ -1275,6 +1463,12 @@ int rtems_jffs2_initialize(
 	if (err == 0) {
 		do_mount_fs_was_successful = true;
 
+		if (jffs2_mount_data->gc_task != NULL && !jffs2_is_readonly(c)) {
+			err = rtems_jffs2_gc_task_create(sb, jffs2_mount_data->gc_task);
+		}
+	}
+
+	if (err == 0) {
 		sb->s_root = jffs2_iget(sb, 1);
 		if (IS_ERR(sb->s_root)) {
 			err = PTR_ERR(sb->s_root);
@@ -1288,6 +1482,10 @@ int rtems_jffs2_initialize(
 			jffs2_erase_pending_blocks(c, 0);
 		}
 
+		if (sb->s_gc_task != 0) {
+			rtems_jffs2_gc_task_start(sb);
+		}
+
 		mt_entry->fs_info = fs_info;
 		mt_entry->ops = &rtems_jffs2_ops;
 		mt_entry->mt_fs_root->location.node_access = sb->s_root;
@@ -32,12 +32,15 @@
 #include <time.h>
 
 #include <rtems/jffs2.h>
+#include <rtems/rtems/event.h>
 #include <rtems/thread.h>
 
 #define CONFIG_JFFS2_RTIME
 
 #define CONFIG_JFFS2_ZLIB
 
+#define CONFIG_JFFS2_SUMMARY
+
 struct _inode;
 struct super_block;
 
@@ -105,6 +108,10 @@ struct super_block {
 	rtems_jffs2_flash_control	*s_flash_control;
 	rtems_jffs2_compressor_control	*s_compressor_control;
 	bool			s_is_readonly;
+	bool			s_enable_summary;
+	rtems_id		s_gc_task;
+	rtems_id		s_gc_stopper;
+	rtems_jffs2_gc_task_config	s_gc_config;
 	unsigned char		s_gc_buffer[PAGE_CACHE_SIZE]; // Avoids malloc when user may be under memory pressure
 	rtems_recursive_mutex	s_mutex;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
@@ -120,11 +127,19 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
+#define RTEMS_JFFS2_GC_EVENT_TRIGGER RTEMS_EVENT_0
+
+#define RTEMS_JFFS2_GC_EVENT_STOP RTEMS_EVENT_1
+
 static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 {
 	const struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
 
+	if (sb->s_gc_task != 0) {
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT_TRIGGER);
+	}
+
 	if (fc->trigger_garbage_collection != NULL) {
 		(*fc->trigger_garbage_collection)(fc);
 	}
@@ -1256,6 +1256,10 @@ static int jffs2_do_read_inode_internal(struct jffs2_sb_info *c,
 				      f->inocache->ino, je32_to_cpu(latest_node->isize), new_size);
 			latest_node->isize = cpu_to_je32(new_size);
 		}
+
+		/* RTEMS: Restore the compression selection of the file */
+		if (latest_node->usercompr == RTEMS_JFFS2_COMPRESSION_NONE)
+			f->usercompr = RTEMS_JFFS2_COMPRESSION_NONE;
 		break;
 
 	case S_IFLNK:
@@ -171,7 +171,8 @@ struct jffs2_sum_marker
 
 #ifdef CONFIG_JFFS2_SUMMARY	/* SUMMARY SUPPORT ENABLED */
 
-#define jffs2_sum_active() (1)
+/* RTEMS: The summary support is enabled through the mount options */
+#define jffs2_sum_active() (c->summary != NULL)
 int jffs2_sum_init(struct jffs2_sb_info *c);
 void jffs2_sum_exit(struct jffs2_sb_info *c);
 void jffs2_sum_disable_collecting(struct jffs2_summary *s);
@@ -24,21 +24,73 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <rtems.h>
 #include <rtems/libio_.h>
 #include <rtems/pipe.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/cpu.h>
 
 #define LIBIO_ACCMODE(_iop) (rtems_libio_iop_flags(_iop) & LIBIO_FLAGS_READ_WRITE)
 #define LIBIO_NODELAY(_iop) rtems_libio_iop_is_no_delay(_iop)
 
 static rtems_mutex pipe_mutex = RTEMS_MUTEX_INITIALIZER("Pipes");
 
+/*
+ * Control block to manage each pipe.
+ *
+ * The buffer is a ring with free running head and tail indices.  The head is
+ * only changed by the writer and the tail is only changed by the reader, so a
+ * single reader and a single writer can transfer data without a common lock.
+ * Multiple readers are serialized by the read mutex and multiple writers are
+ * serialized by the write mutex.  The pipe mutex protects the open and close
+ * bookkeeping and the wait queues.  The indices are placed in distinct cache
+ * lines to avoid false sharing between the reader and the writer.
+ */
+struct pipe_control {
+  char *Buffer;
+  unsigned int Size;
+  Atomic_Uint Readers;
+  Atomic_Uint Writers;
+  Atomic_Uint waitingReaders;
+  Atomic_Uint waitingWriters;
+  unsigned int readerCounter;     /* incremental counters */
+  unsigned int writerCounter;     /* for differentiation of successive opens */
+  rtems_mutex Mutex;
+  rtems_mutex readMutex;
+  rtems_mutex writeMutex;
+  rtems_condition_variable readBarrier;   /* wait queues */
+  rtems_condition_variable writeBarrier;
+#if 0
+  boolean Anonymous;      /* anonymous pipe or FIFO */
+#endif
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Atomic_Uint Tail;
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Atomic_Uint Head;
+};
+
+
+RTEMS_STATIC_ASSERT((PIPE_BUF & (PIPE_BUF - 1)) == 0, PIPE_BUF_power_of_two);
+
+#define PIPE_INDEX(_pipe, _index) ((_index) & ((_pipe)->Size - 1))
+
+#define PIPE_HEAD(_pipe) \
+  _Atomic_Load_uint(&(_pipe)->Head, ATOMIC_ORDER_ACQUIRE)
+
+#define PIPE_TAIL(_pipe) \
+  _Atomic_Load_uint(&(_pipe)->Tail, ATOMIC_ORDER_ACQUIRE)
+
+#define PIPE_READERS(_pipe) \
+  _Atomic_Load_uint(&(_pipe)->Readers, ATOMIC_ORDER_RELAXED)
+
+#define PIPE_WRITERS(_pipe) \
+  _Atomic_Load_uint(&(_pipe)->Writers, ATOMIC_ORDER_RELAXED)
 
-#define PIPE_EMPTY(_pipe) (_pipe->Length == 0)
-#define PIPE_FULL(_pipe)  (_pipe->Length == _pipe->Size)
-#define PIPE_SPACE(_pipe) (_pipe->Size - _pipe->Length)
-#define PIPE_WSTART(_pipe) ((_pipe->Start + _pipe->Length) % _pipe->Size)
+#define PIPE_INC(_counter) \
+  _Atomic_Fetch_add_uint(&(_counter), 1, ATOMIC_ORDER_RELAXED)
+
+#define PIPE_DEC(_counter) \
+  _Atomic_Fetch_sub_uint(&(_counter), 1, ATOMIC_ORDER_RELAXED)
 
 #define PIPE_LOCK(_pipe) rtems_mutex_lock(&(_pipe)->Mutex)
 
@@ -68,8 +120,8 @@ static int pipe_alloc(
   pipe_control_t *pipe;
   int err = -ENOMEM;
 
-  pipe = malloc(sizeof(pipe_control_t));
-  if (pipe == NULL)
+  /* The ring indices are cache line aligned */
+  if (posix_memalign((void **) &pipe, CPU_CACHE_LINE_BYTES, sizeof(*pipe)) != 0)
     return err;
   memset(pipe, 0, sizeof(pipe_control_t));
 
@@ -83,6 +135,8 @@ static int pipe_alloc(
   rtems_condition_variable_init(&pipe->readBarrier, "Pipe Read");
   rtems_condition_variable_init(&pipe->writeBarrier, "Pipe Write");
   rtems_mutex_init(&pipe->Mutex, "Pipe");
+  rtems_mutex_init(&pipe->readMutex, "Pipe Reader");
+  rtems_mutex_init(&pipe->writeMutex, "Pipe Writer");
 
   *pipep = pipe;
   if (c ++ == 'z')
@@ -98,6 +152,8 @@ static inline void pipe_free(
   rtems_condition_variable_destroy(&pipe->readBarrier);
   rtems_condition_variable_destroy(&pipe->writeBarrier);
   rtems_mutex_destroy(&pipe->Mutex);
+  rtems_mutex_destroy(&pipe->readMutex);
+  rtems_mutex_destroy(&pipe->writeMutex);
   free(pipe->Buffer);
   free(pipe);
 }
@@ -156,13 +212,13 @@ void pipe_release(
 
   mode = LIBIO_ACCMODE(iop);
   if (mode & LIBIO_FLAGS_READ)
-     pipe->Readers --;
+     PIPE_DEC(pipe->Readers);
   if (mode & LIBIO_FLAGS_WRITE)
-     pipe->Writers --;
+     PIPE_DEC(pipe->Writers);
 
   PIPE_UNLOCK(pipe);
 
-  if (pipe->Readers == 0 && pipe->Writers == 0) {
+  if (PIPE_READERS(pipe) == 0 && PIPE_WRITERS(pipe) == 0) {
 #if 0
     /* To delete an anonymous pipe file when all users closed it */
     if (pipe->Anonymous)
@@ -171,10 +227,10 @@ void pipe_release(
     pipe_free(pipe);
     *pipep = NULL;
   }
-  else if (pipe->Readers == 0 && mode != LIBIO_FLAGS_WRITE)
+  else if (PIPE_READERS(pipe) == 0 && mode != LIBIO_FLAGS_WRITE)
     /* Notify waiting Writers that all their partners left */
     PIPE_WAKEUPWRITERS(pipe);
-  else if (pipe->Writers == 0 && mode != LIBIO_FLAGS_READ)
+  else if (PIPE_WRITERS(pipe) == 0 && mode != LIBIO_FLAGS_READ)
     PIPE_WAKEUPREADERS(pipe);
 
   pipe_unlock();
@@ -210,10 +266,10 @@ int fifo_open(
   switch (LIBIO_ACCMODE(iop)) {
     case LIBIO_FLAGS_READ:
       pipe->readerCounter ++;
-      if (pipe->Readers ++ == 0)
+      if (PIPE_INC(pipe->Readers) == 0)
         PIPE_WAKEUPWRITERS(pipe);
 
-      if (pipe->Writers == 0) {
+      if (PIPE_WRITERS(pipe) == 0) {
         /* Not an error */
         if (LIBIO_NODELAY(iop))
           break;
@@ -230,16 +286,16 @@ int fifo_open(
     case LIBIO_FLAGS_WRITE:
       pipe->writerCounter ++;
 
-      if (pipe->Writers ++ == 0)
+      if (PIPE_INC(pipe->Writers) == 0)
         PIPE_WAKEUPREADERS(pipe);
 
-      if (pipe->Readers == 0 && LIBIO_NODELAY(iop)) {
+      if (PIPE_READERS(pipe) == 0 && LIBIO_NODELAY(iop)) {
 	PIPE_UNLOCK(pipe);
         err = -ENXIO;
         goto out_error;
       }
 
-      if (pipe->Readers == 0) {
+      if (PIPE_READERS(pipe) == 0) {
         prevCounter = pipe->readerCounter;
         err = -EINTR;
         do {
@@ -250,10 +306,10 @@ int fifo_open(
 
     case LIBIO_FLAGS_READ_WRITE:
       pipe->readerCounter ++;
-      if (pipe->Readers ++ == 0)
+      if (PIPE_INC(pipe->Readers) == 0)
         PIPE_WAKEUPWRITERS(pipe);
       pipe->writerCounter ++;
-      if (pipe->Writers ++ == 0)
+      if (PIPE_INC(pipe->Writers) == 0)
         PIPE_WAKEUPREADERS(pipe);
       break;
   }
@@ -266,134 +322,396 @@ out_error:
   return err;
 }
 
-ssize_t pipe_read(
+/*
+ * Acquire the read mutex which serializes the readers of the pipe.  The owner
+ * of the read mutex releases it while it waits for data, so the read mutex is
+ * only owned while data is copied out of the pipe.  A non-blocking reader
+ * which finds the read mutex owned returns EAGAIN.
+ */
+static int pipe_read_lock(
   pipe_control_t *pipe,
-  void           *buffer,
-  size_t          count,
-  rtems_libio_t  *iop
+  bool            nodelay
+)
+{
+  if (nodelay)
+    return rtems_mutex_try_lock(&pipe->readMutex) == 0 ? 0 : -EAGAIN;
+
+  rtems_mutex_lock(&pipe->readMutex);
+  return 0;
+}
+
+/*
+ * Acquire the write mutex which serializes the writers of the pipe.  The owner
+ * of the write mutex releases it while it waits for space, so the write mutex
+ * is only owned while data is copied into the pipe.  A non-blocking writer
+ * which finds the write mutex owned returns EAGAIN.
+ */
+static int pipe_write_lock(
+  pipe_control_t *pipe,
+  bool            nodelay
+)
+{
+  if (nodelay)
+    return rtems_mutex_try_lock(&pipe->writeMutex) == 0 ? 0 : -EAGAIN;
+
+  rtems_mutex_lock(&pipe->writeMutex);
+  return 0;
+}
+
+/*
+ * Return the count of bytes available for reading at the tail returned in
+ * tailp, zero if the pipe is empty and no writers exist, or a negative error
+ * number.  Called with the read mutex held.  The read mutex is released while
+ * the reader waits, so other readers may consume data in the meantime.
+ */
+static int pipe_wait_for_data(
+  pipe_control_t *pipe,
+  unsigned int   *tailp,
+  bool            nodelay
 )
 {
-  int chunk, chunk1, read = 0, ret = 0;
+  unsigned int tail;
+  unsigned int length;
+  int ret;
+
+  tail = _Atomic_Load_uint(&pipe->Tail, ATOMIC_ORDER_RELAXED);
+  length = PIPE_HEAD(pipe) - tail;
+  if (length > 0) {
+    *tailp = tail;
+    return (int) length;
+  }
 
   PIPE_LOCK(pipe);
+  PIPE_INC(pipe->waitingReaders);
+
+  while (true) {
+    /* Pairs with the fence in pipe_publish_head() */
+    _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+
+    tail = _Atomic_Load_uint(&pipe->Tail, ATOMIC_ORDER_RELAXED);
+    length = PIPE_HEAD(pipe) - tail;
+    if (length > 0) {
+      ret = (int) length;
+      break;
+    }
 
-  while (PIPE_EMPTY(pipe)) {
     /* Not an error */
-    if (pipe->Writers == 0)
-      goto out_locked;
+    if (PIPE_WRITERS(pipe) == 0) {
+      ret = 0;
+      break;
+    }
 
-    if (LIBIO_NODELAY(iop)) {
+    if (nodelay) {
       ret = -EAGAIN;
-      goto out_locked;
+      break;
     }
 
     /* Wait until pipe is no more empty or no writer exists */
-    pipe->waitingReaders ++;
+    rtems_mutex_unlock(&pipe->readMutex);
     PIPE_READWAIT(pipe);
-    pipe->waitingReaders --;
+
+    /* The read mutex is obtained before the pipe mutex */
+    PIPE_UNLOCK(pipe);
+    rtems_mutex_lock(&pipe->readMutex);
+    PIPE_LOCK(pipe);
   }
 
-  /* Read chunk bytes */
-  chunk = MIN(count - read,  pipe->Length);
-  chunk1 = pipe->Size - pipe->Start;
-  if (chunk > chunk1) {
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk1);
-    memcpy(buffer + read + chunk1, pipe->Buffer, chunk - chunk1);
+  PIPE_DEC(pipe->waitingReaders);
+  PIPE_UNLOCK(pipe);
+  *tailp = tail;
+  return ret;
+}
+
+/*
+ * Return the count of bytes available for writing at the head returned in
+ * headp which is at least need, or a negative error number.  Called with the
+ * write mutex held.  The write mutex is released while the writer waits, so
+ * other writers may produce data in the meantime.
+ */
+static int pipe_wait_for_space(
+  pipe_control_t *pipe,
+  unsigned int   *headp,
+  unsigned int    need,
+  bool            nodelay
+)
+{
+  unsigned int head;
+  unsigned int space;
+  int ret;
+
+  if (PIPE_READERS(pipe) == 0)
+    return -EPIPE;
+
+  head = _Atomic_Load_uint(&pipe->Head, ATOMIC_ORDER_RELAXED);
+  space = pipe->Size - (head - PIPE_TAIL(pipe));
+  if (space >= need) {
+    *headp = head;
+    return (int) space;
   }
-  else
-    memcpy(buffer + read, pipe->Buffer + pipe->Start, chunk);
 
-  pipe->Start += chunk;
-  pipe->Start %= pipe->Size;
-  pipe->Length -= chunk;
-  /* For buffering optimization */
-  if (PIPE_EMPTY(pipe))
-    pipe->Start = 0;
+  PIPE_LOCK(pipe);
+  PIPE_INC(pipe->waitingWriters);
 
-  if (pipe->waitingWriters > 0)
-    PIPE_WAKEUPWRITERS(pipe);
-  read += chunk;
+  while (true) {
+    /* Pairs with the fence in pipe_publish_tail() */
+    _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+
+    head = _Atomic_Load_uint(&pipe->Head, ATOMIC_ORDER_RELAXED);
+    space = pipe->Size - (head - PIPE_TAIL(pipe));
+    if (space >= need) {
+      ret = (int) space;
+      break;
+    }
+
+    if (PIPE_READERS(pipe) == 0) {
+      ret = -EPIPE;
+      break;
+    }
+
+    if (nodelay) {
+      ret = -EAGAIN;
+      break;
+    }
 
-out_locked:
+    /* Wait until there is need bytes space or no reader exists */
+    rtems_mutex_unlock(&pipe->writeMutex);
+    PIPE_WRITEWAIT(pipe);
+
+    /* The write mutex is obtained before the pipe mutex */
+    PIPE_UNLOCK(pipe);
+    rtems_mutex_lock(&pipe->writeMutex);
+    PIPE_LOCK(pipe);
+  }
+
+  PIPE_DEC(pipe->waitingWriters);
   PIPE_UNLOCK(pipe);
+  *headp = head;
+  return ret;
+}
+
+/*
+ * Readers wait only on an empty pipe and writers wait only on a full pipe, so
+ * the pipe lock is only acquired on the empty to non-empty and full to
+ * non-full transitions with a waiting partner.
+ */
+static void pipe_publish_head(
+  pipe_control_t *pipe,
+  unsigned int    head
+)
+{
+  _Atomic_Store_uint(&pipe->Head, head, ATOMIC_ORDER_RELEASE);
+  _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
 
-  if (read > 0)
-    return read;
+  if (_Atomic_Load_uint(&pipe->waitingReaders, ATOMIC_ORDER_RELAXED) > 0) {
+    PIPE_LOCK(pipe);
+    PIPE_WAKEUPREADERS(pipe);
+    PIPE_UNLOCK(pipe);
+  }
+}
+
+static void pipe_publish_tail(
+  pipe_control_t *pipe,
+  unsigned int    tail
+)
+{
+  _Atomic_Store_uint(&pipe->Tail, tail, ATOMIC_ORDER_RELEASE);
+  _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+
+  if (_Atomic_Load_uint(&pipe->waitingWriters, ATOMIC_ORDER_RELAXED) > 0) {
+    PIPE_LOCK(pipe);
+    PIPE_WAKEUPWRITERS(pipe);
+    PIPE_UNLOCK(pipe);
+  }
+}
+
+static void pipe_signal_broken_pipe(int err)
+{
+#ifdef RTEMS_POSIX_API
+  /* Signal SIGPIPE */
+  if (err == -EPIPE)
+    kill(getpid(), SIGPIPE);
+#else
+  (void) err;
+#endif
+}
+
+static ssize_t pipe_read_buffer(
+  pipe_control_t *pipe,
+  void           *buffer,
+  size_t          count,
+  bool            nodelay
+)
+{
+  unsigned int tail, start, chunk, chunk1;
+  int ret;
+
+  ret = pipe_read_lock(pipe, nodelay);
+  if (ret != 0)
+    return ret;
+
+  ret = pipe_wait_for_data(pipe, &tail, nodelay);
+
+  if (ret > 0) {
+    /* Read chunk bytes */
+    chunk = MIN(count, (unsigned int) ret);
+    start = PIPE_INDEX(pipe, tail);
+    chunk1 = MIN(chunk, pipe->Size - start);
+    memcpy(buffer, pipe->Buffer + start, chunk1);
+    memcpy((char *) buffer + chunk1, pipe->Buffer, chunk - chunk1);
+
+    pipe_publish_tail(pipe, tail + chunk);
+    ret = (int) chunk;
+  }
+
+  rtems_mutex_unlock(&pipe->readMutex);
   return ret;
 }
 
-ssize_t pipe_write(
+static ssize_t pipe_write_buffer(
   pipe_control_t *pipe,
   const void     *buffer,
   size_t          count,
-  rtems_libio_t  *iop
+  bool            nodelay
 )
 {
-  int chunk, chunk1, written = 0, ret = 0;
+  unsigned int head, start, chunk, chunk1;
+  size_t written = 0;
+  int ret;
 
   /* Write nothing */
   if (count == 0)
     return 0;
 
-  PIPE_LOCK(pipe);
-
-  if (pipe->Readers == 0) {
-    ret = -EPIPE;
-    goto out_locked;
-  }
+  ret = pipe_write_lock(pipe, nodelay);
+  if (ret != 0)
+    return ret;
 
   /* Write of PIPE_BUF bytes or less shall not be interleaved */
   chunk = count <= pipe->Size ? count : 1;
 
   while (written < count) {
-    while (PIPE_SPACE(pipe) < chunk) {
-      if (LIBIO_NODELAY(iop)) {
-        ret = -EAGAIN;
-        goto out_locked;
-      }
-
-      /* Wait until there is chunk bytes space or no reader exists */
-      pipe->waitingWriters ++;
-      PIPE_WRITEWAIT(pipe);
-      pipe->waitingWriters --;
-
-      if (pipe->Readers == 0) {
-        ret = -EPIPE;
-        goto out_locked;
-      }
-    }
+    ret = pipe_wait_for_space(pipe, &head, chunk, nodelay);
+    if (ret < 0)
+      break;
 
-    chunk = MIN(count - written, PIPE_SPACE(pipe));
-    chunk1 = pipe->Size - PIPE_WSTART(pipe);
-    if (chunk > chunk1) {
-      memcpy(pipe->Buffer + PIPE_WSTART(pipe), buffer + written, chunk1);
-      memcpy(pipe->Buffer, buffer + written + chunk1, chunk - chunk1);
-    }
-    else
-      memcpy(pipe->Buffer + PIPE_WSTART(pipe), buffer + written, chunk);
+    chunk = MIN(count - written, (unsigned int) ret);
+    start = PIPE_INDEX(pipe, head);
+    chunk1 = MIN(chunk, pipe->Size - start);
+    memcpy(pipe->Buffer + start, (const char *) buffer + written, chunk1);
+    memcpy(pipe->Buffer, (const char *) buffer + written + chunk1,
+      chunk - chunk1);
 
-    pipe->Length += chunk;
-    if (pipe->waitingReaders > 0)
-      PIPE_WAKEUPREADERS(pipe);
+    pipe_publish_head(pipe, head + chunk);
     written += chunk;
     /* Write of more than PIPE_BUF bytes can be interleaved */
     chunk = 1;
   }
 
-out_locked:
-  PIPE_UNLOCK(pipe);
-
-#ifdef RTEMS_POSIX_API
-  /* Signal SIGPIPE */
-  if (ret == -EPIPE)
-    kill(getpid(), SIGPIPE);
-#endif
+  rtems_mutex_unlock(&pipe->writeMutex);
+  pipe_signal_broken_pipe(ret);
 
   if (written > 0)
     return written;
   return ret;
 }
 
+ssize_t pipe_read(
+  pipe_control_t *pipe,
+  void           *buffer,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  return pipe_read_buffer(pipe, buffer, count, LIBIO_NODELAY(iop));
+}
+
+ssize_t pipe_write(
+  pipe_control_t *pipe,
+  const void     *buffer,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  return pipe_write_buffer(pipe, buffer, count, LIBIO_NODELAY(iop));
+}
+
+/*
+ * The splice operations do not hold the read or write mutex during the I/O
+ * on the other file descriptor, since this I/O may block for an unbounded
+ * time.  The data is moved through a buffer of PIPE_BUF bytes on the stack.
+ */
+ssize_t pipe_splice_read(
+  pipe_control_t *pipe,
+  int             fd_out,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  char buffer[PIPE_BUF];
+  ssize_t length;
+  size_t moved = 0;
+
+  length = pipe_read_buffer(pipe, buffer, MIN(count, sizeof(buffer)),
+    LIBIO_NODELAY(iop));
+  if (length <= 0)
+    return length;
+
+  /* The data is consumed, so write all of it unless an error occurs */
+  while (moved < (size_t) length) {
+    ssize_t n;
+
+    n = write(fd_out, buffer + moved, (size_t) length - moved);
+    if (n < 0 && moved == 0)
+      return -errno;
+
+    if (n <= 0)
+      break;
+
+    moved += (size_t) n;
+  }
+
+  return moved;
+}
+
+ssize_t pipe_splice_write(
+  pipe_control_t *pipe,
+  int             fd_in,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  char buffer[PIPE_BUF];
+  unsigned int head;
+  ssize_t n;
+  int ret;
+
+  if (count == 0)
+    return 0;
+
+  ret = pipe_write_lock(pipe, LIBIO_NODELAY(iop));
+  if (ret != 0)
+    return ret;
+
+  /* Read from fd_in only if there is space in the pipe */
+  ret = pipe_wait_for_space(pipe, &head, 1, LIBIO_NODELAY(iop));
+  rtems_mutex_unlock(&pipe->writeMutex);
+
+  if (ret < 0) {
+    pipe_signal_broken_pipe(ret);
+    return ret;
+  }
+
+  n = read(fd_in, buffer, MIN(MIN(count, sizeof(buffer)), (unsigned int) ret));
+  if (n <= 0)
+    return n < 0 ? -errno : 0;
+
+  /*
+   * The data is consumed from fd_in, so wait for space even in non-blocking
+   * mode, since another writer may have used the space in the meantime.
+   */
+  return pipe_write_buffer(pipe, buffer, (size_t) n, false);
+}
+
 int pipe_ioctl(
   pipe_control_t  *pipe,
   ioctl_command_t  cmd,
@@ -402,14 +720,14 @@ int pipe_ioctl(
 )
 {
   if (cmd == FIONREAD) {
+    unsigned int tail;
+
     if (buffer == NULL)
       return -EFAULT;
 
-    PIPE_LOCK(pipe);
-
     /* Return length of pipe */
-    *(unsigned int *)buffer = pipe->Length;
-    PIPE_UNLOCK(pipe);
+    tail = PIPE_TAIL(pipe);
+    *(unsigned int *)buffer = PIPE_HEAD(pipe) - tail;
     return 0;
   }
 
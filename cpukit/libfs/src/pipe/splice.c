@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup FIFO_PIPE
+ *
+ * @brief Pipe Splice Support
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio_.h>
+#include <rtems/pipe.h>
+#include <rtems/seterr.h>
+
+static rtems_libio_t *rtems_pipe_splice_hold(int fd, unsigned int access)
+{
+  rtems_libio_t *iop;
+  unsigned int   flags;
+  unsigned int   mandatory;
+
+  if ((uint32_t) fd >= rtems_libio_number_iops) {
+    errno = EBADF;
+    return NULL;
+  }
+
+  iop = rtems_libio_iop(fd);
+  flags = rtems_libio_iop_hold(iop);
+  mandatory = LIBIO_FLAGS_OPEN | access;
+
+  if ((flags & mandatory) != mandatory) {
+    rtems_libio_iop_drop(iop);
+    errno = EBADF;
+    return NULL;
+  }
+
+  return iop;
+}
+
+static IMFS_jnode_t *rtems_pipe_splice_get_fifo(const rtems_libio_t *iop)
+{
+  if (iop->pathinfo.handlers !=
+      IMFS_mknod_control_fifo.node_control.handlers) {
+    return NULL;
+  }
+
+  return iop->pathinfo.node_access;
+}
+
+ssize_t rtems_pipe_splice(int fd_in, int fd_out, size_t count)
+{
+  rtems_libio_t *iop_in;
+  rtems_libio_t *iop_out;
+  IMFS_jnode_t  *fifo_in;
+  IMFS_jnode_t  *fifo_out;
+  ssize_t        n;
+
+  iop_in = rtems_pipe_splice_hold(fd_in, LIBIO_FLAGS_READ);
+  if (iop_in == NULL) {
+    return -1;
+  }
+
+  iop_out = rtems_pipe_splice_hold(fd_out, LIBIO_FLAGS_WRITE);
+  if (iop_out == NULL) {
+    rtems_libio_iop_drop(iop_in);
+    return -1;
+  }
+
+  fifo_in = rtems_pipe_splice_get_fifo(iop_in);
+  fifo_out = rtems_pipe_splice_get_fifo(iop_out);
+
+  if (fifo_in != NULL && fifo_in != fifo_out) {
+    n = pipe_splice_read(
+      ((IMFS_fifo_t *) fifo_in)->pipe,
+      fd_out,
+      count,
+      iop_in
+    );
+
+    if (n > 0) {
+      IMFS_update_atime(fifo_in);
+    }
+  } else if (fifo_out != NULL && fifo_in == NULL) {
+    n = pipe_splice_write(
+      ((IMFS_fifo_t *) fifo_out)->pipe,
+      fd_in,
+      count,
+      iop_out
+    );
+
+    if (n > 0) {
+      IMFS_mtime_ctime_update(fifo_out);
+    }
+  } else {
+    n = -EINVAL;
+  }
+
+  rtems_libio_iop_drop(iop_out);
+  rtems_libio_iop_drop(iop_in);
+
+  if (n < 0) {
+    rtems_set_errno_and_return_minus_one(-n);
+  }
+
+  return n;
+}
@@ -199,5 +199,6 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_device_handlers = {
   .mmap_h      = rtems_filesystem_default_mmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .writev_h    = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
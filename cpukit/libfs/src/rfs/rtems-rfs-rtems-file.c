@@ -98,6 +98,66 @@ rtems_rfs_rtems_file_close (rtems_libio_t* iop)
   return rc;
 }
 
+/**
+ * Move the position of the file handle to the offset of the IO control.  The
+ * IO control may be a private copy with an explicit offset, see
+ * rtems_copy_file_range().
+ *
+ * @param file
+ * @param pos
+ * @return int
+ */
+static int
+rtems_rfs_rtems_file_set_pos (rtems_rfs_file_handle* file,
+                              rtems_rfs_pos          pos)
+{
+  if (rtems_rfs_block_get_pos (rtems_rfs_file_fs (file),
+                               rtems_rfs_file_bpos (file)) == pos)
+    return 0;
+
+  return rtems_rfs_file_seek (file, pos, &pos);
+}
+
+/**
+ * Move the position of the file handle to the write offset of the IO control.
+ * If the offset is past the physical end of the file, then the file size is
+ * set to the offset before writing.  The rtems_rfs_file_io_end() grows the
+ * file subsequently.  In append mode the write offset is the end of the file.
+ *
+ * @param iop
+ * @param file
+ * @param pos
+ * @return int
+ */
+static int
+rtems_rfs_rtems_file_set_write_pos (rtems_libio_t*         iop,
+                                    rtems_rfs_file_handle* file,
+                                    rtems_rfs_pos*         pos)
+{
+  rtems_rfs_pos file_size;
+  int           rc;
+
+  *pos = iop->offset;
+  file_size = rtems_rfs_file_size (file);
+  if (*pos > file_size)
+  {
+    rc = rtems_rfs_file_set_size (file, *pos);
+    if (rc)
+      return rc;
+
+    rtems_rfs_file_set_bpos (file, *pos);
+    return 0;
+  }
+
+  if (*pos < file_size && rtems_libio_iop_is_append(iop))
+  {
+    *pos = file_size;
+    return rtems_rfs_file_seek (file, *pos, pos);
+  }
+
+  return rtems_rfs_rtems_file_set_pos (file, *pos);
+}
+
 /**
  * This routine processes the read() system call.
  *
@@ -126,6 +186,13 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
 
   if (pos < rtems_rfs_file_size (file))
   {
+    rc = rtems_rfs_rtems_file_set_pos (file, pos);
+    if (rc > 0)
+    {
+      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      return rtems_rfs_rtems_error ("file-read: read seek", rc);
+    }
+
     while (count)
     {
       size_t size;
@@ -181,7 +248,6 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
 {
   rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
   rtems_rfs_pos          pos;
-  rtems_rfs_pos          file_size;
   const uint8_t*         data = buffer;
   ssize_t                write = 0;
   int                    rc;
@@ -191,33 +257,11 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
 
   rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
 
-  pos = iop->offset;
-  file_size = rtems_rfs_file_size (file);
-  if (pos > file_size)
-  {
-    /*
-     * If the iop position is past the physical end of the file we need to set
-     * the file size to the new length before writing.  The
-     * rtems_rfs_file_io_end() will grow the file subsequently.
-     */
-    rc = rtems_rfs_file_set_size (file, pos);
-    if (rc)
-    {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
-      return rtems_rfs_rtems_error ("file-write: write extend", rc);
-    }
-
-    rtems_rfs_file_set_bpos (file, pos);
-  }
-  else if (pos < file_size && rtems_libio_iop_is_append(iop))
+  rc = rtems_rfs_rtems_file_set_write_pos (iop, file, &pos);
+  if (rc)
   {
-    pos = file_size;
-    rc = rtems_rfs_file_seek (file, pos, &pos);
-    if (rc)
-    {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
-      return rtems_rfs_rtems_error ("file-write: write append seek", rc);
-    }
+    rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+    return rtems_rfs_rtems_error ("file-write: write seek", rc);
   }
 
   while (count)
@@ -262,6 +306,132 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   return write;
 }
 
+/**
+ * This routine processes the rtems_copy_file_range() call.  For a copy to
+ * another file of the same file system instance, the data is copied directly
+ * from the block buffers of the input file into the block buffers of the
+ * output file.  Both files are accessed with the one instance lock held, so no
+ * other lock is nested.  A full block of the output file is obtained without a
+ * read of the device.  All other copies use the generic handler which calls
+ * the read and write handlers with the instance lock released in between.
+ *
+ * @param iop_in
+ * @param iop_out
+ * @param count
+ * @return ssize_t
+ */
+static ssize_t
+rtems_rfs_rtems_file_copy_file_range (rtems_libio_t* iop_in,
+                                      rtems_libio_t* iop_out,
+                                      size_t         count)
+{
+  rtems_rfs_file_handle* in = rtems_rfs_rtems_get_iop_file_handle (iop_in);
+  rtems_rfs_file_handle* out;
+  rtems_rfs_file_system* fs = rtems_rfs_file_fs (in);
+  rtems_rfs_pos          pos_in;
+  rtems_rfs_pos          pos_out;
+  ssize_t                copied = 0;
+  int                    rc;
+
+  if (iop_out->pathinfo.handlers != &rtems_rfs_rtems_file_handlers ||
+      rtems_rfs_rtems_pathloc_dev (&iop_out->pathinfo) != fs ||
+      rtems_rfs_rtems_get_iop_ino (iop_out) ==
+      rtems_rfs_rtems_get_iop_ino (iop_in))
+    return rtems_filesystem_default_copy_file_range (iop_in, iop_out, count);
+
+  out = rtems_rfs_rtems_get_iop_file_handle (iop_out);
+
+  if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_READ))
+    printf("rtems-rfs: file-copy: in:%p out:%p count:%zd\n", in, out, count);
+
+  rtems_rfs_rtems_lock (fs);
+
+  pos_in = iop_in->offset;
+
+  if (count == 0 || pos_in >= rtems_rfs_file_size (in))
+  {
+    rtems_rfs_rtems_unlock (fs);
+    return 0;
+  }
+
+  rc = rtems_rfs_rtems_file_set_pos (in, pos_in);
+  if (rc > 0)
+  {
+    rtems_rfs_rtems_unlock (fs);
+    return rtems_rfs_rtems_error ("file-copy: read seek", rc);
+  }
+
+  rc = rtems_rfs_rtems_file_set_write_pos (iop_out, out, &pos_out);
+  if (rc)
+  {
+    rtems_rfs_rtems_unlock (fs);
+    return rtems_rfs_rtems_error ("file-copy: write seek", rc);
+  }
+
+  while (count)
+  {
+    size_t size_in;
+    size_t size_out;
+
+    rc = rtems_rfs_file_io_start (in, &size_in, true);
+    if (rc > 0)
+    {
+      if (!copied)
+        copied = rtems_rfs_rtems_error ("file-copy: read: io-start", rc);
+      break;
+    }
+
+    if (size_in == 0)
+      break;
+
+    if (size_in > count)
+      size_in = count;
+
+    size_out = size_in;
+    rc = rtems_rfs_file_io_start (out, &size_out, false);
+    if (rc)
+    {
+      rtems_rfs_file_io_end (in, 0, true);
+      if (!copied)
+        copied = rtems_rfs_rtems_error ("file-copy: write: io-start", rc);
+      break;
+    }
+
+    if (size_out > size_in)
+      size_out = size_in;
+
+    memcpy (rtems_rfs_file_data (out), rtems_rfs_file_data (in), size_out);
+
+    rc = rtems_rfs_file_io_end (out, size_out, false);
+    if (rc)
+    {
+      rtems_rfs_file_io_end (in, 0, true);
+      copied = rtems_rfs_rtems_error ("file-copy: write: io-end", rc);
+      break;
+    }
+
+    count  -= size_out;
+    copied += size_out;
+
+    rc = rtems_rfs_file_io_end (in, size_out, true);
+    if (rc > 0)
+    {
+      copied = rtems_rfs_rtems_error ("file-copy: read: io-end", rc);
+      break;
+    }
+  }
+
+  if (copied >= 0)
+  {
+    iop_in->offset = pos_in + copied;
+    iop_out->offset = pos_out + copied;
+  }
+
+  rtems_rfs_rtems_unlock (fs);
+
+  return copied;
+}
+
 /**
  * This routine processes the lseek() system call.
  *
@@ -352,5 +522,6 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_file_handlers = {
   .mmap_h      = rtems_filesystem_default_mmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .writev_h    = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_rfs_rtems_file_copy_file_range
 };
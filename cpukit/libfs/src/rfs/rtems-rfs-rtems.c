@@ -102,6 +102,51 @@ static void rtems_rfs_rtems_follow_link(
   }
 }
 
+/**
+ * Look up a directory entry through the file system name cache. The parent
+ * directory is identified by its inode number. The cache entry contains the
+ * inode number and the directory offset of the entry, an inode number of zero
+ * indicates a not existing entry.
+ */
+static int
+rtems_rfs_rtems_dir_lookup_ino (const rtems_filesystem_location_info_t* currentloc,
+                                rtems_rfs_file_system*                  fs,
+                                rtems_rfs_inode_handle*                 inode,
+                                const char*                             name,
+                                int                                     length,
+                                rtems_rfs_ino*                          ino,
+                                uint32_t*                               offset)
+{
+  uintptr_t parent = rtems_rfs_inode_ino (inode);
+  uintptr_t child;
+  uintptr_t child_2;
+  int       rc;
+
+  if (rtems_filesystem_is_parent_directory (name, length))
+    return rtems_rfs_dir_lookup_ino (fs, inode, name, length, ino, offset);
+
+  if (rtems_filesystem_name_cache_lookup (currentloc->mt_entry, parent,
+                                          name, length, &child, &child_2))
+  {
+    if (child == RTEMS_RFS_EMPTY_INO)
+      return ENOENT;
+
+    *ino = (rtems_rfs_ino) child;
+    *offset = (uint32_t) child_2;
+    return 0;
+  }
+
+  rc = rtems_rfs_dir_lookup_ino (fs, inode, name, length, ino, offset);
+  if (rc == 0)
+    rtems_filesystem_name_cache_enter (currentloc->mt_entry, parent,
+                                       name, length, *ino, *offset);
+  else if (rc == ENOENT)
+    rtems_filesystem_name_cache_enter (currentloc->mt_entry, parent,
+                                       name, length, RTEMS_RFS_EMPTY_INO, 0);
+
+  return rc;
+}
+
 static rtems_filesystem_eval_path_generic_status
 rtems_rfs_rtems_eval_token(
   rtems_filesystem_eval_path_context_t *ctx,
@@ -124,7 +169,8 @@ rtems_rfs_rtems_eval_token(
       rtems_rfs_file_system* fs = rtems_rfs_rtems_pathloc_dev (currentloc);
       rtems_rfs_ino entry_ino;
       uint32_t entry_doff;
-      int rc = rtems_rfs_dir_lookup_ino (
+      int rc = rtems_rfs_rtems_dir_lookup_ino (
+        currentloc,
         fs,
         inode,
         token,
@@ -703,7 +749,8 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_link_handlers =
   .mmap_h      = rtems_filesystem_default_mmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .writev_h    = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 /**
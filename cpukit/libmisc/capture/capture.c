@@ -28,6 +28,8 @@
 #include <string.h>
 
 #include <rtems/captureimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threaddispatch.h>
 #include "capture_buffer.h"
 
 /*
@@ -55,9 +57,15 @@
 #define RTEMS_CAPTURE_RECORD_EVENTS  (0)
 #endif
 
-typedef struct {
+/*
+ * The records are produced by the owner processor with interrupts disabled
+ * and consumed by the reader. The producer does not take a lock, the reader
+ * lock only serializes the readers of a processor.
+ */
+typedef struct rtems_capture_per_cpu_data {
   rtems_capture_buffer records;
-  uint32_t             count;
+  uint32_t             count;   /* The records provided by the last read. */
+  uint32_t             lost;    /* The records lost due to a full buffer. */
   rtems_id             reader;
   rtems_interrupt_lock lock;
   uint32_t             flags;
@@ -352,20 +360,22 @@ rtems_capture_create_control (rtems_name name, rtems_id id)
   return control;
 }
 
+/*
+ * Disabling the interrupts makes the executing processor the only producer
+ * of its buffer. There is no need for an atomic read-modify-write operation
+ * or a lock.
+ */
 void
 rtems_capture_record_lock (rtems_capture_record_lock_context* context)
 {
-  rtems_capture_per_cpu_data* cpu;
-  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
-  rtems_interrupt_lock_interrupt_disable (&context->lock_context);
-  context->lock = &cpu->lock;
-  rtems_interrupt_lock_acquire_isr (&cpu->lock, &context->lock_context);
+  rtems_interrupt_local_disable (context->level);
+  context->cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
 }
 
 void
 rtems_capture_record_unlock (rtems_capture_record_lock_context* context)
 {
-  rtems_interrupt_lock_release (context->lock, &context->lock_context);
+  rtems_interrupt_local_enable (context->level);
 }
 
 void*
@@ -379,9 +389,8 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
 
   size += sizeof (rtems_capture_record);
 
-  cpu = capture_per_cpu_get (rtems_scheduler_get_processor ());
-
   rtems_capture_record_lock (context);
+  cpu = context->cpu;
 
   ptr = rtems_capture_buffer_allocate (&cpu->records, size);
   if (ptr != NULL)
@@ -389,8 +398,6 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
     rtems_capture_record in;
     rtems_capture_time time;
 
-    ++cpu->count;
-
     if ((events & RTEMS_CAPTURE_RECORD_EVENTS) == 0)
       tcb->Capture.flags |= RTEMS_CAPTURE_TRACED;
 
@@ -409,7 +416,7 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
     ptr = rtems_capture_record_append(ptr, &in, sizeof(in));
   }
   else
-    cpu->flags |= RTEMS_CAPTURE_OVERFLOW;
+    ++cpu->lost;
 
   return ptr;
 }
@@ -417,6 +424,7 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
 void
 rtems_capture_record_close (rtems_capture_record_lock_context* context)
 {
+  rtems_capture_buffer_commit (&context->cpu->records);
   rtems_capture_record_unlock (context);
 }
 
@@ -760,6 +768,25 @@ rtems_capture_flush_tcb (rtems_tcb *tcb, void *arg)
   return false;
 }
 
+/*
+ * This function resets the capture buffer of a CPU. It must be called on the
+ * owning CPU if the CPU is online, since the producers only disable the
+ * interrupts. The lock serializes the reset with the readers.
+ */
+static void
+rtems_capture_flush_on_cpu (void* arg)
+{
+  rtems_capture_per_cpu_data*  cpu = arg;
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire (&cpu->lock, &lock_context);
+  cpu->count = 0;
+  cpu->lost = 0;
+  if (cpu->records.buffer)
+    rtems_capture_buffer_flush (&cpu->records);
+  rtems_interrupt_lock_release (&cpu->lock, &lock_context);
+}
+
 /*
  * This function flushes the capture buffer. The prime parameter allows the
  * capture engine to also be primed again.
@@ -788,19 +815,28 @@ rtems_capture_flush (bool prime)
     else
       capture_flags_global &= ~RTEMS_CAPTURE_OVERFLOW;
 
+    rtems_interrupt_lock_release (&capture_lock_global, &lock_context_global);
+
     for (cpu=0; cpu < rtems_scheduler_get_processor_maximum(); cpu++) {
-      RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
-      rtems_interrupt_lock_context lock_context_per_cpu;
-
-      rtems_interrupt_lock_acquire (lock, &lock_context_per_cpu);
-      capture_count_on_cpu(cpu) = 0;
-      if (capture_records_on_cpu(cpu).buffer)
-        rtems_capture_buffer_flush( &capture_records_on_cpu(cpu) );
-      rtems_interrupt_lock_release (lock, &lock_context_per_cpu);
+#if defined(RTEMS_SMP)
+      /*
+       * A producer which saw capture control enabled may still record on its
+       * processor. Reset the buffer on the owning processor, so that no
+       * record is in progress.
+       */
+      if (_Per_CPU_Is_processor_online (_Per_CPU_Get_by_index (cpu))) {
+        Per_CPU_Control* cpu_self;
+
+        cpu_self = _Thread_Dispatch_disable ();
+        _SMP_Unicast_action (cpu, rtems_capture_flush_on_cpu,
+                             capture_per_cpu_get (cpu));
+        _Thread_Dispatch_enable (cpu_self);
+        continue;
+      }
+#endif
+      rtems_capture_flush_on_cpu (capture_per_cpu_get (cpu));
     }
 
-    rtems_interrupt_lock_release (&capture_lock_global, &lock_context_global);
-
     sc = RTEMS_SUCCESSFUL;
   }
 
@@ -1229,6 +1265,10 @@ rtems_capture_count_records (const void* records, size_t size)
  * The user must release the records. This is achieved with a call to
  * rtems_capture_release. Calls this function without a release will
  * result in at least the same number of records being released.
+ *
+ * The records can be read while the capture engine is on, since the
+ * recording processor never waits for the reader and the reader only sees
+ * committed records.
  */
 rtems_status_code
 rtems_capture_read (uint32_t cpu, size_t* read, const void** recs)
@@ -1260,17 +1300,12 @@ rtems_capture_read (uint32_t cpu, size_t* read, const void** recs)
       return RTEMS_RESOURCE_IN_USE;
     }
 
-    if ( (capture_flags_global & RTEMS_CAPTURE_ON) != 0 )
-    {
-      rtems_interrupt_lock_release (lock, &lock_context);
-      return RTEMS_UNSATISFIED;
-    }
-
     *flags |= RTEMS_CAPTURE_READER_ACTIVE;
 
     *recs = rtems_capture_buffer_peek( records, &recs_size );
 
     *read = rtems_capture_count_records( *recs, recs_size );
+    capture_count_on_cpu (cpu) = *read;
 
     rtems_interrupt_lock_release (lock, &lock_context);
 
@@ -1309,11 +1344,6 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
       count = *total;
     }
 
-    if ( (capture_flags_global & RTEMS_CAPTURE_ON) != 0 ) {
-      rtems_interrupt_lock_release (lock, &lock_context);
-      return RTEMS_UNSATISFIED;
-    }
-
     counted = count;
 
     ptr = rtems_capture_buffer_peek( records, &ptr_size );
@@ -1346,6 +1376,146 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
   return sc;
 }
 
+/*
+ * This function returns the count of records lost on a CPU due to a full
+ * capture buffer. Only the owning CPU increments the count, so a plain read
+ * is sufficient.
+ */
+rtems_status_code
+rtems_capture_get_lost (uint32_t cpu, uint32_t* lost)
+{
+  if (capture_per_cpu == NULL)
+    return RTEMS_NOT_CONFIGURED;
+
+  if (cpu >= rtems_scheduler_get_processor_maximum ())
+    return RTEMS_INVALID_NUMBER;
+
+  *lost = capture_per_cpu_get (cpu)->lost;
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * Merge cursor of a CPU used to read the records in time order.
+ */
+typedef struct {
+  const uint8_t*       recs;      /* The next record to visit. */
+  size_t               read;      /* The records of the read block. */
+  size_t               visited;   /* The visited records of the read block. */
+  bool                 active;    /* A block is read and not released. */
+  bool                 exhausted; /* No more records are available. */
+  rtems_capture_record rec;       /* The next record, copied out. */
+} rtems_capture_merge_cursor;
+
+static rtems_status_code
+rtems_capture_merge_fill (uint32_t cpu, rtems_capture_merge_cursor* cursor)
+{
+  rtems_status_code sc;
+  const void*       recs;
+
+  sc = rtems_capture_read (cpu, &cursor->read, &recs);
+  if (sc != RTEMS_SUCCESSFUL)
+    return sc;
+
+  if (cursor->read == 0)
+  {
+    rtems_capture_release (cpu, 0);
+    cursor->exhausted = true;
+    return RTEMS_SUCCESSFUL;
+  }
+
+  cursor->recs = recs;
+  cursor->visited = 0;
+  cursor->active = true;
+  rtems_capture_record_extract (cursor->recs, &cursor->rec,
+                                sizeof (cursor->rec));
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * This function reads the records of all CPUs in time order. The records of
+ * each CPU are in time order, so the earliest record of all CPUs is the
+ * next record.
+ */
+rtems_status_code
+rtems_capture_read_merged (size_t                       count,
+                           rtems_capture_record_visitor visitor,
+                           void*                        arg)
+{
+  rtems_capture_merge_cursor* cursors;
+  rtems_status_code           sc = RTEMS_SUCCESSFUL;
+  uint32_t                    cpus;
+  uint32_t                    cpu;
+  bool                        stop = false;
+
+  if (capture_per_cpu == NULL)
+    return RTEMS_NOT_CONFIGURED;
+
+  cpus = rtems_scheduler_get_processor_maximum ();
+  cursors = calloc (cpus, sizeof (*cursors));
+  if (cursors == NULL)
+    return RTEMS_NO_MEMORY;
+
+  while (!stop && (count > 0))
+  {
+    rtems_capture_merge_cursor* cursor_out = NULL;
+    uint32_t                    cpu_out = 0;
+
+    for (cpu = 0; cpu < cpus; cpu++)
+    {
+      rtems_capture_merge_cursor* cursor = &cursors[cpu];
+
+      if (!cursor->active && !cursor->exhausted)
+      {
+        sc = rtems_capture_merge_fill (cpu, cursor);
+        if (sc != RTEMS_SUCCESSFUL)
+          break;
+      }
+
+      if (cursor->active &&
+          ((cursor_out == NULL) || (cursor->rec.time < cursor_out->rec.time)))
+      {
+        cursor_out = cursor;
+        cpu_out = cpu;
+      }
+    }
+
+    if ((sc != RTEMS_SUCCESSFUL) || (cursor_out == NULL))
+      break;
+
+    stop = (*visitor) (cpu_out,
+                       &cursor_out->rec,
+                       cursor_out->recs + sizeof (rtems_capture_record),
+                       cursor_out->rec.size - sizeof (rtems_capture_record),
+                       arg);
+
+    cursor_out->recs += cursor_out->rec.size;
+    ++cursor_out->visited;
+    --count;
+
+    /*
+     * Release a completely visited block, there may be another block if the
+     * records wrapped around in the capture buffer.
+     */
+    if (cursor_out->visited == cursor_out->read)
+    {
+      rtems_capture_release (cpu_out, cursor_out->visited);
+      cursor_out->active = false;
+    }
+    else
+      rtems_capture_record_extract (cursor_out->recs, &cursor_out->rec,
+                                    sizeof (cursor_out->rec));
+  }
+
+  for (cpu = 0; cpu < cpus; cpu++)
+  {
+    if (cursors[cpu].active)
+      rtems_capture_release (cpu, cursors[cpu].visited);
+  }
+
+  free (cursors);
+  return sc;
+}
+
 /*
  * This function returns a string for an event based on the bit in the
  * event. The functions takes the bit offset as a number not the bit
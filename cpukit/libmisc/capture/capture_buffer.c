@@ -29,67 +29,56 @@
 void*
 rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size)
 {
-  void* ptr = NULL;
+  void*  ptr = NULL;
+  size_t head;
+  size_t tail;
 
-  if ((buffer->count + size) <= buffer->end)
-  {
-    size_t end;
+  head = _Atomic_Load_ulong (&buffer->head, ATOMIC_ORDER_RELAXED);
 
-    /*
-     * Determine if the end of free space is marked with the end of buffer
-     * space, or the head of allocated space.
-     *
-     * |...|head| freespace |tail| ...| end
-     *
-     * tail|.....|head| freespace| end
-     */
-    if (buffer->tail > buffer->head)
-    {
-      end = buffer->tail;
-    } else
-    {
-      end = buffer->end;
-    }
+  /*
+   * The acquire pairs with the release of the consumer, so the consumer is
+   * done with the space it freed.
+   */
+  tail = _Atomic_Load_ulong (&buffer->tail, ATOMIC_ORDER_ACQUIRE);
 
+  /*
+   * Determine if the end of free space is marked with the end of buffer
+   * space, or the tail of allocated space.
+   *
+   * |...|tail| records |head| freespace | end
+   *
+   * |...|head| freespace |tail| records | end
+   */
+  if (head >= tail)
+  {
     /*
      * Can we allocate it easily?
      */
-    if ((buffer->head + size) <= end)
+    if ((head + size) <= buffer->size)
     {
-      ptr = &buffer->buffer[buffer->head];
-      buffer->head += size;
-      buffer->count = buffer->count + size;
-      if (buffer->max_rec < size)
-        buffer->max_rec = size;
+      ptr = &buffer->buffer[head];
+      buffer->reserved = head + size;
     }
-    else
+    else if (size < tail)
     {
       /*
-       * We have to consider wrapping around to the front of the buffer
-       *
-       * If there is no room at the end of the buffer and we have we already
-       * wrapped then we can't allocate and if there is room at the front of
-       * the buffer.
+       * Wrap around to the front of the buffer. Change the end to the last
+       * used byte, so a read will wrap when out of data. The head must not
+       * reach the tail since this would indicate an empty buffer.
        */
-      if ((end != buffer->tail) && (buffer->tail >= size))
-      {
-        /*
-         * Change the end pointer to the last used byte, so a read will wrap
-         * when out of data
-         */
-        buffer->end = buffer->head;
-
-        /*
-         * Now return the buffer
-         */
-        ptr = buffer->buffer;
-        buffer->head = size;
-        buffer->count = buffer->count + size;
-        if (buffer->max_rec < size)
-          buffer->max_rec = size;
-      }
+      buffer->end = head;
+      ptr = buffer->buffer;
+      buffer->reserved = size;
     }
   }
+  else if ((head + size) < tail)
+  {
+    ptr = &buffer->buffer[head];
+    buffer->reserved = head + size;
+  }
+
+  if ((ptr != NULL) && (buffer->max_rec < size))
+    buffer->max_rec = size;
 
   return ptr;
 }
@@ -99,31 +88,32 @@ rtems_capture_buffer_free (rtems_capture_buffer* buffer, size_t size)
 {
   void*  ptr;
   size_t next;
+  size_t head;
+  size_t tail;
   size_t buff_size;
 
   if (size == 0)
     return NULL;
 
   ptr = rtems_capture_buffer_peek (buffer, &buff_size);
-  next = buffer->tail + size;
+  head = _Atomic_Load_ulong (&buffer->head, ATOMIC_ORDER_ACQUIRE);
+  tail = _Atomic_Load_ulong (&buffer->tail, ATOMIC_ORDER_RELAXED);
+  next = tail + size;
 
   /*
-   * Check if we are freeing space past the end of the buffer
+   * Check if we are freeing space past the end of the block
    */
-  _Assert (! rtems_capture_buffer_is_empty( buffer));
-  _Assert (!((buffer->tail > buffer->head) && (next > buffer->end)));
-  _Assert (!((buffer->tail < buffer->head) && (next > buffer->head)));
+  _Assert (ptr != NULL);
+  _Assert (size <= buff_size);
 
-  buffer->count = buffer->count - size;
+  if ((tail > head) && (next == buffer->end))
+    next = 0;
 
-  if (next == buffer->end)
-  {
-    buffer->end = buffer->size;
-    buffer->tail = 0;
-  } else
-  {
-    buffer->tail = next;
-  }
+  /*
+   * The release pairs with the acquire of the producer, so the records are
+   * read before the producer overwrites them.
+   */
+  _Atomic_Store_ulong (&buffer->tail, next, ATOMIC_ORDER_RELEASE);
 
   return ptr;
 }
@@ -27,6 +27,7 @@
 #define __CAPTURE_BUFFER_H_
 
 #include <stdlib.h>
+#include <rtems/score/atomic.h>
 
 /**@{*/
 #ifdef __cplusplus
@@ -34,24 +35,33 @@ extern "C" {
 #endif
 
 /**
- * Capture buffer. There is one per CPU.
+ * The capture buffer is a single producer, single consumer ring of variable
+ * size records. The producer is the processor owning the buffer with
+ * interrupts disabled and the consumer is the reader of the buffer. Neither
+ * side waits for the other side. The producer owns the head and the end, the
+ * consumer owns the tail. The head and the tail are exchanged through atomic
+ * operations, so the records are read while they are recorded.
  */
 typedef struct rtems_capture_buffer {
-  uint8_t* buffer;       /**< The per cpu buffer. */
-  size_t   size;         /**< The size of the buffer in bytes. */
-  size_t   count;        /**< The number of used bytes in the buffer. */
-  size_t   head;         /**< First record. */
-  size_t   tail;         /**< Head == Tail for empty. */
-  size_t   end;          /**< Buffer current end, it may move in. */
-  size_t   max_rec;      /**< The largest record in the buffer. */
+  uint8_t*     buffer;   /**< The per cpu buffer. */
+  size_t       size;     /**< The size of the buffer in bytes. */
+  Atomic_Ulong head;     /**< End of the committed records. */
+  Atomic_Ulong tail;     /**< First record, head == tail for empty. */
+  size_t       reserved; /**< The head after the commit of the allocation. */
+  size_t       end;      /**< Buffer current end, it may move in. */
+  size_t       max_rec;  /**< The largest record in the buffer. */
 } rtems_capture_buffer;
 
+/*
+ * Flushing is only allowed if there is no producer and no consumer.
+ */
 static inline void
 rtems_capture_buffer_flush (rtems_capture_buffer* buffer)
 {
   buffer->end = buffer->size;
-  buffer->head = buffer->tail =  0;
-  buffer->count = 0;
+  _Atomic_Store_ulong (&buffer->head, 0, ATOMIC_ORDER_RELAXED);
+  _Atomic_Store_ulong (&buffer->tail, 0, ATOMIC_ORDER_RELAXED);
+  buffer->reserved = 0;
   buffer->max_rec = 0;
 }
 
@@ -60,6 +70,8 @@ rtems_capture_buffer_create (rtems_capture_buffer* buffer, size_t size)
 {
   buffer->buffer = malloc(size);
   buffer->size = size;
+  _Atomic_Init_ulong (&buffer->head, 0);
+  _Atomic_Init_ulong (&buffer->tail, 0);
   rtems_capture_buffer_flush (buffer);
 }
 
@@ -74,43 +86,68 @@ rtems_capture_buffer_destroy (rtems_capture_buffer*  buffer)
 static inline bool
 rtems_capture_buffer_is_empty (rtems_capture_buffer* buffer)
 {
-   return buffer->count == 0;
-}
-
-static inline bool
-rtems_capture_buffer_is_full (rtems_capture_buffer* buffer)
-{
-   return buffer->count == buffer->size;
+  return _Atomic_Load_ulong (&buffer->head, ATOMIC_ORDER_RELAXED) ==
+    _Atomic_Load_ulong (&buffer->tail, ATOMIC_ORDER_RELAXED);
 }
 
 static inline bool
 rtems_capture_buffer_has_wrapped (rtems_capture_buffer* buffer)
 {
-  if (buffer->tail > buffer->head)
+  if (_Atomic_Load_ulong (&buffer->tail, ATOMIC_ORDER_RELAXED) >
+      _Atomic_Load_ulong (&buffer->head, ATOMIC_ORDER_RELAXED))
     return true;
 
   return false;
 }
 
+/*
+ * The consumer gets the contiguous block of committed records at the tail.
+ */
 static inline void*
 rtems_capture_buffer_peek (rtems_capture_buffer* buffer, size_t* size)
 {
-  if (rtems_capture_buffer_is_empty (buffer))
+  size_t head;
+  size_t tail;
+
+  head = _Atomic_Load_ulong (&buffer->head, ATOMIC_ORDER_ACQUIRE);
+  tail = _Atomic_Load_ulong (&buffer->tail, ATOMIC_ORDER_RELAXED);
+
+  if (tail > head)
   {
-    *size = 0;
-    return NULL;
+    /*
+     * The producer wrapped around. The end is stable until the consumer
+     * wrapped around as well.
+     */
+    if (tail == buffer->end)
+    {
+      tail = 0;
+      _Atomic_Store_ulong (&buffer->tail, tail, ATOMIC_ORDER_RELEASE);
+      *size = head;
+    }
+    else
+      *size = buffer->end - tail;
   }
-
-  if (buffer->tail > buffer->head)
-    *size = buffer->end - buffer->tail;
   else
-    *size = buffer->head - buffer->tail;
+    *size = head - tail;
 
-  return &buffer->buffer[buffer->tail];
+  if (*size == 0)
+    return NULL;
+
+  return &buffer->buffer[tail];
 }
 
+/*
+ * The producer allocates a record which becomes visible to the consumer with
+ * the commit.
+ */
 void* rtems_capture_buffer_allocate (rtems_capture_buffer* buffer, size_t size);
 
+static inline void
+rtems_capture_buffer_commit (rtems_capture_buffer* buffer)
+{
+  _Atomic_Store_ulong (&buffer->head, buffer->reserved, ATOMIC_ORDER_RELEASE);
+}
+
 void* rtems_capture_buffer_free (rtems_capture_buffer* buffer, size_t size);
 
 #ifdef __cplusplus
@@ -35,19 +35,6 @@
 #include <rtems/monitor.h>
 #include <rtems/captureimpl.h>
 
-/*
- * Structure used during printing of the capture records.
- */
-
-typedef struct
-{
-  const void*          recs;      /**< Next record to be read. */
-  size_t               read;      /**< Number of records read. */
-  size_t               printed;   /**< Records been printed. */
-  bool                 rec_valid; /**< The record is valid. */
-  rtems_capture_record rec;       /**< The record, copied out. */
-} ctrace_per_cpu;
-
 /*
  * Task block size.
  */
@@ -254,149 +241,99 @@ rtems_capture_print_record_capture(int                         cpu,
 }
 
 /*
- * rtems_capture_print_trace_records
- *
- * This function is a monitor command that dumps trace records.
+ * Context used during printing of the capture records.
  */
-
-void
-rtems_capture_print_trace_records (int total, bool csv)
+typedef struct
 {
-  ctrace_per_cpu*    per_cpu;
-  ctrace_per_cpu*    cpu;
-  int                cpus;
-  rtems_capture_time last_time = 0;
-  int                i;
-
-  cpus = rtems_scheduler_get_processor_maximum ();
+  bool               csv;       /**< Print in the csv format. */
+  rtems_capture_time last_time; /**< The time of the last printed event. */
+} ctrace_print_context;
+
+static bool
+rtems_capture_print_trace_record (uint32_t                    cpu,
+                                  const rtems_capture_record* rec,
+                                  const void*                 data,
+                                  size_t                      size,
+                                  void*                       arg)
+{
+  ctrace_print_context* ctx = arg;
 
-  per_cpu = calloc (cpus, sizeof(*per_cpu));
-  if (per_cpu == NULL)
+  if (ctx->csv)
   {
-    fprintf(stdout, "error: no memory\n");
-    return;
+    fprintf(stdout,
+            "%03i,%08" PRIu32 ",%03" PRIu32
+            ",%03" PRIu32 ",%04" PRIx32 ",%" PRId64 "\n",
+            (int) cpu,
+            (uint32_t) rec->task_id,
+            (rec->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
+            (rec->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
+            (rec->events >> RTEMS_CAPTURE_EVENT_START),
+            (uint64_t) rec->time);
   }
-
-  while (total)
+  else
   {
-    const rtems_capture_record* rec_out = NULL;
-    int                         cpu_out = -1;
-    rtems_capture_time          this_time = 0;
-
-    /* Prime the per_cpu data */
-    for (i = 0; i < cpus; i++) {
-      cpu = &per_cpu[i];
-
-      if (cpu->read == 0)
-      {
-        rtems_status_code sc;
-        sc = rtems_capture_read (i, &cpu->read, &cpu->recs);
-        if (sc != RTEMS_SUCCESSFUL)
-        {
-          fprintf (stdout,
-                   "error: trace read failed: %s\n", rtems_status_text (sc));
-          rtems_capture_flush (0);
-          free (per_cpu);
-          return;
-        }
-        /* Release the buffer if there are no records to read */
-        if (cpu->read == 0)
-          rtems_capture_release (i, 0);
-      }
-
-      /* Read the record out from the capture buffer */
-      if (!cpu->rec_valid && (cpu->read != 0))
-      {
-        cpu->recs = rtems_capture_record_extract (cpu->recs,
-                                                  &cpu->rec,
-                                                  sizeof (cpu->rec));
-        cpu->rec_valid = true;
-      }
-
-      /* Find the next record to print, the earliest recond on any core */
-      if ((cpu->rec_valid) && ((this_time == 0) || (cpu->rec.time < this_time)))
-      {
-        rec_out = &cpu->rec;
-        cpu_out = i;
-        this_time = rec_out->time;
-      }
-    }
-
-    /*  If we have read all the records abort. */
-    if (rec_out == NULL)
-      break;
+    if ((rec->events >> RTEMS_CAPTURE_EVENT_START) == 0)
+    {
+      rtems_capture_task_record task_rec;
 
-    cpu = &per_cpu[cpu_out];
+      if (size < sizeof (task_rec))
+        return false;
 
-    /* Print the record */
-    if (csv)
-    {
-      fprintf(stdout,
-              "%03i,%08" PRIu32 ",%03" PRIu32
-              ",%03" PRIu32 ",%04" PRIx32 ",%" PRId64 "\n",
-              cpu_out,
-              (uint32_t) rec_out->task_id,
-              (rec_out->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
-              (rec_out->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
-              (rec_out->events >> RTEMS_CAPTURE_EVENT_START),
-              (uint64_t) rec_out->time);
+      rtems_capture_record_extract (data, &task_rec, sizeof (task_rec));
+      ctrace_task_name_add (rec->task_id, task_rec.name);
+      rtems_capture_print_record_task (cpu, rec, &task_rec);
     }
     else
     {
-      if ((rec_out->events >> RTEMS_CAPTURE_EVENT_START) == 0)
-      {
-        rtems_capture_task_record task_rec;
-        cpu->recs = rtems_capture_record_extract (cpu->recs,
-                                                  &task_rec,
-                                                  sizeof (task_rec));
-        ctrace_task_name_add (rec_out->task_id, task_rec.name);
-        rtems_capture_print_record_task (cpu_out, rec_out, &task_rec);
-      }
+      rtems_capture_time diff;
+      const rtems_name*  name = NULL;
+      if (ctx->last_time != 0)
+        diff = rec->time - ctx->last_time;
       else
-      {
-        rtems_capture_time diff;
-        const rtems_name*  name = NULL;
-        if (last_time != 0)
-          diff = rec_out->time - last_time;
-        else
-          diff = 0;
-        last_time = rec_out->time;
-        ctrace_task_name_find (rec_out->task_id, &name);
-        rtems_capture_print_record_capture (cpu_out, rec_out, diff, name);
-        if ((rec_out->events &
-             (RTEMS_CAPTURE_DELETED_BY_EVENT | RTEMS_CAPTURE_DELETED_EVENT)) != 0)
-          ctrace_task_name_remove (rec_out->task_id);
-      }
+        diff = 0;
+      ctx->last_time = rec->time;
+      ctrace_task_name_find (rec->task_id, &name);
+      rtems_capture_print_record_capture (cpu, rec, diff, name);
+      if ((rec->events &
+           (RTEMS_CAPTURE_DELETED_BY_EVENT | RTEMS_CAPTURE_DELETED_EVENT)) != 0)
+        ctrace_task_name_remove (rec->task_id);
     }
+  }
 
-    /*
-     * If we have not printed all the records read increment to the next
-     * record. If we have printed all records release the records printed.
-     */
-    cpu->rec_valid = false;
-    ++cpu->printed;
-    if (cpu->printed == cpu->read)
-    {
-      rtems_capture_release (cpu_out, cpu->printed);
-      cpu->recs = NULL;
-      cpu->read = 0;
-      cpu->printed = 0;
-    }
+  return false;
+}
 
-    --total;
-  }
+/*
+ * rtems_capture_print_trace_records
+ *
+ * This function is a monitor command that dumps trace records. The records
+ * of all CPUs are merged in time order.
+ */
+
+void
+rtems_capture_print_trace_records (int total, bool csv)
+{
+  ctrace_print_context ctx;
+  size_t               count;
+  rtems_status_code    sc;
+
+  /* A negative total prints all records */
+  count = total < 0 ? SIZE_MAX : (size_t) total;
 
-  /* Finished so release all the records that were printed. */
-  for (i = 0; i < cpus; i++)
+  ctx.csv = csv;
+  ctx.last_time = 0;
+
+  sc = rtems_capture_read_merged (count, rtems_capture_print_trace_record, &ctx);
+  if (sc == RTEMS_NO_MEMORY)
   {
-    cpu = &per_cpu[i];
-    if (cpu->read != 0)
-    {
-      rtems_capture_release (i, cpu->printed);
-    }
+    fprintf(stdout, "error: no memory\n");
+  }
+  else if (sc != RTEMS_SUCCESSFUL)
+  {
+    fprintf (stdout,
+             "error: trace read failed: %s\n", rtems_status_text (sc));
+    rtems_capture_flush (0);
   }
-
-  free(per_cpu);
 }
 
 void
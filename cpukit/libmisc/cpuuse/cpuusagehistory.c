@@ -0,0 +1,791 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libmisc_cpuuse
+ *
+ * @brief This source file contains the implementation of the CPU usage
+ *   history.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/cpuusehistory.h>
+#include <rtems/thread.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/timecounter.h>
+
+#if defined(RTEMS_PROFILING)
+#include <rtems/counter.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+/*
+ * The times are in sbintime_t units of the uptime.  The uptime is used
+ * instead of the CPU counter since it does not wrap around between two
+ * context switches.
+ */
+
+#define CPU_USAGE_HISTORY_Q 16
+
+typedef struct {
+  /* End of the current interval */
+  int64_t interval_end;
+
+  /* Time accounted to the current interval */
+  int64_t current;
+
+  uint32_t head;
+
+  uint32_t count;
+
+  uint32_t samples[ RTEMS_CPU_USAGE_HISTORY_SIZE ];
+} CPU_usage_History_ring;
+
+typedef struct {
+  ISR_LOCK_MEMBER( Lock )
+  CPU_usage_History_ring Ring;
+} CPU_usage_History_thread;
+
+typedef struct {
+  ISR_LOCK_MEMBER( Lock )
+
+  /* The thread which runs since the last update */
+  Thread_Control *running;
+
+  /* The last update time */
+  int64_t last;
+
+  CPU_usage_History_ring Idle;
+
+  /* The load averages in units of 0.1 percent with 16 fraction bits */
+  uint32_t load_averages[ 3 ];
+
+#if defined(RTEMS_PROFILING)
+  uint64_t total_interrupt_time;
+
+  uint32_t interrupt_time;
+#endif
+} CPU_usage_History_per_CPU;
+
+static PER_CPU_DATA_ITEM(
+  CPU_usage_History_per_CPU,
+  _CPU_usage_History_per_CPU
+);
+
+static struct {
+  rtems_mutex  mutex;
+  Atomic_Uint  enabled;
+  rtems_id     extension_id;
+  uint32_t     extension_index;
+  int64_t      epoch;
+  int64_t      interval;
+  uint32_t     interval_in_us;
+  uint32_t     burst_threshold_in_us;
+
+  /* The load average decays per interval with 16 fraction bits */
+  uint32_t     decays[ 3 ];
+} _CPU_usage_History = {
+  .mutex = RTEMS_MUTEX_INITIALIZER( "CPU Usage History" )
+};
+
+static const uint32_t _CPU_usage_History_windows_in_s[ 3 ] = { 1, 10, 60 };
+
+static CPU_usage_History_per_CPU *_CPU_usage_History_Get_per_CPU(
+  Per_CPU_Control *cpu
+)
+{
+  CPU_usage_History_per_CPU *per_cpu;
+
+  per_cpu = PER_CPU_DATA_GET(
+    cpu,
+    CPU_usage_History_per_CPU,
+    _CPU_usage_History_per_CPU
+  );
+  return per_cpu;
+}
+
+static CPU_usage_History_thread *_CPU_usage_History_Get_thread(
+  const Thread_Control *the_thread
+)
+{
+  return the_thread->extensions[ _CPU_usage_History.extension_index ];
+}
+
+static void _CPU_usage_History_Push(
+  CPU_usage_History_ring *ring,
+  uint32_t                sample,
+  uint64_t                n
+)
+{
+  if ( n > RTEMS_CPU_USAGE_HISTORY_SIZE ) {
+    n = RTEMS_CPU_USAGE_HISTORY_SIZE;
+  }
+
+  while ( n > 0 ) {
+    ring->samples[ ring->head ] = sample;
+    ring->head = ( ring->head + 1 ) % RTEMS_CPU_USAGE_HISTORY_SIZE;
+
+    if ( ring->count < RTEMS_CPU_USAGE_HISTORY_SIZE ) {
+      ++ring->count;
+    }
+
+    --n;
+  }
+}
+
+static void _CPU_usage_History_Initialize_ring(
+  CPU_usage_History_ring *ring,
+  int64_t                 now
+)
+{
+  int64_t interval;
+
+  interval = _CPU_usage_History.interval;
+  memset( ring, 0, sizeof( *ring ) );
+  ring->interval_end = _CPU_usage_History.epoch +
+    ( ( now - _CPU_usage_History.epoch ) / interval + 1 ) * interval;
+}
+
+/*
+ * Advances the ring to the end time.  If used is true, then the time interval
+ * from begin to end is accounted to the ring.  Returns the count of completed
+ * intervals.  The sample of the first completed interval is returned in
+ * first, all other completed intervals have the same sample returned in
+ * other.
+ */
+static uint64_t _CPU_usage_History_Advance(
+  CPU_usage_History_ring *ring,
+  int64_t                 begin,
+  int64_t                 end,
+  bool                    used,
+  uint32_t               *first,
+  uint32_t               *other
+)
+{
+  int64_t  interval;
+  int64_t  gap;
+  uint64_t full;
+
+  interval = _CPU_usage_History.interval;
+
+  if ( used && begin < ring->interval_end - interval ) {
+    /* A concurrent query advanced the ring */
+    begin = ring->interval_end - interval;
+  }
+
+  if ( end < ring->interval_end ) {
+    if ( used && end > begin ) {
+      ring->current += end - begin;
+    }
+
+    return 0;
+  }
+
+  if ( used ) {
+    ring->current += ring->interval_end - begin;
+  }
+
+  *first = (uint32_t) sbttous( ring->current );
+  _CPU_usage_History_Push( ring, *first, 1 );
+
+  gap = end - ring->interval_end;
+
+  if ( gap >= interval ) {
+    full = (uint64_t) gap / (uint64_t) interval;
+  } else {
+    full = 0;
+  }
+
+  *other = used ? _CPU_usage_History.interval_in_us : 0;
+  _CPU_usage_History_Push( ring, *other, full );
+
+  ring->interval_end += (int64_t) ( full + 1 ) * interval;
+  ring->current = used ? end - ( ring->interval_end - interval ) : 0;
+
+  return full + 1;
+}
+
+static uint32_t _CPU_usage_History_Decay(
+  uint32_t decay,
+  uint64_t n
+)
+{
+  uint32_t result;
+
+  result = UINT32_C( 1 ) << CPU_USAGE_HISTORY_Q;
+
+  while ( n > 0 && result != 0 ) {
+    if ( ( n & 1 ) != 0 ) {
+      result = (uint32_t)
+        ( ( (uint64_t) result * decay ) >> CPU_USAGE_HISTORY_Q );
+    }
+
+    decay = (uint32_t) ( ( (uint64_t) decay * decay ) >> CPU_USAGE_HISTORY_Q );
+    n >>= 1;
+  }
+
+  return result;
+}
+
+static uint32_t _CPU_usage_History_Load( uint32_t idle_in_us )
+{
+  uint32_t interval_in_us;
+
+  interval_in_us = _CPU_usage_History.interval_in_us;
+
+  if ( idle_in_us >= interval_in_us ) {
+    return 0;
+  }
+
+  return (uint32_t) ( ( (uint64_t) ( interval_in_us - idle_in_us ) * 1000 ) /
+    interval_in_us );
+}
+
+static void _CPU_usage_History_Update_load_averages(
+  CPU_usage_History_per_CPU *per_cpu,
+  uint32_t                   load,
+  uint64_t                   n
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( per_cpu->load_averages ); ++i ) {
+    uint32_t decay;
+    int64_t  target;
+    int64_t  average;
+
+    /* The closed form of n updates with the same load */
+    decay = _CPU_usage_History_Decay( _CPU_usage_History.decays[ i ], n );
+    target = (int64_t) load << CPU_USAGE_HISTORY_Q;
+    average = per_cpu->load_averages[ i ];
+    average = target +
+      ( ( ( average - target ) * decay ) >> CPU_USAGE_HISTORY_Q );
+    per_cpu->load_averages[ i ] = (uint32_t) average;
+  }
+}
+
+static void _CPU_usage_History_Update(
+  Per_CPU_Control           *cpu,
+  CPU_usage_History_per_CPU *per_cpu,
+  int64_t                    now,
+  bool                       enabled
+)
+{
+  Thread_Control *running;
+  int64_t         last;
+  uint64_t        completed;
+  uint32_t        first;
+  uint32_t        other;
+
+  running = per_cpu->running;
+  last = per_cpu->last;
+
+  if ( now <= last ) {
+    return;
+  }
+
+  if ( enabled && running != NULL ) {
+    CPU_usage_History_thread *thread;
+
+    thread = _CPU_usage_History_Get_thread( running );
+
+    if ( thread != NULL ) {
+      ISR_lock_Context lock_context;
+
+      _ISR_lock_Acquire( &thread->Lock, &lock_context );
+      (void) _CPU_usage_History_Advance(
+        &thread->Ring,
+        last,
+        last,
+        false,
+        &first,
+        &other
+      );
+      (void) _CPU_usage_History_Advance(
+        &thread->Ring,
+        last,
+        now,
+        true,
+        &first,
+        &other
+      );
+      _ISR_lock_Release( &thread->Lock, &lock_context );
+    }
+  }
+
+  completed = _CPU_usage_History_Advance(
+    &per_cpu->Idle,
+    last,
+    now,
+    running != NULL && running->is_idle,
+    &first,
+    &other
+  );
+
+  if ( completed > 0 ) {
+    _CPU_usage_History_Update_load_averages(
+      per_cpu,
+      _CPU_usage_History_Load( first ),
+      1
+    );
+    _CPU_usage_History_Update_load_averages(
+      per_cpu,
+      _CPU_usage_History_Load( other ),
+      completed - 1
+    );
+
+#if defined(RTEMS_PROFILING)
+    per_cpu->interrupt_time = (uint32_t) (
+      rtems_counter_ticks_to_nanoseconds(
+        cpu->Stats.total_interrupt_time - per_cpu->total_interrupt_time
+      ) / 1000
+    );
+    per_cpu->total_interrupt_time = cpu->Stats.total_interrupt_time;
+#endif
+  }
+
+  (void) cpu;
+  per_cpu->last = now;
+}
+
+static bool _CPU_usage_History_Is_enabled( void )
+{
+  return _Atomic_Load_uint(
+    &_CPU_usage_History.enabled,
+    ATOMIC_ORDER_ACQUIRE
+  ) != 0;
+}
+
+static void _CPU_usage_History_Switch(
+  Thread_Control *executing,
+  Thread_Control *heir
+)
+{
+  Per_CPU_Control           *cpu_self;
+  CPU_usage_History_per_CPU *per_cpu;
+  ISR_lock_Context           lock_context;
+  int64_t                    now;
+
+  (void) executing;
+
+  now = _Timecounter_Sbinuptime();
+  cpu_self = _Per_CPU_Get();
+  per_cpu = _CPU_usage_History_Get_per_CPU( cpu_self );
+
+  _ISR_lock_ISR_disable_and_acquire( &per_cpu->Lock, &lock_context );
+  _CPU_usage_History_Update(
+    cpu_self,
+    per_cpu,
+    now,
+    _CPU_usage_History_Is_enabled()
+  );
+  per_cpu->running = heir;
+  _ISR_lock_Release_and_ISR_enable( &per_cpu->Lock, &lock_context );
+}
+
+static CPU_usage_History_thread *_CPU_usage_History_Allocate( int64_t now )
+{
+  CPU_usage_History_thread *thread;
+
+  thread = malloc( sizeof( *thread ) );
+
+  if ( thread != NULL ) {
+    _ISR_lock_Initialize( &thread->Lock, "CPU Usage History" );
+    _CPU_usage_History_Initialize_ring( &thread->Ring, now );
+  }
+
+  return thread;
+}
+
+static void _CPU_usage_History_Free( Thread_Control *the_thread )
+{
+  CPU_usage_History_thread *thread;
+
+  thread = _CPU_usage_History_Get_thread( the_thread );
+  the_thread->extensions[ _CPU_usage_History.extension_index ] = NULL;
+
+  if ( thread != NULL ) {
+    _ISR_lock_Destroy( &thread->Lock );
+    free( thread );
+  }
+}
+
+static bool _CPU_usage_History_Thread_create(
+  Thread_Control *executing,
+  Thread_Control *created
+)
+{
+  (void) executing;
+
+  if ( _CPU_usage_History_Is_enabled() ) {
+    created->extensions[ _CPU_usage_History.extension_index ] =
+      _CPU_usage_History_Allocate( _Timecounter_Sbinuptime() );
+  }
+
+  return true;
+}
+
+static void _CPU_usage_History_Thread_delete(
+  Thread_Control *executing,
+  Thread_Control *deleted
+)
+{
+  (void) executing;
+
+  if ( _CPU_usage_History_Is_enabled() ) {
+    _CPU_usage_History_Free( deleted );
+  }
+}
+
+static const rtems_extensions_table _CPU_usage_History_extensions = {
+  .thread_create = _CPU_usage_History_Thread_create,
+  .thread_delete = _CPU_usage_History_Thread_delete,
+  .thread_switch = _CPU_usage_History_Switch
+};
+
+typedef struct {
+  int64_t now;
+  bool    no_memory;
+} CPU_usage_History_attach_context;
+
+static bool _CPU_usage_History_Attach( Thread_Control *the_thread, void *arg )
+{
+  CPU_usage_History_attach_context *ctx;
+  CPU_usage_History_thread         *thread;
+
+  ctx = arg;
+  thread = _CPU_usage_History_Allocate( ctx->now );
+  the_thread->extensions[ _CPU_usage_History.extension_index ] = thread;
+
+  if ( thread == NULL ) {
+    ctx->no_memory = true;
+  }
+
+  return false;
+}
+
+static bool _CPU_usage_History_Detach( Thread_Control *the_thread, void *arg )
+{
+  (void) arg;
+  _CPU_usage_History_Free( the_thread );
+  return false;
+}
+
+rtems_status_code rtems_cpu_usage_history_start(
+  uint32_t interval,
+  uint32_t burst_threshold
+)
+{
+  rtems_status_code                sc;
+  CPU_usage_History_attach_context ctx;
+  uint32_t                         cpu_max;
+  uint32_t                         cpu_index;
+  int64_t                          now;
+  size_t                           i;
+
+  if (
+    interval < RTEMS_CPU_USAGE_HISTORY_INTERVAL_MINIMUM ||
+    interval > RTEMS_CPU_USAGE_HISTORY_INTERVAL_MAXIMUM ||
+    burst_threshold == 0 ||
+    burst_threshold > 100
+  ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  rtems_mutex_lock( &_CPU_usage_History.mutex );
+
+  if ( _CPU_usage_History.extension_id != 0 ) {
+    rtems_mutex_unlock( &_CPU_usage_History.mutex );
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  now = _Timecounter_Sbinuptime();
+  _CPU_usage_History.epoch = now;
+  _CPU_usage_History.interval = ustosbt( interval );
+  _CPU_usage_History.interval_in_us = interval;
+  _CPU_usage_History.burst_threshold_in_us =
+    (uint32_t) ( ( (uint64_t) interval * burst_threshold ) / 100 );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( _CPU_usage_History.decays ); ++i ) {
+    uint64_t window;
+
+    /* Linear approximation of exp( -interval / window ) */
+    window = (uint64_t) _CPU_usage_History_windows_in_s[ i ] * 1000000;
+    _CPU_usage_History.decays[ i ] = (uint32_t)
+      ( ( ( window - interval ) << CPU_USAGE_HISTORY_Q ) / window );
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control           *cpu;
+    CPU_usage_History_per_CPU *per_cpu;
+    ISR_lock_Context           lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    per_cpu = _CPU_usage_History_Get_per_CPU( cpu );
+    _ISR_lock_Initialize( &per_cpu->Lock, "CPU Usage History" );
+    _ISR_lock_ISR_disable_and_acquire( &per_cpu->Lock, &lock_context );
+    per_cpu->running = _Per_CPU_Get_executing( cpu );
+    per_cpu->last = now;
+    _CPU_usage_History_Initialize_ring( &per_cpu->Idle, now );
+#if defined(RTEMS_PROFILING)
+    per_cpu->total_interrupt_time = cpu->Stats.total_interrupt_time;
+#endif
+    _ISR_lock_Release_and_ISR_enable( &per_cpu->Lock, &lock_context );
+  }
+
+  sc = rtems_extension_create(
+    rtems_build_name( 'C', 'P', 'U', 'H' ),
+    &_CPU_usage_History_extensions,
+    &_CPU_usage_History.extension_id
+  );
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    _CPU_usage_History.extension_id = 0;
+    rtems_mutex_unlock( &_CPU_usage_History.mutex );
+    return RTEMS_TOO_MANY;
+  }
+
+  _CPU_usage_History.extension_index =
+    rtems_object_id_get_index( _CPU_usage_History.extension_id );
+
+  /*
+   * The allocator lock serializes the attach with the thread create and
+   * delete extensions.
+   */
+  ctx.now = now;
+  ctx.no_memory = false;
+  _Objects_Allocator_lock();
+  rtems_task_iterate( _CPU_usage_History_Attach, &ctx );
+
+  if ( ctx.no_memory ) {
+    rtems_task_iterate( _CPU_usage_History_Detach, NULL );
+    _Objects_Allocator_unlock();
+    (void) rtems_extension_delete( _CPU_usage_History.extension_id );
+    _CPU_usage_History.extension_id = 0;
+    rtems_mutex_unlock( &_CPU_usage_History.mutex );
+    return RTEMS_NO_MEMORY;
+  }
+
+  _Atomic_Store_uint( &_CPU_usage_History.enabled, 1, ATOMIC_ORDER_RELEASE );
+  _Objects_Allocator_unlock();
+  rtems_mutex_unlock( &_CPU_usage_History.mutex );
+  return RTEMS_SUCCESSFUL;
+}
+
+bool rtems_cpu_usage_history_is_running( void )
+{
+  return _CPU_usage_History_Is_enabled();
+}
+
+uint32_t rtems_cpu_usage_history_get_interval( void )
+{
+  if ( !_CPU_usage_History_Is_enabled() ) {
+    return 0;
+  }
+
+  return _CPU_usage_History.interval_in_us;
+}
+
+static int64_t _CPU_usage_History_Flush( void )
+{
+  int64_t  now;
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  now = _Timecounter_Sbinuptime();
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control           *cpu;
+    CPU_usage_History_per_CPU *per_cpu;
+    ISR_lock_Context           lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    per_cpu = _CPU_usage_History_Get_per_CPU( cpu );
+    _ISR_lock_ISR_disable_and_acquire( &per_cpu->Lock, &lock_context );
+    _CPU_usage_History_Update( cpu, per_cpu, now, true );
+    _ISR_lock_Release_and_ISR_enable( &per_cpu->Lock, &lock_context );
+  }
+
+  return now;
+}
+
+static uint32_t _CPU_usage_History_Copy(
+  const CPU_usage_History_ring *ring,
+  uint32_t                     *samples
+)
+{
+  uint32_t i;
+
+  for ( i = 0; i < ring->count; ++i ) {
+    samples[ i ] = ring->samples[
+      ( ring->head + RTEMS_CPU_USAGE_HISTORY_SIZE - 1 - i ) %
+        RTEMS_CPU_USAGE_HISTORY_SIZE
+    ];
+  }
+
+  for ( ; i < RTEMS_CPU_USAGE_HISTORY_SIZE; ++i ) {
+    samples[ i ] = 0;
+  }
+
+  return ring->count;
+}
+
+rtems_status_code rtems_cpu_usage_history_get(
+  rtems_id                 id,
+  rtems_cpu_usage_history *history
+)
+{
+  Thread_Control           *the_thread;
+  CPU_usage_History_thread *thread;
+  ISR_lock_Context          lock_context;
+  CPU_usage_History_ring    ring;
+  uint32_t                  first;
+  uint32_t                  other;
+  int64_t                   now;
+  uint32_t                  i;
+
+  if ( history == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( !_CPU_usage_History_Is_enabled() ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  now = _CPU_usage_History_Flush();
+
+  /* The allocator lock prevents a concurrent thread delete */
+  _Objects_Allocator_lock();
+  the_thread = _Thread_Get( id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  _ISR_lock_ISR_enable( &lock_context );
+  thread = _CPU_usage_History_Get_thread( the_thread );
+
+  if ( thread == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &thread->Lock, &lock_context );
+  (void) _CPU_usage_History_Advance(
+    &thread->Ring,
+    now,
+    now,
+    false,
+    &first,
+    &other
+  );
+  ring = thread->Ring;
+  _ISR_lock_Release_and_ISR_enable( &thread->Lock, &lock_context );
+  _Objects_Allocator_unlock();
+
+  history->sample_count = _CPU_usage_History_Copy( &ring, history->samples );
+  history->peak = 0;
+  history->peak_index = 0;
+  history->burst_count = 0;
+
+  for ( i = 0; i < history->sample_count; ++i ) {
+    uint32_t sample;
+
+    sample = history->samples[ i ];
+
+    if ( sample > history->peak ) {
+      history->peak = sample;
+      history->peak_index = i;
+    }
+
+    if ( sample >= _CPU_usage_History.burst_threshold_in_us ) {
+      ++history->burst_count;
+    }
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_cpu_usage_history_get_processor(
+  uint32_t                           cpu_index,
+  rtems_cpu_usage_processor_history *history
+)
+{
+  Per_CPU_Control           *cpu;
+  CPU_usage_History_per_CPU *per_cpu;
+  ISR_lock_Context           lock_context;
+  CPU_usage_History_ring     ring;
+  size_t                     i;
+
+  if ( history == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( !_CPU_usage_History_Is_enabled() ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if ( cpu_index >= rtems_scheduler_get_processor_maximum() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  cpu = _Per_CPU_Get_by_index( cpu_index );
+  per_cpu = _CPU_usage_History_Get_per_CPU( cpu );
+  _ISR_lock_ISR_disable_and_acquire( &per_cpu->Lock, &lock_context );
+  _CPU_usage_History_Update( cpu, per_cpu, _Timecounter_Sbinuptime(), true );
+  ring = per_cpu->Idle;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( history->load_averages ); ++i ) {
+    history->load_averages[ i ] =
+      per_cpu->load_averages[ i ] >> CPU_USAGE_HISTORY_Q;
+  }
+
+#if defined(RTEMS_PROFILING)
+  history->interrupt_time = per_cpu->interrupt_time;
+#else
+  history->interrupt_time = 0;
+#endif
+  _ISR_lock_Release_and_ISR_enable( &per_cpu->Lock, &lock_context );
+
+  history->sample_count =
+    _CPU_usage_History_Copy( &ring, history->idle_samples );
+  return RTEMS_SUCCESSFUL;
+}
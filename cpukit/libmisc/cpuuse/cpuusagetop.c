@@ -33,6 +33,7 @@
 #include <inttypes.h>
 
 #include <rtems/cpuuse.h>
+#include <rtems/cpuusehistory.h>
 #include <rtems/printer.h>
 #include <rtems/malloc.h>
 #include <rtems/score/objectimpl.h>
@@ -55,6 +56,7 @@ typedef struct
   volatile bool          thread_run;
   volatile bool          thread_active;
   volatile bool          single_page;
+  volatile bool          history;
   volatile uint32_t      sort_order;
   volatile uint32_t      poll_rate_usecs;
   volatile uint32_t      show;
@@ -88,6 +90,13 @@ typedef struct
 #define RTEMS_TOP_SORT_CURRENT       (4)
 #define RTEMS_TOP_SORT_MAX           (4)
 
+/*
+ * The CPU usage history interval and burst threshold used by the history
+ * view.
+ */
+#define RTEMS_TOP_HISTORY_INTERVAL_USECS (100000)
+#define RTEMS_TOP_HISTORY_BURST_PERCENT  (50)
+
 static inline bool equal_to_uint32_t( uint32_t * lhs, uint32_t * rhs )
 {
    if ( *lhs == *rhs )
@@ -156,6 +165,38 @@ print_time(rtems_cpu_usage_data*    data,
 /*
  * Count the number of tasks.
  */
+/*
+ * Print the load averages, the idle and the interrupt time of the most recent
+ * history interval of each processor.
+ */
+static void
+print_processor_history(rtems_cpu_usage_data* data)
+{
+  uint32_t cpu_max = rtems_scheduler_get_processor_maximum();
+  uint32_t cpu_index;
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index)
+  {
+    rtems_cpu_usage_processor_history history;
+    rtems_status_code                 sc;
+
+    sc = rtems_cpu_usage_history_get_processor(cpu_index, &history);
+    if (sc != RTEMS_SUCCESSFUL)
+      continue;
+
+    rtems_printf(data->printer,
+                 "\nCPU %2" PRIu32 ": Load 1s/10s/60s: %3" PRIu32 ".%" PRIu32 "%%"
+                 " %3" PRIu32 ".%" PRIu32 "%% %3" PRIu32 ".%" PRIu32 "%%"
+                 "  Idle: %7" PRIu32 "us  ISR: %7" PRIu32 "us",
+                 cpu_index,
+                 history.load_averages[0] / 10, history.load_averages[0] % 10,
+                 history.load_averages[1] / 10, history.load_averages[1] % 10,
+                 history.load_averages[2] / 10, history.load_averages[2] % 10,
+                 history.idle_samples[0],
+                 history.interrupt_time);
+  }
+}
+
 static bool
 task_counter(Thread_Control *thrad, void* arg)
 {
@@ -359,13 +400,26 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
       continue;
     }
 
+    if (data->history && !rtems_cpu_usage_history_is_running())
+    {
+      sc = rtems_cpu_usage_history_start(RTEMS_TOP_HISTORY_INTERVAL_USECS,
+                                         RTEMS_TOP_HISTORY_BURST_PERCENT);
+      if (sc != RTEMS_SUCCESSFUL)
+      {
+        rtems_printf(data->printer,
+                     "error: cannot start CPU usage history: %s\n",
+                     rtems_status_text(sc));
+        data->history = false;
+      }
+    }
+
     _Protected_heap_Get_information(&_Workspace_Area, &wksp);
 
     if (data->single_page)
       rtems_printf(data->printer,
                    "\x1b[H\x1b[J"
                    " ENTER:Exit  SPACE:Refresh"
-                   "  S:Scroll  A:All  <>:Order  +/-:Lines\n");
+                   "  S:Scroll  A:All  H:History  <>:Order  +/-:Lines\n");
     rtems_printf(data->printer, "\n");
 
     /*
@@ -393,6 +447,12 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
     rtems_printf(data->printer,
                  "  Idle: %4" PRIu32 ".%03" PRIu32 "%%", ival, fval);
 
+    /*
+     * Per-processor load averages of the CPU usage history.
+     */
+    if (data->history)
+      print_processor_history(data);
+
     /*
      * Memory usage.
      */
@@ -417,13 +477,15 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
 
     rtems_printf(data->printer,
        "\n"
-        " ID         | NAME                | RPRI | CPRI   | TIME                | TOTAL   | CURRENT\n"
-        "-%s---------+---------------------+-%s-----%s-----+---------------------+-%s------+--%s----\n",
+        " ID         | NAME                | RPRI | CPRI   | TIME                | TOTAL   | CURRENT%s\n"
+        "-%s---------+---------------------+-%s-----%s-----+---------------------+-%s------+--%s----%s\n",
+       data->history ? " | LAST(us) | PEAK(us) | BURST" : "",
        data->sort_order == RTEMS_TOP_SORT_ID ? "^^" : "--",
        data->sort_order == RTEMS_TOP_SORT_REAL_PRI ? "^^" : "--",
        data->sort_order == RTEMS_TOP_SORT_CURRENT_PRI ? "^^" : "--",
                           data->sort_order == RTEMS_TOP_SORT_TOTAL ? "^^" : "--",
-       data->sort_order == RTEMS_TOP_SORT_CURRENT ? "^^" : "--"
+       data->sort_order == RTEMS_TOP_SORT_CURRENT ? "^^" : "--",
+       data->history ? "+----------+----------+------" : ""
     );
 
     task_count = 0;
@@ -483,7 +545,24 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
                    " |%4" PRIu32 ".%03" PRIu32, ival, fval);
       _Timestamp_Divide(&current_usage, &data->period, &ival, &fval);
       rtems_printf(data->printer,
-                   " |%4" PRIu32 ".%03" PRIu32 "\n", ival, fval);
+                   " |%4" PRIu32 ".%03" PRIu32, ival, fval);
+
+      /*
+       * The most recent interval, the peak interval, and the count of burst
+       * intervals of the history.
+       */
+      if (data->history)
+      {
+        rtems_cpu_usage_history history;
+
+        if (rtems_cpu_usage_history_get(thread->Object.id, &history) ==
+            RTEMS_SUCCESSFUL)
+          rtems_printf(data->printer,
+                       " | %8" PRIu32 " | %8" PRIu32 " | %5" PRIu32,
+                       history.samples[0], history.peak, history.burst_count);
+      }
+
+      rtems_printf(data->printer, "\n");
     }
 
     if (data->single_page && (data->show != 0) && (task_count < data->show))
@@ -604,6 +683,11 @@ void rtems_cpu_usage_top_with_plugin(
         ++data.sort_order;
       rtems_event_send(id, RTEMS_EVENT_1);
     }
+    else if ((c == 'h') || (c == 'H'))
+    {
+      data.history = !data.history;
+      rtems_event_send(id, RTEMS_EVENT_1);
+    }
     else if ((c == 's') || (c == 'S'))
     {
       data.single_page = !data.single_page;
@@ -0,0 +1,157 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSRecord
+ *
+ * @brief Shell Command to Control the Program Counter Sampling
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/recordsampler.h>
+#include <rtems/shell.h>
+
+static int rtems_shell_pcsample_usage(const char *name)
+{
+  fprintf(stderr, "%s [start [INTERVAL [DEPTH]] | stop | status]\n", name);
+  return 1;
+}
+
+static bool rtems_shell_pcsample_get_number(
+  const char *s,
+  uint32_t   *value
+)
+{
+  char          *end;
+  unsigned long  n;
+
+  n = strtoul(s, &end, 0);
+  if (*s == '\0' || *end != '\0' || n > UINT32_MAX)
+    return false;
+
+  *value = (uint32_t) n;
+  return true;
+}
+
+static int rtems_shell_pcsample_start(int argc, char **argv)
+{
+  rtems_status_code sc;
+  uint32_t          interval;
+  uint32_t          depth;
+
+  interval = 1;
+  depth = 0;
+
+  if (argc > 4)
+    return rtems_shell_pcsample_usage(argv[0]);
+
+  if (argc > 2 && !rtems_shell_pcsample_get_number(argv[2], &interval))
+    return rtems_shell_pcsample_usage(argv[0]);
+
+  if (argc > 3 && !rtems_shell_pcsample_get_number(argv[3], &depth))
+    return rtems_shell_pcsample_usage(argv[0]);
+
+  sc = rtems_record_sampler_start(interval, depth);
+  if (sc != RTEMS_SUCCESSFUL) {
+    fprintf(stderr, "%s: cannot start: %s\n", argv[0], rtems_status_text(sc));
+    return 1;
+  }
+
+  return 0;
+}
+
+static int rtems_shell_pcsample_stop(const char *name)
+{
+  rtems_status_code sc;
+
+  sc = rtems_record_sampler_stop();
+  if (sc != RTEMS_SUCCESSFUL) {
+    fprintf(stderr, "%s: cannot stop: %s\n", name, rtems_status_text(sc));
+    return 1;
+  }
+
+  return 0;
+}
+
+static int rtems_shell_pcsample_status(void)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  printf(
+    "sampling: %s\n",
+    rtems_record_sampler_is_running() ? "running" : "stopped"
+  );
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    printf(
+      "processor %" PRIu32 ": %" PRIu32 " samples\n",
+      cpu_index,
+      rtems_record_sampler_get_sample_count(cpu_index)
+    );
+  }
+
+  return 0;
+}
+
+static int rtems_shell_main_pcsample(int argc, char **argv)
+{
+  if (argc == 1 || strcmp(argv[1], "status") == 0) {
+    if (argc > 2)
+      return rtems_shell_pcsample_usage(argv[0]);
+
+    return rtems_shell_pcsample_status();
+  }
+
+  if (strcmp(argv[1], "start") == 0)
+    return rtems_shell_pcsample_start(argc, argv);
+
+  if (strcmp(argv[1], "stop") == 0 && argc == 2)
+    return rtems_shell_pcsample_stop(argv[0]);
+
+  return rtems_shell_pcsample_usage(argv[0]);
+}
+
+rtems_shell_cmd_t rtems_shell_PCSAMPLE_Command = {
+  .name = "pcsample",
+  .usage = "pcsample [start [INTERVAL [DEPTH]] | stop | status]",
+  .topic = "rtems",
+  .command = rtems_shell_main_pcsample
+};
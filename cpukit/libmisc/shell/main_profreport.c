@@ -17,6 +17,7 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
 
 #include <rtems/profiling.h>
 #include <rtems/printer.h>
@@ -26,6 +27,15 @@
 static int rtems_shell_main_profreport(int argc, char **argv)
 {
   rtems_printer printer;
+  bool reset = false;
+
+  if (argc == 2 && strcmp(argv[1], "-r") == 0) {
+    reset = true;
+  } else if (argc != 1) {
+    fprintf(stderr, "usage: %s [-r]\n", argv[0]);
+    return 1;
+  }
+
   rtems_print_printer_printf(&printer);
   rtems_profiling_report_xml(
     "Shell",
@@ -34,12 +44,18 @@ static int rtems_shell_main_profreport(int argc, char **argv)
     "  "
   );
 
+  if (reset) {
+    rtems_profiling_reset_thread_queues();
+    rtems_profiling_reset_latencies();
+  }
+
   return 0;
 }
 
 rtems_shell_cmd_t rtems_shell_PROFREPORT_Command = {
   .name = "profreport",
-  .usage = "profreport",
+  .usage = "profreport [-r]\n"
+    "  -r  reset the thread queue statistics and latencies after the report",
   .topic = "rtems",
   .command = rtems_shell_main_profreport
 };
@@ -417,15 +417,62 @@ report_sorted_samples(const T_measure_runtime_context *ctx)
 	}
 }
 
+enum {
+	STAT_MIN,
+	STAT_P1,
+	STAT_Q1,
+	STAT_Q2,
+	STAT_Q3,
+	STAT_P99,
+	STAT_MAX,
+	STAT_MAD,
+	STAT_COUNT
+};
+
+static void
+report_machine_readable(const T_measure_runtime_request *req,
+    const char *variant, size_t sample_count, const T_ticks *stats,
+    T_time a, T_time d)
+{
+	T_time_string ts[STAT_COUNT + 2];
+	size_t i;
+
+	for (i = 0; i < STAT_COUNT; ++i) {
+		T_ticks_to_string_ns(stats[i], ts[i]);
+	}
+
+	T_time_to_string_ns(a, ts[STAT_COUNT]);
+	T_time_to_string_ns(d, ts[STAT_COUNT + 1]);
+
+	if ((req->flags & T_MEASURE_RUNTIME_REPORT_JSON) != 0) {
+		T_printf("M:J:{\"name\":\"%s\",\"variant\":\"%s\","
+		    "\"n\":%zu,\"min\":%s,\"p1\":%s,\"q1\":%s,"
+		    "\"q2\":%s,\"q3\":%s,\"p99\":%s,\"max\":%s,"
+		    "\"mad\":%s,\"sum\":%s,\"duration\":%s}\n",
+		    req->name, variant, sample_count, ts[STAT_MIN],
+		    ts[STAT_P1], ts[STAT_Q1], ts[STAT_Q2], ts[STAT_Q3],
+		    ts[STAT_P99], ts[STAT_MAX], ts[STAT_MAD], ts[STAT_COUNT],
+		    ts[STAT_COUNT + 1]);
+	}
+
+	if ((req->flags & T_MEASURE_RUNTIME_REPORT_CSV) != 0) {
+		T_printf("M:C:%s,%s,%zu,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s\n",
+		    req->name, variant, sample_count, ts[STAT_MIN],
+		    ts[STAT_P1], ts[STAT_Q1], ts[STAT_Q2], ts[STAT_Q3],
+		    ts[STAT_P99], ts[STAT_MAX], ts[STAT_MAD], ts[STAT_COUNT],
+		    ts[STAT_COUNT + 1]);
+	}
+}
+
 static void
 measure_variant_end(const T_measure_runtime_context *ctx,
-    const T_measure_runtime_request *req, T_time begin)
+    const T_measure_runtime_request *req, const char *variant, T_time begin)
 {
 	size_t sample_count;
 	T_ticks *samples;
 	T_time_string ts;
+	T_ticks stats[STAT_COUNT];
 	T_time d;
-	T_ticks v;
 	T_time a;
 
 	sample_count = ctx->sample_count;
@@ -439,23 +486,24 @@ measure_variant_end(const T_measure_runtime_context *ctx,
 		report_sorted_samples(ctx);
 	}
 
-	v = samples[0];
-	T_printf("M:MI:%s\n", T_ticks_to_string_ns(v, ts));
-	v = samples[(1 * sample_count) / 100];
-	T_printf("M:P1:%s\n", T_ticks_to_string_ns(v, ts));
-	v = samples[(1 * sample_count) / 4];
-	T_printf("M:Q1:%s\n", T_ticks_to_string_ns(v, ts));
-	v = samples[sample_count / 2];
-	T_printf("M:Q2:%s\n", T_ticks_to_string_ns(v, ts));
-	v = samples[(3 * sample_count) / 4];
-	T_printf("M:Q3:%s\n", T_ticks_to_string_ns(v, ts));
-	v = samples[(99 * sample_count) / 100];
-	T_printf("M:P99:%s\n", T_ticks_to_string_ns(v, ts));
-	v = samples[sample_count - 1];
-	T_printf("M:MX:%s\n", T_ticks_to_string_ns(v, ts));
-	v = median_absolute_deviation(samples, sample_count);
-	T_printf("M:MAD:%s\n", T_ticks_to_string_ns(v, ts));
+	stats[STAT_MIN] = samples[0];
+	T_printf("M:MI:%s\n", T_ticks_to_string_ns(stats[STAT_MIN], ts));
+	stats[STAT_P1] = samples[(1 * sample_count) / 100];
+	T_printf("M:P1:%s\n", T_ticks_to_string_ns(stats[STAT_P1], ts));
+	stats[STAT_Q1] = samples[(1 * sample_count) / 4];
+	T_printf("M:Q1:%s\n", T_ticks_to_string_ns(stats[STAT_Q1], ts));
+	stats[STAT_Q2] = samples[sample_count / 2];
+	T_printf("M:Q2:%s\n", T_ticks_to_string_ns(stats[STAT_Q2], ts));
+	stats[STAT_Q3] = samples[(3 * sample_count) / 4];
+	T_printf("M:Q3:%s\n", T_ticks_to_string_ns(stats[STAT_Q3], ts));
+	stats[STAT_P99] = samples[(99 * sample_count) / 100];
+	T_printf("M:P99:%s\n", T_ticks_to_string_ns(stats[STAT_P99], ts));
+	stats[STAT_MAX] = samples[sample_count - 1];
+	T_printf("M:MX:%s\n", T_ticks_to_string_ns(stats[STAT_MAX], ts));
+	stats[STAT_MAD] = median_absolute_deviation(samples, sample_count);
+	T_printf("M:MAD:%s\n", T_ticks_to_string_ns(stats[STAT_MAD], ts));
 	T_printf("M:D:%s\n", T_time_to_string_ns(a, ts));
+	report_machine_readable(req, variant, sample_count, stats, a, d);
 	T_printf("M:E:%s:D:%s\n", req->name, T_time_to_string_ns(d, ts));
 }
 
@@ -523,8 +571,10 @@ measure_full_cache(T_measure_runtime_context *ctx,
 	void *arg;
 	size_t i;
 	T_time begin;
+	const char *variant;
 
-	measure_variant_begin(req->name, "FullCache");
+	variant = "FullCache";
+	measure_variant_begin(req->name, variant);
 	begin = T_now();
 	sample_count = ctx->sample_count;
 	samples = ctx->samples;
@@ -564,7 +614,7 @@ measure_full_cache(T_measure_runtime_context *ctx,
 		}
 	}
 
-	measure_variant_end(ctx, req, begin);
+	measure_variant_end(ctx, req, variant, begin);
 }
 
 static void
@@ -577,8 +627,10 @@ measure_hot_cache(T_measure_runtime_context *ctx,
 	void *arg;
 	size_t i;
 	T_time begin;
+	const char *variant;
 
-	measure_variant_begin(req->name, "HotCache");
+	variant = "HotCache";
+	measure_variant_begin(req->name, variant);
 	begin = T_now();
 	sample_count = ctx->sample_count;
 	samples = ctx->samples;
@@ -627,7 +679,7 @@ measure_hot_cache(T_measure_runtime_context *ctx,
 		}
 	}
 
-	measure_variant_end(ctx, req, begin);
+	measure_variant_end(ctx, req, variant, begin);
 }
 
 static void
@@ -641,8 +693,10 @@ measure_dirty_cache(T_measure_runtime_context *ctx,
 	size_t i;
 	T_time begin;
 	size_t token;
+	const char *variant;
 
-	measure_variant_begin(req->name, "DirtyCache");
+	variant = "DirtyCache";
+	measure_variant_begin(req->name, variant);
 	begin = T_now();
 	sample_count = ctx->sample_count;
 	samples = ctx->samples;
@@ -684,7 +738,7 @@ measure_dirty_cache(T_measure_runtime_context *ctx,
 		}
 	}
 
-	measure_variant_end(ctx, req, begin);
+	measure_variant_end(ctx, req, variant, begin);
 }
 
 #ifdef __sparc__
@@ -743,9 +797,10 @@ measure_load_variant(T_measure_runtime_context *ctx,
 	size_t i;
 	T_time begin;
 	size_t token;
+	char variant[16];
 
-	T_printf("M:B:%s\n", req->name);
-	T_printf("M:V:Load/%" PRIu32 "\n", load + 1);
+	(void)T_snprintf(variant, sizeof(variant), "Load/%" PRIu32, load + 1);
+	measure_variant_begin(req->name, variant);
 	begin = T_now();
 	sample_count = ctx->sample_count;
 	samples = ctx->samples;
@@ -791,7 +846,7 @@ measure_load_variant(T_measure_runtime_context *ctx,
 		}
 	}
 
-	measure_variant_end(ctx, req, begin);
+	measure_variant_end(ctx, req, variant, begin);
 }
 
 static void
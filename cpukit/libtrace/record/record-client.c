@@ -36,6 +36,7 @@
 
 #include <rtems/recordclient.h>
 
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include <rtems/score/assert.h>
@@ -730,3 +731,1497 @@ void rtems_record_client_destroy(
 
   free( ctx->per_cpu[ 0 ].items );
 }
+
+typedef struct {
+  rtems_record_client_function_node *node;
+  rtems_record_client_function_node *function;
+  uint64_t                           entry_bt;
+  uint64_t                           off_time;
+  uint64_t                           child_time;
+} function_frame;
+
+struct rtems_record_client_function_stack {
+  rtems_record_client_function_stack *next;
+  uint64_t                            id;
+  uint64_t                            off_time;
+  uint64_t                            suspend_bt;
+  bool                                suspended;
+  function_frame                     *frames;
+  size_t                              depth;
+  size_t                              capacity;
+};
+
+/*
+ * Thread identifiers have 32 bits, so use the upper bits to distinguish the
+ * interrupt contexts and the contexts of the processors before the first
+ * thread switch.
+ */
+#define FUNCTION_STACK_INITIAL( cpu ) ( ( UINT64_C( 1 ) << 32 ) | ( cpu ) )
+
+#define FUNCTION_STACK_INTERRUPT( cpu ) ( ( UINT64_C( 2 ) << 32 ) | ( cpu ) )
+
+static size_t hash_key( uint64_t key )
+{
+  return (size_t) ( ( key * UINT64_C( 0x9e3779b97f4a7c15 ) ) >>
+    ( 64 - RTEMS_RECORD_CLIENT_FUNCTION_HASH_BITS ) );
+}
+
+static rtems_record_client_function_stack *function_get_stack(
+  rtems_record_client_function_context *ctx,
+  uint64_t                              id
+)
+{
+  rtems_record_client_function_stack **bucket;
+  rtems_record_client_function_stack  *stack;
+
+  bucket = &ctx->stacks[ hash_key( id ) ];
+  stack = *bucket;
+
+  while ( stack != NULL ) {
+    if ( stack->id == id ) {
+      return stack;
+    }
+
+    stack = stack->next;
+  }
+
+  stack = calloc( 1, sizeof( *stack ) );
+  if ( stack == NULL ) {
+    return NULL;
+  }
+
+  stack->id = id;
+  stack->next = *bucket;
+  *bucket = stack;
+  return stack;
+}
+
+static void function_set_stack_id(
+  rtems_record_client_function_context *ctx,
+  rtems_record_client_function_stack   *stack,
+  uint64_t                              id
+)
+{
+  rtems_record_client_function_stack **link;
+  rtems_record_client_function_stack **bucket;
+
+  link = &ctx->stacks[ hash_key( stack->id ) ];
+
+  while ( *link != stack ) {
+    link = &( *link )->next;
+  }
+
+  *link = stack->next;
+  bucket = &ctx->stacks[ hash_key( id ) ];
+  stack->id = id;
+  stack->next = *bucket;
+  *bucket = stack;
+}
+
+static rtems_record_client_function_node *function_get_flat(
+  rtems_record_client_function_context *ctx,
+  uint64_t                              function
+)
+{
+  rtems_record_client_function_node **bucket;
+  rtems_record_client_function_node  *node;
+
+  bucket = &ctx->functions[ hash_key( function ) ];
+  node = *bucket;
+
+  while ( node != NULL ) {
+    if ( node->function == function ) {
+      return node;
+    }
+
+    node = node->next_in_bucket;
+  }
+
+  node = calloc( 1, sizeof( *node ) );
+  if ( node == NULL ) {
+    return NULL;
+  }
+
+  node->function = function;
+  node->next_in_bucket = *bucket;
+  *bucket = node;
+  return node;
+}
+
+static rtems_record_client_function_node *function_get_child(
+  rtems_record_client_function_node *parent,
+  uint64_t                           function
+)
+{
+  rtems_record_client_function_node **link;
+  rtems_record_client_function_node  *node;
+
+  link = &parent->first_child;
+  node = *link;
+
+  while ( node != NULL ) {
+    if ( node->function == function ) {
+      return node;
+    }
+
+    link = &node->next_sibling;
+    node = *link;
+  }
+
+  node = calloc( 1, sizeof( *node ) );
+  if ( node == NULL ) {
+    return NULL;
+  }
+
+  node->parent = parent;
+  node->function = function;
+  *link = node;
+  return node;
+}
+
+static void function_suspend(
+  rtems_record_client_function_stack *stack,
+  uint64_t                            bt
+)
+{
+  if ( stack != NULL && !stack->suspended ) {
+    stack->suspended = true;
+    stack->suspend_bt = bt;
+  }
+}
+
+static void function_resume(
+  rtems_record_client_function_stack *stack,
+  uint64_t                            bt
+)
+{
+  if ( stack->suspended ) {
+    stack->suspended = false;
+
+    /*
+     * The items of different processors are not delivered in time order, so
+     * a thread migration may show up with a switch in before the switch out.
+     */
+    if ( bt > stack->suspend_bt ) {
+      stack->off_time += bt - stack->suspend_bt;
+    }
+  }
+}
+
+static rtems_record_client_function_stack *function_current_stack(
+  rtems_record_client_function_context *ctx,
+  uint32_t                              cpu
+)
+{
+  rtems_record_client_function_stack *stack;
+
+  if ( ctx->per_cpu[ cpu ].interrupt_nest_level > 0 ) {
+    return ctx->per_cpu[ cpu ].interrupt;
+  }
+
+  stack = ctx->per_cpu[ cpu ].thread;
+
+  if ( stack == NULL ) {
+    stack = function_get_stack( ctx, FUNCTION_STACK_INITIAL( cpu ) );
+    ctx->per_cpu[ cpu ].thread = stack;
+  }
+
+  return stack;
+}
+
+static rtems_record_client_status function_entry(
+  rtems_record_client_function_context *ctx,
+  rtems_record_client_function_stack   *stack,
+  uint64_t                              bt,
+  uint64_t                              function
+)
+{
+  rtems_record_client_function_node *parent;
+  rtems_record_client_function_node *node;
+  rtems_record_client_function_node *flat;
+  function_frame                    *frame;
+
+  if ( stack->depth == stack->capacity ) {
+    size_t          capacity;
+    function_frame *frames;
+
+    capacity = stack->capacity > 0 ? 2 * stack->capacity : 16;
+    frames = realloc( stack->frames, capacity * sizeof( *frames ) );
+    if ( frames == NULL ) {
+      return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+    }
+
+    stack->frames = frames;
+    stack->capacity = capacity;
+  }
+
+  if ( stack->depth > 0 ) {
+    parent = stack->frames[ stack->depth - 1 ].node;
+  } else {
+    parent = &ctx->root;
+  }
+
+  node = function_get_child( parent, function );
+  flat = function_get_flat( ctx, function );
+
+  if ( node == NULL || flat == NULL ) {
+    return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+  }
+
+  ++node->calls;
+  ++flat->calls;
+  ++flat->active;
+
+  frame = &stack->frames[ stack->depth ];
+  ++stack->depth;
+  frame->node = node;
+  frame->function = flat;
+  frame->entry_bt = bt;
+  frame->off_time = stack->off_time;
+  frame->child_time = 0;
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static void function_finish(
+  rtems_record_client_function_stack *stack,
+  uint64_t                            bt
+)
+{
+  function_frame                    *frame;
+  rtems_record_client_function_node *flat;
+  uint64_t                           on_time;
+  uint64_t                           off_time;
+  uint64_t                           self_time;
+
+  --stack->depth;
+  frame = &stack->frames[ stack->depth ];
+
+  on_time = bt > frame->entry_bt ? bt - frame->entry_bt : 0;
+  off_time = stack->off_time - frame->off_time;
+  on_time = on_time > off_time ? on_time - off_time : 0;
+  self_time = on_time > frame->child_time ? on_time - frame->child_time : 0;
+
+  frame->node->total_time += on_time;
+  frame->node->self_time += self_time;
+
+  flat = frame->function;
+  flat->self_time += self_time;
+  --flat->active;
+
+  if ( flat->active == 0 ) {
+    flat->total_time += on_time;
+  }
+
+  if ( stack->depth > 0 ) {
+    stack->frames[ stack->depth - 1 ].child_time += on_time;
+  }
+}
+
+static void function_exit(
+  rtems_record_client_function_context *ctx,
+  rtems_record_client_function_stack   *stack,
+  uint64_t                              bt,
+  uint64_t                              function
+)
+{
+  size_t depth;
+
+  depth = stack->depth;
+
+  while ( depth > 0 ) {
+    --depth;
+
+    if ( stack->frames[ depth ].node->function == function ) {
+      /* Calls without an exit event end with the exit of their caller */
+      while ( stack->depth > depth + 1 ) {
+        function_finish( stack, bt );
+        ++ctx->implicit_exits;
+      }
+
+      function_finish( stack, bt );
+      return;
+    }
+  }
+
+  ++ctx->unmatched_exits;
+}
+
+static void function_discard(
+  rtems_record_client_function_context *ctx,
+  rtems_record_client_function_stack   *stack
+)
+{
+  if ( stack == NULL ) {
+    return;
+  }
+
+  while ( stack->depth > 0 ) {
+    --stack->depth;
+    --stack->frames[ stack->depth ].function->active;
+    ++ctx->discarded_calls;
+  }
+}
+
+void rtems_record_client_function_init(
+  rtems_record_client_function_context *ctx
+)
+{
+  memset( ctx, 0, sizeof( *ctx ) );
+}
+
+rtems_record_client_status rtems_record_client_function_process(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  rtems_record_client_function_context *ctx;
+  rtems_record_client_function_stack   *stack;
+
+  ctx = arg;
+
+  if ( cpu >= RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT ) {
+    return RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU;
+  }
+
+  switch ( event ) {
+    case RTEMS_RECORD_FUNCTION_ENTRY:
+      stack = function_current_stack( ctx, cpu );
+      if ( stack == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      return function_entry( ctx, stack, bt, data );
+    case RTEMS_RECORD_FUNCTION_EXIT:
+      stack = function_current_stack( ctx, cpu );
+      if ( stack == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      function_exit( ctx, stack, bt, data );
+      break;
+    case RTEMS_RECORD_THREAD_SWITCH_OUT:
+      stack = ctx->per_cpu[ cpu ].thread;
+
+      if ( stack != NULL && stack->id == FUNCTION_STACK_INITIAL( cpu ) ) {
+        /* Calls before the first thread switch belong to this thread */
+        function_set_stack_id( ctx, stack, data );
+      } else if ( stack == NULL || stack->id != data ) {
+        stack = function_get_stack( ctx, data );
+        if ( stack == NULL ) {
+          return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+        }
+      }
+
+      function_suspend( stack, bt );
+      ctx->per_cpu[ cpu ].thread = NULL;
+      break;
+    case RTEMS_RECORD_THREAD_SWITCH_IN:
+      stack = function_get_stack( ctx, data );
+      if ( stack == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      function_resume( stack, bt );
+      ctx->per_cpu[ cpu ].thread = stack;
+      break;
+    case RTEMS_RECORD_INTERRUPT_ENTRY:
+      if ( ctx->per_cpu[ cpu ].interrupt_nest_level == 0 ) {
+        stack = ctx->per_cpu[ cpu ].interrupt;
+
+        if ( stack == NULL ) {
+          stack = function_get_stack( ctx, FUNCTION_STACK_INTERRUPT( cpu ) );
+          if ( stack == NULL ) {
+            return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+          }
+
+          ctx->per_cpu[ cpu ].interrupt = stack;
+        }
+
+        function_suspend( ctx->per_cpu[ cpu ].thread, bt );
+        function_resume( stack, bt );
+      }
+
+      ++ctx->per_cpu[ cpu ].interrupt_nest_level;
+      break;
+    case RTEMS_RECORD_INTERRUPT_EXIT:
+      if ( ctx->per_cpu[ cpu ].interrupt_nest_level > 0 ) {
+        --ctx->per_cpu[ cpu ].interrupt_nest_level;
+
+        if ( ctx->per_cpu[ cpu ].interrupt_nest_level == 0 ) {
+          function_suspend( ctx->per_cpu[ cpu ].interrupt, bt );
+
+          stack = ctx->per_cpu[ cpu ].thread;
+          if ( stack != NULL ) {
+            function_resume( stack, bt );
+          }
+        }
+      }
+      break;
+    case RTEMS_RECORD_PER_CPU_OVERFLOW:
+      /* The call stacks of this processor lost an unknown set of events */
+      function_discard( ctx, ctx->per_cpu[ cpu ].thread );
+      function_discard( ctx, ctx->per_cpu[ cpu ].interrupt );
+      ctx->per_cpu[ cpu ].interrupt_nest_level = 0;
+      break;
+    default:
+      break;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+void rtems_record_client_function_visit_call_tree(
+  const rtems_record_client_function_context *ctx,
+  rtems_record_client_function_visitor        visitor,
+  void                                       *arg
+)
+{
+  const rtems_record_client_function_node *node;
+  uint32_t                                 depth;
+
+  node = ctx->root.first_child;
+  depth = 0;
+
+  while ( node != NULL ) {
+    ( *visitor )( node, depth, arg );
+
+    if ( node->first_child != NULL ) {
+      node = node->first_child;
+      ++depth;
+      continue;
+    }
+
+    while ( node != &ctx->root && node->next_sibling == NULL ) {
+      node = node->parent;
+      --depth;
+    }
+
+    if ( node == &ctx->root ) {
+      break;
+    }
+
+    node = node->next_sibling;
+  }
+}
+
+void rtems_record_client_function_visit_functions(
+  const rtems_record_client_function_context *ctx,
+  rtems_record_client_function_visitor        visitor,
+  void                                       *arg
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE; ++i ) {
+    const rtems_record_client_function_node *node;
+
+    node = ctx->functions[ i ];
+
+    while ( node != NULL ) {
+      ( *visitor )( node, 0, arg );
+      node = node->next_in_bucket;
+    }
+  }
+}
+
+void rtems_record_client_function_destroy(
+  rtems_record_client_function_context *ctx
+)
+{
+  rtems_record_client_function_node *node;
+  size_t                             i;
+
+  node = ctx->root.first_child;
+
+  while ( node != NULL ) {
+    rtems_record_client_function_node *next;
+
+    if ( node->first_child != NULL ) {
+      node = node->first_child;
+      continue;
+    }
+
+    if ( node->next_sibling != NULL ) {
+      next = node->next_sibling;
+    } else {
+      next = node->parent;
+      next->first_child = NULL;
+
+      if ( next == &ctx->root ) {
+        next = NULL;
+      }
+    }
+
+    free( node );
+    node = next;
+  }
+
+  for ( i = 0; i < RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE; ++i ) {
+    rtems_record_client_function_stack *stack;
+
+    node = ctx->functions[ i ];
+
+    while ( node != NULL ) {
+      rtems_record_client_function_node *next;
+
+      next = node->next_in_bucket;
+      free( node );
+      node = next;
+    }
+
+    stack = ctx->stacks[ i ];
+
+    while ( stack != NULL ) {
+      rtems_record_client_function_stack *next;
+
+      next = stack->next;
+      free( stack->frames );
+      free( stack );
+      stack = next;
+    }
+  }
+}
+
+static rtems_record_client_sample_node *sample_get_node(
+  rtems_record_client_sample_node **buckets,
+  uint64_t                          key
+)
+{
+  rtems_record_client_sample_node **bucket;
+  rtems_record_client_sample_node  *node;
+
+  bucket = &buckets[ hash_key( key ) ];
+  node = *bucket;
+
+  while ( node != NULL ) {
+    if ( node->key == key ) {
+      return node;
+    }
+
+    node = node->next;
+  }
+
+  node = calloc( 1, sizeof( *node ) );
+  if ( node == NULL ) {
+    return NULL;
+  }
+
+  node->key = key;
+  node->next = *bucket;
+  *bucket = node;
+  return node;
+}
+
+static rtems_record_client_status sample_add_frame(
+  rtems_record_client_sample_context *ctx,
+  uint32_t                            cpu,
+  uint64_t                            pc,
+  bool                                is_pc
+)
+{
+  rtems_record_client_sample_node *node;
+  uint64_t                         key;
+  uint32_t                         frame_count;
+  uint32_t                         i;
+
+  key = pc;
+
+  if ( pc != 0 && ctx->resolve != NULL ) {
+    key = ( *ctx->resolve )( pc, ctx->resolve_arg );
+  }
+
+  frame_count = ctx->per_cpu[ cpu ].frame_count;
+
+  for ( i = 0; i < frame_count; ++i ) {
+    if ( ctx->per_cpu[ cpu ].frames[ i ] == key ) {
+      /* Recursive calls count only once */
+      return RTEMS_RECORD_CLIENT_SUCCESS;
+    }
+  }
+
+  if ( frame_count < RTEMS_RECORD_CLIENT_SAMPLE_FRAME_MAXIMUM ) {
+    ctx->per_cpu[ cpu ].frames[ frame_count ] = key;
+    ctx->per_cpu[ cpu ].frame_count = frame_count + 1;
+  }
+
+  node = sample_get_node( &ctx->functions[ 0 ], key );
+  if ( node == NULL ) {
+    return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+  }
+
+  if ( is_pc ) {
+    ++node->self;
+  }
+
+  ++node->total;
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+void rtems_record_client_sample_init(
+  rtems_record_client_sample_context  *ctx,
+  rtems_record_client_sample_resolver  resolve,
+  void                                *arg
+)
+{
+  memset( ctx, 0, sizeof( *ctx ) );
+  ctx->resolve = resolve;
+  ctx->resolve_arg = arg;
+}
+
+rtems_record_client_status rtems_record_client_sample_process(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  rtems_record_client_sample_context *ctx;
+  rtems_record_client_sample_node    *node;
+
+  (void) bt;
+  ctx = arg;
+
+  if ( cpu >= RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT ) {
+    return RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU;
+  }
+
+  switch ( event ) {
+    case RTEMS_RECORD_SAMPLE_PC:
+      ++ctx->sample_count;
+      ctx->per_cpu[ cpu ].frame_count = 0;
+      return sample_add_frame( ctx, cpu, data, true );
+    case RTEMS_RECORD_SAMPLE_CALLER:
+      return sample_add_frame( ctx, cpu, data, false );
+    case RTEMS_RECORD_SAMPLE_THREAD:
+      node = sample_get_node( &ctx->threads[ 0 ], data );
+      if ( node == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      ++node->self;
+      ++node->total;
+      break;
+    default:
+      break;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static void sample_visit(
+  rtems_record_client_sample_node * const *buckets,
+  rtems_record_client_sample_visitor       visitor,
+  void                                    *arg
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE; ++i ) {
+    const rtems_record_client_sample_node *node;
+
+    node = buckets[ i ];
+
+    while ( node != NULL ) {
+      ( *visitor )( node, arg );
+      node = node->next;
+    }
+  }
+}
+
+void rtems_record_client_sample_visit_functions(
+  const rtems_record_client_sample_context *ctx,
+  rtems_record_client_sample_visitor        visitor,
+  void                                     *arg
+)
+{
+  sample_visit( &ctx->functions[ 0 ], visitor, arg );
+}
+
+void rtems_record_client_sample_visit_threads(
+  const rtems_record_client_sample_context *ctx,
+  rtems_record_client_sample_visitor        visitor,
+  void                                     *arg
+)
+{
+  sample_visit( &ctx->threads[ 0 ], visitor, arg );
+}
+
+static void sample_free(
+  rtems_record_client_sample_node **buckets
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE; ++i ) {
+    rtems_record_client_sample_node *node;
+
+    node = buckets[ i ];
+
+    while ( node != NULL ) {
+      rtems_record_client_sample_node *next;
+
+      next = node->next;
+      free( node );
+      node = next;
+    }
+  }
+}
+
+void rtems_record_client_sample_destroy(
+  rtems_record_client_sample_context *ctx
+)
+{
+  sample_free( &ctx->functions[ 0 ] );
+  sample_free( &ctx->threads[ 0 ] );
+}
+
+struct rtems_record_client_sched_resource {
+  rtems_record_client_sched_resource *next;
+  uint64_t                            id;
+  rtems_record_client_sched_thread   *owner;
+};
+
+/*
+ * The object API field of the identifiers of threads created by the system,
+ * for example the idle threads, has the value of the internal API.
+ */
+#define SCHED_IS_IDLE( id ) ( ( ( ( id ) >> 24 ) & 0x7 ) == 1 )
+
+static rtems_record_client_sched_thread *sched_get_thread(
+  rtems_record_client_sched_context *ctx,
+  uint64_t                           id
+)
+{
+  rtems_record_client_sched_thread **bucket;
+  rtems_record_client_sched_thread  *thread;
+
+  bucket = &ctx->threads[ hash_key( id ) ];
+  thread = *bucket;
+
+  while ( thread != NULL ) {
+    if ( thread->id == id ) {
+      return thread;
+    }
+
+    thread = thread->next;
+  }
+
+  thread = calloc( 1, sizeof( *thread ) );
+  if ( thread == NULL ) {
+    return NULL;
+  }
+
+  thread->id = id;
+  thread->next = *bucket;
+  *bucket = thread;
+  return thread;
+}
+
+static rtems_record_client_sched_resource *sched_get_resource(
+  rtems_record_client_sched_context *ctx,
+  uint64_t                           id
+)
+{
+  rtems_record_client_sched_resource **bucket;
+  rtems_record_client_sched_resource  *resource;
+
+  bucket = &ctx->resources[ hash_key( id ) ];
+  resource = *bucket;
+
+  while ( resource != NULL ) {
+    if ( resource->id == id ) {
+      return resource;
+    }
+
+    resource = resource->next;
+  }
+
+  resource = calloc( 1, sizeof( *resource ) );
+  if ( resource == NULL ) {
+    return NULL;
+  }
+
+  resource->id = id;
+  resource->next = *bucket;
+  *bucket = resource;
+  return resource;
+}
+
+static void sched_emit(
+  rtems_record_client_sched_context      *ctx,
+  rtems_record_client_sched_segment_kind  kind,
+  const rtems_record_client_sched_thread *thread,
+  uint32_t                                cpu,
+  uint64_t                                begin,
+  uint64_t                                end
+)
+{
+  rtems_record_client_sched_segment segment;
+
+  if ( ctx->handler == NULL ) {
+    return;
+  }
+
+  segment.kind = kind;
+  segment.thread = thread;
+  segment.owner = NULL;
+  segment.runner = NULL;
+  segment.cpu = cpu;
+  segment.begin = begin;
+  segment.end = end;
+  ( *ctx->handler )( &segment, ctx->handler_arg );
+}
+
+static void sched_execute_end(
+  rtems_record_client_sched_context *ctx,
+  uint32_t                           cpu,
+  uint64_t                           bt
+)
+{
+  rtems_record_client_sched_thread *thread;
+  uint64_t                          begin;
+  uint64_t                          delta;
+
+  thread = ctx->per_cpu[ cpu ].executing;
+  begin = ctx->per_cpu[ cpu ].switch_in_bt;
+  ctx->per_cpu[ cpu ].executing = NULL;
+
+  /*
+   * The items of different processors are not delivered in time order, so
+   * guard against negative intervals.
+   */
+  delta = bt > begin ? bt - begin : 0;
+  thread->run_time += delta;
+
+  if ( SCHED_IS_IDLE( thread->id ) ) {
+    ctx->per_cpu[ cpu ].idle_time += delta;
+  } else {
+    ctx->per_cpu[ cpu ].busy_time += delta;
+  }
+
+  sched_emit(
+    ctx,
+    RTEMS_RECORD_CLIENT_SCHED_SEGMENT_EXECUTE,
+    thread,
+    cpu,
+    begin,
+    begin + delta
+  );
+}
+
+static void sched_remove_waiter(
+  rtems_record_client_sched_context *ctx,
+  rtems_record_client_sched_thread  *thread
+)
+{
+  rtems_record_client_sched_thread **link;
+
+  link = &ctx->waiters;
+
+  while ( *link != NULL ) {
+    if ( *link == thread ) {
+      *link = thread->next_waiter;
+      break;
+    }
+
+    link = &( *link )->next_waiter;
+  }
+
+  thread->next_waiter = NULL;
+  thread->waiting = false;
+}
+
+static void sched_check_inversion(
+  rtems_record_client_sched_context *ctx,
+  rtems_record_client_sched_thread  *runner,
+  uint32_t                           cpu,
+  uint64_t                           bt
+)
+{
+  rtems_record_client_sched_thread *waiter;
+
+  if ( !runner->priority_known ) {
+    return;
+  }
+
+  waiter = ctx->waiters;
+
+  while ( waiter != NULL ) {
+    rtems_record_client_sched_resource *resource;
+    rtems_record_client_sched_thread   *owner;
+
+    resource = sched_get_resource( ctx, waiter->wait_resource );
+    owner = resource != NULL ? resource->owner : NULL;
+
+    if (
+      owner != NULL && owner != runner && owner != waiter &&
+      owner->state == RTEMS_RECORD_CLIENT_SCHED_READY &&
+      owner->cpu == cpu &&
+      waiter->priority_known && runner->priority > waiter->priority
+    ) {
+      rtems_record_client_sched_segment segment;
+
+      ++waiter->inversion_count;
+      ++ctx->inversion_count;
+
+      if ( ctx->handler != NULL ) {
+        segment.kind = RTEMS_RECORD_CLIENT_SCHED_SEGMENT_INVERSION;
+        segment.thread = waiter;
+        segment.owner = owner;
+        segment.runner = runner;
+        segment.cpu = cpu;
+        segment.begin = bt;
+        segment.end = bt;
+        ( *ctx->handler )( &segment, ctx->handler_arg );
+      }
+    }
+
+    waiter = waiter->next_waiter;
+  }
+}
+
+static void sched_switch_out(
+  rtems_record_client_sched_context *ctx,
+  rtems_record_client_sched_thread  *thread,
+  uint32_t                           cpu,
+  uint64_t                           bt
+)
+{
+  if ( ctx->per_cpu[ cpu ].executing == thread ) {
+    sched_execute_end( ctx, cpu, bt );
+  }
+
+  /*
+   * In case of a thread migration, the switch in on the other processor may
+   * show up before the switch out on this processor.
+   */
+  if (
+    thread->state == RTEMS_RECORD_CLIENT_SCHED_EXECUTING &&
+    thread->cpu == cpu
+  ) {
+    if ( thread->blocking ) {
+      thread->state = RTEMS_RECORD_CLIENT_SCHED_BLOCKED;
+    } else if ( ctx->state_events ) {
+      thread->state = RTEMS_RECORD_CLIENT_SCHED_READY;
+      thread->ready_bt = bt;
+    } else {
+      thread->state = RTEMS_RECORD_CLIENT_SCHED_UNKNOWN;
+    }
+  }
+
+  thread->blocking = false;
+}
+
+static void sched_switch_in(
+  rtems_record_client_sched_context *ctx,
+  rtems_record_client_sched_thread  *thread,
+  uint32_t                           cpu,
+  uint64_t                           bt
+)
+{
+  if ( thread->state == RTEMS_RECORD_CLIENT_SCHED_READY ) {
+    uint64_t latency;
+
+    latency = bt > thread->ready_bt ? bt - thread->ready_bt : 0;
+    ++thread->ready_count;
+    thread->total_ready_latency += latency;
+
+    if ( thread->max_ready_latency < latency ) {
+      thread->max_ready_latency = latency;
+    }
+
+    sched_emit(
+      ctx,
+      RTEMS_RECORD_CLIENT_SCHED_SEGMENT_READY,
+      thread,
+      cpu,
+      thread->ready_bt,
+      thread->ready_bt + latency
+    );
+  }
+
+  if ( thread->waiting ) {
+    sched_remove_waiter( ctx, thread );
+  }
+
+  if ( ctx->per_cpu[ cpu ].executing != NULL ) {
+    sched_execute_end( ctx, cpu, bt );
+  }
+
+  thread->state = RTEMS_RECORD_CLIENT_SCHED_EXECUTING;
+  thread->cpu = cpu;
+  thread->blocking = false;
+  ++thread->switch_in_count;
+  ctx->per_cpu[ cpu ].executing = thread;
+  ctx->per_cpu[ cpu ].switch_in_bt = bt;
+
+  /*
+   * The priority of the thread may follow the thread switch in, so the
+   * check is done once the priority is up to date.
+   */
+  ctx->per_cpu[ cpu ].check_inversion = true;
+}
+
+static void sched_check_pending_inversion(
+  rtems_record_client_sched_context *ctx,
+  uint32_t                           cpu
+)
+{
+  ctx->per_cpu[ cpu ].check_inversion = false;
+
+  if ( ctx->waiters != NULL && ctx->per_cpu[ cpu ].executing != NULL ) {
+    sched_check_inversion(
+      ctx,
+      ctx->per_cpu[ cpu ].executing,
+      cpu,
+      ctx->per_cpu[ cpu ].switch_in_bt
+    );
+  }
+}
+
+static void sched_append_name(
+  rtems_record_client_sched_thread *thread,
+  uint64_t                          data
+)
+{
+  size_t i;
+
+  for ( i = 0; i < sizeof( data ); ++i ) {
+    char c;
+
+    c = (char) ( data >> ( i * 8 ) );
+
+    if (
+      c != '\0' &&
+      thread->name_length < RTEMS_RECORD_CLIENT_SCHED_NAME_SIZE - 1
+    ) {
+      thread->name[ thread->name_length ] = c;
+      ++thread->name_length;
+    }
+  }
+
+  thread->name[ thread->name_length ] = '\0';
+}
+
+void rtems_record_client_sched_init(
+  rtems_record_client_sched_context         *ctx,
+  rtems_record_client_sched_segment_handler  handler,
+  void                                      *arg
+)
+{
+  memset( ctx, 0, sizeof( *ctx ) );
+  ctx->handler = handler;
+  ctx->handler_arg = arg;
+}
+
+rtems_record_client_status rtems_record_client_sched_process(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  rtems_record_client_sched_context  *ctx;
+  rtems_record_client_sched_thread   *thread;
+  rtems_record_client_sched_resource *resource;
+
+  ctx = arg;
+
+  if ( cpu >= RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT ) {
+    return RTEMS_RECORD_CLIENT_ERROR_UNSUPPORTED_CPU;
+  }
+
+  if ( !ctx->per_cpu[ cpu ].active ) {
+    ctx->per_cpu[ cpu ].active = true;
+    ctx->per_cpu[ cpu ].first_bt = bt;
+  }
+
+  if ( bt > ctx->per_cpu[ cpu ].last_bt ) {
+    ctx->per_cpu[ cpu ].last_bt = bt;
+  }
+
+  if (
+    ctx->per_cpu[ cpu ].check_inversion &&
+    event != RTEMS_RECORD_THREAD_PRIO_CURRENT_HIGH &&
+    event != RTEMS_RECORD_THREAD_PRIO_CURRENT_LOW
+  ) {
+    sched_check_pending_inversion( ctx, cpu );
+  }
+
+  switch ( event ) {
+    case RTEMS_RECORD_THREAD_SWITCH_OUT:
+      thread = sched_get_thread( ctx, data );
+      if ( thread == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      sched_switch_out( ctx, thread, cpu, bt );
+      break;
+    case RTEMS_RECORD_THREAD_SWITCH_IN:
+      thread = sched_get_thread( ctx, data );
+      if ( thread == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      sched_switch_in( ctx, thread, cpu, bt );
+      ctx->per_cpu[ cpu ].selected = thread;
+      ctx->per_cpu[ cpu ].priority_high = 0;
+      break;
+    case RTEMS_RECORD_THREAD_ID:
+    case RTEMS_RECORD_THREAD_CREATE:
+      thread = sched_get_thread( ctx, data );
+      if ( thread == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      thread->name_length = 0;
+      thread->name[ 0 ] = '\0';
+      ctx->per_cpu[ cpu ].selected = thread;
+      ctx->per_cpu[ cpu ].priority_high = 0;
+      break;
+    case RTEMS_RECORD_THREAD_NAME:
+      thread = ctx->per_cpu[ cpu ].selected;
+
+      if ( thread != NULL ) {
+        sched_append_name( thread, data );
+      }
+      break;
+    case RTEMS_RECORD_THREAD_PRIO_CURRENT_HIGH:
+      ctx->per_cpu[ cpu ].priority_high = data;
+      break;
+    case RTEMS_RECORD_THREAD_PRIO_CURRENT_LOW:
+      thread = ctx->per_cpu[ cpu ].selected;
+
+      if ( thread != NULL ) {
+        thread->priority = ( ctx->per_cpu[ cpu ].priority_high << 32 ) | data;
+        thread->priority_known = true;
+      }
+
+      ctx->per_cpu[ cpu ].priority_high = 0;
+
+      if ( ctx->per_cpu[ cpu ].check_inversion ) {
+        sched_check_pending_inversion( ctx, cpu );
+      }
+      break;
+    case RTEMS_RECORD_THREAD_STATE_SET:
+      thread = sched_get_thread( ctx, data );
+      if ( thread == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      ctx->state_events = true;
+      thread->blocking = true;
+
+      if ( thread->state == RTEMS_RECORD_CLIENT_SCHED_READY ) {
+        thread->state = RTEMS_RECORD_CLIENT_SCHED_BLOCKED;
+      }
+      break;
+    case RTEMS_RECORD_THREAD_STATE_CLEAR:
+      thread = sched_get_thread( ctx, data );
+      if ( thread == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      ctx->state_events = true;
+
+      if ( thread->state != RTEMS_RECORD_CLIENT_SCHED_EXECUTING ) {
+        thread->state = RTEMS_RECORD_CLIENT_SCHED_READY;
+        thread->ready_bt = bt;
+      }
+      break;
+    case RTEMS_RECORD_THREAD_RESOURCE_OBTAIN:
+      resource = sched_get_resource( ctx, data );
+      if ( resource == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      resource->owner = ctx->per_cpu[ cpu ].executing;
+      break;
+    case RTEMS_RECORD_THREAD_RESOURCE_RELEASE:
+      resource = sched_get_resource( ctx, data );
+      if ( resource == NULL ) {
+        return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+      }
+
+      resource->owner = NULL;
+      break;
+    case RTEMS_RECORD_THREAD_QUEUE_ENQUEUE:
+      thread = ctx->per_cpu[ cpu ].executing;
+
+      if ( thread != NULL ) {
+        if ( !thread->waiting ) {
+          thread->waiting = true;
+          thread->next_waiter = ctx->waiters;
+          ctx->waiters = thread;
+        }
+
+        thread->wait_resource = data;
+      }
+      break;
+    case RTEMS_RECORD_THREAD_QUEUE_OWNER:
+      thread = ctx->per_cpu[ cpu ].executing;
+
+      if ( thread != NULL && thread->waiting ) {
+        resource = sched_get_resource( ctx, thread->wait_resource );
+        if ( resource == NULL ) {
+          return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+        }
+
+        if ( data != 0 ) {
+          resource->owner = sched_get_thread( ctx, data );
+          if ( resource->owner == NULL ) {
+            return RTEMS_RECORD_CLIENT_ERROR_NO_MEMORY;
+          }
+        } else {
+          resource->owner = NULL;
+        }
+      }
+      break;
+    case RTEMS_RECORD_PER_CPU_OVERFLOW:
+      /* The state of this processor lost an unknown set of events */
+      ++ctx->overflow_count;
+      ctx->per_cpu[ cpu ].executing = NULL;
+      ctx->per_cpu[ cpu ].selected = NULL;
+      break;
+    default:
+      break;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+void rtems_record_client_sched_finish(
+  rtems_record_client_sched_context *ctx
+)
+{
+  uint32_t cpu;
+
+  for ( cpu = 0; cpu < RTEMS_RECORD_CLIENT_MAXIMUM_CPU_COUNT; ++cpu ) {
+    if ( ctx->per_cpu[ cpu ].check_inversion ) {
+      sched_check_pending_inversion( ctx, cpu );
+    }
+
+    if ( ctx->per_cpu[ cpu ].executing != NULL ) {
+      sched_execute_end( ctx, cpu, ctx->per_cpu[ cpu ].last_bt );
+    }
+  }
+}
+
+void rtems_record_client_sched_visit_threads(
+  const rtems_record_client_sched_context *ctx,
+  rtems_record_client_sched_visitor        visitor,
+  void                                    *arg
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE; ++i ) {
+    const rtems_record_client_sched_thread *thread;
+
+    thread = ctx->threads[ i ];
+
+    while ( thread != NULL ) {
+      ( *visitor )( thread, arg );
+      thread = thread->next;
+    }
+  }
+}
+
+void rtems_record_client_sched_destroy(
+  rtems_record_client_sched_context *ctx
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_RECORD_CLIENT_FUNCTION_HASH_SIZE; ++i ) {
+    rtems_record_client_sched_thread   *thread;
+    rtems_record_client_sched_resource *resource;
+
+    thread = ctx->threads[ i ];
+
+    while ( thread != NULL ) {
+      rtems_record_client_sched_thread *next;
+
+      next = thread->next;
+      free( thread );
+      thread = next;
+    }
+
+    resource = ctx->resources[ i ];
+
+    while ( resource != NULL ) {
+      rtems_record_client_sched_resource *next;
+
+      next = resource->next;
+      free( resource );
+      resource = next;
+    }
+  }
+}
+
+static void chrome_separator( rtems_record_client_chrome_context *ctx )
+{
+  if ( ctx->count > 0 ) {
+    fputs( ",\n", ctx->file );
+  }
+
+  ++ctx->count;
+}
+
+static void chrome_time( FILE *file, const char *key, uint64_t bt )
+{
+  uint64_t ns;
+
+  /* The trace event times are in microseconds */
+  ns = rtems_record_client_bintime_to_nanoseconds( bt );
+  fprintf(
+    file,
+    "\"%s\":%" PRIu64 ".%03" PRIu64,
+    key,
+    ns / 1000,
+    ns % 1000
+  );
+}
+
+static void chrome_thread_name(
+  FILE                                   *file,
+  const rtems_record_client_sched_thread *thread
+)
+{
+  size_t i;
+
+  if ( thread->name_length == 0 ) {
+    fprintf( file, "0x%08" PRIx64, thread->id );
+    return;
+  }
+
+  for ( i = 0; i < thread->name_length; ++i ) {
+    unsigned char c;
+
+    c = (unsigned char) thread->name[ i ];
+
+    if ( c == '"' || c == '\\' ) {
+      fprintf( file, "\\%c", c );
+    } else if ( c < 0x20 || c >= 0x7f ) {
+      fprintf( file, "\\u%04x", c );
+    } else {
+      fputc( c, file );
+    }
+  }
+}
+
+void rtems_record_client_chrome_begin(
+  rtems_record_client_chrome_context *ctx,
+  FILE                               *file
+)
+{
+  ctx->file = file;
+  ctx->count = 0;
+  fputs( "[\n", file );
+  chrome_separator( ctx );
+  fputs(
+    "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"
+    "\"args\":{\"name\":\"Processors\"}}",
+    file
+  );
+  chrome_separator( ctx );
+  fputs(
+    "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+    "\"args\":{\"name\":\"Ready threads\"}}",
+    file
+  );
+}
+
+void rtems_record_client_chrome_segment(
+  const rtems_record_client_sched_segment *segment,
+  void                                    *arg
+)
+{
+  rtems_record_client_chrome_context *ctx;
+  FILE                               *file;
+
+  ctx = arg;
+  file = ctx->file;
+  chrome_separator( ctx );
+
+  switch ( segment->kind ) {
+    case RTEMS_RECORD_CLIENT_SCHED_SEGMENT_EXECUTE:
+      fputs( "{\"name\":\"", file );
+      chrome_thread_name( file, segment->thread );
+      fprintf(
+        file,
+        "\",\"cat\":\"execute\",\"ph\":\"X\",\"pid\":0,\"tid\":%" PRIu32 ",",
+        segment->cpu
+      );
+      break;
+    case RTEMS_RECORD_CLIENT_SCHED_SEGMENT_READY:
+      fputs( "{\"name\":\"ready\",\"cat\":\"ready\",\"ph\":\"X\",", file );
+      fprintf(
+        file,
+        "\"pid\":1,\"tid\":%" PRIu32 ",",
+        (uint32_t) segment->thread->id
+      );
+      break;
+    default:
+      fputs( "{\"name\":\"priority inversion\",\"cat\":\"inversion\",", file );
+      fprintf(
+        file,
+        "\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":%" PRIu32 ",",
+        segment->cpu
+      );
+      chrome_time( file, "ts", segment->begin );
+      fputs( ",\"args\":{\"waiter\":\"", file );
+      chrome_thread_name( file, segment->thread );
+      fputs( "\",\"owner\":\"", file );
+      chrome_thread_name( file, segment->owner );
+      fputs( "\",\"runner\":\"", file );
+      chrome_thread_name( file, segment->runner );
+      fputs( "\"}}", file );
+      return;
+  }
+
+  chrome_time( file, "ts", segment->begin );
+  fputc( ',', file );
+  chrome_time( file, "dur", segment->end - segment->begin );
+  fprintf(
+    file,
+    ",\"args\":{\"id\":\"0x%08" PRIx64 "\"}}",
+    segment->thread->id
+  );
+}
+
+void rtems_record_client_chrome_instant(
+  rtems_record_client_chrome_context *ctx,
+  uint64_t                            bt,
+  uint32_t                            cpu,
+  rtems_record_event                  event,
+  uint64_t                            data
+)
+{
+  FILE *file;
+
+  file = ctx->file;
+  chrome_separator( ctx );
+  fprintf(
+    file,
+    "{\"name\":\"%s\",\"cat\":\"event\",\"ph\":\"i\",\"s\":\"t\","
+    "\"pid\":0,\"tid\":%" PRIu32 ",",
+    rtems_record_event_text( event ),
+    cpu
+  );
+  chrome_time( file, "ts", bt );
+  fprintf( file, ",\"args\":{\"data\":\"0x%" PRIx64 "\"}}", data );
+}
+
+void rtems_record_client_chrome_end(
+  rtems_record_client_chrome_context *ctx
+)
+{
+  fputs( "\n]\n", ctx->file );
+}
@@ -89,7 +89,7 @@ static void drain_visitor(
   dump_chunk( arg, items, count * sizeof( *items ) );
 }
 
-void rtems_record_dump(
+void rtems_record_dump_header(
   rtems_record_dump_chunk  chunk,
   void                    *arg
 )
@@ -104,5 +104,18 @@ void rtems_record_dump(
   size = _Record_Stream_header_initialize( &header );
   dump_chunk( &ctx, &header, size );
   rtems_task_iterate( thread_names_visitor, &ctx );
+}
+
+void rtems_record_dump(
+  rtems_record_dump_chunk  chunk,
+  void                    *arg
+)
+{
+  dump_context ctx;
+
+  ctx.chunk = chunk;
+  ctx.arg = arg;
+
+  rtems_record_dump_header( chunk, arg );
   rtems_record_drain( drain_visitor, &ctx );
 }
@@ -0,0 +1,238 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/sysinit.h>
+#include <rtems/thread.h>
+
+/*
+ * The function filter is an open addressing hash set with linear probing.  It
+ * has at least one free slot, so that each probe sequence ends.  Functions are
+ * only added to the filter or the filter is cleared as a whole.  This enables
+ * lookups without a lock.
+ */
+#define RECORD_FUNCTION_FILTER_BITS 8
+
+#define RECORD_FUNCTION_FILTER_SIZE ( 1U << RECORD_FUNCTION_FILTER_BITS )
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_RECORD_FUNCTION_FILTER_MAXIMUM + 1 == RECORD_FUNCTION_FILTER_SIZE,
+  RTEMS_RECORD_FUNCTION_FILTER_MAXIMUM
+);
+
+typedef struct {
+  Atomic_Uint    mode;
+  Atomic_Uintptr filter[ RECORD_FUNCTION_FILTER_SIZE ];
+  unsigned int   count;
+  rtems_mutex    mutex;
+} Record_Function_Control;
+
+static Record_Function_Control _Record_Function = {
+  .mode = ATOMIC_INITIALIZER_UINT( RTEMS_RECORD_FUNCTION_DISABLED ),
+  .mutex = RTEMS_MUTEX_INITIALIZER( "Record Function" )
+};
+
+#define RECORD_NO_INSTRUMENT __attribute__(( __no_instrument_function__ ))
+
+void __cyg_profile_func_enter( void *this_fn, void *call_site )
+  RECORD_NO_INSTRUMENT;
+
+void __cyg_profile_func_exit( void *this_fn, void *call_site )
+  RECORD_NO_INSTRUMENT;
+
+static RECORD_NO_INSTRUMENT unsigned int _Record_Function_hash(
+  uintptr_t function
+)
+{
+  uint32_t hash;
+
+  /* Function addresses are aligned, so discard the lower bits */
+  hash = (uint32_t) ( function >> 2 ) * UINT32_C( 2654435761 );
+  return hash >> ( 32 - RECORD_FUNCTION_FILTER_BITS );
+}
+
+static RECORD_NO_INSTRUMENT bool _Record_Function_is_in_filter(
+  uintptr_t function
+)
+{
+  unsigned int index;
+
+  index = _Record_Function_hash( function );
+
+  while ( true ) {
+    uintptr_t slot;
+
+    slot = _Atomic_Load_uintptr(
+      &_Record_Function.filter[ index ],
+      ATOMIC_ORDER_RELAXED
+    );
+
+    if ( slot == function ) {
+      return true;
+    }
+
+    if ( slot == 0 ) {
+      return false;
+    }
+
+    index = ( index + 1 ) & ( RECORD_FUNCTION_FILTER_SIZE - 1 );
+  }
+}
+
+static RECORD_NO_INSTRUMENT void _Record_Function_produce(
+  rtems_record_event  event,
+  void               *function
+)
+{
+  unsigned int         mode;
+  rtems_record_context context;
+
+  mode = _Atomic_Load_uint( &_Record_Function.mode, ATOMIC_ORDER_RELAXED );
+
+  if ( RTEMS_PREDICT_FALSE( mode != RTEMS_RECORD_FUNCTION_ALL ) ) {
+    bool in_filter;
+
+    if ( mode == RTEMS_RECORD_FUNCTION_DISABLED ) {
+      return;
+    }
+
+    in_filter = _Record_Function_is_in_filter( (uintptr_t) function );
+
+    if ( in_filter != ( mode == RTEMS_RECORD_FUNCTION_INCLUDE ) ) {
+      return;
+    }
+  }
+
+  rtems_record_prepare( &context );
+  rtems_record_add( &context, event, (rtems_record_data) function );
+  rtems_record_commit( &context );
+}
+
+void __cyg_profile_func_enter( void *this_fn, void *call_site )
+{
+  (void) call_site;
+  _Record_Function_produce( RTEMS_RECORD_FUNCTION_ENTRY, this_fn );
+}
+
+void __cyg_profile_func_exit( void *this_fn, void *call_site )
+{
+  (void) call_site;
+  _Record_Function_produce( RTEMS_RECORD_FUNCTION_EXIT, this_fn );
+}
+
+void rtems_record_function_set_mode( rtems_record_function_mode mode )
+{
+  _Atomic_Store_uint( &_Record_Function.mode, mode, ATOMIC_ORDER_RELAXED );
+}
+
+rtems_record_function_mode rtems_record_function_get_mode( void )
+{
+  return (rtems_record_function_mode) _Atomic_Load_uint(
+    &_Record_Function.mode,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+bool rtems_record_function_filter_add( const void *function )
+{
+  uintptr_t    value;
+  unsigned int index;
+  bool         added;
+
+  value = (uintptr_t) function;
+  index = _Record_Function_hash( value );
+  added = false;
+  rtems_mutex_lock( &_Record_Function.mutex );
+
+  while ( true ) {
+    uintptr_t slot;
+
+    slot = _Atomic_Load_uintptr(
+      &_Record_Function.filter[ index ],
+      ATOMIC_ORDER_RELAXED
+    );
+
+    if ( slot == value ) {
+      added = true;
+      break;
+    }
+
+    if ( slot == 0 ) {
+      if ( _Record_Function.count < RTEMS_RECORD_FUNCTION_FILTER_MAXIMUM ) {
+        ++_Record_Function.count;
+        _Atomic_Store_uintptr(
+          &_Record_Function.filter[ index ],
+          value,
+          ATOMIC_ORDER_RELAXED
+        );
+        added = true;
+      }
+
+      break;
+    }
+
+    index = ( index + 1 ) & ( RECORD_FUNCTION_FILTER_SIZE - 1 );
+  }
+
+  rtems_mutex_unlock( &_Record_Function.mutex );
+  return added;
+}
+
+void rtems_record_function_filter_clear( void )
+{
+  size_t i;
+
+  rtems_mutex_lock( &_Record_Function.mutex );
+
+  for ( i = 0; i < RECORD_FUNCTION_FILTER_SIZE; ++i ) {
+    _Atomic_Store_uintptr(
+      &_Record_Function.filter[ i ],
+      0,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+
+  _Record_Function.count = 0;
+  rtems_mutex_unlock( &_Record_Function.mutex );
+}
+
+static void _Record_Function_initialize( void )
+{
+  if ( _Per_CPU_Get_by_index( 0 )->record != NULL ) {
+    rtems_record_function_set_mode( RTEMS_RECORD_FUNCTION_ALL );
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  _Record_Function_initialize,
+  RTEMS_SYSINIT_RECORD,
+  RTEMS_SYSINIT_ORDER_LAST
+);
@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/profiling.h>
+
+#include <string.h>
+
+#define NAME_ITEM_COUNT ( 16 / sizeof( rtems_record_data ) )
+
+static void produce( void *arg, const rtems_profiling_data *data )
+{
+  const rtems_profiling_latency *latency;
+  rtems_record_item              items[ 6 + NAME_ITEM_COUNT ];
+  size_t                         n;
+
+  (void) arg;
+
+  if ( data->header.type != RTEMS_PROFILING_LATENCY ) {
+    return;
+  }
+
+  latency = &data->latency;
+  items[ 0 ].event = RTEMS_RECORD_LATENCY_PROCESSOR;
+  items[ 0 ].data = latency->processor_index;
+  items[ 1 ].event = RTEMS_RECORD_LATENCY_KIND;
+  items[ 1 ].data = latency->kind;
+  items[ 2 ].event = RTEMS_RECORD_LATENCY_DURATION;
+  items[ 2 ].data = latency->duration;
+  items[ 3 ].event = RTEMS_RECORD_LATENCY_BEGIN;
+  items[ 3 ].data = (rtems_record_data) latency->begin;
+  items[ 4 ].event = RTEMS_RECORD_LATENCY_END;
+  items[ 4 ].data = (rtems_record_data) latency->end;
+  items[ 5 ].event = RTEMS_RECORD_LATENCY_EXECUTING;
+  items[ 5 ].data = latency->executing;
+  n = 6;
+
+  if ( latency->name != NULL ) {
+    n += _Record_String_to_items(
+      RTEMS_RECORD_LATENCY_LOCK_NAME,
+      latency->name,
+      strlen( latency->name ),
+      &items[ n ],
+      NAME_ITEM_COUNT
+    );
+  }
+
+  rtems_record_produce_n( items, n );
+}
+
+void rtems_record_latencies( void )
+{
+  rtems_profiling_iterate( produce, NULL );
+}
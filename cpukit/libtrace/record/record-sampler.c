@@ -0,0 +1,436 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordsampler.h>
+#include <rtems/record.h>
+#include <rtems/config.h>
+#include <rtems/thread.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/watchdogimpl.h>
+
+typedef struct {
+  Watchdog_Control Watchdog;
+
+  /*
+   * The active indicator is protected by the watchdog lock of the processor.
+   * This ensures that a watchdog which is about to insert itself again
+   * observes a stop request.
+   */
+  bool active;
+
+  uint32_t sample_count;
+} Record_Sampler_per_CPU;
+
+static PER_CPU_DATA_ITEM( Record_Sampler_per_CPU, _Record_Sampler_per_CPU );
+
+static struct {
+  rtems_mutex       mutex;
+  bool              running;
+  Watchdog_Interval interval;
+  uint32_t          backtrace_depth;
+} _Record_Sampler = {
+  .mutex = RTEMS_MUTEX_INITIALIZER( "Record Sampler" )
+};
+
+#if defined(__riscv)
+#define RECORD_SAMPLER_FRAME_RECORD_OFFSET \
+  ( -2 * (intptr_t) sizeof( uintptr_t ) )
+#else
+#define RECORD_SAMPLER_FRAME_RECORD_OFFSET 0
+#endif
+
+static bool _Record_Sampler_Is_in_area(
+  uintptr_t begin,
+  uintptr_t end,
+  uintptr_t record
+)
+{
+  return record >= begin && record <= end - 2 * sizeof( uintptr_t );
+}
+
+static bool _Record_Sampler_Is_valid_frame_record(
+  const Per_CPU_Control *cpu_self,
+  const Thread_Control  *executing,
+  uintptr_t              record
+)
+{
+  uintptr_t begin;
+
+  if ( ( record & ( sizeof( uintptr_t ) - 1 ) ) != 0 ) {
+    return false;
+  }
+
+  begin = (uintptr_t) executing->Start.Initial_stack.area;
+
+  if (
+    _Record_Sampler_Is_in_area(
+      begin,
+      begin + executing->Start.Initial_stack.size,
+      record
+    )
+  ) {
+    return true;
+  }
+
+  return _Record_Sampler_Is_in_area(
+    (uintptr_t) cpu_self->interrupt_stack_low,
+    (uintptr_t) cpu_self->interrupt_stack_high,
+    record
+  );
+}
+
+void rtems_record_sampler_sample( uintptr_t pc, uintptr_t frame_pointer )
+{
+  rtems_record_context    context;
+  Per_CPU_Control        *cpu_self;
+  Thread_Control         *executing;
+  Record_Sampler_per_CPU *per_cpu;
+  uint32_t                depth;
+
+  rtems_record_prepare( &context );
+  cpu_self = _Per_CPU_Get();
+  executing = _Per_CPU_Get_executing( cpu_self );
+  per_cpu = PER_CPU_DATA_GET(
+    cpu_self,
+    Record_Sampler_per_CPU,
+    _Record_Sampler_per_CPU
+  );
+  ++per_cpu->sample_count;
+
+  rtems_record_add( &context, RTEMS_RECORD_SAMPLE_PC, pc );
+  rtems_record_add(
+    &context,
+    RTEMS_RECORD_SAMPLE_THREAD,
+    executing != NULL ? executing->Object.id : 0
+  );
+
+  depth = _Record_Sampler.backtrace_depth;
+
+  while ( depth > 0 && frame_pointer != 0 && executing != NULL ) {
+    const uintptr_t *record;
+    uintptr_t        caller_frame_pointer;
+
+    record = (const uintptr_t *)
+      ( frame_pointer + RECORD_SAMPLER_FRAME_RECORD_OFFSET );
+
+    if (
+      !_Record_Sampler_Is_valid_frame_record(
+        cpu_self,
+        executing,
+        (uintptr_t) record
+      )
+    ) {
+      break;
+    }
+
+    rtems_record_add( &context, RTEMS_RECORD_SAMPLE_CALLER, record[ 1 ] );
+    --depth;
+
+    /* The stacks grow down, so the caller frame must be above this frame */
+    caller_frame_pointer = record[ 0 ];
+
+    if ( caller_frame_pointer <= frame_pointer ) {
+      break;
+    }
+
+    frame_pointer = caller_frame_pointer;
+  }
+
+  rtems_record_commit( &context );
+}
+
+#if defined(__aarch64__) && defined(__LP64__)
+/*
+ * The outer-most interrupt saves the interrupt context on the thread stack
+ * and switches to the interrupt stack through SPSel, see
+ * aarch64-exception-interrupt.S.  The SP_EL1 stack pointer references the
+ * saved FPSR and FPCR followed by the saved ELR and SPSR until the interrupt
+ * returns.  The interrupt entry does not change the frame pointer, so the
+ * frame record chain on the interrupt stack leads to the frame pointer of the
+ * interrupted context.
+ */
+RTEMS_WEAK bool _Record_Sampler_Get_interrupted_context(
+  uintptr_t *pc,
+  uintptr_t *frame_pointer
+)
+{
+  const Per_CPU_Control *cpu_self;
+  const uint64_t        *context;
+  uintptr_t              low;
+  uintptr_t              high;
+  uintptr_t              fp;
+  ISR_Level              level;
+
+  cpu_self = _Per_CPU_Get();
+
+  if ( !_Per_CPU_Is_ISR_in_progress( cpu_self ) ) {
+    return false;
+  }
+
+  _ISR_Local_disable( level );
+  __asm__ volatile (
+    "msr spsel, #1\n"
+    "mov %0, sp\n"
+    "msr spsel, #0"
+    : "=&r" ( context )
+  );
+  _ISR_Local_enable( level );
+
+  *pc = (uintptr_t) context[ 2 ];
+
+  low = (uintptr_t) cpu_self->interrupt_stack_low;
+  high = (uintptr_t) cpu_self->interrupt_stack_high;
+  fp = (uintptr_t) __builtin_frame_address( 0 );
+
+  while ( _Record_Sampler_Is_in_area( low, high, fp ) ) {
+    uintptr_t caller_frame_pointer;
+
+    caller_frame_pointer = ( (const uintptr_t *) fp )[ 0 ];
+
+    if (
+      _Record_Sampler_Is_in_area( low, high, caller_frame_pointer ) &&
+      caller_frame_pointer <= fp
+    ) {
+      fp = 0;
+      break;
+    }
+
+    fp = caller_frame_pointer;
+  }
+
+  *frame_pointer = fp;
+  return true;
+}
+
+static bool _Record_Sampler_Has_interrupted_context( void )
+{
+  return true;
+}
+#else
+/*
+ * There is no implementation for this architecture.  Unless a BSP provides
+ * one, rtems_record_sampler_start() returns RTEMS_NOT_IMPLEMENTED.
+ */
+static bool _Record_Sampler_No_interrupted_context(
+  uintptr_t *pc,
+  uintptr_t *frame_pointer
+)
+{
+  (void) pc;
+  (void) frame_pointer;
+
+  return false;
+}
+
+bool _Record_Sampler_Get_interrupted_context(
+  uintptr_t *pc,
+  uintptr_t *frame_pointer
+) RTEMS_WEAK_ALIAS( _Record_Sampler_No_interrupted_context );
+
+static bool _Record_Sampler_Has_interrupted_context( void )
+{
+  return _Record_Sampler_Get_interrupted_context !=
+    _Record_Sampler_No_interrupted_context;
+}
+#endif
+
+static void _Record_Sampler_Watchdog( Watchdog_Control *watchdog )
+{
+  Record_Sampler_per_CPU *per_cpu;
+  Per_CPU_Control        *cpu;
+  ISR_lock_Context        lock_context;
+  uintptr_t               pc;
+  uintptr_t               frame_pointer;
+
+  per_cpu = RTEMS_CONTAINER_OF( watchdog, Record_Sampler_per_CPU, Watchdog );
+  cpu = _Watchdog_Get_CPU( watchdog );
+
+  _ISR_lock_ISR_disable( &lock_context );
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+
+  if ( per_cpu->active ) {
+    _Watchdog_Insert(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+      watchdog,
+      cpu->Watchdog.ticks + _Record_Sampler.interval
+    );
+  }
+
+  _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+  _ISR_lock_ISR_enable( &lock_context );
+
+  if ( !_Record_Sampler_Get_interrupted_context( &pc, &frame_pointer ) ) {
+    pc = 0;
+    frame_pointer = 0;
+  }
+
+  rtems_record_sampler_sample( pc, frame_pointer );
+}
+
+rtems_status_code rtems_record_sampler_start(
+  uint32_t interval,
+  uint32_t backtrace_depth
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  if ( _Per_CPU_Get_by_index( 0 )->record == NULL ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if ( !_Record_Sampler_Has_interrupted_context() ) {
+    return RTEMS_NOT_IMPLEMENTED;
+  }
+
+  if (
+    interval == 0 ||
+    backtrace_depth > RTEMS_RECORD_SAMPLER_BACKTRACE_MAXIMUM
+  ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  rtems_mutex_lock( &_Record_Sampler.mutex );
+
+  if ( _Record_Sampler.running ) {
+    rtems_mutex_unlock( &_Record_Sampler.mutex );
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  _Record_Sampler.running = true;
+  _Record_Sampler.interval = interval;
+  _Record_Sampler.backtrace_depth = backtrace_depth;
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control        *cpu;
+    Record_Sampler_per_CPU *per_cpu;
+    ISR_lock_Context        lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( !_Per_CPU_Is_processor_online( cpu ) ) {
+      continue;
+    }
+
+    per_cpu = PER_CPU_DATA_GET(
+      cpu,
+      Record_Sampler_per_CPU,
+      _Record_Sampler_per_CPU
+    );
+    _Watchdog_Preinitialize( &per_cpu->Watchdog, cpu );
+    _Watchdog_Initialize( &per_cpu->Watchdog, _Record_Sampler_Watchdog );
+
+    _ISR_lock_ISR_disable( &lock_context );
+    _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+    per_cpu->active = true;
+    _Watchdog_Insert(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+      &per_cpu->Watchdog,
+      cpu->Watchdog.ticks + interval
+    );
+    _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  rtems_mutex_unlock( &_Record_Sampler.mutex );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_record_sampler_stop( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  rtems_mutex_lock( &_Record_Sampler.mutex );
+
+  if ( !_Record_Sampler.running ) {
+    rtems_mutex_unlock( &_Record_Sampler.mutex );
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control        *cpu;
+    Record_Sampler_per_CPU *per_cpu;
+    ISR_lock_Context        lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    per_cpu = PER_CPU_DATA_GET(
+      cpu,
+      Record_Sampler_per_CPU,
+      _Record_Sampler_per_CPU
+    );
+
+    _ISR_lock_ISR_disable( &lock_context );
+    _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+
+    if ( per_cpu->active ) {
+      per_cpu->active = false;
+      _Watchdog_Remove(
+        &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+        &per_cpu->Watchdog
+      );
+    }
+
+    _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  _Record_Sampler.running = false;
+  rtems_mutex_unlock( &_Record_Sampler.mutex );
+  return RTEMS_SUCCESSFUL;
+}
+
+bool rtems_record_sampler_is_running( void )
+{
+  return _Record_Sampler.running;
+}
+
+uint32_t rtems_record_sampler_get_sample_count( uint32_t cpu_index )
+{
+  Per_CPU_Control        *cpu;
+  Record_Sampler_per_CPU *per_cpu;
+
+  if ( cpu_index >= rtems_configuration_get_maximum_processors() ) {
+    return 0;
+  }
+
+  cpu = _Per_CPU_Get_by_index( cpu_index );
+  per_cpu = PER_CPU_DATA_GET(
+    cpu,
+    Record_Sampler_per_CPU,
+    _Record_Sampler_per_CPU
+  );
+  return per_cpu->sample_count;
+}
@@ -0,0 +1,645 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordsink.h>
+#include <rtems/recorddump.h>
+#include <rtems/record.h>
+#include <rtems/blkdev.h>
+#include <rtems/config.h>
+#include <rtems/score/assert.h>
+#include <rtems/thread.h>
+
+#include <sys/param.h>
+#include <sys/stat.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#define SINK_BUFFER_SIZE_DEFAULT 8192
+
+#define SINK_SUFFIX_SIZE sizeof( ".4294967295" )
+
+#define DRAIN_EVENT RTEMS_EVENT_0
+
+#define STOP_EVENT RTEMS_EVENT_1
+
+typedef struct {
+  rtems_record_sink_config      config;
+  rtems_record_sink_statistics  stats;
+  rtems_id                      task;
+  rtems_binary_semaphore        done;
+  bool                          stopping;
+  bool                          is_block_device;
+  bool                          again;
+  int                           fd;
+  uint32_t                      index;
+  size_t                        file_offset;
+  size_t                        drain_max;
+  unsigned int                  pending_items;
+  bool                          drained;
+  size_t                        buffer_used;
+  unsigned char                *buffer;
+  char                         *file_name;
+  z_stream                      stream;
+} sink_context;
+
+static rtems_mutex sink_mutex = RTEMS_MUTEX_INITIALIZER( "Record Sink" );
+
+static sink_context *sink_instance;
+
+static rtems_record_sink_statistics sink_statistics;
+
+static void sink_error( sink_context *ctx, int error )
+{
+  if ( ctx->stats.error == 0 ) {
+    ctx->stats.error = error;
+  }
+}
+
+static void sink_write( sink_context *ctx, const void *data, size_t len )
+{
+  const char *p;
+
+  if ( ctx->fd < 0 ) {
+    return;
+  }
+
+  if (
+    ctx->is_block_device &&
+    len > ctx->config.file_size - ctx->file_offset
+  ) {
+    /* Never write into the next region */
+    sink_error( ctx, EFBIG );
+    len = ctx->config.file_size - ctx->file_offset;
+  }
+
+  p = data;
+
+  while ( len > 0 ) {
+    ssize_t n;
+
+    n = write( ctx->fd, p, len );
+    if ( n <= 0 ) {
+      sink_error( ctx, n < 0 ? errno : EIO );
+      break;
+    }
+
+    p += n;
+    len -= (size_t) n;
+    ctx->file_offset += (size_t) n;
+    ctx->stats.written_bytes += (uint64_t) n;
+  }
+}
+
+static void sink_flush_buffer( sink_context *ctx )
+{
+  if ( ctx->buffer_used > 0 ) {
+    sink_write( ctx, ctx->buffer, ctx->buffer_used );
+    ctx->buffer_used = 0;
+  }
+}
+
+static void sink_put( sink_context *ctx, const void *data, size_t len )
+{
+  const char *p;
+  size_t      size;
+  size_t      used;
+
+  size = ctx->config.buffer_size;
+  used = ctx->buffer_used;
+
+  if ( used == 0 && len >= size && !ctx->is_block_device ) {
+    /* Avoid the copy of large chunks */
+    sink_write( ctx, data, len );
+    return;
+  }
+
+  p = data;
+
+  while ( len > 0 ) {
+    size_t n;
+
+    n = MIN( len, size - used );
+    memcpy( &ctx->buffer[ used ], p, n );
+    p += n;
+    len -= n;
+    used += n;
+
+    if ( used == size ) {
+      ctx->buffer_used = used;
+      sink_flush_buffer( ctx );
+      used = 0;
+    }
+  }
+
+  ctx->buffer_used = used;
+}
+
+static void sink_deflate( sink_context *ctx, int flush )
+{
+  while ( true ) {
+    int err;
+
+    ctx->stream.next_out = &ctx->buffer[ ctx->buffer_used ];
+    ctx->stream.avail_out = ctx->config.buffer_size - ctx->buffer_used;
+    err = deflate( &ctx->stream, flush );
+    ctx->buffer_used = ctx->config.buffer_size - ctx->stream.avail_out;
+
+    if ( err != Z_OK && err != Z_BUF_ERROR && err != Z_STREAM_END ) {
+      sink_error( ctx, EIO );
+      break;
+    }
+
+    if ( err != Z_OK || ctx->stream.avail_out > 0 ) {
+      break;
+    }
+
+    sink_flush_buffer( ctx );
+  }
+}
+
+static void sink_output( sink_context *ctx, const void *data, size_t len )
+{
+  if ( ctx->config.compression_level > 0 ) {
+    ctx->stream.next_in = RTEMS_DECONST( void *, data );
+    ctx->stream.avail_in = len;
+    sink_deflate( ctx, Z_NO_FLUSH );
+  } else {
+    sink_put( ctx, data, len );
+  }
+}
+
+static void sink_chunk( void *arg, const void *data, size_t length )
+{
+  sink_output( arg, data, length );
+}
+
+static bool sink_open( sink_context *ctx )
+{
+  if ( ctx->is_block_device ) {
+    off_t offset;
+
+    offset = (off_t) ctx->index * (off_t) ctx->config.file_size;
+    if ( lseek( ctx->fd, offset, SEEK_SET ) != offset ) {
+      sink_error( ctx, errno );
+      return false;
+    }
+  } else {
+    snprintf(
+      ctx->file_name,
+      strlen( ctx->config.path ) + SINK_SUFFIX_SIZE,
+      "%s.%" PRIu32,
+      ctx->config.path,
+      ctx->index
+    );
+    ctx->fd = open( ctx->file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+    if ( ctx->fd < 0 ) {
+      sink_error( ctx, errno );
+      return false;
+    }
+  }
+
+  ctx->file_offset = 0;
+
+  if ( ctx->config.compression_level > 0 ) {
+    (void) deflateReset( &ctx->stream );
+  }
+
+  rtems_record_dump_header( sink_chunk, ctx );
+  return true;
+}
+
+static void sink_close( sink_context *ctx )
+{
+  if ( ctx->fd < 0 ) {
+    return;
+  }
+
+  if ( ctx->config.compression_level > 0 ) {
+    ctx->stream.avail_in = 0;
+    sink_deflate( ctx, Z_FINISH );
+  }
+
+  sink_flush_buffer( ctx );
+
+  if ( ctx->is_block_device ) {
+    /* Zero-fill the unused remainder of the region */
+    memset( ctx->buffer, 0, ctx->config.buffer_size );
+
+    while ( ctx->file_offset < ctx->config.file_size ) {
+      size_t  offset;
+
+      offset = ctx->file_offset;
+      sink_write(
+        ctx,
+        ctx->buffer,
+        MIN( ctx->config.buffer_size, ctx->config.file_size - offset )
+      );
+
+      if ( ctx->file_offset == offset ) {
+        break;
+      }
+    }
+
+    (void) fsync( ctx->fd );
+  } else {
+    if ( fsync( ctx->fd ) != 0 ) {
+      sink_error( ctx, errno );
+    }
+
+    (void) close( ctx->fd );
+    ctx->fd = -1;
+  }
+}
+
+static bool sink_needs_rotation( const sink_context *ctx )
+{
+  size_t used;
+
+  if ( ctx->config.file_size == 0 ) {
+    return false;
+  }
+
+  used = ctx->file_offset + ctx->buffer_used;
+
+  if ( ctx->is_block_device ) {
+    /* The next drain must fit into the region */
+    return used + ctx->drain_max > ctx->config.file_size;
+  }
+
+  return used >= ctx->config.file_size;
+}
+
+static void sink_rotate( sink_context *ctx )
+{
+  sink_close( ctx );
+  ctx->index = ( ctx->index + 1 ) % ctx->config.file_count;
+  ++ctx->stats.rotations;
+  (void) sink_open( ctx );
+}
+
+/*
+ * The drain produces for each processor with new items a header of three
+ * items (processor index, tail and head) followed by the items, so the
+ * overflows can be determined by the tail and head values.
+ */
+static void sink_drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  sink_context *ctx;
+
+  ctx = arg;
+
+  if ( ctx->pending_items == 0 ) {
+    unsigned int capacity;
+    unsigned int n;
+
+    _Assert( count == 3 );
+    _Assert( items[ 0 ].event == RTEMS_RECORD_PROCESSOR );
+    capacity = _Record_Configuration.item_count;
+    n = (unsigned int) items[ 2 ].data - (unsigned int) items[ 1 ].data;
+
+    if ( n >= capacity ) {
+      ++ctx->stats.overflows;
+      ctx->stats.lost_items += n - ( capacity - 1 );
+      n = capacity - 1;
+    }
+
+    if ( n > capacity / 2 ) {
+      ctx->again = true;
+    }
+
+    ctx->pending_items = n;
+  } else {
+    ctx->pending_items -= (unsigned int) count;
+    ctx->stats.drained_items += count;
+  }
+
+  ctx->drained = true;
+  sink_output( ctx, items, count * sizeof( *items ) );
+}
+
+static void sink_drain( sink_context *ctx )
+{
+  if ( sink_needs_rotation( ctx ) ) {
+    sink_rotate( ctx );
+  }
+
+  ctx->again = false;
+  ctx->drained = false;
+  rtems_record_drain( sink_drain_visitor, ctx );
+
+  if ( ctx->drained && ctx->config.compression_level > 0 ) {
+    /* Make the drained items decodable without the rest of the stream */
+    ctx->stream.avail_in = 0;
+    sink_deflate( ctx, Z_SYNC_FLUSH );
+  }
+
+  rtems_mutex_lock( &sink_mutex );
+  sink_statistics = ctx->stats;
+  rtems_mutex_unlock( &sink_mutex );
+}
+
+static void sink_task( rtems_task_argument arg )
+{
+  sink_context *ctx;
+  bool          stop;
+
+  ctx = (sink_context *) arg;
+  stop = false;
+
+  while ( !stop ) {
+    rtems_event_set events;
+
+    events = 0;
+    (void) rtems_event_receive(
+      DRAIN_EVENT | STOP_EVENT,
+      RTEMS_EVENT_ANY | ( ctx->again ? RTEMS_NO_WAIT : RTEMS_WAIT ),
+      ctx->config.period,
+      &events
+    );
+    stop = ( events & STOP_EVENT ) != 0;
+
+    sink_drain( ctx );
+
+    if ( !ctx->again ) {
+      sink_flush_buffer( ctx );
+    }
+  }
+
+  sink_close( ctx );
+
+  rtems_mutex_lock( &sink_mutex );
+  sink_statistics = ctx->stats;
+  rtems_mutex_unlock( &sink_mutex );
+
+  rtems_binary_semaphore_post( &ctx->done );
+  rtems_task_exit();
+}
+
+static void sink_destroy( sink_context *ctx )
+{
+  if ( ctx->fd >= 0 ) {
+    (void) close( ctx->fd );
+  }
+
+  if ( ctx->config.compression_level > 0 ) {
+    (void) deflateEnd( &ctx->stream );
+  }
+
+  rtems_binary_semaphore_destroy( &ctx->done );
+  free( ctx->buffer );
+  free( ctx->file_name );
+  free( RTEMS_DECONST( char *, ctx->config.path ) );
+  free( ctx );
+}
+
+static rtems_status_code sink_init_block_device( sink_context *ctx )
+{
+  rtems_blkdev_bnum block_count;
+  uint32_t          block_size;
+  off_t             size;
+  int               rv;
+
+  rv = rtems_disk_fd_get_block_count( ctx->fd, &block_count );
+  if ( rv != 0 ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  rv = rtems_disk_fd_get_block_size( ctx->fd, &block_size );
+  if ( rv != 0 ) {
+    return RTEMS_IO_ERROR;
+  }
+
+  size = (off_t) block_count * block_size;
+
+  if ( ctx->config.file_size == 0 ) {
+    ctx->config.file_size = (size_t) ( size / ctx->config.file_count );
+    ctx->config.file_size -= ctx->config.file_size % block_size;
+  }
+
+  if (
+    (off_t) ctx->config.file_size * ctx->config.file_count > size ||
+    ctx->config.file_size < 2 * ctx->drain_max
+  ) {
+    return RTEMS_INVALID_SIZE;
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code sink_create(
+  const rtems_record_sink_config  *config,
+  sink_context                   **ctx_ptr
+)
+{
+  sink_context      *ctx;
+  char              *path;
+  struct stat        st;
+  rtems_status_code  sc;
+  size_t             len;
+
+  ctx = calloc( 1, sizeof( *ctx ) );
+  if ( ctx == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  ctx->fd = -1;
+  ctx->config = *config;
+  rtems_binary_semaphore_init( &ctx->done, "Record Sink" );
+
+  if ( ctx->config.file_count == 0 ) {
+    ctx->config.file_count = 1;
+  }
+
+  if ( ctx->config.buffer_size == 0 ) {
+    ctx->config.buffer_size = SINK_BUFFER_SIZE_DEFAULT;
+  }
+
+  len = strlen( config->path );
+  path = strdup( config->path );
+  ctx->config.path = path;
+  ctx->file_name = malloc( len + SINK_SUFFIX_SIZE );
+  ctx->buffer = malloc( ctx->config.buffer_size );
+
+  if ( path == NULL || ctx->file_name == NULL || ctx->buffer == NULL ) {
+    ctx->config.compression_level = 0;
+    sink_destroy( ctx );
+    return RTEMS_NO_MEMORY;
+  }
+
+  ctx->drain_max = rtems_configuration_get_maximum_processors() *
+    ( _Record_Configuration.item_count + 2 ) * sizeof( rtems_record_item );
+
+  if ( ctx->config.compression_level > 0 ) {
+    if (
+      deflateInit( &ctx->stream, ctx->config.compression_level ) != Z_OK
+    ) {
+      ctx->config.compression_level = 0;
+      sink_destroy( ctx );
+      return RTEMS_IO_ERROR;
+    }
+
+    /* Account for the sync flush marker */
+    ctx->drain_max = deflateBound( &ctx->stream, ctx->drain_max ) + 6;
+  }
+
+  if ( stat( path, &st ) == 0 && S_ISBLK( st.st_mode ) ) {
+    ctx->is_block_device = true;
+    ctx->fd = open( path, O_RDWR );
+    if ( ctx->fd < 0 ) {
+      sink_destroy( ctx );
+      return RTEMS_IO_ERROR;
+    }
+
+    sc = sink_init_block_device( ctx );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      sink_destroy( ctx );
+      return sc;
+    }
+  }
+
+  if ( !sink_open( ctx ) ) {
+    sink_destroy( ctx );
+    return RTEMS_IO_ERROR;
+  }
+
+  *ctx_ptr = ctx;
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_record_sink_start(
+  const rtems_record_sink_config *config,
+  rtems_task_priority             priority
+)
+{
+  sink_context      *ctx;
+  rtems_status_code  sc;
+
+  if ( config == NULL || config->path == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  rtems_mutex_lock( &sink_mutex );
+
+  if ( sink_instance != NULL ) {
+    rtems_mutex_unlock( &sink_mutex );
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  memset( &sink_statistics, 0, sizeof( sink_statistics ) );
+
+  sc = sink_create( config, &ctx );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    rtems_mutex_unlock( &sink_mutex );
+    return sc;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'R', 'S', 'N', 'K' ),
+    priority,
+    2 * RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->task
+  );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    sink_close( ctx );
+    sink_destroy( ctx );
+    rtems_mutex_unlock( &sink_mutex );
+    return sc;
+  }
+
+  sink_instance = ctx;
+  rtems_mutex_unlock( &sink_mutex );
+
+  (void) rtems_task_start( ctx->task, sink_task, (rtems_task_argument) ctx );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_record_sink_stop( void )
+{
+  sink_context *ctx;
+
+  rtems_mutex_lock( &sink_mutex );
+  ctx = sink_instance;
+
+  if ( ctx == NULL || ctx->stopping ) {
+    rtems_mutex_unlock( &sink_mutex );
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  ctx->stopping = true;
+  rtems_mutex_unlock( &sink_mutex );
+
+  (void) rtems_event_send( ctx->task, STOP_EVENT );
+  rtems_binary_semaphore_wait( &ctx->done );
+
+  rtems_mutex_lock( &sink_mutex );
+  sink_instance = NULL;
+  rtems_mutex_unlock( &sink_mutex );
+
+  sink_destroy( ctx );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_record_sink_flush( void )
+{
+  rtems_status_code sc;
+
+  rtems_mutex_lock( &sink_mutex );
+
+  if ( sink_instance != NULL && !sink_instance->stopping ) {
+    sc = rtems_event_send( sink_instance->task, DRAIN_EVENT );
+  } else {
+    sc = RTEMS_INCORRECT_STATE;
+  }
+
+  rtems_mutex_unlock( &sink_mutex );
+  return sc;
+}
+
+void rtems_record_sink_get_statistics( rtems_record_sink_statistics *stats )
+{
+  rtems_mutex_lock( &sink_mutex );
+  *stats = sink_statistics;
+  rtems_mutex_unlock( &sink_mutex );
+}
@@ -127,6 +127,13 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_KEVENT_EXIT ] = "KEVENT_EXIT",
   [ RTEMS_RECORD_KQUEUE_ENTRY ] = "KQUEUE_ENTRY",
   [ RTEMS_RECORD_KQUEUE_EXIT ] = "KQUEUE_EXIT",
+  [ RTEMS_RECORD_LATENCY_BEGIN ] = "LATENCY_BEGIN",
+  [ RTEMS_RECORD_LATENCY_DURATION ] = "LATENCY_DURATION",
+  [ RTEMS_RECORD_LATENCY_END ] = "LATENCY_END",
+  [ RTEMS_RECORD_LATENCY_EXECUTING ] = "LATENCY_EXECUTING",
+  [ RTEMS_RECORD_LATENCY_KIND ] = "LATENCY_KIND",
+  [ RTEMS_RECORD_LATENCY_LOCK_NAME ] = "LATENCY_LOCK_NAME",
+  [ RTEMS_RECORD_LATENCY_PROCESSOR ] = "LATENCY_PROCESSOR",
   [ RTEMS_RECORD_LENGTH ] = "LENGTH",
   [ RTEMS_RECORD_LINE ] = "LINE",
   [ RTEMS_RECORD_LINK_ENTRY ] = "LINK_ENTRY",
@@ -226,6 +233,9 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_RTEMS_TIMER_RESET ] = "RTEMS_TIMER_RESET",
   [ RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_AFTER ] = "RTEMS_TIMER_SERVER_FIRE_AFTER",
   [ RTEMS_RECORD_RTEMS_TIMER_SERVER_FIRE_WHEN ] = "RTEMS_TIMER_SERVER_FIRE_WHEN",
+  [ RTEMS_RECORD_SAMPLE_CALLER ] = "SAMPLE_CALLER",
+  [ RTEMS_RECORD_SAMPLE_PC ] = "SAMPLE_PC",
+  [ RTEMS_RECORD_SAMPLE_THREAD ] = "SAMPLE_THREAD",
   [ RTEMS_RECORD_SBWAIT_ENTRY ] = "SBWAIT_ENTRY",
   [ RTEMS_RECORD_SBWAIT_EXIT ] = "SBWAIT_EXIT",
   [ RTEMS_RECORD_SBWAKEUP_ENTRY ] = "SBWAKEUP_ENTRY",
@@ -330,8 +340,13 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_THREAD_QUEUE_ID ] = "THREAD_QUEUE_ID",
   [ RTEMS_RECORD_THREAD_QUEUE_INITIALIZE ] = "THREAD_QUEUE_INITIALIZE",
   [ RTEMS_RECORD_THREAD_QUEUE_NAME ] = "THREAD_QUEUE_NAME",
+  [ RTEMS_RECORD_THREAD_QUEUE_OWNER ] = "THREAD_QUEUE_OWNER",
   [ RTEMS_RECORD_THREAD_QUEUE_SURRENDER ] = "THREAD_QUEUE_SURRENDER",
   [ RTEMS_RECORD_THREAD_QUEUE_SURRENDER_STICKY ] = "THREAD_QUEUE_SURRENDER_STICKY",
+  [ RTEMS_RECORD_THREAD_QUEUE_WAIT_BUCKET ] = "THREAD_QUEUE_WAIT_BUCKET",
+  [ RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT ] = "THREAD_QUEUE_WAIT_COUNT",
+  [ RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME ] = "THREAD_QUEUE_WAIT_TIME",
+  [ RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME_MAX ] = "THREAD_QUEUE_WAIT_TIME_MAX",
   [ RTEMS_RECORD_THREAD_RESOURCE_OBTAIN ] = "THREAD_RESOURCE_OBTAIN",
   [ RTEMS_RECORD_THREAD_RESOURCE_RELEASE ] = "THREAD_RESOURCE_RELEASE",
   [ RTEMS_RECORD_THREAD_RESTART ] = "THREAD_RESTART",
@@ -380,21 +395,6 @@ static const char * const event_text[] = {
   [ RTEMS_RECORD_WRITE_EXIT ] = "WRITE_EXIT",
   [ RTEMS_RECORD_WRITEV_ENTRY ] = "WRITEV_ENTRY",
   [ RTEMS_RECORD_WRITEV_EXIT ] = "WRITEV_EXIT",
-  [ RTEMS_RECORD_SYSTEM_341 ] = "SYSTEM_341",
-  [ RTEMS_RECORD_SYSTEM_342 ] = "SYSTEM_342",
-  [ RTEMS_RECORD_SYSTEM_343 ] = "SYSTEM_343",
-  [ RTEMS_RECORD_SYSTEM_344 ] = "SYSTEM_344",
-  [ RTEMS_RECORD_SYSTEM_345 ] = "SYSTEM_345",
-  [ RTEMS_RECORD_SYSTEM_346 ] = "SYSTEM_346",
-  [ RTEMS_RECORD_SYSTEM_347 ] = "SYSTEM_347",
-  [ RTEMS_RECORD_SYSTEM_348 ] = "SYSTEM_348",
-  [ RTEMS_RECORD_SYSTEM_349 ] = "SYSTEM_349",
-  [ RTEMS_RECORD_SYSTEM_350 ] = "SYSTEM_350",
-  [ RTEMS_RECORD_SYSTEM_351 ] = "SYSTEM_351",
-  [ RTEMS_RECORD_SYSTEM_352 ] = "SYSTEM_352",
-  [ RTEMS_RECORD_SYSTEM_353 ] = "SYSTEM_353",
-  [ RTEMS_RECORD_SYSTEM_354 ] = "SYSTEM_354",
-  [ RTEMS_RECORD_SYSTEM_355 ] = "SYSTEM_355",
   [ RTEMS_RECORD_SYSTEM_356 ] = "SYSTEM_356",
   [ RTEMS_RECORD_SYSTEM_357 ] = "SYSTEM_357",
   [ RTEMS_RECORD_SYSTEM_358 ] = "SYSTEM_358",
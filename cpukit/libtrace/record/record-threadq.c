@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/profiling.h>
+
+#include <string.h>
+
+#define NAME_ITEM_COUNT ( 16 / sizeof( rtems_record_data ) )
+
+static void produce( void *arg, const rtems_profiling_data *data )
+{
+  const rtems_profiling_thread_queue *thread_queue;
+  rtems_record_item                   items[
+    6 + NAME_ITEM_COUNT +
+    2 * RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS +
+    3 * RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT
+  ];
+  size_t                              n;
+  size_t                              i;
+
+  (void) arg;
+
+  if ( data->header.type != RTEMS_PROFILING_THREAD_QUEUE ) {
+    return;
+  }
+
+  thread_queue = &data->thread_queue;
+  items[ 0 ].event = RTEMS_RECORD_THREAD_QUEUE_ADDRESS;
+  items[ 0 ].data = (rtems_record_data) thread_queue->queue;
+  items[ 1 ].event = RTEMS_RECORD_THREAD_QUEUE_ID;
+  items[ 1 ].data = thread_queue->id;
+  n = 2;
+  n += _Record_String_to_items(
+    RTEMS_RECORD_THREAD_QUEUE_NAME,
+    thread_queue->name,
+    strlen( thread_queue->name ),
+    &items[ n ],
+    NAME_ITEM_COUNT
+  );
+  items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT;
+  items[ n ].data = (rtems_record_data) thread_queue->wait_count;
+  ++n;
+  items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME;
+  items[ n ].data = (rtems_record_data) thread_queue->total_wait_time;
+  ++n;
+  items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME_MAX;
+  items[ n ].data = (rtems_record_data) thread_queue->max_wait_time;
+  ++n;
+
+  /*
+   * A bucket index or owner identifier is followed by the corresponding wait
+   * count and wait time items.
+   */
+  for ( i = 0; i < RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS; ++i ) {
+    if ( thread_queue->histogram[ i ] != 0 ) {
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_BUCKET;
+      items[ n ].data = i;
+      ++n;
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT;
+      items[ n ].data = (rtems_record_data) thread_queue->histogram[ i ];
+      ++n;
+    }
+  }
+
+  for ( i = 0; i < RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT; ++i ) {
+    const rtems_profiling_thread_queue_owner *owner;
+
+    owner = &thread_queue->owners[ i ];
+
+    if ( owner->wait_count != 0 ) {
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_OWNER;
+      items[ n ].data = owner->id;
+      ++n;
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_COUNT;
+      items[ n ].data = (rtems_record_data) owner->wait_count;
+      ++n;
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_WAIT_TIME;
+      items[ n ].data = (rtems_record_data) owner->total_wait_time;
+      ++n;
+    }
+  }
+
+  rtems_record_produce_n( items, n );
+}
+
+void rtems_record_thread_queue_statistics( void )
+{
+  rtems_profiling_iterate( produce, NULL );
+}
@@ -97,21 +97,69 @@ void _Record_Thread_switch(
   struct _Thread_Control *heir
 )
 {
-  rtems_record_item items[ 3 ];
+  rtems_record_item items[ 8 ];
+  size_t            n;
+  Priority_Control  priority;
 
-  items[ 0 ].event = RTEMS_RECORD_THREAD_SWITCH_OUT;
-  items[ 0 ].data = executing->Object.id;
-  items[ 1 ].event = RTEMS_RECORD_THREAD_STACK_CURRENT;
-  items[ 1 ].data =
+  n = 0;
+
+  /*
+   * The thread state and the thread queue on which the executing thread
+   * blocks are produced before the thread switch out, so that a consumer
+   * knows whether the thread was preempted or blocked.
+   */
+  if ( _States_Is_ready( executing->current_state ) ) {
+    items[ n ].event = RTEMS_RECORD_THREAD_STATE_CLEAR;
+    items[ n ].data = executing->Object.id;
+    ++n;
+  } else {
+    const Thread_queue_Queue *queue;
+
+    items[ n ].event = RTEMS_RECORD_THREAD_STATE_SET;
+    items[ n ].data = executing->Object.id;
+    ++n;
+
+    queue = executing->Wait.queue;
+
+    if ( queue != NULL ) {
+      const Thread_Control *owner;
+
+      owner = queue->owner;
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_ENQUEUE;
+      items[ n ].data = (uintptr_t) queue;
+      ++n;
+      items[ n ].event = RTEMS_RECORD_THREAD_QUEUE_OWNER;
+      items[ n ].data = owner != NULL ? owner->Object.id : 0;
+      ++n;
+    }
+  }
+
+  items[ n ].event = RTEMS_RECORD_THREAD_SWITCH_OUT;
+  items[ n ].data = executing->Object.id;
+  ++n;
+  items[ n ].event = RTEMS_RECORD_THREAD_STACK_CURRENT;
+  items[ n ].data =
 #if defined(__GNUC__)
     (uintptr_t) __builtin_frame_address( 0 )
       - (uintptr_t) executing->Start.Initial_stack.area;
 #else
     0;
 #endif
-  items[ 2 ].event = RTEMS_RECORD_THREAD_SWITCH_IN;
-  items[ 2 ].data = heir->Object.id;
-  rtems_record_produce_n( items, RTEMS_ARRAY_SIZE( items ) );
+  ++n;
+  items[ n ].event = RTEMS_RECORD_THREAD_SWITCH_IN;
+  items[ n ].data = heir->Object.id;
+  ++n;
+
+  /* The priority of the heir follows its thread switch in */
+  priority = _Thread_Get_unmapped_priority( heir );
+  items[ n ].event = RTEMS_RECORD_THREAD_PRIO_CURRENT_HIGH;
+  items[ n ].data = (uint32_t) ( priority >> 32 );
+  ++n;
+  items[ n ].event = RTEMS_RECORD_THREAD_PRIO_CURRENT_LOW;
+  items[ n ].data = (uint32_t) priority;
+  ++n;
+
+  rtems_record_produce_n( items, n );
 }
 
 void _Record_Thread_begin( struct _Thread_Control *executing )
@@ -25,8 +25,6 @@
 
 int aio_cancel(int fildes, struct aiocb  *aiocbp)
 {
-  rtems_chain_control *idle_req_chain = &aio_request_queue.idle_req;
-  rtems_chain_control *work_req_chain = &aio_request_queue.work_req;
   rtems_aio_request_chain *r_chain;
   int result;
   
@@ -41,41 +39,20 @@ int aio_cancel(int fildes, struct aiocb  *aiocbp)
   if (aiocbp == NULL) {
     AIO_printf ("Cancel all requests\n");        
          
-    r_chain = rtems_aio_search_fd (work_req_chain, fildes, 0);
-    if (r_chain == NULL) {
-      AIO_printf ("Request chain not on [WQ]\n");
-
-      if (!rtems_chain_is_empty (idle_req_chain)) {
-        r_chain = rtems_aio_search_fd (idle_req_chain, fildes, 0);
-        if (r_chain == NULL) {
-          pthread_mutex_unlock(&aio_request_queue.mutex);
-          return AIO_ALLDONE;
-        }
-
-        AIO_printf ("Request chain on [IQ]\n");
-
-        rtems_chain_extract (&r_chain->next_fd);
-        rtems_aio_remove_fd (r_chain);
-        pthread_mutex_destroy (&r_chain->mutex);
-        pthread_cond_destroy (&r_chain->cond);
-        free (r_chain);
-
-        pthread_mutex_unlock (&aio_request_queue.mutex);
-        return AIO_CANCELED;
-      }
-
+    r_chain = rtems_aio_search_fd (fildes, 0);
+    if (r_chain == NULL ||
+        (rtems_chain_is_empty (&r_chain->perfd) && r_chain->active == 0)) {
+      AIO_printf ("No requests for fd\n");
       pthread_mutex_unlock (&aio_request_queue.mutex);
       return AIO_ALLDONE;
     }
 
-    AIO_printf ("Request chain on [WQ]\n");
-
-    pthread_mutex_lock (&r_chain->mutex);
-    rtems_chain_extract (&r_chain->next_fd);
+    /* The requests in progress cannot be canceled, the worker removes
+       the empty fd chain */
+    result = r_chain->active > 0 ? AIO_NOTCANCELED : AIO_CANCELED;
     rtems_aio_remove_fd (r_chain);
-    pthread_mutex_unlock (&r_chain->mutex);
     pthread_mutex_unlock (&aio_request_queue.mutex);
-    return AIO_CANCELED;
+    return result;
   } else {
     AIO_printf ("Cancel request\n");
 
@@ -84,32 +61,20 @@ int aio_cancel(int fildes, struct aiocb  *aiocbp)
       rtems_set_errno_and_return_minus_one (EINVAL);
     }
       
-    r_chain = rtems_aio_search_fd (work_req_chain, fildes, 0);
+    r_chain = rtems_aio_search_fd (fildes, 0);
     if (r_chain == NULL) {
-      if (!rtems_chain_is_empty (idle_req_chain)) {
-        r_chain = rtems_aio_search_fd (idle_req_chain, fildes, 0);
-        if (r_chain == NULL) { 
-          pthread_mutex_unlock (&aio_request_queue.mutex);
-          rtems_set_errno_and_return_minus_one (EINVAL);
-        }      
-           
-        AIO_printf ("Request on [IQ]\n");                     
-   
-        result = rtems_aio_remove_req (&r_chain->perfd, aiocbp);
-        pthread_mutex_unlock (&aio_request_queue.mutex);
-        return result;
-      } else {
+      /* The aiocbp cannot belong to an outstanding request */
+      if (aio_request_queue.queued_requests > 0) {
         pthread_mutex_unlock (&aio_request_queue.mutex);
-        return AIO_ALLDONE;
+        rtems_set_errno_and_return_minus_one (EINVAL);
       }
-    }  
-      AIO_printf ("Request on [WQ]\n");
-      
-      pthread_mutex_lock (&r_chain->mutex);
-      result = rtems_aio_remove_req (&r_chain->perfd, aiocbp);
-      pthread_mutex_unlock (&r_chain->mutex);
+
       pthread_mutex_unlock (&aio_request_queue.mutex);
-      return result;
+      return AIO_ALLDONE;
+    }
+
+    result = rtems_aio_remove_req (&r_chain->perfd, aiocbp);
+    pthread_mutex_unlock (&aio_request_queue.mutex);
+    return result;
   }
-  return AIO_ALLDONE;
 }
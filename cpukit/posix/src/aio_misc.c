@@ -14,10 +14,17 @@
  * http://www.rtems.org/license/LICENSE.
  */
 
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
 #include <pthread.h>
+#include <signal.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <time.h>
+#include <sys/param.h>
+#include <sys/uio.h>
 #include <rtems/posix/aio_misc.h>
 #include <errno.h>
 
@@ -25,10 +32,62 @@ static void *rtems_aio_handle (void *arg);
 
 rtems_aio_queue aio_request_queue;
 
+/*
+ *  rtems_aio_bind_worker
+ *
+ * Bind a worker to one processor of its scheduler, the workers are
+ * distributed round-robin over the processors
+ *
+ *  Input parameters:
+ *        w            - the worker
+ *        index        - index of the worker in the pool
+ *
+ *  Output parameters:
+ *        NONE
+ */
+
+static void
+rtems_aio_bind_worker (rtems_aio_worker *w, int index)
+{
+#if defined(RTEMS_SMP) && HAVE_DECL_PTHREAD_SETAFFINITY_NP
+  rtems_id scheduler_id;
+  cpu_set_t scheduler_set;
+  cpu_set_t worker_set;
+  int count, cpu;
+
+  if (rtems_task_get_scheduler (w->thread, &scheduler_id) != RTEMS_SUCCESSFUL)
+    return;
+
+  if (rtems_scheduler_get_processor_set (scheduler_id, sizeof (scheduler_set),
+                                         &scheduler_set) != RTEMS_SUCCESSFUL)
+    return;
+
+  count = CPU_COUNT (&scheduler_set);
+  if (count <= 1)
+    return;
+
+  index %= count;
+
+  for (cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET (cpu, &scheduler_set) && index-- == 0)
+      break;
+  }
+
+  CPU_ZERO (&worker_set);
+  CPU_SET (cpu, &worker_set);
+
+  /* Not all schedulers support affinities, the worker stays unbound then */
+  (void) pthread_setaffinity_np (w->thread, sizeof (worker_set), &worker_set);
+#else
+  (void) w;
+  (void) index;
+#endif
+}
+
 /* 
  *  rtems_aio_init
  *
- * Initialize the request queue for aio
+ * Initialize the request queue for aio and create the worker pool
  *
  *  Input parameters:
  *        NONE
@@ -41,6 +100,10 @@ int
 rtems_aio_init (void)
 {
   int result = 0;
+  int i;
+
+  if (aio_request_queue.initialized == AIO_QUEUE_INITIALIZED)
+    return 0;
 
   result = pthread_attr_init (&aio_request_queue.attr);
   if (result != 0)
@@ -49,38 +112,74 @@ rtems_aio_init (void)
   result =
     pthread_attr_setdetachstate (&aio_request_queue.attr,
                                  PTHREAD_CREATE_DETACHED);
-  if (result != 0)
+  if (result != 0) {
     pthread_attr_destroy (&aio_request_queue.attr);
-
+    return result;
+  }
 
   result = pthread_mutex_init (&aio_request_queue.mutex, NULL);
-  if (result != 0)
-    pthread_attr_destroy (&aio_request_queue.attr);
-
-
-  result = pthread_cond_init (&aio_request_queue.new_req, NULL);
   if (result != 0) {
-    pthread_mutex_destroy (&aio_request_queue.mutex);
     pthread_attr_destroy (&aio_request_queue.attr);
+    return result;
   }
 
-  rtems_chain_initialize_empty (&aio_request_queue.work_req);
-  rtems_chain_initialize_empty (&aio_request_queue.idle_req);
+  for (i = 0; i < AIO_FD_TABLE_SIZE; ++i)
+    rtems_chain_initialize_empty (&aio_request_queue.fd_table[i]);
+
+  rtems_chain_initialize_empty (&aio_request_queue.ready_req);
+  rtems_chain_initialize_empty (&aio_request_queue.idle_workers);
 
   aio_request_queue.active_threads = 0;
   aio_request_queue.idle_threads = 0;
+  aio_request_queue.queued_requests = 0;
+
+  /* The workers wait for the queue mutex, so they cannot run before the
+     pool is complete */
+  pthread_mutex_lock (&aio_request_queue.mutex);
+
+  for (i = 0; i < AIO_MAX_THREADS; ++i) {
+    rtems_aio_worker *w = &aio_request_queue.workers[i];
+
+    result = pthread_cond_init (&w->cond, NULL);
+    if (result != 0)
+      break;
+
+    w->r_chain = NULL;
+
+    result = pthread_create (&w->thread, &aio_request_queue.attr,
+                             rtems_aio_handle, w);
+    if (result != 0) {
+      pthread_cond_destroy (&w->cond);
+      break;
+    }
+
+    rtems_aio_bind_worker (w, i);
+    rtems_chain_append_unprotected (&aio_request_queue.idle_workers,
+                                    &w->next_idle);
+    ++aio_request_queue.idle_threads;
+  }
+
+  pthread_mutex_unlock (&aio_request_queue.mutex);
+
+  /* A smaller pool is fine, but at least one worker is required */
+  if (aio_request_queue.idle_threads == 0) {
+    pthread_mutex_destroy (&aio_request_queue.mutex);
+    pthread_attr_destroy (&aio_request_queue.attr);
+    return result;
+  }
+
   aio_request_queue.initialized = AIO_QUEUE_INITIALIZED;
 
-  return result;
+  return 0;
 }
 
 /* 
  *  rtems_aio_search_fd
  *
- * Search and create chain of requests for given FD 
+ * Search and create chain of requests for given FD in the fd table.
+ * The queue mutex must be locked by the caller.
  *
  *  Input parameters:
- *        chain        - chain of FD chains
  *        fildes       - file descriptor to search
  *        create       - if 1 search and create
  *                     - if 0 just search
@@ -88,6 +187,8 @@ rtems_aio_init (void)
  *  Output parameters: 
  *        r_chain      - NULL if create == 0 and there is
  *                       no chain for given fildes
+ *                     - NULL if create == 1 and there is
+ *                       not enough memory
  *                     - pointer to chain is there exists
  *                       a chain for given fildes
  *                     - pointer to newly create chain if
@@ -96,110 +197,123 @@ rtems_aio_init (void)
  */
 
 rtems_aio_request_chain *
-rtems_aio_search_fd (rtems_chain_control *chain, int fildes, int create)
+rtems_aio_search_fd (int fildes, int create)
 {
+  rtems_chain_control *bucket;
   rtems_aio_request_chain *r_chain;
   rtems_chain_node *node;
 
-  node = rtems_chain_first (chain);
-  r_chain = (rtems_aio_request_chain *) node;
+  bucket = &aio_request_queue.fd_table[(unsigned int) fildes %
+                                       AIO_FD_TABLE_SIZE];
 
-  while (r_chain->fildes < fildes && !rtems_chain_is_tail (chain, node)) {
-    node = rtems_chain_next (node);
-    r_chain = (rtems_aio_request_chain *) node;
-  }
+  for (node = rtems_chain_first (bucket);
+       !rtems_chain_is_tail (bucket, node);
+       node = rtems_chain_next (node)) {
+    r_chain = RTEMS_CONTAINER_OF (node, rtems_aio_request_chain, next_fd);
 
-  if (r_chain->fildes == fildes)
-    r_chain->new_fd = 0;
-  else {
-    if (create == 0)
-      r_chain = NULL;
-    else {
-      r_chain = malloc (sizeof (rtems_aio_request_chain));
-      rtems_chain_initialize_empty (&r_chain->perfd);
-      rtems_chain_initialize_node (&r_chain->next_fd);
-
-      if (rtems_chain_is_empty (chain))
-        rtems_chain_prepend (chain, &r_chain->next_fd);
-      else
-        rtems_chain_insert (rtems_chain_previous (node), &r_chain->next_fd);
-
-      r_chain->new_fd = 1;
-	  r_chain->fildes = fildes;
+    if (r_chain->fildes == fildes) {
+      r_chain->new_fd = 0;
+      return r_chain;
     }
   }
+
+  if (create == 0)
+    return NULL;
+
+  r_chain = malloc (sizeof (rtems_aio_request_chain));
+  if (r_chain == NULL)
+    return NULL;
+
+  rtems_chain_initialize_empty (&r_chain->perfd);
+  rtems_chain_append_unprotected (bucket, &r_chain->next_fd);
+  r_chain->fildes = fildes;
+  r_chain->new_fd = 1;
+  r_chain->active = 0;
+
   return r_chain;
 }
 
-/*
- *  rtems_aio_move_to_work 
- * 
- * Move chain of requests from IQ to WQ
+/* 
+ *  rtems_aio_insert_prio
+ *
+ * Add request to given FD chain. The chain is ordered
+ * by priority, requests of equal priority are kept in
+ * submission order
  *
  *  Input parameters:
- *        r_chain      - chain of requests
+ *        chain        - chain of requests for a given FD
+ *        req          - request (see aio_misc.h)
  *
- *  Output paramteres:
+ *  Output parameters: 
  *        NONE
  */
 
 static void
-rtems_aio_move_to_work (rtems_aio_request_chain *r_chain)
+rtems_aio_insert_prio (rtems_chain_control *chain, rtems_aio_request *req)
 {
-  rtems_chain_control *work_req_chain = &aio_request_queue.work_req;
-  rtems_aio_request_chain *temp;
   rtems_chain_node *node;
 
-  node = rtems_chain_first (work_req_chain);
-  temp = (rtems_aio_request_chain *) node;
+  node = rtems_chain_last (chain);
 
-  while (temp->fildes < r_chain->fildes &&
-	 !rtems_chain_is_tail (work_req_chain, node)) {
-    node = rtems_chain_next (node);
-    temp = (rtems_aio_request_chain *) node;
-  }
+  while (!rtems_chain_is_head (chain, node) &&
+         ((rtems_aio_request *) node)->aiocbp->aio_reqprio >
+         req->aiocbp->aio_reqprio)
+    node = rtems_chain_previous (node);
 
-  rtems_chain_insert (rtems_chain_previous (node), &r_chain->next_fd);
+  rtems_chain_insert_unprotected (node, &req->next_prio);
 }
- 
 
-/* 
- *  rtems_aio_insert_prio
+/*
+ *  rtems_aio_complete
  *
- * Add request to given FD chain. The chain is ordered
- * by priority
+ * Finish a processed or canceled request. The result must be already
+ * stored in the aio control block. The queue mutex must be locked by the
+ * caller.
  *
  *  Input parameters:
- *        chain        - chain of requests for a given FD
  *        req          - request (see aio_misc.h)
  *
- *  Output parameters: 
+ *  Output parameters:
  *        NONE
  */
 
-static void
-rtems_aio_insert_prio (rtems_chain_control *chain, rtems_aio_request *req)
+void rtems_aio_complete (rtems_aio_request *req)
 {
-  rtems_chain_node *node;
+  rtems_aio_listio *listio = req->listio;
 
-  AIO_printf ("FD exists \n");
-  node = rtems_chain_first (chain);
+  free (req);
 
-  if (rtems_chain_is_empty (chain)) {
-    AIO_printf ("First in chain \n");
-    rtems_chain_prepend (chain, &req->next_prio);
-  } else {
-    AIO_printf ("Add by priority \n");
-    int prio = ((rtems_aio_request *) node)->aiocbp->aio_reqprio;
+  if (listio != NULL)
+    rtems_aio_listio_release (listio);
+}
 
-    while (req->aiocbp->aio_reqprio > prio &&
-           !rtems_chain_is_tail (chain, node)) {
-      node = rtems_chain_next (node);
-      prio = ((rtems_aio_request *) node)->aiocbp->aio_reqprio;
-    }
+/*
+ *  rtems_aio_listio_release
+ *
+ * Drop one pending request of a lio_listio() batch. The last one wakes
+ * up the waiting caller or sends the notification. The queue mutex must
+ * be locked by the caller.
+ *
+ *  Input parameters:
+ *        listio       - the batch
+ *
+ *  Output parameters:
+ *        NONE
+ */
 
-    rtems_chain_insert (node->previous, &req->next_prio);
+void rtems_aio_listio_release (rtems_aio_listio *listio)
+{
+  if (--listio->pending > 0)
+    return;
 
+  if (listio->mode == LIO_WAIT) {
+    pthread_cond_signal (&listio->done);
+  } else {
+    if (listio->sig.sigev_notify == SIGEV_SIGNAL)
+      sigqueue (getpid (), listio->sig.sigev_signo, listio->sig.sigev_value);
+
+    pthread_cond_destroy (&listio->done);
+    free (listio);
   }
 }
 
@@ -226,10 +340,11 @@ void rtems_aio_remove_fd (rtems_aio_request_chain *r_chain)
     {
       rtems_aio_request *req = (rtems_aio_request *) node;
       node = rtems_chain_next (node);
-      rtems_chain_extract (&req->next_prio);
-      req->aiocbp->error_code = ECANCELED;
+      rtems_chain_extract_unprotected (&req->next_prio);
+      --aio_request_queue.queued_requests;
       req->aiocbp->return_value = -1;
-      free (req);
+      req->aiocbp->error_code = ECANCELED;
+      rtems_aio_complete (req);
     }
 }
 
@@ -247,13 +362,11 @@ void rtems_aio_remove_fd (rtems_aio_request_chain *r_chain)
  *  Output parameters: 
  *         AIO_NOTCANCELED   - if request was not canceled
  *         AIO_CANCELED      - if request was canceled
+ *         AIO_ALLDONE       - if request was already done
  */
 
 int rtems_aio_remove_req (rtems_chain_control *chain, struct aiocb *aiocbp)
 {
-  if (rtems_chain_is_empty (chain))
-    return AIO_ALLDONE;
-
   rtems_chain_node *node = rtems_chain_first (chain);
   rtems_aio_request *current;
   
@@ -264,23 +377,113 @@ int rtems_aio_remove_req (rtems_chain_control *chain, struct aiocb *aiocbp)
     current = (rtems_aio_request *) node;
   }
   
+  /* Not queued, the request is either in progress or done */
   if (rtems_chain_is_tail (chain, node))
-    return AIO_NOTCANCELED;
-  else
-    {
-      rtems_chain_extract (node);
-      current->aiocbp->error_code = ECANCELED;
-      current->aiocbp->return_value = -1;
-      free (current); 
-    }
-    
+    return aiocbp->error_code == EINPROGRESS ? AIO_NOTCANCELED : AIO_ALLDONE;
+
+  rtems_chain_extract_unprotected (node);
+  --aio_request_queue.queued_requests;
+  current->aiocbp->return_value = -1;
+  current->aiocbp->error_code = ECANCELED;
+  rtems_aio_complete (current);
+
   return AIO_CANCELED;
 }
 
+/*
+ *  rtems_aio_schedule
+ *
+ * Hand a new fd chain to an idle worker or put it on the ready
+ * chain if all workers are busy. The queue mutex must be locked.
+ *
+ *  Input parameters:
+ *        r_chain      - the new fd chain
+ *        req          - the first request of the fd chain
+ *
+ *  Output parameters:
+ *        NONE
+ */
+
+static void
+rtems_aio_schedule (rtems_aio_request_chain *r_chain, rtems_aio_request *req)
+{
+  rtems_aio_worker *w;
+  struct sched_param param;
+
+  if (rtems_chain_is_empty (&aio_request_queue.idle_workers)) {
+    AIO_printf ("All workers busy, fd chain is ready\n");
+    rtems_chain_append_unprotected (&aio_request_queue.ready_req,
+                                    &r_chain->next_ready);
+    return;
+  }
+
+  AIO_printf ("Wake up idle worker\n");
+  w = RTEMS_CONTAINER_OF (
+    rtems_chain_get_first_unprotected (&aio_request_queue.idle_workers),
+    rtems_aio_worker,
+    next_idle
+  );
+  --aio_request_queue.idle_threads;
+  ++aio_request_queue.active_threads;
+
+  /* Give the worker the request priority before it becomes ready, so that
+     an idle worker of a low priority cannot delay the request */
+  param.sched_priority = req->priority;
+  pthread_setschedparam (w->thread, req->policy, &param);
+
+  w->r_chain = r_chain;
+  pthread_cond_signal (&w->cond);
+}
+
+/*
+ *  rtems_aio_insert
+ *
+ * Add a request to the chain of its fd. The queue mutex must be locked.
+ *
+ *  Input parameters:
+ *        req        - see aio_misc.h
+ *
+ *  Output parameters:
+ *         0         - if request was added to queue
+ *         errno     - otherwise, the request was not added
+ */
+
+static int
+rtems_aio_insert (rtems_aio_request *req)
+{
+  rtems_aio_request_chain *r_chain;
+  int policy;
+  struct sched_param param;
+
+  r_chain = rtems_aio_search_fd (req->aiocbp->aio_fildes, 1);
+  if (r_chain == NULL)
+    return EAGAIN;
+
+  /* _POSIX_PRIORITIZED_IO and _POSIX_PRIORITY_SCHEDULING are defined, 
+     we can use aio_reqprio to lower the priority of the request */
+  pthread_getschedparam (pthread_self(), &policy, &param);
+
+  rtems_chain_initialize_node (&req->next_prio);
+  req->caller_thread = pthread_self ();
+  req->priority = param.sched_priority - req->aiocbp->aio_reqprio;
+  req->policy = policy;
+  req->aiocbp->error_code = EINPROGRESS;
+  req->aiocbp->return_value = 0;
+
+  rtems_aio_insert_prio (&r_chain->perfd, req);
+  ++aio_request_queue.queued_requests;
+
+  /* A fd chain stays scheduled until a worker finds it empty */
+  if (r_chain->new_fd == 1)
+    rtems_aio_schedule (r_chain, req);
+
+  return 0;
+}
+
 /* 
  *  rtems_aio_enqueue
  *
- * Enqueue requests, and creates threads to process them 
+ * Enqueue requests, and wake up workers to process them 
  *
  *  Input parameters:
  *        req        - see aio_misc.h
@@ -293,12 +496,7 @@ int rtems_aio_remove_req (rtems_chain_control *chain, struct aiocb *aiocbp)
 int
 rtems_aio_enqueue (rtems_aio_request *req)
 {
-
-  rtems_aio_request_chain *r_chain;
-  rtems_chain_control *chain;
-  pthread_t thid;
-  int result, policy;
-  struct sched_param param;
+  int result;
 
   /* The queue should be initialized */
   AIO_assert (aio_request_queue.initialized == AIO_QUEUE_INITIALIZED);
@@ -309,94 +507,254 @@ rtems_aio_enqueue (rtems_aio_request *req)
     return result;
   }
 
-  /* _POSIX_PRIORITIZED_IO and _POSIX_PRIORITY_SCHEDULING are defined, 
-     we can use aio_reqprio to lower the priority of the request */
-  pthread_getschedparam (pthread_self(), &policy, &param);
+  req->listio = NULL;
+  result = rtems_aio_insert (req);
+  if (result != 0) {
+    req->aiocbp->error_code = result;
+    req->aiocbp->return_value = -1;
+    free (req);
+  }
 
-  rtems_chain_initialize_node (&req->next_prio);
-  req->caller_thread = pthread_self ();
-  req->priority = param.sched_priority - req->aiocbp->aio_reqprio;
-  req->policy = policy;
-  req->aiocbp->error_code = EINPROGRESS;
-  req->aiocbp->return_value = 0;
+  pthread_mutex_unlock (&aio_request_queue.mutex);
+  return result;
+}
 
-  if ((aio_request_queue.idle_threads == 0) &&
-      aio_request_queue.active_threads < AIO_MAX_THREADS)
-    /* we still have empty places on the active_threads chain */
-    {
-      chain = &aio_request_queue.work_req;
-      r_chain = rtems_aio_search_fd (chain, req->aiocbp->aio_fildes, 1);
-      
-      if (r_chain->new_fd == 1) {
-	rtems_chain_prepend (&r_chain->perfd, &req->next_prio);
-	r_chain->new_fd = 0;
-	pthread_mutex_init (&r_chain->mutex, NULL);
-	pthread_cond_init (&r_chain->cond, NULL);
-	    
-	AIO_printf ("New thread \n");
-	result = pthread_create (&thid, &aio_request_queue.attr,
-				 rtems_aio_handle, (void *) r_chain);
-	if (result != 0) {
-	  pthread_mutex_unlock (&aio_request_queue.mutex);
-	  return result;
-	}
-	++aio_request_queue.active_threads;
-      }
-      else {
-	/* put request in the fd chain it belongs to */
-	pthread_mutex_lock (&r_chain->mutex);
-	rtems_aio_insert_prio (&r_chain->perfd, req);
-	pthread_cond_signal (&r_chain->cond);
-	pthread_mutex_unlock (&r_chain->mutex);
-      }
+/*
+ *  rtems_aio_enqueue_list
+ *
+ * Enqueue a batch of requests with one acquisition of the queue mutex.
+ * Requests which cannot be added get their error status and are
+ * completed immediately. The queue mutex must be locked.
+ *
+ *  Input parameters:
+ *        reqs       - chain of requests, linked by next_prio
+ *
+ *  Output parameters:
+ *        count      - number of requests which could not be added
+ */
+
+int
+rtems_aio_enqueue_list (rtems_chain_control *reqs)
+{
+  rtems_chain_node *node;
+  int failed = 0;
+
+  AIO_assert (aio_request_queue.initialized == AIO_QUEUE_INITIALIZED);
+
+  while ((node = rtems_chain_get_unprotected (reqs)) != NULL) {
+    rtems_aio_request *req = (rtems_aio_request *) node;
+    int result;
+
+    result = rtems_aio_insert (req);
+    if (result != 0) {
+      req->aiocbp->return_value = -1;
+      req->aiocbp->error_code = result;
+      rtems_aio_complete (req);
+      ++failed;
     }
-  else 
-    {
-      /* the maximum number of threads has been already created
-	 even though some of them might be idle.
-	 The request belongs to one of the active fd chain */
-      r_chain = rtems_aio_search_fd (&aio_request_queue.work_req,
-				     req->aiocbp->aio_fildes, 0);
-      if (r_chain != NULL)
-	{
-	  pthread_mutex_lock (&r_chain->mutex);
-	  rtems_aio_insert_prio (&r_chain->perfd, req);
-	  pthread_cond_signal (&r_chain->cond);
-	  pthread_mutex_unlock (&r_chain->mutex);
-	    
-	} else {
-      
-	/* or to the idle chain */
-	chain = &aio_request_queue.idle_req;
-	r_chain = rtems_aio_search_fd (chain, req->aiocbp->aio_fildes, 1);
-      
-	if (r_chain->new_fd == 1) {
-	  /* If this is a new fd chain we signal the idle threads that
-	     might be waiting for requests */
-	  AIO_printf (" New chain on waiting queue \n ");
-	  rtems_chain_prepend (&r_chain->perfd, &req->next_prio);
-	  r_chain->new_fd = 0;
-	  pthread_mutex_init (&r_chain->mutex, NULL);
-	  pthread_cond_init (&r_chain->cond, NULL);
-	} else
-	  /* just insert the request in the existing fd chain */
-	  rtems_aio_insert_prio (&r_chain->perfd, req);
-	if (aio_request_queue.idle_threads > 0)
-	  pthread_cond_signal (&aio_request_queue.new_req);
-      }
+  }
+
+  return failed;
+}
+
+/*
+ *  rtems_aio_get_batch
+ *
+ * Take the first request of a fd chain and all directly following
+ * requests which continue its transfer at the adjacent file offset. The
+ * queue mutex must be locked.
+ *
+ *  Input parameters:
+ *        r_chain    - a non-empty fd chain
+ *        batch      - array of AIO_MAX_MERGE requests
+ *
+ *  Output parameters:
+ *        count      - number of requests in batch
+ */
+
+static int
+rtems_aio_get_batch (rtems_aio_request_chain *r_chain,
+                     rtems_aio_request **batch)
+{
+  rtems_chain_control *chain = &r_chain->perfd;
+  struct aiocb *aiocbp;
+  off_t end;
+  int count;
+
+  batch[0] = (rtems_aio_request *) rtems_chain_get_first_unprotected (chain);
+  count = 1;
+  aiocbp = batch[0]->aiocbp;
+
+  if (aiocbp->aio_lio_opcode == LIO_READ ||
+      aiocbp->aio_lio_opcode == LIO_WRITE) {
+    end = aiocbp->aio_offset + (off_t) aiocbp->aio_nbytes;
+
+    while (count < AIO_MAX_MERGE && !rtems_chain_is_empty (chain)) {
+      rtems_aio_request *next = (rtems_aio_request *) rtems_chain_first (chain);
+
+      if (next->aiocbp->aio_lio_opcode != aiocbp->aio_lio_opcode ||
+          next->aiocbp->aio_offset != end)
+        break;
+
+      rtems_chain_extract_unprotected (&next->next_prio);
+      batch[count] = next;
+      ++count;
+      end += (off_t) next->aiocbp->aio_nbytes;
     }
+  }
 
-  pthread_mutex_unlock (&aio_request_queue.mutex);
-  return 0;
+  r_chain->active = count;
+  aio_request_queue.queued_requests -= count;
+  return count;
+}
+
+/*
+ *  rtems_aio_transfer
+ *
+ * Vectored read or write at a file offset. Like pread() and pwrite()
+ * this uses the file offset of the file descriptor temporarily.
+ *
+ *  Input parameters:
+ *        opcode     - LIO_READ or LIO_WRITE
+ *        fildes     - file descriptor
+ *        iov        - the buffers
+ *        iovcnt     - number of buffers
+ *        offset     - file offset of the transfer
+ *
+ *  Output parameters:
+ *        -1         - if an error occurred
+ *        count      - number of bytes transferred otherwise
+ */
+
+static ssize_t
+rtems_aio_transfer (int opcode, int fildes, const struct iovec *iov,
+                    int iovcnt, off_t offset)
+{
+  off_t cur;
+  ssize_t result;
+  int eno;
+
+  if (iovcnt == 1) {
+    if (opcode == LIO_READ)
+      return pread (fildes, iov[0].iov_base, iov[0].iov_len, offset);
+
+    return pwrite (fildes, iov[0].iov_base, iov[0].iov_len, offset);
+  }
+
+  cur = lseek (fildes, 0, SEEK_CUR);
+  if (cur == -1)
+    return -1;
+
+  if (lseek (fildes, offset, SEEK_SET) == -1)
+    return -1;
+
+  if (opcode == LIO_READ)
+    result = readv (fildes, iov, iovcnt);
+  else
+    result = writev (fildes, iov, iovcnt);
+
+  eno = errno;
+  lseek (fildes, cur, SEEK_SET);
+  errno = eno;
+
+  return result;
+}
+
+/*
+ *  rtems_aio_process
+ *
+ * Carry out a batch of requests. The queue mutex must not be locked.
+ *
+ *  Input parameters:
+ *        batch      - requests returned by rtems_aio_get_batch()
+ *        count      - number of requests in batch
+ *
+ *  Output parameters:
+ *        -1         - if an error occurred, see errno
+ *        result     - result of the operation otherwise
+ */
+
+static ssize_t
+rtems_aio_process (rtems_aio_request **batch, int count)
+{
+  struct aiocb *aiocbp = batch[0]->aiocbp;
+  struct iovec iov[AIO_MAX_MERGE];
+  int i;
+
+  switch (aiocbp->aio_lio_opcode) {
+  case LIO_READ:
+  case LIO_WRITE:
+    AIO_printf ("read/write\n");
+
+    for (i = 0; i < count; ++i) {
+      iov[i].iov_base = (void *) batch[i]->aiocbp->aio_buf;
+      iov[i].iov_len = batch[i]->aiocbp->aio_nbytes;
+    }
+
+    return rtems_aio_transfer (aiocbp->aio_lio_opcode, aiocbp->aio_fildes,
+                               iov, count, aiocbp->aio_offset);
+
+  case LIO_SYNC:
+    AIO_printf ("sync\n");
+    return fsync (aiocbp->aio_fildes);
+
+  default:
+    errno = EINVAL;
+    return -1;
+  }
+}
+
+/*
+ *  rtems_aio_set_results
+ *
+ * Store the result of a processed batch in the aio control blocks. The
+ * queue mutex must be locked, so that aio_cancel() sees either requests
+ * in progress or done requests.
+ *
+ *  Input parameters:
+ *        batch      - requests returned by rtems_aio_get_batch()
+ *        count      - number of requests in batch
+ *        result     - result of rtems_aio_process()
+ *        eno        - error number if result is -1
+ *
+ *  Output parameters:
+ *        NONE
+ */
+
+static void
+rtems_aio_set_results (rtems_aio_request **batch, int count, ssize_t result,
+                       int eno)
+{
+  size_t remaining = (size_t) result;
+  int i;
+
+  /* A short transfer completes the leading requests of a merged batch */
+  for (i = 0; i < count; ++i) {
+    struct aiocb *aiocbp = batch[i]->aiocbp;
+
+    if (result == -1) {
+      aiocbp->return_value = -1;
+      aiocbp->error_code = eno;
+    } else {
+      size_t n = aiocbp->aio_lio_opcode == LIO_SYNC ?
+        (size_t) result : MIN (remaining, aiocbp->aio_nbytes);
+
+      remaining -= n;
+      aiocbp->return_value = (ssize_t) n;
+      aiocbp->error_code = 0;
+    }
+  }
 }
 
 /* 
  *  rtems_aio_handle
  *
- * Thread processing requests 
+ * Worker thread processing fd chains. At most one worker processes
+ * a fd chain at a time, so the requests of a fd are carried out in
+ * order.
  *
  *  Input parameters:
- *        arg        - the chain for the fd to be worked on
+ *        arg        - the worker
  * 
  *  Output parameters: 
  *        NULL       - if error
@@ -405,161 +763,70 @@ rtems_aio_enqueue (rtems_aio_request *req)
 static void *
 rtems_aio_handle (void *arg)
 {
-
-  rtems_aio_request_chain *r_chain = arg;
-  rtems_aio_request *req;
-  rtems_chain_control *chain;
+  rtems_aio_worker *w = arg;
+  rtems_aio_request *batch[AIO_MAX_MERGE];
+  rtems_aio_request_chain *r_chain;
   rtems_chain_node *node;
-  int result, policy;
   struct sched_param param;
+  ssize_t result;
+  int count, eno, i;
 
   AIO_printf ("Thread started\n");
- 
-  while (1) {
-    
-    /* acquire the mutex of the current fd chain.
-       we don't need to lock the queue mutex since we can
-       add requests to idle fd chains or even active ones
-       if the working request has been extracted from the
-       chain */
-    result = pthread_mutex_lock (&r_chain->mutex);
-    if (result != 0)
-      return NULL;
-    
-    chain = &r_chain->perfd;    
-
-    /* If the locked chain is not empty, take the first
-       request extract it, unlock the chain and process 
-       the request, in this way the user can supply more
-       requests to this fd chain */
-    if (!rtems_chain_is_empty (chain)) {
-
-      AIO_printf ("Get new request from not empty chain\n");	
-      node = rtems_chain_first (chain);
-      req = (rtems_aio_request *) node;
-      
-      /* See _POSIX_PRIORITIZE_IO and _POSIX_PRIORITY_SCHEDULING
-	 discussion in rtems_aio_enqueue () */
-      pthread_getschedparam (pthread_self(), &policy, &param);
-      param.sched_priority = req->priority;
-      pthread_setschedparam (pthread_self(), req->policy, &param);
-
-      rtems_chain_extract (node);
-
-      pthread_mutex_unlock (&r_chain->mutex);
-
-      switch (req->aiocbp->aio_lio_opcode) {
-      case LIO_READ:
-	AIO_printf ("read\n");
-        result = pread (req->aiocbp->aio_fildes,
-                        (void *) req->aiocbp->aio_buf,
-                        req->aiocbp->aio_nbytes, req->aiocbp->aio_offset);
-        break;
 
-      case LIO_WRITE:
-	AIO_printf ("write\n");
-        result = pwrite (req->aiocbp->aio_fildes,
-                         (void *) req->aiocbp->aio_buf,
-                         req->aiocbp->aio_nbytes, req->aiocbp->aio_offset);
-        break;
-        
-      case LIO_SYNC:
-	AIO_printf ("sync\n");
-      	result = fsync (req->aiocbp->aio_fildes);
-      	break;
-
-      default:
-        result = -1;
-      }
-      if (result == -1) {
-        req->aiocbp->return_value = -1;
-	req->aiocbp->error_code = errno;
+  result = pthread_mutex_lock (&aio_request_queue.mutex);
+  if (result != 0)
+    return NULL;
+
+  while (1) {
+    /* Wait until rtems_aio_schedule() assigns a fd chain */
+    while (w->r_chain == NULL)
+      pthread_cond_wait (&w->cond, &aio_request_queue.mutex);
+
+    r_chain = w->r_chain;
+
+    while (r_chain != NULL) {
+      if (rtems_chain_is_empty (&r_chain->perfd)) {
+        /* All requests are done or canceled */
+        AIO_printf ("Chain is empty, remove it\n");
+        rtems_chain_extract_unprotected (&r_chain->next_fd);
+        free (r_chain);
       } else {
-        req->aiocbp->return_value = result;
-        req->aiocbp->error_code = 0;
-      }
+        count = rtems_aio_get_batch (r_chain, batch);
 
-      // notification needed for lio
+        /* See _POSIX_PRIORITIZE_IO and _POSIX_PRIORITY_SCHEDULING
+           discussion in rtems_aio_insert () */
+        param.sched_priority = batch[0]->priority;
+        pthread_setschedparam (pthread_self(), batch[0]->policy, &param);
 
-    } else {
-      /* If the fd chain is empty we unlock the fd chain
-	 and we lock the queue chain, this will ensure that
-	 we have at most one request comming to our fd chain
-	 when we check. 
-	 
-	 If there was no request added sleep for 3 seconds and
-	 wait for a signal on chain, this will unlock the queue.
-	 The fd chain is already unlocked */
-
-      struct timespec timeout;
-      
-      AIO_printf ("Chain is empty [WQ], wait for work\n");
-     
-      pthread_mutex_unlock (&r_chain->mutex);
-      pthread_mutex_lock (&aio_request_queue.mutex);
-      
-      if (rtems_chain_is_empty (chain))
-	{
-	  clock_gettime (CLOCK_REALTIME, &timeout);
-	  timeout.tv_sec += 3;
-	  timeout.tv_nsec = 0;
-	  result = pthread_cond_timedwait (&r_chain->cond,
-					   &aio_request_queue.mutex,
-					   &timeout);
-
-	  /* If no requests were added to the chain we delete the fd chain from 
-	     the queue and start working with idle fd chains */
-	  if (result == ETIMEDOUT) {
-	    rtems_chain_extract (&r_chain->next_fd);
-	    pthread_mutex_destroy (&r_chain->mutex);
-	    pthread_cond_destroy (&r_chain->cond);
-	    free (r_chain);
-	    
-	    /* If the idle chain is empty sleep for 3 seconds and wait for a 
-	       signal. The thread now becomes idle. */
-	    if (rtems_chain_is_empty (&aio_request_queue.idle_req)) {
-	      AIO_printf ("Chain is empty [IQ], wait for work\n");	      
-
-	      ++aio_request_queue.idle_threads;
-	      --aio_request_queue.active_threads;
-	      clock_gettime (CLOCK_REALTIME, &timeout);
-	      timeout.tv_sec += 3;
-	      timeout.tv_nsec = 0;
-
-	      result = pthread_cond_timedwait (&aio_request_queue.new_req,
-					       &aio_request_queue.mutex,
-					       &timeout);
-	      
-	      /* If no new fd chain was added in the idle requests
-		 then this thread is finished */
-	      if (result == ETIMEDOUT) {
-		AIO_printf ("Etimeout\n");
-		--aio_request_queue.idle_threads;
-		pthread_mutex_unlock (&aio_request_queue.mutex);
-		return NULL;
-	      }
-	    }
-	    /* Otherwise move this chain to the working chain and 
-	       start the loop all over again */
-	    AIO_printf ("Work on idle\n");
-	    --aio_request_queue.idle_threads;
-	    ++aio_request_queue.active_threads;
-
-	    node = rtems_chain_first (&aio_request_queue.idle_req);
-	    rtems_chain_extract (node);
-
-	    r_chain = (rtems_aio_request_chain *) node;
-	    rtems_aio_move_to_work (r_chain);
-	    
-	  }
-	}
-      /* If there was a request added in the initial fd chain then release
-	 the mutex and process it */
-      pthread_mutex_unlock (&aio_request_queue.mutex);
-      
+        pthread_mutex_unlock (&aio_request_queue.mutex);
+        result = rtems_aio_process (batch, count);
+        eno = errno;
+        pthread_mutex_lock (&aio_request_queue.mutex);
+
+        rtems_aio_set_results (batch, count, result, eno);
+
+        for (i = 0; i < count; ++i)
+          rtems_aio_complete (batch[i]);
+
+        r_chain->active = 0;
+
+        /* Let the other ready fd chains go first */
+        rtems_chain_append_unprotected (&aio_request_queue.ready_req,
+                                        &r_chain->next_ready);
+      }
+
+      node = rtems_chain_get_unprotected (&aio_request_queue.ready_req);
+      r_chain = node != NULL ?
+        RTEMS_CONTAINER_OF (node, rtems_aio_request_chain, next_ready) : NULL;
+      w->r_chain = r_chain;
     }
+
+    AIO_printf ("No ready chain, wait for work\n");
+    --aio_request_queue.active_threads;
+    ++aio_request_queue.idle_threads;
+    rtems_chain_append_unprotected (&aio_request_queue.idle_workers,
+                                    &w->next_idle);
   }
-  
-  AIO_printf ("Thread finished\n");
+
   return NULL;
 }
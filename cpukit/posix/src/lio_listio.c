@@ -23,16 +23,160 @@
 
 #include <aio.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
 
-#include <rtems/score/basedefs.h>
+#include <rtems/posix/aio_misc.h>
 #include <rtems/seterr.h>
 
+/*
+ *  lio_check
+ *
+ * Check a list entry like aio_read() and aio_write() do
+ *
+ *  Input parameters:
+ *        aiocbp - asynchronous I/O control block
+ *
+ *  Output parameters:
+ *        0      - if the entry is valid
+ *        errno  - otherwise
+ */
+
+static int
+lio_check (const struct aiocb *aiocbp)
+{
+  int mode;
+
+  mode = fcntl (aiocbp->aio_fildes, F_GETFL);
+  if (mode == -1)
+    return EBADF;
+
+  mode &= O_ACCMODE;
+
+  if (aiocbp->aio_lio_opcode == LIO_READ) {
+    if (mode != O_RDONLY && mode != O_RDWR)
+      return EBADF;
+  } else if (aiocbp->aio_lio_opcode == LIO_WRITE) {
+    if (mode != O_WRONLY && mode != O_RDWR)
+      return EBADF;
+  } else {
+    return EINVAL;
+  }
+
+  if (aiocbp->aio_reqprio < 0 || aiocbp->aio_reqprio > AIO_PRIO_DELTA_MAX)
+    return EINVAL;
+
+  if (aiocbp->aio_offset < 0)
+    return EINVAL;
+
+  return 0;
+}
+
 int lio_listio(
-  int              mode RTEMS_UNUSED,
-  struct aiocb    *__restrict const  list[__restrict] RTEMS_UNUSED,
-  int              nent RTEMS_UNUSED,
-  struct sigevent *__restrict sig RTEMS_UNUSED
+  int              mode,
+  struct aiocb    *__restrict const  list[__restrict],
+  int              nent,
+  struct sigevent *__restrict sig
 )
 {
-  rtems_set_errno_and_return_minus_one( ENOSYS );
+  rtems_aio_listio wait_listio;
+  rtems_aio_listio *listio;
+  rtems_chain_control reqs;
+  int failed = 0;
+  int result;
+  int i;
+
+  if (mode != LIO_WAIT && mode != LIO_NOWAIT)
+    rtems_set_errno_and_return_minus_one (EINVAL);
+
+  if (list == NULL || nent <= 0 || nent > AIO_LISTIO_MAX)
+    rtems_set_errno_and_return_minus_one (EINVAL);
+
+  if (mode == LIO_NOWAIT && sig != NULL &&
+      sig->sigev_notify != SIGEV_NONE && sig->sigev_notify != SIGEV_SIGNAL)
+    rtems_set_errno_and_return_minus_one (EINVAL);
+
+  if (mode == LIO_WAIT) {
+    listio = &wait_listio;
+  } else {
+    listio = malloc (sizeof (*listio));
+    if (listio == NULL)
+      rtems_set_errno_and_return_minus_one (EAGAIN);
+  }
+
+  result = pthread_cond_init (&listio->done, NULL);
+  if (result != 0) {
+    if (mode == LIO_NOWAIT)
+      free (listio);
+
+    rtems_set_errno_and_return_minus_one (EAGAIN);
+  }
+
+  listio->mode = mode;
+
+  if (mode == LIO_NOWAIT && sig != NULL)
+    listio->sig = *sig;
+  else
+    listio->sig.sigev_notify = SIGEV_NONE;
+
+  /* This reference of the caller keeps the batch until it is submitted */
+  listio->pending = 1;
+
+  rtems_chain_initialize_empty (&reqs);
+
+  for (i = 0; i < nent; ++i) {
+    struct aiocb *aiocbp = list[i];
+    rtems_aio_request *req;
+
+    if (aiocbp == NULL || aiocbp->aio_lio_opcode == LIO_NOP)
+      continue;
+
+    result = lio_check (aiocbp);
+    if (result == 0) {
+      req = malloc (sizeof (rtems_aio_request));
+      if (req == NULL)
+        result = EAGAIN;
+    }
+
+    if (result != 0) {
+      aiocbp->error_code = result;
+      aiocbp->return_value = -1;
+      ++failed;
+      continue;
+    }
+
+    req->aiocbp = aiocbp;
+    req->listio = listio;
+    rtems_chain_append_unprotected (&reqs, &req->next_prio);
+    ++listio->pending;
+  }
+
+  /* Submit the whole batch in one pass, the workers cannot complete a
+     request of it before the queue mutex is released */
+  pthread_mutex_lock (&aio_request_queue.mutex);
+  failed += rtems_aio_enqueue_list (&reqs);
+
+  if (mode == LIO_WAIT) {
+    --listio->pending;
+
+    while (listio->pending > 0)
+      pthread_cond_wait (&listio->done, &aio_request_queue.mutex);
+
+    pthread_mutex_unlock (&aio_request_queue.mutex);
+    pthread_cond_destroy (&listio->done);
+
+    for (i = 0; i < nent; ++i) {
+      if (list[i] != NULL && list[i]->aio_lio_opcode != LIO_NOP &&
+          list[i]->error_code != 0)
+        ++failed;
+    }
+  } else {
+    rtems_aio_listio_release (listio);
+    pthread_mutex_unlock (&aio_request_queue.mutex);
+  }
+
+  if (failed > 0)
+    rtems_set_errno_and_return_minus_one (EIO);
+
+  return 0;
 }
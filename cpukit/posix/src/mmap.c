@@ -159,9 +159,7 @@ void *mmap(
 
     /* Check to see if the mapping is valid for a regular file. */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
@@ -234,6 +232,18 @@ void *mmap(
     return MAP_FAILED;
   }
 
+  /*
+   * A shared mapping of a regular file may refer directly to the file data.
+   * Keep a reference to the file until the mapping is removed by munmap(), so
+   * that the file data stays valid after a close() and unlink().
+   */
+  if ( map_shared && S_ISREG( sb.st_mode ) ) {
+    rtems_filesystem_instance_lock( &iop->pathinfo );
+    rtems_filesystem_location_clone( &mapping->file, &iop->pathinfo );
+    rtems_filesystem_instance_unlock( &iop->pathinfo );
+    mapping->file_referenced = true;
+  }
+
   mmap_mappings_lock_obtain();
 
   if ( map_fixed ) {
@@ -248,8 +258,11 @@ void *mmap(
       current_mapping = (mmap_mapping*) node;
       if ( ( addr >= current_mapping->addr ) &&
            ( addr < ( current_mapping->addr + current_mapping->len )) ) {
-        free( mapping );
         mmap_mappings_lock_release( );
+        if ( mapping->file_referenced ) {
+          rtems_filesystem_location_free( &mapping->file );
+        }
+        free( mapping );
         errno = ENXIO;
         return MAP_FAILED;
       }
@@ -289,6 +302,9 @@ void *mmap(
         iop, &mapping->addr, len, prot, off );
     if ( err != 0 ) {
       mmap_mappings_lock_release( );
+      if ( mapping->file_referenced ) {
+        rtems_filesystem_location_free( &mapping->file );
+      }
       free( mapping );
       return MAP_FAILED;
     }
@@ -22,6 +22,7 @@
 int munmap(void *addr, size_t len)
 {
   mmap_mapping     *mapping;
+  mmap_mapping     *file_mapping;
   rtems_chain_node *node;
 
   /*
@@ -43,6 +44,8 @@ int munmap(void *addr, size_t len)
     return -1;
   }
 
+  file_mapping = NULL;
+
   mmap_mappings_lock_obtain();
 
   node = rtems_chain_first (&mmap_mappings);
@@ -67,12 +70,24 @@ int munmap(void *addr, size_t len)
           free( mapping->addr );
         }
       }
-      free( mapping );
+
+      /* The file reference is released outside the mappings lock */
+      if ( mapping->file_referenced ) {
+        file_mapping = mapping;
+      } else {
+        free( mapping );
+      }
       break;
     }
     node = rtems_chain_next( node );
   }
 
   mmap_mappings_lock_release( );
+
+  if ( file_mapping != NULL ) {
+    rtems_filesystem_location_free( &file_mapping->file );
+    free( file_mapping );
+  }
+
   return 0;
 }
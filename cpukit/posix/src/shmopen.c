@@ -314,7 +314,8 @@ static const rtems_filesystem_file_handlers_r shm_handlers = {
   .mmap_h = shm_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .copy_file_range_h = rtems_filesystem_default_copy_file_range
 };
 
 static void _POSIX_Shm_Manager_initialization( void )
@@ -4,7 +4,8 @@
  * @ingroup RTEMSAPIProfiling
  *
  * @brief This source file contains the implementation of
- *   rtems_profiling_iterate().
+ *   rtems_profiling_iterate(), rtems_profiling_reset_latencies(), and
+ *   rtems_profiling_reset_thread_queues().
  */
 
 /*
@@ -27,8 +28,10 @@
 
 #include <rtems/profiling.h>
 #include <rtems/counter.h>
+#include <rtems/score/latencytrace.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smplock.h>
+#include <rtems/score/threadqstats.h>
 #include <rtems.h>
 
 #include <string.h>
@@ -78,6 +81,16 @@ static void per_cpu_stats_iterate(
         stats->total_interrupt_time
       );
 
+#ifdef RTEMS_SMP
+    per_cpu_data->max_ipi_latency =
+      rtems_counter_ticks_to_nanoseconds(stats->max_ipi_latency);
+
+    per_cpu_data->ipi_count = stats->ipi_count;
+
+    per_cpu_data->total_ipi_latency =
+      rtems_counter_ticks_to_nanoseconds(stats->total_ipi_latency);
+#endif
+
     (*visitor)(visitor_arg, data);
   }
 #else
@@ -147,6 +160,143 @@ static void smp_lock_stats_iterate(
 #endif
 }
 
+#if defined(RTEMS_PROFILING)
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS
+    == THREAD_QUEUE_STATS_HISTOGRAM_COUNTS,
+  thread_queue_histogram_counts
+);
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT
+    == THREAD_QUEUE_STATS_OWNER_COUNT,
+  thread_queue_owner_count
+);
+#endif
+
+static void thread_queue_stats_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#ifdef RTEMS_PROFILING
+  Thread_queue_Stats snapshot;
+  size_t n = _Thread_queue_Stats_get_count();
+  size_t i;
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_THREAD_QUEUE;
+
+  for (i = 0; i < n; ++i) {
+    rtems_profiling_thread_queue *thread_queue_data = &data->thread_queue;
+    size_t j;
+
+    if (!_Thread_queue_Stats_get(i, &snapshot)) {
+      continue;
+    }
+
+    thread_queue_data->queue = snapshot.queue;
+    thread_queue_data->id = snapshot.id;
+    thread_queue_data->name = snapshot.name;
+    thread_queue_data->deleted = snapshot.deleted;
+    thread_queue_data->max_wait_time = snapshot.max_wait_time;
+    thread_queue_data->wait_count = snapshot.wait_count;
+    thread_queue_data->total_wait_time = snapshot.total_wait_time;
+
+    memcpy(
+      &thread_queue_data->histogram[0],
+      &snapshot.histogram[0],
+      sizeof(thread_queue_data->histogram)
+    );
+
+    for (j = 0; j < THREAD_QUEUE_STATS_OWNER_COUNT; ++j) {
+      thread_queue_data->owners[j].id = snapshot.owners[j].id;
+      thread_queue_data->owners[j].wait_count = snapshot.owners[j].wait_count;
+      thread_queue_data->owners[j].total_wait_time =
+        snapshot.owners[j].total_wait_time;
+    }
+
+    (*visitor)(visitor_arg, data);
+  }
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
+#if defined(RTEMS_PROFILING)
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_LATENCY_COUNT == LATENCY_TRACE_ENTRY_COUNT,
+  latency_count
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_LATENCY_INTERRUPTS_DISABLED
+    == (int) LATENCY_TRACE_INTERRUPTS_DISABLED,
+  latency_interrupts_disabled
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_LATENCY_THREAD_DISPATCH_DISABLED
+    == (int) LATENCY_TRACE_THREAD_DISPATCH_DISABLED,
+  latency_thread_dispatch_disabled
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_LATENCY_LOCK_HELD == (int) LATENCY_TRACE_LOCK_HELD,
+  latency_lock_held
+);
+#endif
+
+static void latency_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#ifdef RTEMS_PROFILING
+  uint32_t cpu_max = rtems_scheduler_get_processor_maximum();
+  uint32_t cpu_index;
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_LATENCY;
+
+  for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+    int kind;
+
+    for (kind = 0; kind < LATENCY_TRACE_KIND_COUNT; ++kind) {
+      Latency_trace_Entry entries[LATENCY_TRACE_ENTRY_COUNT];
+      size_t n;
+      size_t i;
+
+      n = _Latency_trace_Get(cpu_index, (Latency_trace_Kind) kind, entries);
+
+      for (i = 0; i < n; ++i) {
+        rtems_profiling_latency *latency_data = &data->latency;
+
+        latency_data->processor_index = cpu_index;
+        latency_data->kind = (rtems_profiling_latency_kind) kind;
+        latency_data->rank = (uint32_t) i;
+        latency_data->duration =
+          rtems_counter_ticks_to_nanoseconds(entries[i].duration);
+        latency_data->begin = entries[i].begin;
+        latency_data->end = entries[i].end;
+        latency_data->executing = entries[i].executing;
+        latency_data->name = entries[i].name;
+
+        (*visitor)(visitor_arg, data);
+      }
+    }
+  }
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
 void rtems_profiling_iterate(
   rtems_profiling_visitor visitor,
   void *visitor_arg
@@ -156,4 +306,29 @@ void rtems_profiling_iterate(
 
   per_cpu_stats_iterate(visitor, visitor_arg, &data);
   smp_lock_stats_iterate(visitor, visitor_arg, &data);
+  thread_queue_stats_iterate(visitor, visitor_arg, &data);
+  latency_iterate(visitor, visitor_arg, &data);
+}
+
+void rtems_profiling_reset_latencies(void)
+{
+#ifdef RTEMS_PROFILING
+  _Latency_trace_Reset();
+#endif
+}
+
+void rtems_profiling_reset_thread_queues(void)
+{
+#ifdef RTEMS_PROFILING
+  _Thread_queue_Stats_reset();
+#endif
+}
+
+uint64_t rtems_profiling_get_thread_queue_dropped_wait_count(void)
+{
+#ifdef RTEMS_PROFILING
+  return _Thread_queue_Stats_get_dropped();
+#else
+  return 0;
+#endif
 }
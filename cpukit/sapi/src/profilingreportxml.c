@@ -157,6 +157,41 @@ static void report_per_cpu(context *ctx, const rtems_profiling_per_cpu *per_cpu)
   );
   update_retval(ctx, rv);
 
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxIPILatency unit=\"ns\">%" PRIu32 "</MaxIPILatency>\n",
+    per_cpu->max_ipi_latency
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanIPILatency unit=\"ns\">%" PRIu64 "</MeanIPILatency>\n",
+    arithmetic_mean(
+      per_cpu->total_ipi_latency,
+      per_cpu->ipi_count
+    )
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalIPILatency unit=\"ns\">%" PRIu64 "</TotalIPILatency>\n",
+    per_cpu->total_ipi_latency
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<IPICount>%" PRIu64 "</IPICount>\n",
+    per_cpu->ipi_count
+  );
+  update_retval(ctx, rv);
+
   indent(ctx, 1);
   rv = rtems_printf(
     ctx->printer,
@@ -262,6 +297,188 @@ static void report_smp_lock(context *ctx, const rtems_profiling_smp_lock *smp_lo
   update_retval(ctx, rv);
 }
 
+static void report_thread_queue(
+  context *ctx,
+  const rtems_profiling_thread_queue *thread_queue
+)
+{
+  int rv;
+  uint32_t i;
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<ThreadQueueProfilingReport name=\"%s\" id=\"0x%08" PRIx32
+      "\" address=\"%p\" deleted=\"%s\">\n",
+    thread_queue->name,
+    thread_queue->id,
+    thread_queue->queue,
+    thread_queue->deleted ? "true" : "false"
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxWaitTime unit=\"ns\">%" PRIu64 "</MaxWaitTime>\n",
+    thread_queue->max_wait_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanWaitTime unit=\"ns\">%" PRIu64 "</MeanWaitTime>\n",
+    arithmetic_mean(
+      thread_queue->total_wait_time,
+      thread_queue->wait_count
+    )
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalWaitTime unit=\"ns\">%" PRIu64 "</TotalWaitTime>\n",
+    thread_queue->total_wait_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<WaitCount>%" PRIu64 "</WaitCount>\n",
+    thread_queue->wait_count
+  );
+  update_retval(ctx, rv);
+
+  for (i = 0; i < RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS; ++i) {
+    if (thread_queue->histogram[i] == 0) {
+      continue;
+    }
+
+    indent(ctx, 2);
+    rv = rtems_printf(
+      ctx->printer,
+      "<WaitTimeCount lowerBound=\"%" PRIu32 "\" unit=\"us\">%"
+        PRIu64 "</WaitTimeCount>\n",
+      i > 0 ? UINT32_C(1) << (i - 1) : 0,
+      thread_queue->histogram[i]
+    );
+    update_retval(ctx, rv);
+  }
+
+  for (i = 0; i < RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT; ++i) {
+    const rtems_profiling_thread_queue_owner *owner;
+
+    owner = &thread_queue->owners[i];
+
+    if (owner->wait_count == 0) {
+      continue;
+    }
+
+    indent(ctx, 2);
+    rv = rtems_printf(
+      ctx->printer,
+      "<Owner id=\"0x%08" PRIx32 "\" waitCount=\"%" PRIu64
+        "\" totalWaitTime=\"%" PRIu64 "\" unit=\"ns\"/>\n",
+      owner->id,
+      owner->wait_count,
+      owner->total_wait_time
+    );
+    update_retval(ctx, rv);
+  }
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</ThreadQueueProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
+static const char *latency_kind_name(rtems_profiling_latency_kind kind)
+{
+  switch (kind) {
+    case RTEMS_PROFILING_LATENCY_INTERRUPTS_DISABLED:
+      return "InterruptsDisabled";
+    case RTEMS_PROFILING_LATENCY_THREAD_DISPATCH_DISABLED:
+      return "ThreadDispatchDisabled";
+    case RTEMS_PROFILING_LATENCY_LOCK_HELD:
+      return "LockHeld";
+  }
+
+  return "Unknown";
+}
+
+static void report_latency(
+  context *ctx,
+  const rtems_profiling_latency *latency
+)
+{
+  int rv;
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<LatencyProfilingReport processorIndex=\"%" PRIu32
+      "\" kind=\"%s\" rank=\"%" PRIu32 "\">\n",
+    latency->processor_index,
+    latency_kind_name(latency->kind),
+    latency->rank
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<Duration unit=\"ns\">%" PRIu32 "</Duration>\n",
+    latency->duration
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<Begin>%p</Begin>\n",
+    latency->begin
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<End>%p</End>\n",
+    latency->end
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<Executing>0x%08" PRIx32 "</Executing>\n",
+    latency->executing
+  );
+  update_retval(ctx, rv);
+
+  if (latency->name != NULL) {
+    indent(ctx, 2);
+    rv = rtems_printf(
+      ctx->printer,
+      "<LockName>%s</LockName>\n",
+      latency->name
+    );
+    update_retval(ctx, rv);
+  }
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</LatencyProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
 static void report(void *arg, const rtems_profiling_data *data)
 {
   context *ctx = arg;
@@ -273,6 +490,12 @@ static void report(void *arg, const rtems_profiling_data *data)
     case RTEMS_PROFILING_SMP_LOCK:
       report_smp_lock(ctx, &data->smp_lock);
       break;
+    case RTEMS_PROFILING_THREAD_QUEUE:
+      report_thread_queue(ctx, &data->thread_queue);
+      break;
+    case RTEMS_PROFILING_LATENCY:
+      report_latency(ctx, &data->latency);
+      break;
   }
 }
 
@@ -301,6 +524,14 @@ int rtems_profiling_report_xml(
 
   rtems_profiling_iterate(report, ctx);
 
+  indent(ctx, 1);
+  rv = rtems_printf(
+    printer,
+    "<ThreadQueueDroppedWaitCount>%" PRIu64 "</ThreadQueueDroppedWaitCount>\n",
+    rtems_profiling_get_thread_queue_dropped_wait_count()
+  );
+  update_retval(ctx, rv);
+
   indent(ctx, 0);
   rv = rtems_printf(printer, "</ProfilingReport>\n");
   update_retval(ctx, rv);
@@ -0,0 +1,316 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreLatencyTrace
+ *
+ * @brief This source file contains the implementation of
+ *   _Latency_trace_Get(), _Latency_trace_Interrupt_entry(),
+ *   _Latency_trace_ISR_disable(), _Latency_trace_ISR_enable(),
+ *   _Latency_trace_ISR_set_level(), _Latency_trace_Reset(), and
+ *   _Latency_trace_Update().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/latencytrace.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/thread.h>
+
+#include <string.h>
+
+#if defined(RTEMS_PROFILING)
+
+/*
+ * The functions of this file are called by _ISR_Local_disable() and
+ * _ISR_Local_enable().  They shall use only the _CPU_ISR_Disable() and
+ * _CPU_ISR_Enable() CPU port operations to avoid a recursion.
+ */
+
+typedef struct {
+  /*
+   * The sequence is odd while the table is updated.  Only the owner processor
+   * updates the table with interrupts disabled.  Readers retry if the sequence
+   * changed during the read.
+   */
+  Atomic_Uint sequence;
+
+  unsigned int generation;
+
+  CPU_Counter_ticks minimum;
+
+  Latency_trace_Entry entries[ LATENCY_TRACE_ENTRY_COUNT ];
+} Latency_trace_Table;
+
+typedef struct {
+  bool interrupts_disabled;
+
+  CPU_Counter_ticks interrupts_disabled_instant;
+
+  const void *interrupts_disabled_caller;
+
+  Latency_trace_Table tables[ LATENCY_TRACE_KIND_COUNT ];
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Latency_trace_Per_CPU;
+
+/*
+ * The latency tracer is used before the per-CPU data areas are initialized,
+ * so it cannot use PER_CPU_DATA_ITEM().
+ */
+static Latency_trace_Per_CPU
+_Latency_trace_Per_CPU[ CPU_MAXIMUM_PROCESSORS ];
+
+static Atomic_Uint _Latency_trace_Generation;
+
+static Latency_trace_Per_CPU *_Latency_trace_Get_per_CPU(
+  const Per_CPU_Control *cpu
+)
+{
+  return &_Latency_trace_Per_CPU[ _Per_CPU_Get_index( cpu ) ];
+}
+
+static void _Latency_trace_Insert(
+  const Per_CPU_Control *cpu,
+  Latency_trace_Table   *table,
+  CPU_Counter_ticks      duration,
+  const void            *begin,
+  const void            *end,
+  const char            *name
+)
+{
+  unsigned int          generation;
+  unsigned int          sequence;
+  size_t                i;
+  Latency_trace_Entry  *entry;
+  const Thread_Control *executing;
+
+  generation = _Atomic_Load_uint(
+    &_Latency_trace_Generation,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( duration <= table->minimum && generation == table->generation ) {
+    return;
+  }
+
+  sequence = _Atomic_Load_uint( &table->sequence, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &table->sequence, sequence + 1, ATOMIC_ORDER_RELAXED );
+
+  /* Pairs with the fence in _Latency_trace_Get() */
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+
+  if ( generation != table->generation ) {
+    table->generation = generation;
+    table->minimum = 0;
+    memset( table->entries, 0, sizeof( table->entries ) );
+  }
+
+  if ( duration > table->minimum ) {
+    /* The entries are sorted by decreasing duration, drop the shortest */
+    i = LATENCY_TRACE_ENTRY_COUNT - 1;
+
+    while ( i > 0 && table->entries[ i - 1 ].duration < duration ) {
+      table->entries[ i ] = table->entries[ i - 1 ];
+      --i;
+    }
+
+    entry = &table->entries[ i ];
+    entry->duration = duration;
+    entry->begin = begin;
+    entry->end = end;
+    entry->name = name;
+
+    executing = _Per_CPU_Get_executing( cpu );
+
+    if ( executing != NULL ) {
+      entry->executing = executing->Object.id;
+    } else {
+      entry->executing = 0;
+    }
+
+    table->minimum = table->entries[ LATENCY_TRACE_ENTRY_COUNT - 1 ].duration;
+  }
+
+  _Atomic_Store_uint( &table->sequence, sequence + 2, ATOMIC_ORDER_RELEASE );
+}
+
+void _Latency_trace_Update(
+  Latency_trace_Kind  kind,
+  CPU_Counter_ticks   duration,
+  const void         *begin,
+  const void         *end,
+  const char         *name
+)
+{
+  ISR_Level              level;
+  const Per_CPU_Control *cpu;
+
+  _CPU_ISR_Disable( level );
+  cpu = _Per_CPU_Get_snapshot();
+  _Latency_trace_Insert(
+    cpu,
+    &_Latency_trace_Get_per_CPU( cpu )->tables[ kind ],
+    duration,
+    begin,
+    end,
+    name
+  );
+  _CPU_ISR_Enable( level );
+}
+
+void _Latency_trace_ISR_disable( ISR_Level level )
+{
+  Latency_trace_Per_CPU *per_cpu;
+
+  if ( !_ISR_Is_enabled( level ) ) {
+    return;
+  }
+
+  per_cpu = _Latency_trace_Get_per_CPU( _Per_CPU_Get_snapshot() );
+  per_cpu->interrupts_disabled = true;
+  per_cpu->interrupts_disabled_instant = _CPU_Counter_read();
+  per_cpu->interrupts_disabled_caller = RTEMS_RETURN_ADDRESS();
+}
+
+static void _Latency_trace_ISR_end( const void *end )
+{
+  const Per_CPU_Control *cpu;
+  Latency_trace_Per_CPU *per_cpu;
+  CPU_Counter_ticks      duration;
+
+  cpu = _Per_CPU_Get_snapshot();
+  per_cpu = _Latency_trace_Get_per_CPU( cpu );
+
+  if ( !per_cpu->interrupts_disabled ) {
+    return;
+  }
+
+  per_cpu->interrupts_disabled = false;
+  duration = _CPU_Counter_difference(
+    _CPU_Counter_read(),
+    per_cpu->interrupts_disabled_instant
+  );
+  _Latency_trace_Insert(
+    cpu,
+    &per_cpu->tables[ LATENCY_TRACE_INTERRUPTS_DISABLED ],
+    duration,
+    per_cpu->interrupts_disabled_caller,
+    end,
+    NULL
+  );
+}
+
+void _Latency_trace_ISR_enable( ISR_Level level )
+{
+  if ( _ISR_Is_enabled( level ) ) {
+    _Latency_trace_ISR_end( RTEMS_RETURN_ADDRESS() );
+  }
+}
+
+void _Latency_trace_ISR_set_level( uint32_t new_level )
+{
+  ISR_Level level;
+
+  if ( new_level != 0 ) {
+    return;
+  }
+
+  /* The interrupts may be already enabled, so disable them for the update */
+  _CPU_ISR_Disable( level );
+  _Latency_trace_ISR_end( RTEMS_RETURN_ADDRESS() );
+  _CPU_ISR_Enable( level );
+}
+
+void _Latency_trace_Interrupt_entry( uint32_t cpu_index )
+{
+  _Latency_trace_Per_CPU[ cpu_index ].interrupts_disabled = false;
+}
+
+size_t _Latency_trace_Get(
+  uint32_t             cpu_index,
+  Latency_trace_Kind   kind,
+  Latency_trace_Entry  entries[ LATENCY_TRACE_ENTRY_COUNT ]
+)
+{
+  Latency_trace_Table *table;
+  unsigned int         sequence;
+  bool                 valid;
+  size_t               n;
+
+  if (
+    cpu_index >= CPU_MAXIMUM_PROCESSORS || kind >= LATENCY_TRACE_KIND_COUNT
+  ) {
+    return 0;
+  }
+
+  table = &_Latency_trace_Per_CPU[ cpu_index ].tables[ kind ];
+
+  do {
+    do {
+      sequence = _Atomic_Load_uint( &table->sequence, ATOMIC_ORDER_ACQUIRE );
+    } while ( ( sequence & 1 ) != 0 );
+
+    valid = ( table->generation == _Atomic_Load_uint(
+      &_Latency_trace_Generation,
+      ATOMIC_ORDER_RELAXED
+    ) );
+    memcpy( entries, table->entries, sizeof( table->entries ) );
+
+    /* Pairs with the fence in _Latency_trace_Insert() */
+    _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+  } while (
+    _Atomic_Load_uint( &table->sequence, ATOMIC_ORDER_RELAXED ) != sequence
+  );
+
+  if ( !valid ) {
+    return 0;
+  }
+
+  n = 0;
+
+  while ( n < LATENCY_TRACE_ENTRY_COUNT && entries[ n ].duration != 0 ) {
+    ++n;
+  }
+
+  return n;
+}
+
+void _Latency_trace_Reset( void )
+{
+  /* The tables are cleared by the next update of the owner processor */
+  (void) _Atomic_Fetch_add_uint(
+    &_Latency_trace_Generation,
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+#endif /* RTEMS_PROFILING */
@@ -54,7 +54,10 @@ void _Profiling_Outer_most_interrupt_entry_and_exit(
 
   if ( cpu->thread_dispatch_disable_level == 1 ) {
     stats->thread_dispatch_disabled_instant = interrupt_entry_instant;
+    stats->thread_dispatch_disabled_caller = NULL;
   }
+
+  _Latency_trace_Interrupt_entry( _Per_CPU_Get_index( cpu ) );
 #else
   (void) cpu;
   (void) interrupt_entry_instant;
@@ -329,6 +329,15 @@ void _SMP_Try_to_process_message(
 
 void _SMP_Send_message( Per_CPU_Control *cpu, unsigned long message )
 {
+  /*
+   * Note the request before it is visible, see _Thread_Dispatch_request().
+   * A processor which is not up yet would keep the instant until its first
+   * inter-processor interrupt.
+   */
+  if ( _Per_CPU_Get_state( cpu ) == PER_CPU_STATE_UP ) {
+    _Profiling_Inter_processor_interrupt_request( cpu );
+  }
+
   (void) _Atomic_Fetch_or_ulong(
     &cpu->message, message,
     ATOMIC_ORDER_RELEASE
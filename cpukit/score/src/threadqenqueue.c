@@ -32,6 +32,7 @@
 #include <rtems/score/assert.h>
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/threadimpl.h>
+#include <rtems/score/threadqstats.h>
 #include <rtems/score/status.h>
 #include <rtems/score/watchdogimpl.h>
 
@@ -394,6 +395,9 @@ void _Thread_queue_Enqueue(
   Thread_queue_Deadlock_status deadlock_status;
   Per_CPU_Control             *cpu_self;
   bool                         success;
+#if defined(RTEMS_PROFILING)
+  Thread_queue_Stats_context   stats_context;
+#endif
 
   _Assert( queue_context->enqueue_callout != NULL );
 
@@ -424,6 +428,10 @@ void _Thread_queue_Enqueue(
 
   _Thread_queue_Path_release( queue_context );
 
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_wait_begin( &stats_context, queue, the_thread );
+#endif
+
   the_thread->Wait.return_code = STATUS_SUCCESSFUL;
   _Thread_Wait_flags_set( the_thread, THREAD_QUEUE_INTEND_TO_BLOCK );
   cpu_self = _Thread_queue_Dispatch_disable( queue_context );
@@ -461,6 +469,10 @@ void _Thread_queue_Enqueue(
 
   _Thread_Priority_update( queue_context );
   _Thread_Dispatch_direct( cpu_self );
+
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_wait_end( &stats_context );
+#endif
 }
 
 #if defined(RTEMS_SMP)
@@ -473,6 +485,9 @@ Status_Control _Thread_queue_Enqueue_sticky(
 {
   Thread_queue_Deadlock_status deadlock_status;
   Per_CPU_Control             *cpu_self;
+#if defined(RTEMS_PROFILING)
+  Thread_queue_Stats_context   stats_context;
+#endif
 
   _Assert( queue_context->enqueue_callout != NULL );
 
@@ -496,6 +511,10 @@ Status_Control _Thread_queue_Enqueue_sticky(
 
   _Thread_queue_Path_release( queue_context );
 
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_wait_begin( &stats_context, queue, the_thread );
+#endif
+
   the_thread->Wait.return_code = STATUS_SUCCESSFUL;
   _Thread_Wait_flags_set( the_thread, THREAD_QUEUE_INTEND_TO_BLOCK );
   cpu_self = _Thread_queue_Dispatch_disable( queue_context );
@@ -524,6 +543,10 @@ Status_Control _Thread_queue_Enqueue_sticky(
     /* Wait */
   }
 
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_wait_end( &stats_context );
+#endif
+
   _Thread_Wait_tranquilize( the_thread );
   _Thread_Timer_remove( the_thread );
   return _Thread_Wait_get_status( the_thread );
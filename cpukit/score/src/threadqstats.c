@@ -0,0 +1,641 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _Thread_queue_Stats_get(), _Thread_queue_Stats_get_count(),
+ *   _Thread_queue_Stats_get_dropped(), _Thread_queue_Stats_reset(),
+ *   _Thread_queue_Stats_wait_begin(), and _Thread_queue_Stats_wait_end().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqstats.h>
+#include <rtems/score/threadqimpl.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/smp.h>
+#include <rtems/counter.h>
+
+#include <string.h>
+
+#if defined(RTEMS_PROFILING)
+
+/*
+ * The count of table entries probed for a thread queue.  The probe count
+ * bounds the search with interrupts disabled.
+ */
+#define THREAD_QUEUE_STATS_PROBE_COUNT 4
+
+typedef struct {
+  Thread_queue_Stats Stats;
+
+  /*
+   * The entry is unused if the generation is not the current statistics
+   * generation.  This makes a reset of all tables a single atomic increment.
+   */
+  unsigned int generation;
+
+  /*
+   * The name of a thread queue not associated with an object.
+   */
+  const char *name;
+
+  /*
+   * The object name at the last wait, used to report the name of a deleted
+   * object.
+   */
+  Objects_Name object_name;
+} Thread_queue_Stats_entry;
+
+typedef struct {
+  /*
+   * The sequence is odd while the table is updated.  Only the owner processor
+   * updates the table with interrupts disabled.  Readers retry if the sequence
+   * changed during the read.
+   */
+  Atomic_Uint sequence;
+
+  unsigned int generation;
+
+  uint64_t dropped;
+
+  Thread_queue_Stats_entry entries[ THREAD_QUEUE_STATS_MAXIMUM ];
+} Thread_queue_Stats_per_CPU;
+
+static PER_CPU_DATA_ITEM(
+  Thread_queue_Stats_per_CPU,
+  _Thread_queue_Stats_per_CPU
+);
+
+static Atomic_Uint _Thread_queue_Stats_generation;
+
+static Thread_queue_Stats_per_CPU *_Thread_queue_Stats_get_per_CPU(
+  const Per_CPU_Control *cpu
+)
+{
+  Thread_queue_Stats_per_CPU *per_cpu;
+
+  per_cpu = PER_CPU_DATA_GET(
+    cpu,
+    Thread_queue_Stats_per_CPU,
+    _Thread_queue_Stats_per_CPU
+  );
+
+  return per_cpu;
+}
+
+static unsigned int _Thread_queue_Stats_get_generation( void )
+{
+  return _Atomic_Load_uint(
+    &_Thread_queue_Stats_generation,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+static size_t _Thread_queue_Stats_home( const Thread_queue_Queue *queue )
+{
+  return (size_t) ( (uintptr_t) queue >> 3 ) % THREAD_QUEUE_STATS_MAXIMUM;
+}
+
+void _Thread_queue_Stats_wait_begin(
+  Thread_queue_Stats_context *stats_context,
+  const Thread_queue_Queue   *queue,
+  const Thread_Control       *the_thread
+)
+{
+  const Thread_Control *owner;
+  const char           *name;
+
+  if ( the_thread != _Thread_Executing ) {
+    stats_context->queue = NULL;
+    return;
+  }
+
+  stats_context->queue = queue;
+  name = queue->name;
+
+  /*
+   * The object is alive during the enqueue, so its name is available without
+   * an object lookup.  The name is only converted to a string by the reader.
+   */
+  if ( name == _Thread_queue_Object_name ) {
+    const Objects_Control *the_object;
+
+    the_object = &THREAD_QUEUE_QUEUE_TO_OBJECT( queue )->Object;
+    stats_context->id = the_object->id;
+    stats_context->object_name = the_object->name;
+  } else {
+    if ( name == NULL ) {
+      name = _Thread_queue_Object_name;
+    }
+
+    stats_context->id = 0;
+  }
+
+  stats_context->name = name;
+
+  owner = queue->owner;
+
+  if ( owner != NULL ) {
+    stats_context->owner = owner->Object.id;
+  } else {
+    stats_context->owner = 0;
+  }
+
+  stats_context->generation = _Thread_queue_Stats_get_generation();
+  stats_context->first = _CPU_Counter_read();
+}
+
+static bool _Thread_queue_Stats_is_used(
+  const Thread_queue_Stats_entry *entry,
+  unsigned int                    generation
+)
+{
+  return entry->generation == generation && entry->Stats.queue != NULL;
+}
+
+static bool _Thread_queue_Stats_is_equal(
+  const Thread_queue_Stats_entry *entry,
+  const Thread_queue_Queue       *queue,
+  Objects_Id                      id
+)
+{
+  return entry->Stats.queue == queue && entry->Stats.id == id;
+}
+
+static Thread_queue_Stats_entry *_Thread_queue_Stats_allocate(
+  Thread_queue_Stats_entry         *entry,
+  const Thread_queue_Stats_context *stats_context,
+  unsigned int                      generation
+)
+{
+  memset( entry, 0, sizeof( *entry ) );
+  entry->Stats.queue = stats_context->queue;
+  entry->Stats.id = stats_context->id;
+  entry->generation = generation;
+  entry->name = stats_context->name;
+  return entry;
+}
+
+static Thread_queue_Stats_entry *_Thread_queue_Stats_find(
+  Thread_queue_Stats_per_CPU       *per_cpu,
+  const Thread_queue_Stats_context *stats_context,
+  unsigned int                      generation
+)
+{
+  Thread_queue_Stats_entry *victim;
+  size_t                    index;
+  size_t                    i;
+
+  /*
+   * Open addressing with a bounded linear probe.  If no probed entry is free
+   * or belongs to the thread queue, then the probed entry with the least
+   * waits is evicted and its waits are accounted as dropped.
+   */
+  victim = NULL;
+  index = _Thread_queue_Stats_home( stats_context->queue );
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_PROBE_COUNT; ++i ) {
+    Thread_queue_Stats_entry *entry;
+
+    entry = &per_cpu->entries[ index ];
+
+    if ( !_Thread_queue_Stats_is_used( entry, generation ) ) {
+      return _Thread_queue_Stats_allocate( entry, stats_context, generation );
+    }
+
+    if (
+      _Thread_queue_Stats_is_equal(
+        entry,
+        stats_context->queue,
+        stats_context->id
+      )
+    ) {
+      return entry;
+    }
+
+    if (
+      victim == NULL || entry->Stats.wait_count < victim->Stats.wait_count
+    ) {
+      victim = entry;
+    }
+
+    index = ( index + 1 ) % THREAD_QUEUE_STATS_MAXIMUM;
+  }
+
+  per_cpu->dropped += victim->Stats.wait_count;
+  return _Thread_queue_Stats_allocate( victim, stats_context, generation );
+}
+
+static size_t _Thread_queue_Stats_histogram_index( uint64_t wait_time )
+{
+  uint64_t microseconds;
+  size_t   index;
+
+  microseconds = wait_time / 1000;
+  index = 0;
+
+  while (
+    microseconds != 0 && index < THREAD_QUEUE_STATS_HISTOGRAM_COUNTS - 1
+  ) {
+    microseconds >>= 1;
+    ++index;
+  }
+
+  return index;
+}
+
+static void _Thread_queue_Stats_add_owner(
+  Thread_queue_Stats *stats,
+  Objects_Id          id,
+  uint64_t            wait_count,
+  uint64_t            wait_time
+)
+{
+  Thread_queue_Stats_owner *owner;
+  size_t                    i;
+
+  owner = &stats->owners[ 0 ];
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_OWNER_COUNT; ++i ) {
+    Thread_queue_Stats_owner *other;
+
+    other = &stats->owners[ i ];
+
+    if ( other->id == id && other->wait_count > 0 ) {
+      owner = other;
+      break;
+    }
+
+    if ( other->wait_count < owner->wait_count ) {
+      owner = other;
+    }
+  }
+
+  /* The replaced owner hands its counts over, see space-saving algorithm */
+  owner->id = id;
+  owner->wait_count += wait_count;
+  owner->total_wait_time += wait_time;
+}
+
+void _Thread_queue_Stats_wait_end( Thread_queue_Stats_context *stats_context )
+{
+  CPU_Counter_ticks           last;
+  uint64_t                    wait_time;
+  unsigned int                generation;
+  unsigned int                sequence;
+  ISR_Level                   level;
+  Thread_queue_Stats_per_CPU *per_cpu;
+  Thread_queue_Stats_entry   *entry;
+  Thread_queue_Stats         *stats;
+
+  if ( stats_context->queue == NULL ) {
+    return;
+  }
+
+  last = _CPU_Counter_read();
+  wait_time = rtems_counter_ticks_to_nanoseconds(
+    _CPU_Counter_difference( last, stats_context->first )
+  );
+
+  generation = _Thread_queue_Stats_get_generation();
+
+  if ( stats_context->generation != generation ) {
+    return;
+  }
+
+  _ISR_Local_disable( level );
+  per_cpu = _Thread_queue_Stats_get_per_CPU( _Per_CPU_Get() );
+
+  sequence = _Atomic_Load_uint( &per_cpu->sequence, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &per_cpu->sequence, sequence + 1, ATOMIC_ORDER_RELAXED );
+
+  /* Pairs with the fence in _Thread_queue_Stats_read() */
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+
+  if ( per_cpu->generation != generation ) {
+    per_cpu->generation = generation;
+    per_cpu->dropped = 0;
+  }
+
+  entry = _Thread_queue_Stats_find( per_cpu, stats_context, generation );
+
+  if ( stats_context->id != 0 ) {
+    entry->object_name = stats_context->object_name;
+  }
+
+  stats = &entry->Stats;
+  ++stats->wait_count;
+  stats->total_wait_time += wait_time;
+
+  if ( wait_time > stats->max_wait_time ) {
+    stats->max_wait_time = wait_time;
+  }
+
+  ++stats->histogram[ _Thread_queue_Stats_histogram_index( wait_time ) ];
+  _Thread_queue_Stats_add_owner( stats, stats_context->owner, 1, wait_time );
+
+  _Atomic_Store_uint( &per_cpu->sequence, sequence + 2, ATOMIC_ORDER_RELEASE );
+  _ISR_Local_enable( level );
+}
+
+static void _Thread_queue_Stats_read(
+  const Thread_queue_Stats_per_CPU *per_cpu,
+  size_t                            index,
+  Thread_queue_Stats_entry         *entry
+)
+{
+  unsigned int sequence;
+
+  do {
+    do {
+      sequence = _Atomic_Load_uint( &per_cpu->sequence, ATOMIC_ORDER_ACQUIRE );
+    } while ( ( sequence & 1 ) != 0 );
+
+    *entry = per_cpu->entries[ index ];
+
+    /* Pairs with the fence in _Thread_queue_Stats_wait_end() */
+    _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+  } while (
+    _Atomic_Load_uint( &per_cpu->sequence, ATOMIC_ORDER_RELAXED ) != sequence
+  );
+}
+
+static bool _Thread_queue_Stats_lookup(
+  const Thread_queue_Stats_per_CPU *per_cpu,
+  const Thread_queue_Queue         *queue,
+  Objects_Id                        id,
+  unsigned int                      generation,
+  Thread_queue_Stats_entry         *entry
+)
+{
+  size_t index;
+  size_t i;
+
+  index = _Thread_queue_Stats_home( queue );
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_PROBE_COUNT; ++i ) {
+    _Thread_queue_Stats_read( per_cpu, index, entry );
+
+    if (
+      _Thread_queue_Stats_is_used( entry, generation ) &&
+      _Thread_queue_Stats_is_equal( entry, queue, id )
+    ) {
+      return true;
+    }
+
+    index = ( index + 1 ) % THREAD_QUEUE_STATS_MAXIMUM;
+  }
+
+  return false;
+}
+
+static void _Thread_queue_Stats_merge(
+  Thread_queue_Stats       *snapshot,
+  const Thread_queue_Stats *stats
+)
+{
+  size_t i;
+
+  snapshot->wait_count += stats->wait_count;
+  snapshot->total_wait_time += stats->total_wait_time;
+
+  if ( stats->max_wait_time > snapshot->max_wait_time ) {
+    snapshot->max_wait_time = stats->max_wait_time;
+  }
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_HISTOGRAM_COUNTS; ++i ) {
+    snapshot->histogram[ i ] += stats->histogram[ i ];
+  }
+
+  for ( i = 0; i < THREAD_QUEUE_STATS_OWNER_COUNT; ++i ) {
+    const Thread_queue_Stats_owner *owner;
+
+    owner = &stats->owners[ i ];
+
+    if ( owner->wait_count > 0 ) {
+      _Thread_queue_Stats_add_owner(
+        snapshot,
+        owner->id,
+        owner->wait_count,
+        owner->total_wait_time
+      );
+    }
+  }
+}
+
+static void _Thread_queue_Stats_get_name(
+  Thread_queue_Stats             *snapshot,
+  const Thread_queue_Stats_entry *entry
+)
+{
+  const Objects_Information *information;
+  const Objects_Control     *the_object;
+
+  snapshot->name[ 0 ] = '\0';
+  snapshot->deleted = false;
+
+  if ( snapshot->id == 0 ) {
+    (void) strlcpy( snapshot->name, entry->name, sizeof( snapshot->name ) );
+    return;
+  }
+
+  information = _Objects_Get_information_id( snapshot->id );
+
+  if ( information == NULL ) {
+    snapshot->deleted = true;
+    return;
+  }
+
+  /*
+   * The thread queue is not dereferenced here, since the object may be
+   * already deleted.
+   */
+  _Objects_Allocator_lock();
+  the_object = _Objects_Get_no_protection( snapshot->id, information );
+
+  if (
+    the_object == &THREAD_QUEUE_QUEUE_TO_OBJECT( snapshot->queue )->Object
+  ) {
+    (void) _Objects_Name_to_string(
+      the_object->name,
+      _Objects_Has_string_name( information ),
+      snapshot->name,
+      sizeof( snapshot->name )
+    );
+  } else {
+    snapshot->deleted = true;
+
+    /* The string name of a deleted object is already freed */
+    if ( !_Objects_Has_string_name( information ) ) {
+      (void) _Objects_Name_to_string(
+        entry->object_name,
+        false,
+        snapshot->name,
+        sizeof( snapshot->name )
+      );
+    }
+  }
+
+  _Objects_Allocator_unlock();
+}
+
+size_t _Thread_queue_Stats_get_count( void )
+{
+  return THREAD_QUEUE_STATS_MAXIMUM * _SMP_Get_processor_maximum();
+}
+
+bool _Thread_queue_Stats_get( size_t index, Thread_queue_Stats *snapshot )
+{
+  Thread_queue_Stats_entry entry;
+  Thread_queue_Stats_entry other;
+  unsigned int             generation;
+  uint32_t                 cpu_max;
+  uint32_t                 cpu_index;
+  uint32_t                 cpu_other;
+
+  cpu_max = _SMP_Get_processor_maximum();
+  cpu_index = (uint32_t) ( index / THREAD_QUEUE_STATS_MAXIMUM );
+
+  if ( cpu_index >= cpu_max ) {
+    return false;
+  }
+
+  generation = _Thread_queue_Stats_get_generation();
+  _Thread_queue_Stats_read(
+    _Thread_queue_Stats_get_per_CPU( _Per_CPU_Get_by_index( cpu_index ) ),
+    index % THREAD_QUEUE_STATS_MAXIMUM,
+    &entry
+  );
+
+  if ( !_Thread_queue_Stats_is_used( &entry, generation ) ) {
+    return false;
+  }
+
+  /*
+   * The statistics of a thread queue are aggregated over all processors and
+   * reported with the entry of the first processor which has one.
+   */
+  for ( cpu_other = 0; cpu_other < cpu_index; ++cpu_other ) {
+    if (
+      _Thread_queue_Stats_lookup(
+        _Thread_queue_Stats_get_per_CPU( _Per_CPU_Get_by_index( cpu_other ) ),
+        entry.Stats.queue,
+        entry.Stats.id,
+        generation,
+        &other
+      )
+    ) {
+      return false;
+    }
+  }
+
+  *snapshot = entry.Stats;
+
+  for ( cpu_other = cpu_index + 1; cpu_other < cpu_max; ++cpu_other ) {
+    if (
+      _Thread_queue_Stats_lookup(
+        _Thread_queue_Stats_get_per_CPU( _Per_CPU_Get_by_index( cpu_other ) ),
+        entry.Stats.queue,
+        entry.Stats.id,
+        generation,
+        &other
+      )
+    ) {
+      _Thread_queue_Stats_merge( snapshot, &other.Stats );
+    }
+  }
+
+  _Thread_queue_Stats_get_name( snapshot, &entry );
+  return true;
+}
+
+uint64_t _Thread_queue_Stats_get_dropped( void )
+{
+  unsigned int generation;
+  uint64_t     dropped;
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+
+  generation = _Thread_queue_Stats_get_generation();
+  cpu_max = _SMP_Get_processor_maximum();
+  dropped = 0;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    const Thread_queue_Stats_per_CPU *per_cpu;
+    unsigned int                      sequence;
+    unsigned int                      per_cpu_generation;
+    uint64_t                          per_cpu_dropped;
+
+    per_cpu = _Thread_queue_Stats_get_per_CPU(
+      _Per_CPU_Get_by_index( cpu_index )
+    );
+
+    do {
+      do {
+        sequence = _Atomic_Load_uint(
+          &per_cpu->sequence,
+          ATOMIC_ORDER_ACQUIRE
+        );
+      } while ( ( sequence & 1 ) != 0 );
+
+      per_cpu_generation = per_cpu->generation;
+      per_cpu_dropped = per_cpu->dropped;
+
+      /* Pairs with the fence in _Thread_queue_Stats_wait_end() */
+      _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+    } while (
+      _Atomic_Load_uint( &per_cpu->sequence, ATOMIC_ORDER_RELAXED )
+        != sequence
+    );
+
+    if ( per_cpu_generation == generation ) {
+      dropped += per_cpu_dropped;
+    }
+  }
+
+  return dropped;
+}
+
+void _Thread_queue_Stats_reset( void )
+{
+  /* The tables are cleared lazily by their owner processors */
+  (void) _Atomic_Fetch_add_uint(
+    &_Thread_queue_Stats_generation,
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+#endif /* RTEMS_PROFILING */
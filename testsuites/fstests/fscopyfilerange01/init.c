@@ -0,0 +1,348 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSCOPYFILERANGE 1";
+
+#define FILE_SIZE 10000
+
+static unsigned char pattern[FILE_SIZE];
+
+static unsigned char buffer[FILE_SIZE];
+
+static const rtems_rfs_format_config rfs_config;
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static void create_source(void)
+{
+  ssize_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  for (i = 0; i < sizeof(pattern); ++i) {
+    pattern[i] = (unsigned char) (i * 7 + i / 251);
+  }
+
+  fd = open("src", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, pattern, sizeof(pattern));
+  rtems_test_assert(n == (ssize_t) sizeof(pattern));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_file(const char *path, off_t offset, size_t size)
+{
+  struct stat st;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  rv = stat(path, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == (off_t) size);
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, buffer, sizeof(buffer));
+  rtems_test_assert(n == (ssize_t) size);
+  rtems_test_assert(memcmp(buffer, &pattern[offset], size) == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_file_offsets(void)
+{
+  ssize_t n;
+  off_t off;
+  int in;
+  int out;
+  int rv;
+
+  in = open("src", O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open("dst", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(out >= 0);
+
+  n = rtems_copy_file_range(in, NULL, out, NULL, 1234);
+  rtems_test_assert(n == 1234);
+  rtems_test_assert(lseek(in, 0, SEEK_CUR) == 1234);
+  rtems_test_assert(lseek(out, 0, SEEK_CUR) == 1234);
+
+  n = rtems_copy_file_range(in, NULL, out, NULL, 2 * FILE_SIZE);
+  rtems_test_assert(n == FILE_SIZE - 1234);
+  rtems_test_assert(lseek(in, 0, SEEK_CUR) == FILE_SIZE);
+  rtems_test_assert(lseek(out, 0, SEEK_CUR) == FILE_SIZE);
+
+  /* End of file */
+  n = rtems_copy_file_range(in, NULL, out, NULL, 1);
+  rtems_test_assert(n == 0);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+
+  check_file("dst", 0, FILE_SIZE);
+
+  in = open("src", O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open("dst", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(out >= 0);
+
+  /* The sendfile variant uses the file offset of the output file */
+  off = 0;
+  n = rtems_sendfile(out, in, &off, 5000);
+  rtems_test_assert(n == 5000);
+  rtems_test_assert(off == 5000);
+  rtems_test_assert(lseek(in, 0, SEEK_CUR) == 0);
+  rtems_test_assert(lseek(out, 0, SEEK_CUR) == 5000);
+
+  n = rtems_sendfile(out, in, &off, FILE_SIZE);
+  rtems_test_assert(n == FILE_SIZE - 5000);
+  rtems_test_assert(off == FILE_SIZE);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+
+  check_file("dst", 0, FILE_SIZE);
+}
+
+static void test_explicit_offsets(void)
+{
+  ssize_t n;
+  off_t off_in;
+  off_t off_out;
+  int in;
+  int out;
+  int rv;
+
+  in = open("src", O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open("dst", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(out >= 0);
+
+  rtems_test_assert(lseek(in, 17, SEEK_SET) == 17);
+  rtems_test_assert(lseek(out, 19, SEEK_SET) == 19);
+
+  off_in = 100;
+  off_out = 0;
+  n = rtems_copy_file_range(in, &off_in, out, &off_out, 3000);
+  rtems_test_assert(n == 3000);
+  rtems_test_assert(off_in == 3100);
+  rtems_test_assert(off_out == 3000);
+
+  n = rtems_copy_file_range(in, &off_in, out, &off_out, FILE_SIZE);
+  rtems_test_assert(n == FILE_SIZE - 3100);
+  rtems_test_assert(off_in == FILE_SIZE);
+  rtems_test_assert(off_out == FILE_SIZE - 100);
+
+  /* The file offsets are not changed */
+  rtems_test_assert(lseek(in, 0, SEEK_CUR) == 17);
+  rtems_test_assert(lseek(out, 0, SEEK_CUR) == 19);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+
+  check_file("dst", 100, FILE_SIZE - 100);
+}
+
+static void test_errors(void)
+{
+  ssize_t n;
+  off_t off;
+  int dir;
+  int in;
+  int out;
+  int rv;
+
+  in = open("src", O_RDONLY);
+  rtems_test_assert(in >= 0);
+
+  out = open("dst", O_WRONLY | O_APPEND);
+  rtems_test_assert(out >= 0);
+
+  errno = 0;
+  n = rtems_copy_file_range(in, NULL, in, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  n = rtems_copy_file_range(out, NULL, out, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  n = rtems_copy_file_range(-1, NULL, out, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  off = -1;
+  errno = 0;
+  n = rtems_copy_file_range(in, &off, out, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* Explicit output offsets are not allowed for files in append mode */
+  off = 0;
+  errno = 0;
+  n = rtems_copy_file_range(in, NULL, out, &off, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  /* Explicit offsets are only allowed for regular files */
+  dir = open(".", O_RDONLY);
+  rtems_test_assert(dir >= 0);
+
+  off = 0;
+  errno = 0;
+  n = rtems_copy_file_range(dir, &off, out, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == ESPIPE);
+
+  rv = close(dir);
+  rtems_test_assert(rv == 0);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  out = open("src", O_RDWR);
+  rtems_test_assert(out >= 0);
+
+  errno = 0;
+  n = rtems_copy_file_range(out, NULL, out, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  rv = close(out);
+  rtems_test_assert(rv == 0);
+
+  rv = close(in);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_rfs(void)
+{
+  int rv;
+
+  rv = mkdir(mnt, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(rda, mnt, RTEMS_FILESYSTEM_TYPE_RFS, RTEMS_FILESYSTEM_READ_WRITE,
+    NULL);
+  rtems_test_assert(rv == 0);
+
+  /* Copies within one RFS instance use the block buffers of both files */
+  rv = chdir(mnt);
+  rtems_test_assert(rv == 0);
+
+  create_source();
+  test_file_offsets();
+  test_explicit_offsets();
+
+  rv = chdir("/");
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  create_source();
+  test_file_offsets();
+  test_explicit_offsets();
+  test_errors();
+  test_rfs();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration[] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,218 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSCONFIG 4";
+
+#define NODE_COUNT 500
+
+static void make_name(char *name, size_t size, const char *prefix, int i)
+{
+  int n;
+
+  n = snprintf(name, size, "%s%i", prefix, i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static bool exists(const char *name)
+{
+  struct stat st;
+  int rv;
+
+  rv = stat(name, &st);
+  if (rv != 0) {
+    rtems_test_assert(errno == ENOENT);
+  }
+
+  return rv == 0;
+}
+
+static bool is_removed(int i)
+{
+  return (i % 3) == 1;
+}
+
+static bool is_renamed(int i)
+{
+  return (i % 7) == 2 && !is_removed(i);
+}
+
+static void test_lookup(void)
+{
+  char name[32];
+  int i;
+
+  for (i = 0; i < NODE_COUNT; ++i) {
+    make_name(name, sizeof(name), "node", i);
+    rtems_test_assert(
+      exists(name) == (!is_removed(i) && !is_renamed(i))
+    );
+
+    make_name(name, sizeof(name), "new", i);
+    rtems_test_assert(exists(name) == is_renamed(i));
+  }
+}
+
+static void test_readdir_order(void)
+{
+  char name[32];
+  DIR *dir;
+  struct dirent *d;
+  int i;
+  int rv;
+
+  dir = opendir(".");
+  rtems_test_assert(dir != NULL);
+
+  /* The order is the order of creation, renamed nodes are at the end */
+  i = 0;
+
+  while ((d = readdir(dir)) != NULL) {
+    while (i < NODE_COUNT && (is_removed(i) || is_renamed(i))) {
+      ++i;
+    }
+
+    if (i < NODE_COUNT) {
+      make_name(name, sizeof(name), "node", i);
+      rtems_test_assert(strcmp(d->d_name, name) == 0);
+      ++i;
+    } else {
+      break;
+    }
+  }
+
+  rtems_test_assert(i == NODE_COUNT);
+
+  for (i = 0; i < NODE_COUNT; ++i) {
+    if (is_renamed(i)) {
+      rtems_test_assert(d != NULL);
+      make_name(name, sizeof(name), "new", i);
+      rtems_test_assert(strcmp(d->d_name, name) == 0);
+      d = readdir(dir);
+    }
+  }
+
+  rtems_test_assert(d == NULL);
+
+  rv = closedir(dir);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  char name[32];
+  char new_name[32];
+  int rv;
+  int i;
+
+  TEST_BEGIN();
+
+  rv = mkdir("dir", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = chdir("dir");
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < NODE_COUNT; ++i) {
+    make_name(name, sizeof(name), "node", i);
+    rv = mknod(name, S_IFCHR | S_IRWXU, 0);
+    rtems_test_assert(rv == 0);
+  }
+
+  errno = 0;
+  rv = mknod("node0", S_IFCHR | S_IRWXU, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EEXIST);
+
+  for (i = NODE_COUNT - 1; i >= 0; --i) {
+    if (is_removed(i)) {
+      make_name(name, sizeof(name), "node", i);
+      rv = unlink(name);
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  for (i = 0; i < NODE_COUNT; ++i) {
+    if (is_renamed(i)) {
+      make_name(name, sizeof(name), "node", i);
+      make_name(new_name, sizeof(new_name), "new", i);
+      rv = rename(name, new_name);
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  test_lookup();
+  test_readdir_order();
+
+  for (i = 0; i < NODE_COUNT; ++i) {
+    if (!is_removed(i)) {
+      make_name(name, sizeof(name), is_renamed(i) ? "new" : "node", i);
+      rv = unlink(name);
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  rv = chdir("..");
+  rtems_test_assert(rv == 0);
+
+  rv = rmdir("dir");
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_IMFS_ENABLE_HASHED_DIRECTORIES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,208 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSCONFIG 5";
+
+#define CHUNK_SIZE 1000
+
+#define CHUNK_COUNT 10
+
+#define FILE_SIZE (CHUNK_SIZE * CHUNK_COUNT)
+
+static unsigned char buf[FILE_SIZE];
+
+static unsigned char pattern(size_t i)
+{
+  return (unsigned char) (i * 7 + 3);
+}
+
+static void check_pattern(const unsigned char *data, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    rtems_test_assert(data[i] == pattern(i));
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  const char *file = "file";
+  struct stat st;
+  unsigned char *p;
+  ssize_t n;
+  off_t off;
+  size_t i;
+  int rv;
+  int fd;
+
+  TEST_BEGIN();
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    buf[i] = pattern(i);
+  }
+
+  fd = open(file, O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    n = write(fd, &buf[i * CHUNK_SIZE], CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == FILE_SIZE);
+
+  /* The shared mapping provides a direct pointer to the file data */
+  p = mmap(NULL, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  rtems_test_assert(p != MAP_FAILED);
+  check_pattern(p, FILE_SIZE);
+
+  p[0] = 0xff;
+  off = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(off == 0);
+  n = read(fd, buf, 1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(buf[0] == 0xff);
+  p[0] = pattern(0);
+
+  /* Growing a mapped file must not move the mapped data */
+  off = lseek(fd, 0, SEEK_END);
+  rtems_test_assert(off == FILE_SIZE);
+
+  for (i = 0; i < 4 * CHUNK_COUNT; ++i) {
+    memset(buf, 0xaa, CHUNK_SIZE);
+    n = write(fd, buf, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  check_pattern(p, FILE_SIZE);
+
+  rv = munmap(p, FILE_SIZE);
+  rtems_test_assert(rv == 0);
+
+  /* Shrinking and extending the file yields zeros in the extended area */
+  rv = ftruncate(fd, CHUNK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  rv = ftruncate(fd, 2 * CHUNK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  off = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(off == 0);
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == 2 * CHUNK_SIZE);
+  check_pattern(buf, CHUNK_SIZE);
+
+  for (i = CHUNK_SIZE; i < 2 * CHUNK_SIZE; ++i) {
+    rtems_test_assert(buf[i] == 0);
+  }
+
+  /* A write behind the end of file fills the gap with zeros */
+  off = lseek(fd, 3 * CHUNK_SIZE, SEEK_SET);
+  rtems_test_assert(off == 3 * CHUNK_SIZE);
+  n = write(fd, "x", 1);
+  rtems_test_assert(n == 1);
+
+  off = lseek(fd, 2 * CHUNK_SIZE, SEEK_SET);
+  rtems_test_assert(off == 2 * CHUNK_SIZE);
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == CHUNK_SIZE + 1);
+
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    rtems_test_assert(buf[i] == 0);
+  }
+
+  rtems_test_assert(buf[CHUNK_SIZE] == 'x');
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(file);
+  rtems_test_assert(rv == 0);
+
+  /* A shared mapping keeps the file data after close() and unlink() */
+  for (i = 0; i < FILE_SIZE; ++i) {
+    buf[i] = pattern(i);
+  }
+
+  fd = open(file, O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, buf, FILE_SIZE);
+  rtems_test_assert(n == FILE_SIZE);
+
+  p = mmap(NULL, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  rtems_test_assert(p != MAP_FAILED);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(file);
+  rtems_test_assert(rv == 0);
+
+  check_pattern(p, FILE_SIZE);
+
+  rv = munmap(p, FILE_SIZE);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
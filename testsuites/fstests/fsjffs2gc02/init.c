@@ -0,0 +1,279 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2GC 2";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (8UL * BLOCK_SIZE)
+
+#define FLASH_BLOCKS (FLASH_SIZE / BLOCK_SIZE)
+
+#define MOUNT_POINT "/jffs2"
+
+#define BIG_FILE MOUNT_POINT "/big"
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  uint32_t erase_count;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  memcpy(buffer, &self->area[offset], size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  ++self->erase_count;
+  memset(&self->area[offset], 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_gc_task_config gc_task_config = {
+  .priority = 2,
+  .stack_size = 2 * RTEMS_MINIMUM_STACK_SIZE,
+  .free_blocks_watermark = FLASH_BLOCKS,
+  .passes_per_slice = 1,
+  .slice_interval = 1,
+  .idle_interval = 0
+};
+
+static const rtems_jffs2_mount_data mount_data = {
+  .flash_control = &flash_instance.super,
+  .gc_task = &gc_task_config
+};
+
+static const mode_t mode = S_IRWXU | S_IRWXG | S_IRWXO;
+
+static char keg[523];
+
+static void init_keg(void)
+{
+  size_t i;
+  uint32_t v;
+
+  v = 123;
+  for (i = 0; i < sizeof(keg); ++i) {
+    v = v * 1664525 + 1013904223;
+    keg[i] = (char) (v >> 23);
+  }
+}
+
+static void create_big_file(void)
+{
+  int fd;
+  int rv;
+  int i;
+
+  fd = open(BIG_FILE, O_WRONLY | O_TRUNC | O_CREAT, mode);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < 37; ++i) {
+    ssize_t n;
+
+    n = write(fd, &keg[0], sizeof(keg));
+    rtems_test_assert(n == (ssize_t) sizeof(keg));
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_info(rtems_jffs2_info *info)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_POINT, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_jffs2_info info;
+  rtems_status_code sc;
+  uint32_t erase_count;
+  int rv;
+
+  TEST_BEGIN();
+
+  init_keg();
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  /*
+   * Ensure that jiffies != 0, to use most likely path in
+   * jffs2_mark_node_obsolete().
+   */
+  while (rtems_clock_get_ticks_since_boot() == 0) {
+    /* Wait */
+  }
+
+  rv = mkdir(MOUNT_POINT, mode);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  /*
+   * The garbage collection task has a lower priority than the Init task, so
+   * it cannot run while we create and remove the file.
+   */
+  create_big_file();
+  erase_count = flash_instance.erase_count;
+
+  rv = unlink(BIG_FILE);
+  rtems_test_assert(rv == 0);
+
+  get_info(&info);
+  rtems_test_assert(info.erasable_blocks == 1);
+  rtems_test_assert(info.dirty_size >= BLOCK_SIZE);
+  rtems_test_assert(flash_instance.erase_count == erase_count);
+
+  /* Now let the garbage collection task do its work */
+  sc = rtems_task_wake_after(10);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  get_info(&info);
+  rtems_test_assert(info.erasable_blocks == 0);
+  rtems_test_assert(info.dirty_size < BLOCK_SIZE);
+  rtems_test_assert(flash_instance.erase_count > erase_count);
+
+  /* Ensure that the file system is still usable */
+  create_big_file();
+  rv = unlink(BIG_FILE);
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_task_wake_after(10);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  get_info(&info);
+  rtems_test_assert(info.erasable_blocks == 0);
+
+  /* The unmount stops the garbage collection task */
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,515 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2LZ4 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (16UL * BLOCK_SIZE)
+
+#define MOUNT_POINT "/jffs2"
+
+#define TEXT_FILE MOUNT_POINT "/text"
+
+#define RAW_FILE MOUNT_POINT "/raw"
+
+#define PAGE 4096
+
+#define FILE_PAGES 8
+
+#define SAMPLES 64
+
+/* Node types of the on-flash format, see <linux/jffs2.h> */
+#define COMPR_NONE 0x00
+
+#define COMPR_RTIME 0x02
+
+#define COMPR_ZLIB 0x06
+
+#define COMPR_DYNRUBIN 0x07
+
+#define COMPR_LZ4 0x08
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  memcpy(buffer, &self->area[offset], size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  memset(&self->area[offset], 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static rtems_jffs2_compressor_lz4_control lz4_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_lz4_compress,
+    .decompress = rtems_jffs2_compressor_lz4_decompress
+  }
+};
+
+static rtems_jffs2_compressor_zlib_control zlib_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_zlib_compress,
+    .decompress = rtems_jffs2_compressor_zlib_decompress
+  }
+};
+
+static rtems_jffs2_compressor_control rtime_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static const rtems_jffs2_mount_data mount_data = {
+  .flash_control = &flash_instance.super,
+  .compressor_control = &lz4_instance.super
+};
+
+static const mode_t mode = S_IRWXU | S_IRWXG | S_IRWXO;
+
+static unsigned char text[FILE_PAGES * PAGE];
+
+static unsigned char noise[PAGE];
+
+static unsigned char cdata[PAGE];
+
+static unsigned char ddata[PAGE];
+
+static const char * const words[] = {
+  "flash ", "block ", "erase ", "node ", "inode ", "the ", "of ", "a ",
+  "write ", "read ", "garbage ", "collection ", "summary ", "data ",
+  "journal ", "\n"
+};
+
+static void init_data(void)
+{
+  size_t i;
+  uint32_t v;
+
+  v = 123;
+  i = 0;
+  while (i < sizeof(text)) {
+    const char *w;
+    size_t n;
+
+    v = v * 1664525 + 1013904223;
+    w = words[(v >> 16) % RTEMS_ARRAY_SIZE(words)];
+    n = strlen(w);
+
+    if (n > sizeof(text) - i) {
+      n = sizeof(text) - i;
+    }
+
+    memcpy(&text[i], w, n);
+    i += n;
+  }
+
+  for (i = 0; i < sizeof(noise); ++i) {
+    v = v * 1664525 + 1013904223;
+    noise[i] = (unsigned char) (v >> 23);
+  }
+}
+
+static uint16_t compress(
+  rtems_jffs2_compressor_control *cc,
+  const unsigned char *data,
+  uint32_t size,
+  uint32_t *csize
+)
+{
+  uint32_t datalen;
+
+  datalen = size;
+  *csize = sizeof(cdata);
+  memset(cdata, 0, sizeof(cdata));
+
+  return (*cc->compress)(cc, RTEMS_DECONST(unsigned char *, data), cdata,
+    &datalen, csize);
+}
+
+static void test_round_trip(
+  const unsigned char *data,
+  uint32_t size,
+  bool compressible
+)
+{
+  rtems_jffs2_compressor_control *cc = &lz4_instance.super;
+  uint16_t comprtype;
+  uint32_t csize;
+  int rv;
+
+  comprtype = compress(cc, data, size, &csize);
+
+  if (!compressible) {
+    rtems_test_assert(comprtype == COMPR_NONE);
+    return;
+  }
+
+  rtems_test_assert(comprtype == COMPR_LZ4);
+  rtems_test_assert(csize < size);
+
+  memset(ddata, 0xa5, sizeof(ddata));
+  rv = (*cc->decompress)(cc, comprtype, cdata, ddata, csize, size);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(memcmp(ddata, data, size) == 0);
+
+  /* Corrupt compressed data must be rejected */
+  rv = (*cc->decompress)(cc, comprtype, cdata, ddata, csize - 1, size);
+  rtems_test_assert(rv == -EIO);
+  rv = (*cc->decompress)(cc, comprtype, cdata, ddata, csize, size - 1);
+  rtems_test_assert(rv == -EIO);
+}
+
+static void test_compressor(void)
+{
+  rtems_jffs2_compressor_control *cc = &lz4_instance.super;
+  static unsigned char zero[PAGE];
+  uint16_t comprtype;
+  uint32_t datalen;
+  uint32_t csize;
+  int rv;
+
+  test_round_trip(zero, sizeof(zero), true);
+  test_round_trip(text, PAGE, true);
+  test_round_trip(&text[1], PAGE - 1, true);
+  test_round_trip(&text[PAGE], 100, true);
+  test_round_trip(noise, sizeof(noise), false);
+  test_round_trip(text, 8, false);
+
+  /* Too small destination */
+  datalen = PAGE;
+  csize = 16;
+  comprtype = (*cc->compress)(cc, text, cdata, &datalen, &csize);
+  rtems_test_assert(comprtype == COMPR_NONE);
+
+  /* Data compressed by the RTIME compressor remains readable */
+  comprtype = compress(&rtime_instance, text, PAGE, &csize);
+  rtems_test_assert(comprtype == COMPR_RTIME);
+  rv = (*cc->decompress)(cc, comprtype, cdata, ddata, csize, PAGE);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(memcmp(ddata, text, PAGE) == 0);
+
+  /* Data compressed by the ZLIB compressor remains readable */
+  comprtype = compress(&zlib_instance.super, text, PAGE, &csize);
+  rtems_test_assert(comprtype == COMPR_ZLIB);
+  memset(ddata, 0, sizeof(ddata));
+  rv = (*cc->decompress)(cc, comprtype, cdata, ddata, csize, PAGE);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(memcmp(ddata, text, PAGE) == 0);
+
+  /* Unknown compressor types are rejected */
+  rv = (*cc->decompress)(cc, COMPR_DYNRUBIN, cdata, ddata, csize, PAGE);
+  rtems_test_assert(rv == -EIO);
+}
+
+static void measure_decompression(
+  const char *name,
+  rtems_jffs2_compressor_control *cc,
+  uint16_t expected_comprtype
+)
+{
+  rtems_counter_ticks t;
+  uint16_t comprtype;
+  uint32_t csize;
+  uint64_t ns;
+  int i;
+
+  comprtype = compress(cc, text, PAGE, &csize);
+  rtems_test_assert(comprtype == expected_comprtype);
+
+  t = rtems_counter_read();
+
+  for (i = 0; i < SAMPLES; ++i) {
+    int rv;
+
+    rv = (*cc->decompress)(cc, comprtype, cdata, ddata, csize, PAGE);
+    rtems_test_assert(rv == 0);
+  }
+
+  t = rtems_counter_difference(rtems_counter_read(), t);
+  ns = rtems_counter_ticks_to_nanoseconds(t) / SAMPLES;
+  rtems_test_assert(memcmp(ddata, text, PAGE) == 0);
+
+  printf(
+    "%s: compressed size %" PRIu32 " of %i bytes, "
+    "decompression %" PRIu64 "ns per page\n",
+    name,
+    csize,
+    PAGE,
+    ns
+  );
+}
+
+static void get_info(rtems_jffs2_info *info)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_POINT, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint32_t write_file(const char *path, int compression)
+{
+  rtems_jffs2_info info;
+  uint32_t used_size;
+  ssize_t n;
+  int fd;
+  int rv;
+  int c;
+
+  get_info(&info);
+  used_size = info.used_size;
+
+  fd = open(path, O_WRONLY | O_TRUNC | O_CREAT, mode);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_COMPRESSION, &c);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(c == RTEMS_JFFS2_COMPRESSION_DEFAULT);
+
+  rv = ioctl(fd, RTEMS_JFFS2_SET_COMPRESSION, &compression);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_COMPRESSION, &c);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(c == compression);
+
+  n = write(fd, text, sizeof(text));
+  rtems_test_assert(n == (ssize_t) sizeof(text));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  get_info(&info);
+  return info.used_size - used_size;
+}
+
+static void check_file(const char *path, int compression)
+{
+  unsigned char buf[PAGE];
+  size_t i;
+  int fd;
+  int rv;
+  int c;
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_COMPRESSION, &c);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(c == compression);
+
+  for (i = 0; i < FILE_PAGES; ++i) {
+    ssize_t n;
+
+    n = read(fd, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+    rtems_test_assert(memcmp(buf, &text[i * PAGE], sizeof(buf)) == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_file_system(void)
+{
+  uint32_t text_size;
+  uint32_t raw_size;
+  int compression;
+  int fd;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mkdir(MOUNT_POINT, mode);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  text_size = write_file(TEXT_FILE, RTEMS_JFFS2_COMPRESSION_DEFAULT);
+  raw_size = write_file(RAW_FILE, RTEMS_JFFS2_COMPRESSION_NONE);
+  rtems_test_assert(text_size < sizeof(text));
+  rtems_test_assert(raw_size > sizeof(text));
+  printf(
+    "flash usage: default %" PRIu32 " bytes, none %" PRIu32 " bytes\n",
+    text_size,
+    raw_size
+  );
+
+  check_file(TEXT_FILE, RTEMS_JFFS2_COMPRESSION_DEFAULT);
+  check_file(RAW_FILE, RTEMS_JFFS2_COMPRESSION_NONE);
+
+  fd = open(RAW_FILE, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  compression = -1;
+  errno = 0;
+  rv = ioctl(fd, RTEMS_JFFS2_SET_COMPRESSION, &compression);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  check_file(TEXT_FILE, RTEMS_JFFS2_COMPRESSION_DEFAULT);
+  check_file(RAW_FILE, RTEMS_JFFS2_COMPRESSION_NONE);
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  init_data();
+  test_compressor();
+  measure_decompression("lz4", &lz4_instance.super, COMPR_LZ4);
+  measure_decompression("zlib", &zlib_instance.super, COMPR_ZLIB);
+  measure_decompression("rtime", &rtime_instance, COMPR_RTIME);
+  test_file_system();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
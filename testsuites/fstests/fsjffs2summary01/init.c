@@ -0,0 +1,334 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2SUMMARY 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (16UL * BLOCK_SIZE)
+
+#define MOUNT_POINT "/jffs2"
+
+#define FILE_COUNT 64
+
+#define CHUNK_COUNT 4
+
+#define CHUNK_SIZE 256
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  size_t bytes_read;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  self->bytes_read += size_of_buffer;
+  memcpy(buffer, &self->area[offset], size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  memset(&self->area[offset], 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_mount_data mount_data_summary = {
+  .flash_control = &flash_instance.super,
+  .enable_summary = true
+};
+
+static const rtems_jffs2_mount_data mount_data_no_summary = {
+  .flash_control = &flash_instance.super,
+  .enable_summary = false
+};
+
+static const mode_t mode = S_IRWXU | S_IRWXG | S_IRWXO;
+
+typedef struct {
+  size_t bytes_read;
+  uint64_t ns;
+} mount_measurement;
+
+static void make_name(char *name, size_t size, int i)
+{
+  int n;
+
+  n = snprintf(name, size, MOUNT_POINT "/dir/f%i", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void fill_chunk(unsigned char *chunk, int file, int j)
+{
+  size_t k;
+
+  for (k = 0; k < CHUNK_SIZE; ++k) {
+    chunk[k] = (unsigned char) (file * 31 + j * 7 + k);
+  }
+}
+
+static void do_mount(
+  const rtems_jffs2_mount_data *mount_data,
+  mount_measurement *m
+)
+{
+  rtems_counter_ticks t;
+  int rv;
+
+  flash_instance.bytes_read = 0;
+  t = rtems_counter_read();
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  t = rtems_counter_difference(rtems_counter_read(), t);
+
+  if (m != NULL) {
+    m->bytes_read = flash_instance.bytes_read;
+    m->ns = rtems_counter_ticks_to_nanoseconds(t);
+  }
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_files(void)
+{
+  unsigned char chunk[CHUNK_SIZE];
+  char name[32];
+  int rv;
+  int i;
+
+  rv = mkdir(MOUNT_POINT "/dir", mode);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    int fd;
+    int j;
+
+    make_name(name, sizeof(name), i);
+    fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    rtems_test_assert(fd >= 0);
+
+    /* Each write produces a separate data node */
+    for (j = 0; j < CHUNK_COUNT; ++j) {
+      ssize_t n;
+
+      fill_chunk(chunk, i, j);
+      n = write(fd, chunk, sizeof(chunk));
+      rtems_test_assert(n == (ssize_t) sizeof(chunk));
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_files(void)
+{
+  unsigned char expected[CHUNK_SIZE];
+  unsigned char actual[CHUNK_SIZE];
+  char name[32];
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    int fd;
+    int j;
+    int rv;
+
+    make_name(name, sizeof(name), i);
+    fd = open(name, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    for (j = 0; j < CHUNK_COUNT; ++j) {
+      ssize_t n;
+
+      fill_chunk(expected, i, j);
+      n = read(fd, actual, sizeof(actual));
+      rtems_test_assert(n == (ssize_t) sizeof(actual));
+      rtems_test_assert(memcmp(actual, expected, sizeof(actual)) == 0);
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void print_measurement(const char *what, const mount_measurement *m)
+{
+  printf(
+    "mount %s: %zu bytes read, %" PRIu64 "ns\n",
+    what,
+    m->bytes_read,
+    m->ns
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  mount_measurement with_summary;
+  mount_measurement without_summary;
+  int rv;
+
+  TEST_BEGIN();
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mkdir(MOUNT_POINT, mode);
+  rtems_test_assert(rv == 0);
+
+  do_mount(&mount_data_summary, NULL);
+  create_files();
+  do_unmount();
+
+  do_mount(&mount_data_summary, &with_summary);
+  check_files();
+  do_unmount();
+
+  do_mount(&mount_data_no_summary, &without_summary);
+  check_files();
+  do_unmount();
+
+  print_measurement("with summary", &with_summary);
+  print_measurement("without summary", &without_summary);
+
+  /*
+   * With summary nodes the scan reads only the summary of the filled erase
+   * blocks and not each node.
+   */
+  rtems_test_assert(with_summary.bytes_read < without_summary.bytes_read);
+
+  /* Write more files without summary and ensure the mixed layout mounts */
+  do_mount(&mount_data_no_summary, NULL);
+  rv = rename(MOUNT_POINT "/dir", MOUNT_POINT "/old");
+  rtems_test_assert(rv == 0);
+  create_files();
+  do_unmount();
+
+  do_mount(&mount_data_summary, NULL);
+  check_files();
+  do_unmount();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
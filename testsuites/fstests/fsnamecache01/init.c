@@ -0,0 +1,298 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/libio_.h>
+
+const char rtems_test_name[] = "FSNAMECACHE 1";
+
+#define CACHE_ENTRIES 16
+
+#define EVICTION_COUNT (4 * CACHE_ENTRIES)
+
+static rtems_filesystem_name_cache_statistics stats_before;
+
+static void stats_mark(void)
+{
+  rtems_filesystem_name_cache_get_statistics(&stats_before);
+}
+
+static void stats_check(
+  uint32_t positive_hits,
+  uint32_t negative_hits,
+  uint32_t misses
+)
+{
+  rtems_filesystem_name_cache_statistics stats;
+
+  rtems_filesystem_name_cache_get_statistics(&stats);
+  rtems_test_assert(
+    stats.positive_hits - stats_before.positive_hits == positive_hits
+  );
+  rtems_test_assert(
+    stats.negative_hits - stats_before.negative_hits == negative_hits
+  );
+  rtems_test_assert(stats.misses - stats_before.misses == misses);
+}
+
+static bool exists(const char *path)
+{
+  struct stat st;
+  int rv;
+
+  rv = stat(path, &st);
+  if (rv != 0) {
+    rtems_test_assert(errno == ENOENT);
+  }
+
+  return rv == 0;
+}
+
+static void create_file(const char *path)
+{
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void make_name(char *name, size_t size, int i)
+{
+  int n;
+
+  n = snprintf(name, size, "a/b/c/d/node%i", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void test_deep_path(void)
+{
+  int rv;
+
+  rv = mkdir("a", S_IRWXU);
+  rtems_test_assert(rv == 0);
+  rv = mkdir("a/b", S_IRWXU);
+  rtems_test_assert(rv == 0);
+  rv = mkdir("a/b/c", S_IRWXU);
+  rtems_test_assert(rv == 0);
+  rv = mkdir("a/b/c/d", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  /* The first lookup fills the cache, the negative entry is cached also */
+  stats_mark();
+  rtems_test_assert(!exists("a/b/c/d/f"));
+  stats_check(0, 0, 5);
+
+  stats_mark();
+  rtems_test_assert(!exists("a/b/c/d/f"));
+  stats_check(4, 1, 0);
+
+  /* The creation invalidates the negative entry */
+  create_file("a/b/c/d/f");
+
+  stats_mark();
+  rtems_test_assert(exists("a/b/c/d/f"));
+  stats_check(0, 0, 5);
+
+  stats_mark();
+  rtems_test_assert(exists("a/b/c/d/f"));
+  stats_check(5, 0, 0);
+}
+
+static void test_unlink_rename_rmdir(void)
+{
+  int rv;
+
+  rv = unlink("a/b/c/d/f");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("a/b/c/d/f"));
+  rtems_test_assert(!exists("a/b/c/d/f"));
+
+  create_file("a/b/c/d/g");
+  rtems_test_assert(exists("a/b/c/d/g"));
+  rtems_test_assert(!exists("a/b/c/d/h"));
+
+  rv = rename("a/b/c/d/g", "a/b/c/d/h");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("a/b/c/d/g"));
+  rtems_test_assert(exists("a/b/c/d/h"));
+
+  rv = rename("a/b/c/d", "a/b/c/e");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("a/b/c/d/h"));
+  rtems_test_assert(exists("a/b/c/e/h"));
+
+  rv = rename("a/b/c/e", "a/b/c/d");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(exists("a/b/c/d/h"));
+
+  rv = unlink("a/b/c/d/h");
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir("a/b/c/d/x", S_IRWXU);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(exists("a/b/c/d/x"));
+
+  rv = rmdir("a/b/c/d/x");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("a/b/c/d/x"));
+
+  /* A new node may reuse the memory of the removed node */
+  rv = mkdir("a/b/c/d/y", S_IRWXU);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("a/b/c/d/x"));
+  rtems_test_assert(exists("a/b/c/d/y"));
+
+  rv = rmdir("a/b/c/d/y");
+  rtems_test_assert(rv == 0);
+}
+
+static void test_mount(void)
+{
+  int rv;
+
+  rv = mkdir("m", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(NULL, "m", RTEMS_FILESYSTEM_TYPE_IMFS, RTEMS_FILESYSTEM_READ_WRITE,
+    NULL);
+  rtems_test_assert(rv == 0);
+
+  create_file("m/f");
+  rtems_test_assert(exists("m/f"));
+  rtems_test_assert(exists("m/f"));
+
+  rv = unmount("m");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("m/f"));
+
+  /* The new instance must not see entries of the old instance */
+  rv = mount(NULL, "m", RTEMS_FILESYSTEM_TYPE_IMFS, RTEMS_FILESYSTEM_READ_WRITE,
+    NULL);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!exists("m/f"));
+
+  rv = unmount("m");
+  rtems_test_assert(rv == 0);
+
+  rv = rmdir("m");
+  rtems_test_assert(rv == 0);
+}
+
+static void test_eviction(void)
+{
+  char name[32];
+  int i;
+  int rv;
+
+  for (i = 0; i < EVICTION_COUNT; ++i) {
+    make_name(name, sizeof(name), i);
+    create_file(name);
+  }
+
+  for (i = 0; i < EVICTION_COUNT; ++i) {
+    make_name(name, sizeof(name), i);
+    rtems_test_assert(exists(name));
+  }
+
+  for (i = 0; i < EVICTION_COUNT; ++i) {
+    make_name(name, sizeof(name), i);
+    rtems_test_assert(exists(name));
+  }
+
+  for (i = 0; i < EVICTION_COUNT; ++i) {
+    make_name(name, sizeof(name), i);
+    rv = unlink(name);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(!exists(name));
+  }
+}
+
+static void test_long_name(void)
+{
+  static const char name[] =
+    "a/b/c/d/0123456789012345678901234567890123456789";
+
+  rtems_test_assert(!exists(name));
+
+  /* Long names are not cached */
+  stats_mark();
+  rtems_test_assert(!exists(name));
+  stats_check(4, 0, 0);
+
+  create_file(name);
+  rtems_test_assert(exists(name));
+  stats_mark();
+  rtems_test_assert(exists(name));
+  stats_check(4, 0, 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test_deep_path();
+  test_unlink_rename_rmdir();
+  test_mount();
+  test_eviction();
+  test_long_name();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES CACHE_ENTRIES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -42,6 +42,9 @@ rtems_task Init(
   rtems_status_code   sc;
   rtems_task_priority old_priority;
   rtems_mode          old_mode;
+  size_t              read;
+  const void*         recs;
+  uint32_t            lost;
   rtems_name          to_name = rtems_build_name('I', 'D', 'L', 'E');;
 
   rtems_print_printer_fprintf_putc(&rtems_test_printer);
@@ -80,12 +83,38 @@ rtems_task Init(
 
   capture_test_1();
 
+  /* The records can be read while capture control is enabled */
+  sc = rtems_capture_read (0, &read, &recs);
+  ASSERT_SC(sc);
+  assert(read > 0);
+  assert(recs != NULL);
+
+  sc = rtems_capture_read (0, &read, &recs);
+  assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_capture_release (0, 0);
+  ASSERT_SC(sc);
+
   sc = rtems_capture_set_control (false);
   ASSERT_SC(sc);
 
   rtems_capture_print_trace_records ( 22, false );
   rtems_capture_print_trace_records ( 22, false );
 
+  sc = rtems_capture_flush (false);
+  ASSERT_SC(sc);
+
+  sc = rtems_capture_get_lost (0, &lost);
+  ASSERT_SC(sc);
+  assert(lost == 0);
+
+  sc = rtems_capture_read (0, &read, &recs);
+  ASSERT_SC(sc);
+  assert(read == 0);
+
+  sc = rtems_capture_release (0, 0);
+  ASSERT_SC(sc);
+
   TEST_END();
   exit( 0 );
 }
@@ -0,0 +1,260 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/cpuusehistory.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "CPUUSEHISTORY 1";
+
+#define INTERVAL 10000
+
+#define BURST_THRESHOLD 50
+
+static void busy( uint32_t duration_in_us )
+{
+  uint64_t end;
+
+  end = rtems_clock_get_uptime_nanoseconds() +
+    (uint64_t) duration_in_us * 1000;
+
+  while ( rtems_clock_get_uptime_nanoseconds() < end ) {
+    /* Wait */
+  }
+}
+
+static void idle_for( uint32_t duration_in_us )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(
+    RTEMS_MICROSECONDS_TO_TICKS( duration_in_us ) + 1
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void worker( rtems_task_argument arg )
+{
+  (void) arg;
+
+  busy( 5 * INTERVAL );
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void test_not_started( void )
+{
+  rtems_cpu_usage_history history;
+  rtems_cpu_usage_processor_history processor_history;
+  rtems_status_code sc;
+
+  rtems_test_assert( !rtems_cpu_usage_history_is_running() );
+  rtems_test_assert( rtems_cpu_usage_history_get_interval() == 0 );
+
+  sc = rtems_cpu_usage_history_get( RTEMS_SELF, &history );
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  sc = rtems_cpu_usage_history_get_processor( 0, &processor_history );
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  sc = rtems_cpu_usage_history_start(
+    RTEMS_CPU_USAGE_HISTORY_INTERVAL_MINIMUM - 1,
+    BURST_THRESHOLD
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_cpu_usage_history_start(
+    RTEMS_CPU_USAGE_HISTORY_INTERVAL_MAXIMUM + 1,
+    BURST_THRESHOLD
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_cpu_usage_history_start( INTERVAL, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_cpu_usage_history_start( INTERVAL, 101 );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+}
+
+static void test_start( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_cpu_usage_history_start( INTERVAL, BURST_THRESHOLD );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( rtems_cpu_usage_history_is_running() );
+  rtems_test_assert( rtems_cpu_usage_history_get_interval() == INTERVAL );
+
+  sc = rtems_cpu_usage_history_start( INTERVAL, BURST_THRESHOLD );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+}
+
+static void test_thread( void )
+{
+  rtems_cpu_usage_history history;
+  rtems_status_code sc;
+  uint32_t i;
+
+  sc = rtems_cpu_usage_history_get( RTEMS_SELF, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  /* A burst followed by an idle period */
+  busy( 4 * INTERVAL );
+  idle_for( 4 * INTERVAL );
+
+  sc = rtems_cpu_usage_history_get( RTEMS_SELF, &history );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( history.sample_count >= 8 );
+  rtems_test_assert( history.sample_count <= RTEMS_CPU_USAGE_HISTORY_SIZE );
+  rtems_test_assert( history.peak <= INTERVAL );
+  rtems_test_assert( history.peak >= INTERVAL / 2 );
+  rtems_test_assert( history.peak_index < history.sample_count );
+  rtems_test_assert( history.samples[ history.peak_index ] == history.peak );
+  rtems_test_assert( history.burst_count >= 3 );
+  rtems_test_assert( history.burst_count <= 5 );
+
+  /* The most recent intervals were idle */
+  rtems_test_assert( history.samples[ 0 ] < INTERVAL / 2 );
+  rtems_test_assert( history.samples[ 1 ] < INTERVAL / 2 );
+
+  for ( i = history.sample_count; i < RTEMS_CPU_USAGE_HISTORY_SIZE; ++i ) {
+    rtems_test_assert( history.samples[ i ] == 0 );
+  }
+}
+
+static void test_created_thread( void )
+{
+  rtems_cpu_usage_history history;
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, worker, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The worker runs until it suspends itself, then complete its intervals */
+  idle_for( INTERVAL );
+  idle_for( 2 * INTERVAL );
+
+  sc = rtems_cpu_usage_history_get( id, &history );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( history.sample_count >= 6 );
+  rtems_test_assert( history.peak <= INTERVAL );
+  rtems_test_assert( history.peak >= INTERVAL / 2 );
+  rtems_test_assert( history.burst_count >= 4 );
+  rtems_test_assert( history.samples[ 0 ] == 0 );
+
+  sc = rtems_task_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_cpu_usage_history_get( id, &history );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+}
+
+static void test_processor( void )
+{
+  rtems_cpu_usage_processor_history history;
+  rtems_status_code sc;
+  uint32_t i;
+
+  sc = rtems_cpu_usage_history_get_processor( 0, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_cpu_usage_history_get_processor(
+    rtems_scheduler_get_processor_maximum(),
+    &history
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  busy( 4 * INTERVAL );
+  idle_for( 4 * INTERVAL );
+
+  sc = rtems_cpu_usage_history_get_processor( 0, &history );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( history.sample_count >= 8 );
+
+  /* The most recent intervals were idle */
+  rtems_test_assert( history.idle_samples[ 0 ] > INTERVAL / 2 );
+  rtems_test_assert( history.idle_samples[ 1 ] > INTERVAL / 2 );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( history.load_averages ); ++i ) {
+    rtems_test_assert( history.load_averages[ i ] > 0 );
+    rtems_test_assert( history.load_averages[ i ] < 1000 );
+  }
+
+#if !defined(RTEMS_PROFILING)
+  rtems_test_assert( history.interrupt_time == 0 );
+#endif
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test_not_started();
+  test_start();
+  test_thread();
+  test_created_thread();
+  test_processor();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,290 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordsink.h>
+#include <rtems/recordclient.h>
+#include <rtems/record.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 3";
+
+#define SINK_PATH "/trace/rec"
+
+#define FILE_COUNT 2
+
+#define FILE_SIZE 4096
+
+#define ITEM_COUNT 512
+
+typedef struct {
+  rtems_record_client_context client;
+  uint32_t user_events;
+  uint32_t next_data;
+  bool in_order;
+  unsigned char file[ 65536 ];
+  unsigned char data[ 65536 ];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_record_client_status client_handler(
+  uint64_t            bt,
+  uint32_t            cpu,
+  rtems_record_event  event,
+  uint64_t            data,
+  void               *arg
+)
+{
+  test_context *ctx;
+
+  (void) bt;
+  (void) cpu;
+  ctx = arg;
+
+  if ( event == RTEMS_RECORD_USER_0 ) {
+    if ( data < ctx->next_data ) {
+      ctx->in_order = false;
+    }
+
+    ctx->next_data = (uint32_t) data + 1;
+    ++ctx->user_events;
+  }
+
+  return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static void produce( uint32_t *data, uint32_t count )
+{
+  uint32_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_record_produce( RTEMS_RECORD_USER_0, *data );
+    ++( *data );
+  }
+}
+
+static size_t read_file( test_context *ctx, uint32_t index )
+{
+  char    path[ 32 ];
+  int     fd;
+  ssize_t n;
+  int     rv;
+
+  snprintf( path, sizeof( path ), "%s.%" PRIu32, SINK_PATH, index );
+  fd = open( path, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  n = read( fd, ctx->file, sizeof( ctx->file ) );
+  rtems_test_assert( n > 0 );
+  rtems_test_assert( (size_t) n < sizeof( ctx->file ) );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  return (size_t) n;
+}
+
+static uint32_t check_file( test_context *ctx, uint32_t index, bool compressed )
+{
+  rtems_record_client_status cs;
+  const void *data;
+  size_t size;
+
+  size = read_file( ctx, index );
+
+  if ( compressed ) {
+    z_stream stream;
+    int err;
+
+    memset( &stream, 0, sizeof( stream ) );
+    err = inflateInit( &stream );
+    rtems_test_assert( err == Z_OK );
+
+    stream.next_in = ctx->file;
+    stream.avail_in = size;
+    stream.next_out = ctx->data;
+    stream.avail_out = sizeof( ctx->data );
+    err = inflate( &stream, Z_FINISH );
+    rtems_test_assert( err == Z_STREAM_END );
+
+    size = stream.total_out;
+    data = ctx->data;
+    (void) inflateEnd( &stream );
+  } else {
+    data = ctx->file;
+  }
+
+  ctx->user_events = 0;
+  ctx->next_data = 0;
+  ctx->in_order = true;
+  rtems_record_client_init( &ctx->client, client_handler, ctx );
+  cs = rtems_record_client_run( &ctx->client, data, size );
+  rtems_test_assert( cs == RTEMS_RECORD_CLIENT_SUCCESS );
+  rtems_record_client_destroy( &ctx->client );
+
+  rtems_test_assert( ctx->in_order );
+  return ctx->user_events;
+}
+
+static void test_sink( test_context *ctx, int compression_level )
+{
+  rtems_record_sink_config config;
+  rtems_record_sink_statistics stats;
+  rtems_status_code sc;
+  uint32_t data;
+  uint32_t events;
+  int i;
+
+  memset( &config, 0, sizeof( config ) );
+  config.path = SINK_PATH;
+  config.file_count = FILE_COUNT;
+  config.file_size = FILE_SIZE;
+  config.period = 1;
+  config.compression_level = compression_level;
+
+  sc = rtems_record_sink_start( &config, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_record_sink_start( &config, 2 );
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  data = 0;
+
+  /* Overflow the ring buffer, the sink task cannot run meanwhile */
+  produce( &data, 2 * ITEM_COUNT );
+
+  sc = rtems_record_sink_flush();
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_wake_after( 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_record_sink_get_statistics( &stats );
+  rtems_test_assert( stats.overflows == 1 );
+  rtems_test_assert( stats.lost_items == ITEM_COUNT + 1 );
+  rtems_test_assert( stats.drained_items == ITEM_COUNT - 1 );
+
+  for ( i = 0; i < 16; ++i ) {
+    produce( &data, ITEM_COUNT / 4 );
+
+    sc = rtems_record_sink_flush();
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_wake_after( 1 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_record_sink_stop();
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_record_sink_stop();
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  sc = rtems_record_sink_flush();
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  rtems_record_sink_get_statistics( &stats );
+  rtems_test_assert( stats.error == 0 );
+  rtems_test_assert( stats.overflows == 1 );
+  rtems_test_assert( stats.drained_items == data - ( ITEM_COUNT + 1 ) );
+  rtems_test_assert( stats.written_bytes > 0 );
+
+  if ( compression_level == 0 ) {
+    rtems_test_assert( stats.rotations > 0 );
+  }
+
+  events = check_file( ctx, 0, compression_level > 0 );
+
+  if ( stats.rotations > 0 ) {
+    events += check_file( ctx, 1, compression_level > 0 );
+  }
+
+  /* The oldest file may be overwritten */
+  rtems_test_assert( events > 0 );
+  rtems_test_assert( events <= stats.drained_items );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+  rtems_record_sink_config config;
+  rtems_status_code sc;
+  int rv;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  sc = rtems_record_sink_start( NULL, 2 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  memset( &config, 0, sizeof( config ) );
+  config.path = "/nix/rec";
+  sc = rtems_record_sink_start( &config, 2 );
+  rtems_test_assert( sc == RTEMS_IO_ERROR );
+
+  rv = mkdir( "/trace", S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  test_sink( ctx, 0 );
+  test_sink( ctx, Z_BEST_SPEED );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS ITEM_COUNT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
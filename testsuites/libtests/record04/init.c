@@ -0,0 +1,347 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/recordclient.h>
+#include <rtems.h>
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 4";
+
+/*
+ * This file is compiled with -finstrument-functions.  Only the functions f(),
+ * g(), and h() shall produce function events.
+ */
+#define NO_INSTRUMENT __attribute__(( __no_instrument_function__ ))
+
+#define NODE_COUNT 4
+
+typedef struct {
+  uint64_t function;
+  uint32_t depth;
+  uint64_t calls;
+  uint64_t total_time;
+  uint64_t self_time;
+} test_node;
+
+typedef struct {
+  rtems_record_client_context client;
+  rtems_record_client_function_context functions;
+  test_node nodes[NODE_COUNT];
+  size_t node_count;
+} test_context;
+
+static test_context test_instance;
+
+static volatile int counter;
+
+static __attribute__(( __noinline__ )) void h(void)
+{
+  ++counter;
+}
+
+static __attribute__(( __noinline__ )) void g(void)
+{
+  h();
+  ++counter;
+}
+
+static __attribute__(( __noinline__ )) void f(void)
+{
+  g();
+  g();
+}
+
+static NO_INSTRUMENT uint64_t address(void (*function)(void))
+{
+  return (uintptr_t) function;
+}
+
+static NO_INSTRUMENT void drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  test_context *ctx;
+  rtems_record_client_status cs;
+
+  ctx = arg;
+
+  if (ctx != NULL) {
+    cs = rtems_record_client_run(&ctx->client, items, count * sizeof(*items));
+    rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+  }
+}
+
+static NO_INSTRUMENT void node_visitor(
+  const rtems_record_client_function_node *node,
+  uint32_t                                 depth,
+  void                                    *arg
+)
+{
+  test_context *ctx;
+  test_node *tn;
+
+  ctx = arg;
+
+  if (
+    node->function != address(f) &&
+    node->function != address(g) &&
+    node->function != address(h)
+  ) {
+    return;
+  }
+
+  rtems_test_assert(ctx->node_count < NODE_COUNT);
+  tn = &ctx->nodes[ctx->node_count];
+  ++ctx->node_count;
+  tn->function = node->function;
+  tn->depth = depth;
+  tn->calls = node->calls;
+  tn->total_time = node->total_time;
+  tn->self_time = node->self_time;
+}
+
+static NO_INSTRUMENT void trace_f(
+  test_context *ctx,
+  rtems_record_function_mode mode
+)
+{
+  Record_Stream_header header;
+  size_t size;
+  rtems_record_client_status cs;
+
+  /* Discard the items produced so far */
+  rtems_record_drain(drain_visitor, NULL);
+
+  rtems_record_function_set_mode(mode);
+  rtems_test_assert(rtems_record_function_get_mode() == mode);
+  f();
+  rtems_record_function_set_mode(RTEMS_RECORD_FUNCTION_DISABLED);
+
+  rtems_record_client_function_init(&ctx->functions);
+  rtems_record_client_init(
+    &ctx->client,
+    rtems_record_client_function_process,
+    &ctx->functions
+  );
+  size = _Record_Stream_header_initialize(&header);
+  cs = rtems_record_client_run(&ctx->client, &header, size);
+  rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+  rtems_record_drain(drain_visitor, ctx);
+  rtems_record_client_destroy(&ctx->client);
+  rtems_test_assert(ctx->functions.unmatched_exits == 0);
+  rtems_test_assert(ctx->functions.implicit_exits == 0);
+  rtems_test_assert(ctx->functions.discarded_calls == 0);
+}
+
+static NO_INSTRUMENT void visit_call_tree(test_context *ctx)
+{
+  ctx->node_count = 0;
+  rtems_record_client_function_visit_call_tree(
+    &ctx->functions,
+    node_visitor,
+    ctx
+  );
+}
+
+static NO_INSTRUMENT void visit_functions(test_context *ctx)
+{
+  ctx->node_count = 0;
+  rtems_record_client_function_visit_functions(
+    &ctx->functions,
+    node_visitor,
+    ctx
+  );
+}
+
+static NO_INSTRUMENT const test_node *find_node(
+  const test_context *ctx,
+  void (*function)(void)
+)
+{
+  size_t i;
+
+  for (i = 0; i < ctx->node_count; ++i) {
+    if (ctx->nodes[i].function == address(function)) {
+      return &ctx->nodes[i];
+    }
+  }
+
+  return NULL;
+}
+
+static NO_INSTRUMENT void check_node(
+  const test_node *tn,
+  void (*function)(void),
+  uint32_t depth,
+  uint64_t calls
+)
+{
+  rtems_test_assert(tn->function == address(function));
+  rtems_test_assert(tn->depth == depth);
+  rtems_test_assert(tn->calls == calls);
+  rtems_test_assert(tn->self_time <= tn->total_time);
+}
+
+static NO_INSTRUMENT void test_all(test_context *ctx)
+{
+  const test_node *tn;
+
+  trace_f(ctx, RTEMS_RECORD_FUNCTION_ALL);
+
+  visit_call_tree(ctx);
+  rtems_test_assert(ctx->node_count == 3);
+  check_node(&ctx->nodes[0], f, 0, 1);
+  check_node(&ctx->nodes[1], g, 1, 2);
+  check_node(&ctx->nodes[2], h, 2, 2);
+  rtems_test_assert(
+    ctx->nodes[0].total_time ==
+      ctx->nodes[0].self_time + ctx->nodes[1].total_time
+  );
+  rtems_test_assert(
+    ctx->nodes[1].total_time ==
+      ctx->nodes[1].self_time + ctx->nodes[2].total_time
+  );
+
+  visit_functions(ctx);
+  rtems_test_assert(ctx->node_count == 3);
+  tn = find_node(ctx, f);
+  rtems_test_assert(tn != NULL);
+  check_node(tn, f, 0, 1);
+  tn = find_node(ctx, g);
+  rtems_test_assert(tn != NULL);
+  check_node(tn, g, 0, 2);
+  tn = find_node(ctx, h);
+  rtems_test_assert(tn != NULL);
+  check_node(tn, h, 0, 2);
+
+  rtems_record_client_function_destroy(&ctx->functions);
+}
+
+static NO_INSTRUMENT void test_include(test_context *ctx)
+{
+  rtems_record_function_filter_clear();
+  rtems_test_assert(rtems_record_function_filter_add(g));
+  trace_f(ctx, RTEMS_RECORD_FUNCTION_INCLUDE);
+
+  visit_call_tree(ctx);
+  rtems_test_assert(ctx->node_count == 1);
+  check_node(&ctx->nodes[0], g, 0, 2);
+  rtems_test_assert(ctx->nodes[0].total_time == ctx->nodes[0].self_time);
+
+  rtems_record_client_function_destroy(&ctx->functions);
+}
+
+static NO_INSTRUMENT void test_exclude(test_context *ctx)
+{
+  rtems_record_function_filter_clear();
+  rtems_test_assert(rtems_record_function_filter_add(g));
+  trace_f(ctx, RTEMS_RECORD_FUNCTION_EXCLUDE);
+
+  visit_call_tree(ctx);
+  rtems_test_assert(ctx->node_count == 2);
+  check_node(&ctx->nodes[0], f, 0, 1);
+  check_node(&ctx->nodes[1], h, 1, 2);
+
+  rtems_record_client_function_destroy(&ctx->functions);
+}
+
+static NO_INSTRUMENT void test_disabled(test_context *ctx)
+{
+  trace_f(ctx, RTEMS_RECORD_FUNCTION_DISABLED);
+
+  visit_call_tree(ctx);
+  rtems_test_assert(ctx->node_count == 0);
+
+  rtems_record_client_function_destroy(&ctx->functions);
+}
+
+static NO_INSTRUMENT void test_filter_full(void)
+{
+  static const char functions[RTEMS_RECORD_FUNCTION_FILTER_MAXIMUM + 1];
+  size_t i;
+
+  rtems_record_function_filter_clear();
+
+  for (i = 0; i < RTEMS_RECORD_FUNCTION_FILTER_MAXIMUM; ++i) {
+    rtems_test_assert(rtems_record_function_filter_add(&functions[i]));
+  }
+
+  rtems_test_assert(rtems_record_function_filter_add(&functions[0]));
+  rtems_test_assert(!rtems_record_function_filter_add(&functions[i]));
+
+  rtems_record_function_filter_clear();
+  rtems_test_assert(rtems_record_function_filter_add(&functions[i]));
+  rtems_record_function_filter_clear();
+}
+
+static NO_INSTRUMENT void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  rtems_test_assert(
+    rtems_record_function_get_mode() == RTEMS_RECORD_FUNCTION_ALL
+  );
+  rtems_record_function_set_mode(RTEMS_RECORD_FUNCTION_DISABLED);
+
+  test_all(ctx);
+  test_include(ctx);
+  test_exclude(ctx);
+  test_disabled(ctx);
+  test_filter_full();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 512
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
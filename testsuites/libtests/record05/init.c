@@ -0,0 +1,256 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/recordclient.h>
+#include <rtems/recordsampler.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 5";
+
+#define TICK_SAMPLE_PC 0x5000
+
+#define SAMPLE_PC 0x4000
+
+#if defined(__riscv)
+#define FRAME_POINTER(record) ((uintptr_t) &(record)[2])
+#else
+#define FRAME_POINTER(record) ((uintptr_t) (record))
+#endif
+
+typedef struct {
+  rtems_record_client_context client;
+  rtems_record_client_sample_context samples;
+  const rtems_record_client_sample_node *node;
+  uint64_t key;
+} test_context;
+
+static test_context test_instance;
+
+bool _Record_Sampler_Get_interrupted_context(
+  uintptr_t *pc,
+  uintptr_t *frame_pointer
+)
+{
+  *pc = TICK_SAMPLE_PC;
+  *frame_pointer = 0;
+  return true;
+}
+
+static void drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  test_context *ctx;
+  rtems_record_client_status cs;
+
+  ctx = arg;
+  cs = rtems_record_client_run(&ctx->client, items, count * sizeof(*items));
+  rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+}
+
+static void find_visitor(
+  const rtems_record_client_sample_node *node,
+  void                                  *arg
+)
+{
+  test_context *ctx;
+
+  ctx = arg;
+
+  if (node->key == ctx->key) {
+    ctx->node = node;
+  }
+}
+
+static const rtems_record_client_sample_node *find_function(
+  test_context *ctx,
+  uint64_t key
+)
+{
+  ctx->node = NULL;
+  ctx->key = key;
+  rtems_record_client_sample_visit_functions(&ctx->samples, find_visitor, ctx);
+  rtems_test_assert(ctx->node != NULL);
+  return ctx->node;
+}
+
+static const rtems_record_client_sample_node *find_thread(
+  test_context *ctx,
+  uint64_t key
+)
+{
+  ctx->node = NULL;
+  ctx->key = key;
+  rtems_record_client_sample_visit_threads(&ctx->samples, find_visitor, ctx);
+  rtems_test_assert(ctx->node != NULL);
+  return ctx->node;
+}
+
+static void sample_with_backtrace(void)
+{
+  uintptr_t frames[6];
+  rtems_interrupt_level level;
+
+  frames[0] = FRAME_POINTER(&frames[2]);
+  frames[1] = 0x1000;
+  frames[2] = FRAME_POINTER(&frames[4]);
+  frames[3] = 0x2000;
+  frames[4] = 0;
+  frames[5] = 0x3000;
+
+  rtems_interrupt_local_disable(level);
+  rtems_record_sampler_sample(SAMPLE_PC, FRAME_POINTER(&frames[0]));
+  rtems_interrupt_local_enable(level);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  Record_Stream_header header;
+  size_t size;
+  rtems_record_client_status cs;
+  const rtems_record_client_sample_node *node;
+  rtems_interval ticks;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  rtems_test_assert(!rtems_record_sampler_is_running());
+  sc = rtems_record_sampler_stop();
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+  sc = rtems_record_sampler_start(0, 0);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+  sc = rtems_record_sampler_start(
+    1,
+    RTEMS_RECORD_SAMPLER_BACKTRACE_MAXIMUM + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  /* Discard the items produced so far */
+  rtems_record_client_sample_init(&ctx->samples, NULL, NULL);
+  rtems_record_client_init(
+    &ctx->client,
+    rtems_record_client_sample_process,
+    &ctx->samples
+  );
+  size = _Record_Stream_header_initialize(&header);
+  cs = rtems_record_client_run(&ctx->client, &header, size);
+  rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+  rtems_record_drain(drain_visitor, ctx);
+  rtems_record_client_destroy(&ctx->client);
+  rtems_test_assert(ctx->samples.sample_count == 0);
+  rtems_record_client_sample_destroy(&ctx->samples);
+
+  sc = rtems_record_sampler_start(1, 4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_record_sampler_is_running());
+  sc = rtems_record_sampler_start(1, 4);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  /* Busy wait, so that the samples interrupt this task */
+  ticks = rtems_clock_get_ticks_since_boot();
+  while (rtems_clock_get_ticks_since_boot() - ticks < 5) {
+    /* Wait */
+  }
+
+  sc = rtems_record_sampler_stop();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(!rtems_record_sampler_is_running());
+
+  sample_with_backtrace();
+
+  rtems_record_client_sample_init(&ctx->samples, NULL, NULL);
+  rtems_record_client_init(
+    &ctx->client,
+    rtems_record_client_sample_process,
+    &ctx->samples
+  );
+  size = _Record_Stream_header_initialize(&header);
+  cs = rtems_record_client_run(&ctx->client, &header, size);
+  rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+  rtems_record_drain(drain_visitor, ctx);
+  rtems_record_client_destroy(&ctx->client);
+
+  rtems_test_assert(ctx->samples.sample_count >= 5);
+  rtems_test_assert(
+    ctx->samples.sample_count == rtems_record_sampler_get_sample_count(0)
+  );
+
+  node = find_function(ctx, TICK_SAMPLE_PC);
+  rtems_test_assert(node->self == ctx->samples.sample_count - 1);
+  rtems_test_assert(node->total == node->self);
+
+  node = find_function(ctx, SAMPLE_PC);
+  rtems_test_assert(node->self == 1);
+  rtems_test_assert(node->total == 1);
+
+  node = find_function(ctx, 0x1000);
+  rtems_test_assert(node->self == 0);
+  rtems_test_assert(node->total == 1);
+
+  node = find_function(ctx, 0x2000);
+  rtems_test_assert(node->self == 0);
+  rtems_test_assert(node->total == 1);
+
+  node = find_function(ctx, 0x3000);
+  rtems_test_assert(node->self == 0);
+  rtems_test_assert(node->total == 1);
+
+  node = find_thread(ctx, rtems_task_self());
+  rtems_test_assert(node->self == ctx->samples.sample_count);
+
+  rtems_record_client_sample_destroy(&ctx->samples);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 512
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,415 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/recordclient.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "RECORD 6";
+
+#define HIGH_PRIORITY 3
+
+#define MID_PRIORITY 4
+
+#define LOW_PRIORITY 5
+
+#define EVENT_OBTAINED RTEMS_EVENT_0
+
+#define EVENT_MID RTEMS_EVENT_1
+
+#define EVENT_HIGH RTEMS_EVENT_2
+
+typedef struct {
+  rtems_record_client_context client;
+  rtems_record_client_sched_context sched;
+  rtems_record_client_chrome_context chrome;
+  rtems_id runner;
+  rtems_id mutex;
+  rtems_id low;
+  rtems_id mid;
+  rtems_id high;
+  size_t execute_count;
+  size_t ready_count;
+  size_t inversion_count;
+  const rtems_record_client_sched_thread *thread_low;
+  const rtems_record_client_sched_thread *thread_mid;
+  const rtems_record_client_sched_thread *thread_high;
+  char trace[8192];
+} test_context;
+
+static test_context test_instance;
+
+static void send_events(test_context *ctx, rtems_event_set events)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send(ctx->runner, events);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_events(rtems_event_set events)
+{
+  rtems_status_code sc;
+  rtems_event_set received;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &received
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void obtain(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void release(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_release(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void low_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  /* The runner preempts this task while it owns the mutex */
+  obtain(ctx);
+  send_events(ctx, EVENT_OBTAINED);
+
+  /* This task executes again once the high and mid tasks are blocked */
+  release(ctx);
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void mid_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  /*
+   * This task executes while the high task waits for the mutex owned by the
+   * preempted low task.  The mutex has no locking protocol, so this is a
+   * priority inversion.
+   */
+  send_events(ctx, EVENT_MID);
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void high_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+  obtain(ctx);
+  release(ctx);
+  send_events(ctx, EVENT_HIGH);
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void segment_handler(
+  const rtems_record_client_sched_segment *segment,
+  void *arg
+)
+{
+  test_context *ctx;
+
+  ctx = arg;
+
+  switch (segment->kind) {
+    case RTEMS_RECORD_CLIENT_SCHED_SEGMENT_EXECUTE:
+      ++ctx->execute_count;
+      break;
+    case RTEMS_RECORD_CLIENT_SCHED_SEGMENT_READY:
+      ++ctx->ready_count;
+      break;
+    default:
+      rtems_test_assert(
+        segment->kind == RTEMS_RECORD_CLIENT_SCHED_SEGMENT_INVERSION
+      );
+      rtems_test_assert(segment->thread->id == ctx->high);
+      rtems_test_assert(segment->owner->id == ctx->low);
+      rtems_test_assert(segment->runner->id == ctx->mid);
+      rtems_test_assert(segment->begin == segment->end);
+      ++ctx->inversion_count;
+      break;
+  }
+
+  rtems_record_client_chrome_segment(segment, &ctx->chrome);
+}
+
+static void drain_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  test_context *ctx;
+  rtems_record_client_status cs;
+
+  ctx = arg;
+  cs = rtems_record_client_run(&ctx->client, items, count * sizeof(*items));
+  rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+}
+
+static void discard_visitor(
+  const rtems_record_item *items,
+  size_t                   count,
+  void                    *arg
+)
+{
+  (void) items;
+  (void) count;
+  (void) arg;
+}
+
+static void find_visitor(
+  const rtems_record_client_sched_thread *thread,
+  void *arg
+)
+{
+  test_context *ctx;
+
+  ctx = arg;
+
+  if (thread->id == ctx->low) {
+    ctx->thread_low = thread;
+  } else if (thread->id == ctx->mid) {
+    ctx->thread_mid = thread;
+  } else if (thread->id == ctx->high) {
+    ctx->thread_high = thread;
+  }
+}
+
+static rtems_id create_task(rtems_name name, rtems_task_priority priority)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    name,
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void start_task(
+  test_context *ctx,
+  rtems_id id,
+  rtems_task_entry entry
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_start(id, entry, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void run_priority_inversion(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  ctx->runner = rtems_task_self();
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'U', 'T', 'X'),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->mutex
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->low = create_task(rtems_build_name('L', 'O', 'W', ' '), LOW_PRIORITY);
+  ctx->mid = create_task(rtems_build_name('M', 'I', 'D', ' '), MID_PRIORITY);
+  ctx->high = create_task(
+    rtems_build_name('H', 'I', 'G', 'H'),
+    HIGH_PRIORITY
+  );
+
+  start_task(ctx, ctx->low, low_task);
+  wait_for_events(EVENT_OBTAINED);
+
+  /*
+   * The high task blocks on the mutex owned by the low task.  Then the mid
+   * task executes while the low task is ready.
+   */
+  start_task(ctx, ctx->high, high_task);
+  start_task(ctx, ctx->mid, mid_task);
+  wait_for_events(EVENT_MID);
+
+  /*
+   * The mid task executes a second time while the high task waits for the
+   * mutex.  The low task releases the mutex once the mid task suspended
+   * itself.
+   */
+  wait_for_events(EVENT_HIGH);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  Record_Stream_header header;
+  size_t size;
+  rtems_record_client_status cs;
+  const rtems_record_client_sched_thread *thread;
+  FILE *file;
+  int rv;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  /* Discard the items produced so far */
+  rtems_record_drain(discard_visitor, NULL);
+
+  /*
+   * Only the items produced by the record extensions are analysed, for example
+   * the thread create with the thread name, the thread switches with the
+   * thread state, the thread queue owner, and the thread priority.
+   */
+  run_priority_inversion(ctx);
+
+  file = fmemopen(ctx->trace, sizeof(ctx->trace), "w");
+  rtems_test_assert(file != NULL);
+  rtems_record_client_chrome_begin(&ctx->chrome, file);
+  rtems_record_client_sched_init(&ctx->sched, segment_handler, ctx);
+  rtems_record_client_init(
+    &ctx->client,
+    rtems_record_client_sched_process,
+    &ctx->sched
+  );
+  size = _Record_Stream_header_initialize(&header);
+  cs = rtems_record_client_run(&ctx->client, &header, size);
+  rtems_test_assert(cs == RTEMS_RECORD_CLIENT_SUCCESS);
+  rtems_record_drain(drain_visitor, ctx);
+  rtems_record_client_destroy(&ctx->client);
+  rtems_record_client_sched_finish(&ctx->sched);
+  rtems_record_client_chrome_end(&ctx->chrome);
+  rv = fclose(file);
+  rtems_test_assert(rv == 0);
+
+  rtems_record_client_sched_visit_threads(&ctx->sched, find_visitor, ctx);
+  rtems_test_assert(ctx->sched.overflow_count == 0);
+  rtems_test_assert(ctx->sched.per_cpu[0].busy_time > 0);
+  rtems_test_assert(ctx->sched.state_events);
+  rtems_test_assert(ctx->execute_count >= 8);
+
+  thread = ctx->thread_low;
+  rtems_test_assert(thread != NULL);
+  rtems_test_assert(strcmp(thread->name, "LOW ") == 0);
+  rtems_test_assert(thread->priority_known);
+  rtems_test_assert(thread->priority == LOW_PRIORITY);
+  rtems_test_assert(thread->switch_in_count >= 2);
+  rtems_test_assert(thread->run_time > 0);
+  rtems_test_assert(thread->ready_count >= 1);
+  rtems_test_assert(thread->total_ready_latency > 0);
+  rtems_test_assert(thread->max_ready_latency > 0);
+  rtems_test_assert(thread->inversion_count == 0);
+
+  thread = ctx->thread_mid;
+  rtems_test_assert(thread != NULL);
+  rtems_test_assert(strcmp(thread->name, "MID ") == 0);
+  rtems_test_assert(thread->priority_known);
+  rtems_test_assert(thread->priority == MID_PRIORITY);
+  rtems_test_assert(thread->switch_in_count == 2);
+  rtems_test_assert(thread->ready_count == 1);
+  rtems_test_assert(thread->inversion_count == 0);
+
+  thread = ctx->thread_high;
+  rtems_test_assert(thread != NULL);
+  rtems_test_assert(strcmp(thread->name, "HIGH") == 0);
+  rtems_test_assert(thread->priority_known);
+  rtems_test_assert(thread->priority == HIGH_PRIORITY);
+  rtems_test_assert(thread->switch_in_count >= 2);
+  rtems_test_assert(thread->inversion_count == 2);
+  rtems_test_assert(!thread->waiting);
+
+  rtems_test_assert(ctx->sched.inversion_count == 2);
+  rtems_test_assert(ctx->inversion_count == 2);
+  rtems_test_assert(ctx->ready_count >= 2);
+  rtems_record_client_sched_destroy(&ctx->sched);
+
+  rtems_test_assert(ctx->trace[0] == '[');
+  rtems_test_assert(strstr(ctx->trace, "\"name\":\"HIGH\"") != NULL);
+  rtems_test_assert(strstr(ctx->trace, "\"cat\":\"execute\"") != NULL);
+  rtems_test_assert(strstr(ctx->trace, "\"cat\":\"ready\"") != NULL);
+  rtems_test_assert(strstr(ctx->trace, "\"cat\":\"inversion\"") != NULL);
+  rtems_test_assert(strstr(ctx->trace, "\n]\n") != NULL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS 1024
+
+#define CONFIGURE_RECORD_EXTENSIONS_ENABLED
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
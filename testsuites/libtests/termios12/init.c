@@ -0,0 +1,392 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems/termiostypes.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "TERMIOS 12";
+
+#define DEVICE_PATH "/dma"
+
+#define RAW_OUTPUT_BUFFER_SIZE 64
+
+#define OUTPUT_BUFFER_SIZE 1024
+
+#define DIRECT_SIZE 256
+
+typedef struct {
+  rtems_termios_device_context base;
+  rtems_termios_tty *tty;
+  rtems_id tx_task_id;
+  size_t output_pending;
+  const struct iovec *vector;
+  int vector_count;
+  int vector_calls;
+  const void *vector_base;
+  int completion_parts;
+  size_t output_count;
+  char output_buf[OUTPUT_BUFFER_SIZE];
+  char data[DIRECT_SIZE];
+  int fd;
+} test_context;
+
+static test_context test_instance = {
+  .base = RTEMS_TERMIOS_DEVICE_CONTEXT_INITIALIZER("DMA")
+};
+
+static bool first_open(
+  rtems_termios_tty *tty,
+  rtems_termios_device_context *base,
+  struct termios *term,
+  rtems_libio_open_close_args_t *args
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  ctx->tty = tty;
+
+  return true;
+}
+
+static void output(test_context *ctx, const void *buf, size_t len)
+{
+  rtems_test_assert(ctx->output_count + len <= OUTPUT_BUFFER_SIZE);
+  memcpy(&ctx->output_buf[ctx->output_count], buf, len);
+  ctx->output_count += len;
+}
+
+static void device_write(
+  rtems_termios_device_context *base,
+  const char *buf,
+  size_t len
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  rtems_test_assert(ctx->vector == NULL);
+
+  if (len > 0) {
+    output(ctx, buf, len);
+    ctx->output_pending = len;
+  }
+}
+
+static void device_write_vector(
+  rtems_termios_device_context *base,
+  const struct iovec *iov,
+  int iovcnt
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  rtems_test_assert(ctx->vector == NULL);
+  rtems_test_assert(ctx->output_pending == 0);
+
+  ctx->vector = iov;
+  ctx->vector_count = iovcnt;
+  ctx->vector_base = iov[0].iov_base;
+  ++ctx->vector_calls;
+}
+
+static const rtems_termios_device_handler handler = {
+  .first_open = first_open,
+  .write = device_write,
+  .write_vector = device_write_vector,
+  .mode = TERMIOS_IRQ_DRIVEN
+};
+
+/*
+ * Simulates the transmit interrupt.  This task has a lower priority than the
+ * Init task, so it runs only if the Init task waits for the transmitter.  A
+ * scatter-gather transfer is reported in completion_parts parts to cover
+ * partial and batched completions.
+ */
+static void tx_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    if (ctx->vector != NULL) {
+      const struct iovec *iov = ctx->vector;
+      size_t total = 0;
+      size_t part;
+      int i;
+
+      for (i = 0; i < ctx->vector_count; ++i) {
+        output(ctx, iov[i].iov_base, iov[i].iov_len);
+        total += iov[i].iov_len;
+      }
+
+      ctx->vector = NULL;
+      part = total / ctx->completion_parts;
+
+      for (i = 1; i < ctx->completion_parts; ++i) {
+        rtems_termios_dequeue_characters(ctx->tty, (int) part);
+        total -= part;
+      }
+
+      rtems_termios_dequeue_characters(ctx->tty, (int) total);
+    } else if (ctx->output_pending > 0) {
+      size_t len = ctx->output_pending;
+
+      ctx->output_pending = 0;
+      rtems_termios_dequeue_characters(ctx->tty, (int) len);
+    }
+  }
+}
+
+static void clear_output(test_context *ctx)
+{
+  ctx->output_count = 0;
+  ctx->vector_calls = 0;
+  ctx->completion_parts = 1;
+  memset(ctx->output_buf, 0, OUTPUT_BUFFER_SIZE);
+}
+
+static void drain(test_context *ctx)
+{
+  int rv;
+
+  rv = tcdrain(ctx->fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void set_oflag(test_context *ctx, tcflag_t oflag)
+{
+  struct termios term;
+  int rv;
+
+  rv = tcgetattr(ctx->fd, &term);
+  rtems_test_assert(rv == 0);
+
+  term.c_oflag = oflag;
+
+  rv = tcsetattr(ctx->fd, TCSANOW, &term);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_small_write(test_context *ctx)
+{
+  ssize_t n;
+
+  clear_output(ctx);
+
+  n = write(ctx->fd, &ctx->data[0], RAW_OUTPUT_BUFFER_SIZE / 2);
+  rtems_test_assert(n == RAW_OUTPUT_BUFFER_SIZE / 2);
+  drain(ctx);
+
+  rtems_test_assert(ctx->vector_calls == 0);
+  rtems_test_assert(ctx->output_count == RAW_OUTPUT_BUFFER_SIZE / 2);
+  rtems_test_assert(
+    memcmp(ctx->output_buf, ctx->data, RAW_OUTPUT_BUFFER_SIZE / 2) == 0
+  );
+}
+
+static void test_direct_write(test_context *ctx, int completion_parts)
+{
+  char c;
+  ssize_t n;
+
+  clear_output(ctx);
+  ctx->completion_parts = completion_parts;
+
+  /* Ensure that pending characters of the raw output buffer go out first */
+  c = 'x';
+  n = write(ctx->fd, &c, sizeof(c));
+  rtems_test_assert(n == 1);
+  rtems_test_assert(ctx->output_count == 1);
+
+  n = write(ctx->fd, &ctx->data[0], DIRECT_SIZE);
+  rtems_test_assert(n == DIRECT_SIZE);
+
+  rtems_test_assert(ctx->vector_calls == 1);
+  rtems_test_assert(ctx->vector_count == 1);
+  rtems_test_assert(ctx->vector_base == &ctx->data[0]);
+  rtems_test_assert(ctx->output_count == DIRECT_SIZE + 1);
+  rtems_test_assert(ctx->output_buf[0] == 'x');
+  rtems_test_assert(
+    memcmp(&ctx->output_buf[1], ctx->data, DIRECT_SIZE) == 0
+  );
+  rtems_test_assert(ctx->tty->rawOutBufState == rob_idle);
+  rtems_test_assert(ctx->tty->rawOutDirectLen == 0);
+}
+
+static void test_writev(test_context *ctx)
+{
+  struct iovec iov[3];
+  ssize_t n;
+
+  clear_output(ctx);
+
+  iov[0].iov_base = &ctx->data[0];
+  iov[0].iov_len = 10;
+  iov[1].iov_base = &ctx->data[10];
+  iov[1].iov_len = 0;
+  iov[2].iov_base = &ctx->data[10];
+  iov[2].iov_len = 20;
+
+  n = writev(ctx->fd, iov, RTEMS_ARRAY_SIZE(iov));
+  rtems_test_assert(n == 30);
+
+  rtems_test_assert(ctx->vector_calls == 1);
+  rtems_test_assert(ctx->vector_count == 3);
+  rtems_test_assert(ctx->vector_base == &ctx->data[0]);
+  rtems_test_assert(ctx->output_count == 30);
+  rtems_test_assert(memcmp(ctx->output_buf, ctx->data, 30) == 0);
+}
+
+static void test_opost(test_context *ctx)
+{
+  ssize_t n;
+
+  clear_output(ctx);
+  set_oflag(ctx, OPOST);
+
+  n = write(ctx->fd, &ctx->data[0], DIRECT_SIZE);
+  rtems_test_assert(n == DIRECT_SIZE);
+  drain(ctx);
+
+  rtems_test_assert(ctx->vector_calls == 0);
+  rtems_test_assert(ctx->output_count == DIRECT_SIZE);
+  rtems_test_assert(memcmp(ctx->output_buf, ctx->data, DIRECT_SIZE) == 0);
+
+  set_oflag(ctx, 0);
+}
+
+static void test_non_blocking(test_context *ctx)
+{
+  int flags;
+  int rv;
+  ssize_t n;
+
+  clear_output(ctx);
+
+  flags = fcntl(ctx->fd, F_GETFL, 0);
+  rtems_test_assert(flags >= 0);
+
+  rv = fcntl(ctx->fd, F_SETFL, flags | O_NONBLOCK);
+  rtems_test_assert(rv == 0);
+
+  n = write(ctx->fd, &ctx->data[0], DIRECT_SIZE);
+  rtems_test_assert(n == RAW_OUTPUT_BUFFER_SIZE - 1);
+
+  rv = fcntl(ctx->fd, F_SETFL, flags);
+  rtems_test_assert(rv == 0);
+
+  drain(ctx);
+
+  rtems_test_assert(ctx->vector_calls == 0);
+  rtems_test_assert(ctx->output_count == RAW_OUTPUT_BUFFER_SIZE - 1);
+  rtems_test_assert(
+    memcmp(ctx->output_buf, ctx->data, RAW_OUTPUT_BUFFER_SIZE - 1) == 0
+  );
+}
+
+static void setup(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < DIRECT_SIZE; ++i) {
+    ctx->data[i] = (char) i;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'X', ' ', ' '),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->tx_task_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->tx_task_id, tx_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_termios_initialize();
+
+  sc = rtems_termios_bufsize(256, 256, RAW_OUTPUT_BUFFER_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_termios_device_install(DEVICE_PATH, &handler, NULL, &ctx->base);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->fd = open(DEVICE_PATH, O_RDWR);
+  rtems_test_assert(ctx->fd >= 0);
+
+  set_oflag(ctx, 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  setup(ctx);
+  test_small_write(ctx);
+  test_direct_write(ctx, 1);
+  test_direct_write(ctx, 4);
+  test_writev(ctx);
+  test_opost(ctx);
+  test_non_blocking(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,329 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <aio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/posix/aio_misc.h>
+
+const char rtems_test_name[] = "PSXAIO 4";
+
+#define CHUNK_COUNT 8
+
+#define CHUNK_SIZE 16
+
+static struct aiocb aiocbs[CHUNK_COUNT + 2];
+
+static char buffers[CHUNK_COUNT][CHUNK_SIZE];
+
+static volatile bool signal_received;
+
+static void signal_handler(int signo)
+{
+  rtems_test_assert(signo == SIGUSR1);
+  signal_received = true;
+}
+
+static void init_aiocb(
+  struct aiocb *aiocbp,
+  int fd,
+  int opcode,
+  void *buf,
+  size_t nbytes,
+  off_t offset
+)
+{
+  memset(aiocbp, 0, sizeof(*aiocbp));
+  aiocbp->aio_fildes = fd;
+  aiocbp->aio_lio_opcode = opcode;
+  aiocbp->aio_buf = buf;
+  aiocbp->aio_nbytes = nbytes;
+  aiocbp->aio_offset = offset;
+}
+
+static void wait_for_completion(const struct aiocb *aiocbp)
+{
+  while (aio_error(aiocbp) == EINPROGRESS) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_listio_wait(int fd)
+{
+  struct aiocb *list[CHUNK_COUNT + 2];
+  char expected[CHUNK_COUNT * CHUNK_SIZE];
+  char data[CHUNK_COUNT * CHUNK_SIZE];
+  ssize_t n;
+  int rv;
+  int i;
+
+  /* Adjacent writes are merged into vectored transfers */
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    memset(buffers[i], 'A' + i, CHUNK_SIZE);
+    init_aiocb(
+      &aiocbs[i],
+      fd,
+      LIO_WRITE,
+      buffers[i],
+      CHUNK_SIZE,
+      i * CHUNK_SIZE
+    );
+    list[i] = &aiocbs[i];
+    memset(&expected[i * CHUNK_SIZE], 'A' + i, CHUNK_SIZE);
+  }
+
+  init_aiocb(&aiocbs[CHUNK_COUNT], fd, LIO_NOP, NULL, 0, 0);
+  list[CHUNK_COUNT] = &aiocbs[CHUNK_COUNT];
+  list[CHUNK_COUNT + 1] = NULL;
+
+  rv = lio_listio(LIO_WAIT, list, CHUNK_COUNT + 2, NULL);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    rtems_test_assert(aio_error(&aiocbs[i]) == 0);
+    rtems_test_assert(aio_return(&aiocbs[i]) == CHUNK_SIZE);
+  }
+
+  n = pread(fd, data, sizeof(data), 0);
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+  rtems_test_assert(memcmp(data, expected, sizeof(data)) == 0);
+
+  /* The file offset is not changed by the vectored transfers */
+  rtems_test_assert(lseek(fd, 0, SEEK_CUR) == 0);
+
+  /* Adjacent reads, the last one is short at the end of file */
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    memset(buffers[i], 0, CHUNK_SIZE);
+    init_aiocb(
+      &aiocbs[i],
+      fd,
+      LIO_READ,
+      buffers[i],
+      CHUNK_SIZE,
+      i * CHUNK_SIZE + CHUNK_SIZE / 2
+    );
+    list[i] = &aiocbs[i];
+  }
+
+  rv = lio_listio(LIO_WAIT, list, CHUNK_COUNT, NULL);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    size_t offset = i * CHUNK_SIZE + CHUNK_SIZE / 2;
+    size_t size = i < CHUNK_COUNT - 1 ? CHUNK_SIZE : CHUNK_SIZE / 2;
+
+    rtems_test_assert(aio_error(&aiocbs[i]) == 0);
+    rtems_test_assert(aio_return(&aiocbs[i]) == (ssize_t) size);
+    rtems_test_assert(memcmp(buffers[i], &expected[offset], size) == 0);
+  }
+}
+
+static void test_listio_errors(int fd)
+{
+  struct aiocb *list[2];
+  char buf[CHUNK_SIZE];
+  int rv;
+
+  init_aiocb(&aiocbs[0], fd, LIO_WRITE, buf, sizeof(buf), 0);
+  list[0] = &aiocbs[0];
+
+  errno = 0;
+  rv = lio_listio(-1, list, 1, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = lio_listio(LIO_WAIT, list, 0, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = lio_listio(LIO_WAIT, list, AIO_LISTIO_MAX + 1, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* The valid entry is carried out despite the invalid one */
+  memset(buf, 'x', sizeof(buf));
+  init_aiocb(&aiocbs[1], 1234, LIO_READ, buf, sizeof(buf), 0);
+  list[1] = &aiocbs[1];
+
+  errno = 0;
+  rv = lio_listio(LIO_WAIT, list, 2, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EIO);
+  rtems_test_assert(aio_error(&aiocbs[0]) == 0);
+  rtems_test_assert(aio_return(&aiocbs[0]) == CHUNK_SIZE);
+  rtems_test_assert(aio_error(&aiocbs[1]) == EBADF);
+  rtems_test_assert(aio_return(&aiocbs[1]) == -1);
+}
+
+static void test_listio_nowait(int fd)
+{
+  struct aiocb *list[CHUNK_COUNT];
+  struct sigaction act;
+  struct sigevent sig;
+  rtems_status_code sc;
+  int rv;
+  int i;
+
+  memset(&act, 0, sizeof(act));
+  act.sa_handler = signal_handler;
+  rv = sigaction(SIGUSR1, &act, NULL);
+  rtems_test_assert(rv == 0);
+
+  memset(&sig, 0, sizeof(sig));
+  sig.sigev_notify = SIGEV_SIGNAL;
+  sig.sigev_signo = SIGUSR1;
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    memset(buffers[i], 'a' + i, CHUNK_SIZE);
+    init_aiocb(
+      &aiocbs[i],
+      fd,
+      LIO_WRITE,
+      buffers[i],
+      CHUNK_SIZE,
+      i * CHUNK_SIZE
+    );
+    list[i] = &aiocbs[i];
+  }
+
+  rv = lio_listio(LIO_NOWAIT, list, CHUNK_COUNT, &sig);
+  rtems_test_assert(rv == 0);
+
+  while (!signal_received) {
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    rtems_test_assert(aio_error(&aiocbs[i]) == 0);
+    rtems_test_assert(aio_return(&aiocbs[i]) == CHUNK_SIZE);
+  }
+
+  sig.sigev_notify = SIGEV_THREAD;
+  errno = 0;
+  rv = lio_listio(LIO_NOWAIT, list, CHUNK_COUNT, &sig);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+}
+
+static void test_fd_order(int fd)
+{
+  char data[CHUNK_SIZE];
+  ssize_t n;
+  int rv;
+  int i;
+
+  /* Requests to the same file are carried out in submission order */
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    memset(buffers[i], '0' + i, CHUNK_SIZE);
+    init_aiocb(&aiocbs[i], fd, LIO_WRITE, buffers[i], CHUNK_SIZE, 0);
+    rv = aio_write(&aiocbs[i]);
+    rtems_test_assert(rv == 0);
+  }
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    wait_for_completion(&aiocbs[i]);
+    rtems_test_assert(aio_error(&aiocbs[i]) == 0);
+    rtems_test_assert(aio_return(&aiocbs[i]) == CHUNK_SIZE);
+  }
+
+  n = pread(fd, data, sizeof(data), 0);
+  rtems_test_assert(n == CHUNK_SIZE);
+  rtems_test_assert(memcmp(data, buffers[CHUNK_COUNT - 1], CHUNK_SIZE) == 0);
+
+  rv = aio_cancel(fd, NULL);
+  rtems_test_assert(rv == AIO_ALLDONE);
+
+  rv = aio_cancel(fd, &aiocbs[0]);
+  rtems_test_assert(rv == AIO_ALLDONE);
+}
+
+static void *POSIX_Init(void *arg)
+{
+  int fd;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = rtems_aio_init();
+  rtems_test_assert(rv == 0);
+
+  /* The worker pool is created only once */
+  rv = rtems_aio_init();
+  rtems_test_assert(rv == 0);
+
+  fd = open("/file", O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  test_listio_wait(fd);
+  test_listio_errors(fd);
+  test_listio_nowait(fd);
+  test_fd_order(fd);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink("/file");
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS (1 + AIO_MAX_THREADS)
+
+#define CONFIGURE_EXTRA_TASK_STACKS \
+  (2 * AIO_MAX_THREADS * RTEMS_MINIMUM_STACK_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
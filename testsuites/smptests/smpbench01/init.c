@@ -0,0 +1,737 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/test.h>
+#include <rtems/test-info.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/atomic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * This benchmark measures the runtime of operations on shared objects on
+ * processor 0 while contender tasks on the processors 1, ..., N - 1 perform
+ * the same operations.  For each operation, the contention level is swept from
+ * zero to N - 1 contenders.  Without contenders, all variants of
+ * T_measure_runtime() are measured, which sweep also the count of processors
+ * with a cache load.  With contenders, only the HotCache variant is measured.
+ * The event sends of all processors go to one shared target task.  The event
+ * send to a blocked task on another processor is measured for each target
+ * processor.  The runtime measurement covers only the sender side, this
+ * includes the request of the cross-processor wakeup.  In addition, the
+ * wakeup latency from the event send until the task runs on the other
+ * processor is measured.  The task takes the CPU counter value when it resumes
+ * execution and hands it back to the sender.  This relies on the system-wide
+ * CPU counter required by SMP configurations.  The results are reported also
+ * as JSON and CSV.
+ */
+
+const char rtems_test_name[] = "SMPBENCH 1";
+
+#define CPU_COUNT 32
+
+#define SAMPLE_COUNT 100
+
+#define MSG_COUNT CPU_COUNT
+
+#define MSG_SIZE sizeof(uint32_t)
+
+#define CONTENDER_PRIORITY 2
+
+#define EVENT_START RTEMS_EVENT_1
+
+#define EVENT_OPERATION RTEMS_EVENT_2
+
+#define EVENT_WAKEUP RTEMS_EVENT_3
+
+#define REQUEST_FLAGS \
+  (T_MEASURE_RUNTIME_ALLOW_CLOCK_ISR | T_MEASURE_RUNTIME_REPORT_JSON | \
+  T_MEASURE_RUNTIME_REPORT_CSV)
+
+#define CONTENDED_REQUEST_FLAGS \
+  (REQUEST_FLAGS | T_MEASURE_RUNTIME_DISABLE_FULL_CACHE | \
+  T_MEASURE_RUNTIME_DISABLE_DIRTY_CACHE | \
+  T_MEASURE_RUNTIME_DISABLE_MINOR_LOAD | T_MEASURE_RUNTIME_DISABLE_MAX_LOAD)
+
+typedef struct test_context test_context;
+
+typedef struct {
+  const char *name;
+  void (*operation)(test_context *, uint32_t);
+} workload;
+
+struct test_context {
+  T_measure_runtime_context *measure;
+  T_measure_runtime_request request;
+  const workload *workload;
+  uint32_t cpu_count;
+  rtems_id contenders[CPU_COUNT];
+  Atomic_Uint stop;
+  Atomic_Uint done;
+  rtems_id mutex;
+  rtems_id sema;
+  rtems_id mq;
+  rtems_id barrier;
+  rtems_id timers[CPU_COUNT];
+  rtems_id event_target;
+  rtems_id wakeup_task;
+  Atomic_Uint wakeup_ready;
+  Atomic_Uint wakeup_done;
+  rtems_counter_ticks wakeup_instant;
+  uint64_t wakeup_latency[SAMPLE_COUNT];
+  char name[64];
+};
+
+static test_context test_instance;
+
+static void contender_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  uint32_t cpu_index;
+
+  ctx = &test_instance;
+  cpu_index = (uint32_t) arg;
+
+  while (true) {
+    rtems_event_set events;
+
+    (void) rtems_event_receive(
+      EVENT_START,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+
+    while (_Atomic_Load_uint(&ctx->stop, ATOMIC_ORDER_ACQUIRE) == 0) {
+      (*ctx->workload->operation)(ctx, cpu_index);
+    }
+
+    _Atomic_Fetch_add_uint(&ctx->done, 1, ATOMIC_ORDER_RELEASE);
+  }
+}
+
+static void start_contenders(test_context *ctx, uint32_t contenders)
+{
+  rtems_status_code sc;
+  uint32_t i;
+
+  _Atomic_Store_uint(&ctx->stop, 0, ATOMIC_ORDER_RELAXED);
+  _Atomic_Store_uint(&ctx->done, 0, ATOMIC_ORDER_RELAXED);
+
+  for (i = 1; i <= contenders; ++i) {
+    sc = rtems_event_send(ctx->contenders[i], EVENT_START);
+    T_quiet_rsc_success(sc);
+  }
+}
+
+static void stop_contenders(test_context *ctx, uint32_t contenders)
+{
+  _Atomic_Store_uint(&ctx->stop, 1, ATOMIC_ORDER_RELEASE);
+
+  while (_Atomic_Load_uint(&ctx->done, ATOMIC_ORDER_ACQUIRE) != contenders) {
+    /* Wait for the contenders to finish their current operation */
+  }
+}
+
+static void operation_body(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  (*ctx->workload->operation)(ctx, 0);
+}
+
+static void measure_workload(test_context *ctx, const workload *w)
+{
+  uint32_t contenders;
+
+  ctx->workload = w;
+
+  for (contenders = 0; contenders < ctx->cpu_count; ++contenders) {
+    (void) T_snprintf(
+      ctx->name,
+      sizeof(ctx->name),
+      "%s/Contenders/%" PRIu32,
+      w->name,
+      contenders
+    );
+    ctx->request.name = ctx->name;
+    ctx->request.body = operation_body;
+    ctx->request.teardown = NULL;
+
+    if (contenders == 0) {
+      ctx->request.flags = REQUEST_FLAGS;
+    } else {
+      ctx->request.flags = CONTENDED_REQUEST_FLAGS;
+    }
+
+    start_contenders(ctx, contenders);
+    T_measure_runtime(ctx->measure, &ctx->request);
+    stop_contenders(ctx, contenders);
+  }
+}
+
+static void setup(void *arg)
+{
+  test_context *ctx;
+  T_measure_runtime_config config;
+  rtems_status_code sc;
+  uint32_t i;
+
+  ctx = arg;
+  ctx->cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if (ctx->cpu_count > CPU_COUNT) {
+    ctx->cpu_count = CPU_COUNT;
+  }
+
+  memset(&config, 0, sizeof(config));
+  config.sample_count = SAMPLE_COUNT;
+  ctx->measure = T_measure_runtime_create(&config);
+  T_assert_not_null(ctx->measure);
+  ctx->request.arg = ctx;
+
+  /* The runner executes on processor 0, see T_measure_runtime_create() */
+  for (i = 1; i < ctx->cpu_count; ++i) {
+    rtems_id id;
+    cpu_set_t cpus;
+
+    sc = rtems_task_create(
+      rtems_build_name('C', 'O', 'N', 'T'),
+      CONTENDER_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    T_assert_rsc_success(sc);
+    ctx->contenders[i] = id;
+
+    CPU_ZERO(&cpus);
+    CPU_SET((int) i, &cpus);
+    sc = rtems_task_set_affinity(id, sizeof(cpus), &cpus);
+    T_assert_rsc_success(sc);
+
+    sc = rtems_task_start(id, contender_task, i);
+    T_assert_rsc_success(sc);
+  }
+}
+
+static void teardown(void *arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t i;
+
+  ctx = arg;
+
+  for (i = 1; i < ctx->cpu_count; ++i) {
+    if (ctx->contenders[i] != 0) {
+      sc = rtems_task_delete(ctx->contenders[i]);
+      T_rsc_success(sc);
+      ctx->contenders[i] = 0;
+    }
+  }
+}
+
+static const T_fixture fixture = {
+  .setup = setup,
+  .teardown = teardown,
+  .initial_context = &test_instance
+};
+
+static void mutex_operation(test_context *ctx, uint32_t cpu_index)
+{
+  (void) cpu_index;
+  (void) rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  (void) rtems_semaphore_release(ctx->mutex);
+}
+
+static const workload mutex_workload = {
+  .name = "MutexObtainRelease",
+  .operation = mutex_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchMutex, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = T_fixture_context();
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'U', 'T', 'X'),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->mutex
+  );
+  T_assert_rsc_success(sc);
+
+  measure_workload(ctx, &mutex_workload);
+
+  sc = rtems_semaphore_delete(ctx->mutex);
+  T_rsc_success(sc);
+}
+
+static void sema_operation(test_context *ctx, uint32_t cpu_index)
+{
+  (void) cpu_index;
+  (void) rtems_semaphore_obtain(ctx->sema, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  (void) rtems_semaphore_release(ctx->sema);
+}
+
+static const workload sema_workload = {
+  .name = "SemaphoreObtainRelease",
+  .operation = sema_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchSemaphore, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = T_fixture_context();
+  sc = rtems_semaphore_create(
+    rtems_build_name('S', 'E', 'M', 'A'),
+    1,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_FIFO,
+    0,
+    &ctx->sema
+  );
+  T_assert_rsc_success(sc);
+
+  measure_workload(ctx, &sema_workload);
+
+  sc = rtems_semaphore_delete(ctx->sema);
+  T_rsc_success(sc);
+}
+
+static void mq_operation(test_context *ctx, uint32_t cpu_index)
+{
+  uint32_t msg;
+  size_t size;
+
+  /*
+   * Each sender receives a message afterwards, so the queue is never full
+   * and a receiver waits only for a short time.
+   */
+  msg = cpu_index;
+  (void) rtems_message_queue_send(ctx->mq, &msg, sizeof(msg));
+  (void) rtems_message_queue_receive(
+    ctx->mq,
+    &msg,
+    &size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static const workload mq_workload = {
+  .name = "MessageQueueSendReceive",
+  .operation = mq_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchMessageQueue, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = T_fixture_context();
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    MSG_COUNT,
+    MSG_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->mq
+  );
+  T_assert_rsc_success(sc);
+
+  measure_workload(ctx, &mq_workload);
+
+  sc = rtems_message_queue_delete(ctx->mq);
+  T_rsc_success(sc);
+}
+
+static void event_target_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    rtems_event_set events;
+
+    /* The start event is never sent to this task, so it stays blocked */
+    (void) rtems_event_receive(
+      EVENT_START,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+  }
+}
+
+static void event_operation(test_context *ctx, uint32_t cpu_index)
+{
+  /*
+   * All processors send to the same blocked task and contend for its thread
+   * wait lock.  The sent events do not satisfy the wait condition.
+   */
+  (void) cpu_index;
+  (void) rtems_event_send(ctx->event_target, EVENT_OPERATION);
+}
+
+static const workload event_workload = {
+  .name = "EventSendShared",
+  .operation = event_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchEvent, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = T_fixture_context();
+  sc = rtems_task_create(
+    rtems_build_name('E', 'V', 'T', 'G'),
+    CONTENDER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->event_target
+  );
+  T_assert_rsc_success(sc);
+
+  sc = rtems_task_start(ctx->event_target, event_target_task, 0);
+  T_assert_rsc_success(sc);
+
+  measure_workload(ctx, &event_workload);
+
+  sc = rtems_task_delete(ctx->event_target);
+  T_rsc_success(sc);
+}
+
+static void barrier_operation(test_context *ctx, uint32_t cpu_index)
+{
+  uint32_t released;
+
+  (void) cpu_index;
+  (void) rtems_barrier_release(ctx->barrier, &released);
+}
+
+static const workload barrier_workload = {
+  .name = "BarrierRelease",
+  .operation = barrier_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchBarrier, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = T_fixture_context();
+  sc = rtems_barrier_create(
+    rtems_build_name('B', 'A', 'R', 'R'),
+    RTEMS_BARRIER_MANUAL_RELEASE,
+    0,
+    &ctx->barrier
+  );
+  T_assert_rsc_success(sc);
+
+  measure_workload(ctx, &barrier_workload);
+
+  sc = rtems_barrier_delete(ctx->barrier);
+  T_rsc_success(sc);
+}
+
+static void malloc_operation(test_context *ctx, uint32_t cpu_index)
+{
+  void *p;
+
+  (void) ctx;
+  (void) cpu_index;
+  p = malloc(64);
+  RTEMS_OBFUSCATE_VARIABLE(p);
+  free(p);
+}
+
+static const workload malloc_workload = {
+  .name = "MallocFree",
+  .operation = malloc_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchMalloc, &fixture)
+{
+  measure_workload(T_fixture_context(), &malloc_workload);
+}
+
+static void timer_routine(rtems_id id, void *arg)
+{
+  (void) id;
+  (void) arg;
+}
+
+static void watchdog_operation(test_context *ctx, uint32_t cpu_index)
+{
+  /* Each fire after removes the pending watchdog and inserts it again */
+  (void) rtems_timer_fire_after(
+    ctx->timers[cpu_index],
+    60 * rtems_clock_get_ticks_per_second(),
+    timer_routine,
+    NULL
+  );
+}
+
+static const workload watchdog_workload = {
+  .name = "WatchdogInsert",
+  .operation = watchdog_operation
+};
+
+T_TEST_CASE_FIXTURE(SMPBenchWatchdog, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t i;
+
+  ctx = T_fixture_context();
+
+  for (i = 0; i < ctx->cpu_count; ++i) {
+    sc = rtems_timer_create(
+      rtems_build_name('T', 'I', 'M', 'R'),
+      &ctx->timers[i]
+    );
+    T_assert_rsc_success(sc);
+  }
+
+  measure_workload(ctx, &watchdog_workload);
+
+  for (i = 0; i < ctx->cpu_count; ++i) {
+    sc = rtems_timer_delete(ctx->timers[i]);
+    T_rsc_success(sc);
+  }
+}
+
+static void wakeup_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_event_set events;
+
+    _Atomic_Store_uint(&ctx->wakeup_ready, 1, ATOMIC_ORDER_RELEASE);
+    (void) rtems_event_receive(
+      EVENT_WAKEUP,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    ctx->wakeup_instant = rtems_counter_read();
+    _Atomic_Store_uint(&ctx->wakeup_done, 1, ATOMIC_ORDER_RELEASE);
+  }
+}
+
+static void wakeup_setup(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+
+  while (_Atomic_Load_uint(&ctx->wakeup_ready, ATOMIC_ORDER_ACQUIRE) == 0) {
+    /* Wait for the task to prepare for the next wakeup */
+  }
+
+  /* Give the task some time to block on its event receive */
+  rtems_counter_delay_nanoseconds(10000);
+  _Atomic_Store_uint(&ctx->wakeup_ready, 0, ATOMIC_ORDER_RELAXED);
+}
+
+static void wakeup_body(void *arg)
+{
+  test_context *ctx;
+
+  ctx = arg;
+  (void) rtems_event_send(ctx->wakeup_task, EVENT_WAKEUP);
+}
+
+static int latency_compare(const void *a, const void *b)
+{
+  uint64_t x;
+  uint64_t y;
+
+  x = *(const uint64_t *) a;
+  y = *(const uint64_t *) b;
+
+  if (x < y) {
+    return -1;
+  }
+
+  if (x > y) {
+    return 1;
+  }
+
+  return 0;
+}
+
+static void measure_wakeup_latency(test_context *ctx, uint32_t cpu_index)
+{
+  uint64_t *latency;
+  uint64_t sum;
+  size_t i;
+
+  latency = ctx->wakeup_latency;
+  sum = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks send_instant;
+
+    wakeup_setup(ctx);
+    _Atomic_Store_uint(&ctx->wakeup_done, 0, ATOMIC_ORDER_RELAXED);
+    send_instant = rtems_counter_read();
+    (void) rtems_event_send(ctx->wakeup_task, EVENT_WAKEUP);
+
+    while (_Atomic_Load_uint(&ctx->wakeup_done, ATOMIC_ORDER_ACQUIRE) == 0) {
+      /* Wait for the task to run on its processor */
+    }
+
+    latency[i] = rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(ctx->wakeup_instant, send_instant)
+    );
+    sum += latency[i];
+  }
+
+  qsort(latency, SAMPLE_COUNT, sizeof(latency[0]), latency_compare);
+
+  T_log(
+    T_QUIET,
+    "{\"name\":\"CrossProcessorWakeupLatency/Processor/%" PRIu32 "\","
+    "\"n\":%i,\"min\":%" PRIu64 ",\"q1\":%" PRIu64 ",\"q2\":%" PRIu64 ","
+    "\"q3\":%" PRIu64 ",\"p99\":%" PRIu64 ",\"max\":%" PRIu64 ","
+    "\"mean\":%" PRIu64 ",\"unit\":\"ns\"}",
+    cpu_index,
+    SAMPLE_COUNT,
+    latency[0],
+    latency[SAMPLE_COUNT / 4],
+    latency[SAMPLE_COUNT / 2],
+    latency[(3 * SAMPLE_COUNT) / 4],
+    latency[(99 * SAMPLE_COUNT) / 100],
+    latency[SAMPLE_COUNT - 1],
+    sum / SAMPLE_COUNT
+  );
+}
+
+T_TEST_CASE_FIXTURE(SMPBenchCrossProcessorEventSend, &fixture)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t cpu_index;
+
+  ctx = T_fixture_context();
+
+  for (cpu_index = 1; cpu_index < ctx->cpu_count; ++cpu_index) {
+    cpu_set_t cpus;
+
+    _Atomic_Store_uint(&ctx->wakeup_ready, 0, ATOMIC_ORDER_RELAXED);
+    sc = rtems_task_create(
+      rtems_build_name('W', 'A', 'K', 'E'),
+      CONTENDER_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->wakeup_task
+    );
+    T_assert_rsc_success(sc);
+
+    CPU_ZERO(&cpus);
+    CPU_SET((int) cpu_index, &cpus);
+    sc = rtems_task_set_affinity(ctx->wakeup_task, sizeof(cpus), &cpus);
+    T_assert_rsc_success(sc);
+
+    sc = rtems_task_start(
+      ctx->wakeup_task,
+      wakeup_task,
+      (rtems_task_argument) ctx
+    );
+    T_assert_rsc_success(sc);
+
+    (void) T_snprintf(
+      ctx->name,
+      sizeof(ctx->name),
+      "CrossProcessorEventSend/Processor/%" PRIu32,
+      cpu_index
+    );
+    ctx->request.name = ctx->name;
+    ctx->request.flags = CONTENDED_REQUEST_FLAGS;
+    ctx->request.setup = wakeup_setup;
+    ctx->request.body = wakeup_body;
+    ctx->request.teardown = NULL;
+    T_measure_runtime(ctx->measure, &ctx->request);
+    ctx->request.setup = NULL;
+
+    measure_wakeup_latency(ctx, cpu_index);
+
+    sc = rtems_task_delete(ctx->wakeup_task);
+    T_rsc_success(sc);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_test_run(arg, TEST_STATE);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + 2 * CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MSG_COUNT, MSG_SIZE)
+
+#define CONFIGURE_MAXIMUM_BARRIERS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS CPU_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,350 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/test.h>
+#include <rtems/test-info.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/profiling.h>
+#include <rtems/score/atomic.h>
+
+#include <string.h>
+
+/*
+ * This benchmark measures the cross-processor wakeup latency for each pair of
+ * a source and a target processor.  The wakeup latency is the time interval
+ * between the rtems_event_send() call on the source processor and the return
+ * of rtems_event_receive() in the woken up task on the target processor.  This
+ * includes the scheduler operation, the inter-processor interrupt, and the
+ * thread dispatch on the target processor.  The CPU counters of all
+ * processors must be synchronized to get meaningful values.
+ *
+ * For each processor pair, the following lines are reported:
+ *
+ * W:S:<source>:<target>:N:<count>:MI:<min>:MX:<max>:ME:<mean>
+ *
+ * W:H:<source>:<target>:<count 0>,<count 1>,...
+ *
+ * The times are in nanoseconds.  The histogram bin with index zero counts the
+ * latencies below WAKEUP_BIN_0_NS nanoseconds.  The bin with index i > 0
+ * counts the latencies in the interval [WAKEUP_BIN_0_NS * 2^(i - 1),
+ * WAKEUP_BIN_0_NS * 2^i).  The last bin counts all greater latencies.
+ *
+ * On configurations with profiling enabled, the inter-processor interrupt
+ * latency statistics of each processor are reported in addition:
+ *
+ * W:I:<processor>:N:<count>:MX:<max>:ME:<mean>
+ */
+
+const char rtems_test_name[] = "SMPWAKEUP 1";
+
+#define CPU_COUNT 32
+
+#define SAMPLE_COUNT 1000
+
+#define WAKEUP_BIN_0_NS 256
+
+#define WAKEUP_BIN_COUNT 12
+
+#define EVENT_WAKEUP RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+typedef struct {
+  rtems_id runner;
+  rtems_id receivers[CPU_COUNT];
+  Atomic_Uint ready[CPU_COUNT];
+  CPU_Counter_ticks send_instant;
+  uint32_t count;
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  uint32_t histogram[WAKEUP_BIN_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static size_t get_bin(uint64_t ns)
+{
+  uint64_t bound;
+  size_t bin;
+
+  bound = WAKEUP_BIN_0_NS;
+  bin = 0;
+
+  while (ns >= bound && bin < WAKEUP_BIN_COUNT - 1) {
+    bound *= 2;
+    ++bin;
+  }
+
+  return bin;
+}
+
+static void add_sample(test_context *ctx, uint64_t ns)
+{
+  ++ctx->count;
+  ctx->sum += ns;
+
+  if (ns < ctx->min) {
+    ctx->min = ns;
+  }
+
+  if (ns > ctx->max) {
+    ctx->max = ns;
+  }
+
+  ++ctx->histogram[get_bin(ns)];
+}
+
+static void receiver_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  uint32_t cpu_index;
+
+  ctx = &test_instance;
+  cpu_index = (uint32_t) arg;
+
+  while (true) {
+    rtems_event_set events;
+    CPU_Counter_ticks now;
+    rtems_status_code sc;
+
+    _Atomic_Store_uint(&ctx->ready[cpu_index], 1, ATOMIC_ORDER_RELEASE);
+    (void) rtems_event_receive(
+      EVENT_WAKEUP,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    now = rtems_counter_read();
+
+    add_sample(
+      ctx,
+      rtems_counter_ticks_to_nanoseconds(
+        rtems_counter_difference(now, ctx->send_instant)
+      )
+    );
+
+    sc = rtems_event_send(ctx->runner, EVENT_DONE);
+    T_quiet_rsc_success(sc);
+  }
+}
+
+static void wait_for_receiver(test_context *ctx, uint32_t target)
+{
+  while (
+    _Atomic_Load_uint(&ctx->ready[target], ATOMIC_ORDER_ACQUIRE) == 0
+  ) {
+    /* Wait for the receiver to prepare for the next wakeup */
+  }
+
+  /* Give the receiver some time to block on its event receive */
+  rtems_counter_delay_nanoseconds(10000);
+  _Atomic_Store_uint(&ctx->ready[target], 0, ATOMIC_ORDER_RELAXED);
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpus;
+
+  CPU_ZERO(&cpus);
+  CPU_SET((int) cpu_index, &cpus);
+  sc = rtems_task_set_affinity(id, sizeof(cpus), &cpus);
+  T_assert_rsc_success(sc);
+}
+
+static void report_pair(
+  const test_context *ctx,
+  uint32_t source,
+  uint32_t target
+)
+{
+  char buf[WAKEUP_BIN_COUNT * 11];
+  size_t n;
+  size_t i;
+
+  T_printf(
+    "W:S:%" PRIu32 ":%" PRIu32 ":N:%" PRIu32 ":MI:%" PRIu64 ":MX:%" PRIu64
+      ":ME:%" PRIu64 "\n",
+    source,
+    target,
+    ctx->count,
+    ctx->min,
+    ctx->max,
+    ctx->sum / ctx->count
+  );
+
+  n = 0;
+
+  for (i = 0; i < WAKEUP_BIN_COUNT; ++i) {
+    n += (size_t) T_snprintf(
+      &buf[n],
+      sizeof(buf) - n,
+      i == 0 ? "%" PRIu32 : ",%" PRIu32,
+      ctx->histogram[i]
+    );
+  }
+
+  T_printf("W:H:%" PRIu32 ":%" PRIu32 ":%s\n", source, target, buf);
+}
+
+static void measure_pair(test_context *ctx, uint32_t source, uint32_t target)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  ctx->count = 0;
+  ctx->min = UINT64_MAX;
+  ctx->max = 0;
+  ctx->sum = 0;
+  memset(ctx->histogram, 0, sizeof(ctx->histogram));
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_event_set events;
+
+    wait_for_receiver(ctx, target);
+    ctx->send_instant = rtems_counter_read();
+    sc = rtems_event_send(ctx->receivers[target], EVENT_WAKEUP);
+    T_quiet_rsc_success(sc);
+
+    sc = rtems_event_receive(
+      EVENT_DONE,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    T_quiet_rsc_success(sc);
+  }
+
+  T_eq_u32(ctx->count, SAMPLE_COUNT);
+  report_pair(ctx, source, target);
+}
+
+static void report_ipi_latency(void *arg, const rtems_profiling_data *data)
+{
+  const rtems_profiling_per_cpu *per_cpu;
+
+  (void) arg;
+
+  if (data->header.type != RTEMS_PROFILING_PER_CPU) {
+    return;
+  }
+
+  per_cpu = &data->per_cpu;
+
+  if (per_cpu->ipi_count == 0) {
+    return;
+  }
+
+  T_printf(
+    "W:I:%" PRIu32 ":N:%" PRIu64 ":MX:%" PRIu32 ":ME:%" PRIu64 "\n",
+    per_cpu->processor_index,
+    per_cpu->ipi_count,
+    per_cpu->max_ipi_latency,
+    per_cpu->total_ipi_latency / per_cpu->ipi_count
+  );
+}
+
+T_TEST_CASE(SMPWakeupLatency)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t cpu_count;
+  uint32_t source;
+  uint32_t target;
+
+  ctx = &test_instance;
+  ctx->runner = rtems_task_self();
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if (cpu_count > CPU_COUNT) {
+    cpu_count = CPU_COUNT;
+  }
+
+  for (target = 0; target < cpu_count; ++target) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'A', 'K', 'E'),
+      1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->receivers[target]
+    );
+    T_assert_rsc_success(sc);
+    set_affinity(ctx->receivers[target], target);
+
+    sc = rtems_task_start(ctx->receivers[target], receiver_task, target);
+    T_assert_rsc_success(sc);
+  }
+
+  for (source = 0; source < cpu_count; ++source) {
+    set_affinity(RTEMS_SELF, source);
+
+    for (target = 0; target < cpu_count; ++target) {
+      if (source == target) {
+        continue;
+      }
+
+      measure_pair(ctx, source, target);
+    }
+  }
+
+  rtems_profiling_iterate(report_ipi_latency, NULL);
+
+  for (target = 0; target < cpu_count; ++target) {
+    sc = rtems_task_delete(ctx->receivers[target]);
+    T_rsc_success(sc);
+  }
+
+  set_affinity(RTEMS_SELF, 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_test_run(arg, TEST_STATE);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + CPU_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
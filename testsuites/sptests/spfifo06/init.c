@@ -0,0 +1,389 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <sys/param.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/pipe.h>
+
+const char rtems_test_name[] = "SPFIFO 6";
+
+#define TRANSFER_SIZE (256 * 1024)
+
+#define SOURCE_FILE "/source"
+
+#define SINK_FILE "/sink"
+
+#define FIFO_FILE "/fifo"
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+typedef struct {
+  rtems_id master;
+  int fd;
+  size_t chunk;
+  uint32_t checksum;
+} consumer_context;
+
+static unsigned char buf[2 * PIPE_BUF];
+
+static unsigned char file_data[3 * PIPE_BUF + 17];
+
+static uint32_t checksum(uint32_t sum, const unsigned char *data, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    sum = (sum << 1 | sum >> 31) ^ data[i];
+  }
+
+  return sum;
+}
+
+static void fill(unsigned char *data, size_t n, size_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    data[i] = (unsigned char) ((offset + i) * 7);
+  }
+}
+
+static void consumer_task(rtems_task_argument arg)
+{
+  consumer_context *ctx;
+  unsigned char data[PIPE_BUF];
+  rtems_status_code sc;
+
+  ctx = (consumer_context *) arg;
+
+  while (true) {
+    ssize_t n;
+
+    n = read(ctx->fd, data, MIN(ctx->chunk, sizeof(data)));
+    rtems_test_assert(n >= 0);
+
+    if (n == 0) {
+      break;
+    }
+
+    ctx->checksum = checksum(ctx->checksum, data, (size_t) n);
+  }
+
+  sc = rtems_event_send(ctx->master, EVENT_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_exit();
+}
+
+static void start_consumer(consumer_context *ctx, int fd, size_t chunk)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  ctx->master = rtems_task_self();
+  ctx->fd = fd;
+  ctx->chunk = chunk;
+  ctx->checksum = 0;
+
+  sc = rtems_task_create(
+    rtems_build_name('C', 'O', 'N', 'S'),
+    RTEMS_MAXIMUM_PRIORITY - 2,
+    RTEMS_MINIMUM_STACK_SIZE + PIPE_BUF,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, consumer_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_consumer(void)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_throughput(size_t chunk)
+{
+  consumer_context ctx;
+  rtems_counter_ticks t;
+  uint32_t sum;
+  uint64_t ns;
+  size_t offset;
+  int fds[2];
+  int rv;
+
+  rv = pipe(fds);
+  rtems_test_assert(rv == 0);
+
+  start_consumer(&ctx, fds[0], chunk);
+
+  sum = 0;
+  offset = 0;
+  t = rtems_counter_read();
+
+  while (offset < TRANSFER_SIZE) {
+    ssize_t n;
+
+    fill(buf, chunk, offset);
+    sum = checksum(sum, buf, chunk);
+    n = write(fds[1], buf, chunk);
+    rtems_test_assert(n == (ssize_t) chunk);
+    offset += chunk;
+  }
+
+  rv = close(fds[1]);
+  rtems_test_assert(rv == 0);
+
+  wait_for_consumer();
+  t = rtems_counter_difference(rtems_counter_read(), t);
+  ns = rtems_counter_ticks_to_nanoseconds(t);
+  rtems_test_assert(ctx.checksum == sum);
+
+  rv = close(fds[0]);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "pipe transfer of %i bytes in chunks of %zu bytes: %" PRIu64 "ns\n",
+    TRANSFER_SIZE,
+    chunk,
+    ns
+  );
+}
+
+static void test_splice(void)
+{
+  unsigned char data[sizeof(file_data)];
+  int source;
+  int sink;
+  int fds[2];
+  ssize_t n;
+  size_t moved;
+  int rv;
+
+  fill(file_data, sizeof(file_data), 0);
+
+  source = open(SOURCE_FILE, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(source >= 0);
+
+  n = write(source, file_data, sizeof(file_data));
+  rtems_test_assert(n == (ssize_t) sizeof(file_data));
+
+  rv = lseek(source, 0, SEEK_SET);
+  rtems_test_assert(rv == 0);
+
+  sink = open(SINK_FILE, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(sink >= 0);
+
+  rv = pipe(fds);
+  rtems_test_assert(rv == 0);
+
+  /* Neither file descriptor refers to a pipe */
+  errno = 0;
+  n = rtems_pipe_splice(source, sink, sizeof(file_data));
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* Same pipe */
+  errno = 0;
+  n = rtems_pipe_splice(fds[0], fds[1], sizeof(file_data));
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* Invalid file descriptor */
+  errno = 0;
+  n = rtems_pipe_splice(-1, fds[1], sizeof(file_data));
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  /* Move the file through the pipe, the pipe buffer wraps around */
+  moved = 0;
+  while (moved < sizeof(file_data)) {
+    ssize_t m;
+    ssize_t k;
+
+    m = rtems_pipe_splice(source, fds[1], PIPE_BUF - 3);
+    rtems_test_assert(m > 0);
+    rtems_test_assert(m <= PIPE_BUF - 3);
+
+    k = 0;
+    while (k < m) {
+      n = rtems_pipe_splice(fds[0], sink, (size_t) (m - k));
+      rtems_test_assert(n > 0);
+      k += n;
+    }
+
+    moved += (size_t) m;
+  }
+
+  rtems_test_assert(moved == sizeof(file_data));
+
+  /* End of file of the source */
+  n = rtems_pipe_splice(source, fds[1], sizeof(file_data));
+  rtems_test_assert(n == 0);
+
+  rv = lseek(sink, 0, SEEK_SET);
+  rtems_test_assert(rv == 0);
+
+  n = read(sink, data, sizeof(data));
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+  rtems_test_assert(memcmp(data, file_data, sizeof(data)) == 0);
+
+  /* End of file of the pipe */
+  rv = close(fds[1]);
+  rtems_test_assert(rv == 0);
+
+  n = rtems_pipe_splice(fds[0], sink, sizeof(file_data));
+  rtems_test_assert(n == 0);
+
+  rv = close(fds[0]);
+  rtems_test_assert(rv == 0);
+
+  rv = close(sink);
+  rtems_test_assert(rv == 0);
+
+  rv = close(source);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(SINK_FILE);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(SOURCE_FILE);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_nonblocking_with_waiting_reader(void)
+{
+  consumer_context ctx;
+  unsigned char c;
+  int nonblocking;
+  int writer;
+  int reader;
+  ssize_t n;
+  int rv;
+  rtems_status_code sc;
+
+  rv = mkfifo(FIFO_FILE, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  nonblocking = open(FIFO_FILE, O_RDONLY | O_NONBLOCK);
+  rtems_test_assert(nonblocking >= 0);
+
+  writer = open(FIFO_FILE, O_WRONLY);
+  rtems_test_assert(writer >= 0);
+
+  reader = open(FIFO_FILE, O_RDONLY);
+  rtems_test_assert(reader >= 0);
+
+  /* Let the consumer wait for data on the empty pipe */
+  start_consumer(&ctx, reader, 1);
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The waiting reader does not own the read mutex */
+  errno = 0;
+  n = read(nonblocking, &c, sizeof(c));
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  c = 0x5a;
+  n = write(writer, &c, sizeof(c));
+  rtems_test_assert(n == (ssize_t) sizeof(c));
+
+  rv = close(writer);
+  rtems_test_assert(rv == 0);
+
+  wait_for_consumer();
+  rtems_test_assert(ctx.checksum == checksum(0, &c, sizeof(c)));
+
+  rv = close(reader);
+  rtems_test_assert(rv == 0);
+
+  rv = close(nonblocking);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(FIFO_FILE);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_splice();
+  test_nonblocking_with_waiting_reader();
+  test_throughput(1);
+  test_throughput(64);
+  test_throughput(PIPE_BUF);
+  test_throughput(2 * PIPE_BUF);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_IMFS_ENABLE_MKFIFO
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
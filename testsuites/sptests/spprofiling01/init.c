@@ -18,6 +18,8 @@
 
 #include <rtems/profiling.h>
 #include <rtems/bspIo.h>
+#include <rtems/counter.h>
+#include <rtems/score/threaddispatch.h>
 #include <rtems.h>
 
 #include <stdio.h>
@@ -113,6 +115,228 @@ static void test_iterate(void)
   rtems_interrupt_lock_destroy(&ctx->d);
 }
 
+typedef struct {
+  rtems_id mutex;
+  rtems_id owner;
+  bool deleted;
+  bool found;
+} thread_queue_context;
+
+static void thread_queue_visitor(void *arg, const rtems_profiling_data *data)
+{
+  thread_queue_context *ctx = arg;
+
+  if (data->header.type == RTEMS_PROFILING_THREAD_QUEUE) {
+    const rtems_profiling_thread_queue *ptq = &data->thread_queue;
+    uint64_t histogram_count = 0;
+    size_t i;
+
+    rtems_test_assert(ptq->id != ctx->mutex || !ctx->found);
+    rtems_test_assert(ptq->wait_count > 0);
+
+    if (ptq->id != ctx->mutex) {
+      return;
+    }
+
+    ctx->found = true;
+    rtems_test_assert(strcmp(ptq->name, "MTX0") == 0);
+    rtems_test_assert(ptq->deleted == ctx->deleted);
+    rtems_test_assert(ptq->wait_count == 1);
+    rtems_test_assert(ptq->total_wait_time == ptq->max_wait_time);
+
+    for (i = 0; i < RTEMS_PROFILING_THREAD_QUEUE_HISTOGRAM_COUNTS; ++i) {
+      histogram_count += ptq->histogram[i];
+    }
+
+    rtems_test_assert(histogram_count == 1);
+    rtems_test_assert(ptq->owners[0].id == ctx->owner);
+    rtems_test_assert(ptq->owners[0].wait_count == 1);
+    rtems_test_assert(ptq->owners[0].total_wait_time == ptq->total_wait_time);
+
+    for (i = 1; i < RTEMS_PROFILING_THREAD_QUEUE_OWNER_COUNT; ++i) {
+      rtems_test_assert(ptq->owners[i].wait_count == 0);
+    }
+  }
+}
+
+static void thread_queue_worker(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(arg, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_release(arg);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test_thread_queue(void)
+{
+  thread_queue_context ctx_instance;
+  thread_queue_context *ctx = &ctx_instance;
+  rtems_status_code sc;
+  rtems_id worker;
+
+  ctx->owner = rtems_task_self();
+  ctx->deleted = false;
+  ctx->found = false;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'T', 'X', '0'),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->mutex
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_profiling_reset_thread_queues();
+
+  sc = rtems_task_start(worker, thread_queue_worker, ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Let the worker block on the mutex */
+  sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_release(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Let the worker obtain and release the mutex */
+  sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_profiling_iterate(thread_queue_visitor, ctx);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(ctx->found);
+#else
+  rtems_test_assert(!ctx->found);
+#endif
+
+  sc = rtems_task_delete(worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_delete(ctx->mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The profiling data of the deleted semaphore remains until it is reused */
+  ctx->deleted = true;
+  ctx->found = false;
+  rtems_profiling_iterate(thread_queue_visitor, ctx);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(ctx->found);
+#else
+  rtems_test_assert(!ctx->found);
+#endif
+
+  rtems_test_assert(rtems_profiling_get_thread_queue_dropped_wait_count() == 0);
+  rtems_profiling_reset_thread_queues();
+}
+
+#define LATENCY_SECTION_NS 100000
+
+typedef struct {
+  uint32_t cpu_index;
+  uint32_t next_rank[3];
+  uint32_t last_duration[3];
+  bool found[3];
+} latency_context;
+
+static void latency_visitor(void *arg, const rtems_profiling_data *data)
+{
+  latency_context *ctx = arg;
+  const rtems_profiling_latency *pl;
+  int kind;
+
+  if (data->header.type != RTEMS_PROFILING_LATENCY) {
+    return;
+  }
+
+  pl = &data->latency;
+
+  if (pl->processor_index != ctx->cpu_index) {
+    return;
+  }
+
+  kind = pl->kind;
+  rtems_test_assert(kind >= 0 && kind < 3);
+  rtems_test_assert(pl->rank == ctx->next_rank[kind]);
+  rtems_test_assert(pl->rank < RTEMS_PROFILING_LATENCY_COUNT);
+  rtems_test_assert(pl->duration > 0);
+
+  if (pl->rank > 0) {
+    rtems_test_assert(pl->duration <= ctx->last_duration[kind]);
+  }
+
+  ++ctx->next_rank[kind];
+  ctx->last_duration[kind] = pl->duration;
+
+  if (pl->rank == 0 && pl->duration >= LATENCY_SECTION_NS / 2) {
+    rtems_test_assert(pl->end != NULL);
+    rtems_test_assert(pl->executing == rtems_task_self());
+    ctx->found[kind] = true;
+  }
+}
+
+static void test_latency(void)
+{
+  latency_context ctx_instance;
+  latency_context *ctx = &ctx_instance;
+  rtems_interrupt_level level;
+  Per_CPU_Control *cpu_self;
+
+  memset(ctx, 0, sizeof(*ctx));
+  rtems_profiling_reset_latencies();
+
+  rtems_interrupt_local_disable(level);
+  ctx->cpu_index = rtems_scheduler_get_processor();
+  rtems_counter_delay_nanoseconds(LATENCY_SECTION_NS);
+  rtems_interrupt_local_enable(level);
+
+  cpu_self = _Thread_Dispatch_disable();
+  rtems_counter_delay_nanoseconds(LATENCY_SECTION_NS);
+  _Thread_Dispatch_enable(cpu_self);
+
+  rtems_profiling_iterate(latency_visitor, ctx);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(ctx->found[RTEMS_PROFILING_LATENCY_INTERRUPTS_DISABLED]);
+  rtems_test_assert(
+    ctx->found[RTEMS_PROFILING_LATENCY_THREAD_DISPATCH_DISABLED]
+  );
+#else
+  rtems_test_assert(ctx->next_rank[0] == 0);
+  rtems_test_assert(ctx->next_rank[1] == 0);
+  rtems_test_assert(ctx->next_rank[2] == 0);
+#endif
+
+  rtems_profiling_reset_latencies();
+  memset(ctx, 0, sizeof(*ctx));
+  rtems_profiling_iterate(latency_visitor, ctx);
+  rtems_test_assert(!ctx->found[RTEMS_PROFILING_LATENCY_INTERRUPTS_DISABLED]);
+  rtems_test_assert(
+    !ctx->found[RTEMS_PROFILING_LATENCY_THREAD_DISPATCH_DISABLED]
+  );
+}
+
 static void test_report_xml(void)
 {
   rtems_status_code sc;
@@ -130,6 +354,8 @@ static void Init(rtems_task_argument arg)
   TEST_BEGIN();
 
   test_iterate();
+  test_thread_queue();
+  test_latency();
   test_report_xml();
 
   TEST_END();
@@ -140,7 +366,9 @@ static void Init(rtems_task_argument arg)
 #define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
 
-#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
 
 #define CONFIGURE_RTEMS_INIT_TASKS_TABLE
 
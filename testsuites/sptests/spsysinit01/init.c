@@ -549,13 +549,15 @@ LAST(RTEMS_SYSINIT_IDLE_THREADS)
 
 FIRST(RTEMS_SYSINIT_LIBIO)
 {
-  assert(rtems_libio_iop_free_head == NULL);
+  assert(
+    _Atomic_Load_ulong(&rtems_libio_iop_free_map[0], ATOMIC_ORDER_RELAXED) == 0
+  );
   next_step(LIBIO_PRE);
 }
 
 LAST(RTEMS_SYSINIT_LIBIO)
 {
-  assert(rtems_libio_iop_free_head == &rtems_libio_iops[0]);
+  assert(rtems_libio_count_free() == rtems_libio_number_iops);
   next_step(LIBIO_POST);
 }
 
@@ -0,0 +1,241 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/termiostypes.h>
+
+const char rtems_test_name[] = "TMTERMIOS 1";
+
+#define CHUNK_SIZE 1024
+
+#define BUFFER_SIZE (2 * CHUNK_SIZE)
+
+#define TOTAL_SIZE (1024 * 1024)
+
+/*
+ * The simulated device receives the data by DMA and hands each chunk to
+ * Termios at once, like a receive interrupt handler would do.
+ */
+typedef struct {
+  rtems_termios_device_context base;
+  rtems_termios_tty *tty;
+  size_t output_count;
+} device_context;
+
+typedef struct {
+  device_context dev;
+  int fd;
+  char rx[CHUNK_SIZE];
+  char data[CHUNK_SIZE];
+} test_context;
+
+static test_context test_instance = {
+  .dev = {
+    .base = RTEMS_TERMIOS_DEVICE_CONTEXT_INITIALIZER("Loopback")
+  }
+};
+
+static bool first_open(
+  rtems_termios_tty *tty,
+  rtems_termios_device_context *base,
+  struct termios *term,
+  rtems_libio_open_close_args_t *args
+)
+{
+  device_context *dev = (device_context *) base;
+
+  dev->tty = tty;
+
+  return true;
+}
+
+static void device_write(
+  rtems_termios_device_context *base,
+  const char *buf,
+  size_t len
+)
+{
+  device_context *dev = (device_context *) base;
+
+  /* The benchmark does not transmit */
+  dev->output_count += len;
+}
+
+static const rtems_termios_device_handler handler = {
+  .first_open = first_open,
+  .write = device_write,
+  .mode = TERMIOS_IRQ_DRIVEN
+};
+
+static void set_raw_mode(test_context *ctx, tcflag_t iflag, tcflag_t lflag)
+{
+  struct termios term;
+  int rv;
+
+  rv = tcgetattr(ctx->fd, &term);
+  rtems_test_assert(rv == 0);
+
+  term.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP
+    | INLCR | IGNCR | ICRNL | IXON | IXOFF);
+  term.c_lflag &= ~(ECHO | ECHOE | ECHOK | ECHONL | ECHOPRT
+    | ECHOCTL | ECHOKE | ICANON | ISIG | IEXTEN);
+  term.c_cflag &= ~(CSIZE | PARENB | CRTSCTS);
+  term.c_cflag |= CS8;
+  term.c_oflag &= ~OPOST;
+  term.c_iflag |= iflag;
+  term.c_lflag |= lflag;
+
+  term.c_cc[VMIN] = 0;
+  term.c_cc[VTIME] = 0;
+
+  rv = tcsetattr(ctx->fd, TCSANOW, &term);
+  rtems_test_assert(rv == 0);
+}
+
+static void run(
+  test_context *ctx,
+  const char *name,
+  tcflag_t iflag,
+  tcflag_t lflag
+)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  uint64_t ns;
+  size_t total;
+
+  set_raw_mode(ctx, iflag, lflag);
+  t0 = rtems_counter_read();
+
+  for (total = 0; total < TOTAL_SIZE; total += CHUNK_SIZE) {
+    int dropped;
+    ssize_t n;
+
+    dropped = rtems_termios_enqueue_raw_characters(
+      ctx->dev.tty,
+      ctx->data,
+      CHUNK_SIZE
+    );
+    rtems_test_assert(dropped == 0);
+
+    n = read(ctx->fd, ctx->rx, sizeof(ctx->rx));
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  t1 = rtems_counter_read();
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0));
+  rtems_test_assert(memcmp(ctx->rx, ctx->data, CHUNK_SIZE) == 0);
+
+  printf(
+    "  <%s bytes=\"%zu\" chunk=\"%i\" ns=\"%" PRIu64 "\" "
+      "bytesPerSecond=\"%" PRIu64 "\"/>\n",
+    name,
+    total,
+    CHUNK_SIZE,
+    ns,
+    ns > 0 ? (UINT64_C(1000000000) * total) / ns : 0
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t i;
+  int rv;
+
+  TEST_BEGIN();
+
+  /* Avoid characters with a special meaning in the processed modes */
+  for (i = 0; i < CHUNK_SIZE; ++i) {
+    ctx->data[i] = (char) ('A' + (i % 26));
+  }
+
+  sc = rtems_termios_bufsize(BUFFER_SIZE, BUFFER_SIZE, 64);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_termios_device_install(
+    "/loopback",
+    &handler,
+    NULL,
+    &ctx->dev.base
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->fd = open("/loopback", O_RDWR);
+  rtems_test_assert(ctx->fd >= 0);
+
+  printf("<TestTimeTermios01>\n");
+
+  /* Bulk receive and read */
+  run(ctx, "Raw", 0, 0);
+
+  /* Input processing enabled, each character is processed */
+  run(ctx, "ProcessedInput", ICRNL, 0);
+
+  /* Signal characters enabled, each character is read separately */
+  run(ctx, "ProcessedRead", 0, ISIG);
+
+  /* Both */
+  run(ctx, "Processed", ICRNL, ISIG);
+
+  printf("</TestTimeTermios01>\n");
+
+  rv = close(ctx->fd);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>